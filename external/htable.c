@@ -9,6 +9,9 @@
 /* We use 0x1 as deleted marker. */
 #define HTABLE_DELETED (0x1)
 
+/* Old-table buckets migrated per add/del during an incremental rehash. */
+#define HTABLE_MIGRATE_BATCH 8
+
 /* We clear out the bits which are always the same, and put metadata there. */
 static inline uintptr_t get_extra_ptr_bits(const struct htable *ht,
 					   uintptr_t e)
@@ -54,6 +57,7 @@ void htable_init(struct htable *ht,
 
 void htable_clear(struct htable *ht)
 {
+	free(ht->old_table);
 	if (ht->table != &ht->perfect_bit)
 		free((void *)ht->table);
 	htable_init(ht, ht->rehash, ht->priv);
@@ -80,35 +84,96 @@ static void *htable_val(const struct htable *ht,
 	return NULL;
 }
 
+/* Entries in the old table carry extra bits folded for the old table
+ * size, so we cannot filter on them; return every valid entry of the
+ * probe chain as a candidate and let the caller compare. */
+static void *htable_oldval(const struct htable *ht,
+			   struct htable_iter *i, size_t hash, bool first)
+{
+	size_t mask = ((size_t)1 << ht->old_bits)-1;
+
+	if (first) {
+		i->old = true;
+		i->off = hash & mask;
+	} else {
+		i->off = (i->off + 1) & mask;
+	}
+
+	while (ht->old_table[i->off]) {
+		if (entry_is_valid(ht->old_table[i->off]))
+			return get_raw_ptr(ht, ht->old_table[i->off]);
+		i->off = (i->off + 1) & mask;
+	}
+	return NULL;
+}
+
 void *htable_firstval(const struct htable *ht,
 		      struct htable_iter *i, size_t hash)
 {
+	void *p;
+
+	i->old = false;
 	i->off = hash_bucket(ht, hash);
-	return htable_val(ht, i, hash, ht->perfect_bit);
+	p = htable_val(ht, i, hash, ht->perfect_bit);
+	if (p || !ht->old_table)
+		return p;
+	return htable_oldval(ht, i, hash, true);
 }
 
 void *htable_nextval(const struct htable *ht,
 		     struct htable_iter *i, size_t hash)
 {
+	void *p;
+
+	if (i->old)
+		return htable_oldval(ht, i, hash, false);
+
 	i->off = (i->off + 1) & ((1 << ht->bits)-1);
-	return htable_val(ht, i, hash, 0);
+	p = htable_val(ht, i, hash, 0);
+	if (p || !ht->old_table)
+		return p;
+	return htable_oldval(ht, i, hash, true);
+}
+
+static void *htable_scan_old(const struct htable *ht, struct htable_iter *i)
+{
+	for (; i->off < (size_t)1 << ht->old_bits; i->off++) {
+		if (entry_is_valid(ht->old_table[i->off]))
+			return get_raw_ptr(ht, ht->old_table[i->off]);
+	}
+	return NULL;
 }
 
 void *htable_first(const struct htable *ht, struct htable_iter *i)
 {
+	i->old = false;
 	for (i->off = 0; i->off < (size_t)1 << ht->bits; i->off++) {
 		if (entry_is_valid(ht->table[i->off]))
 			return get_raw_ptr(ht, ht->table[i->off]);
 	}
+	if (ht->old_table) {
+		i->old = true;
+		i->off = 0;
+		return htable_scan_old(ht, i);
+	}
 	return NULL;
 }
 
 void *htable_next(const struct htable *ht, struct htable_iter *i)
 {
+	if (i->old) {
+		i->off++;
+		return htable_scan_old(ht, i);
+	}
 	for (i->off++; i->off < (size_t)1 << ht->bits; i->off++) {
 		if (entry_is_valid(ht->table[i->off]))
 			return get_raw_ptr(ht, ht->table[i->off]);
 	}
+	if (ht->old_table) {
+		i->old = true;
+		i->off = 0;
+		return htable_scan_old(ht, i);
+	}
 	return NULL;
 }
 
@@ -127,11 +192,47 @@ static void ht_add(struct htable *ht, const void *new, size_t h)
 	ht->table[i] = make_hval(ht, new, get_hash_ptr_bits(ht, h)|perfect);
 }
 
+/* Move up to @num not-yet-migrated buckets from the old table into the
+ * current one.  Migrated slots become HTABLE_DELETED, not 0, so probe
+ * chains of entries behind them stay intact for lookups. */
+static void migrate_buckets(struct htable *ht, size_t num)
+{
+	size_t oldnum;
+	uintptr_t e;
+	void *p;
+
+	if (!ht->old_table)
+		return;
+
+	oldnum = (size_t)1 << ht->old_bits;
+	while (num-- && ht->old_off < oldnum) {
+		if (entry_is_valid(e = ht->old_table[ht->old_off])) {
+			p = get_raw_ptr(ht, e);
+			ht_add(ht, p, ht->rehash(p, ht->priv));
+			ht->old_table[ht->old_off] = HTABLE_DELETED;
+		}
+		ht->old_off++;
+	}
+
+	if (ht->old_off == oldnum) {
+		free(ht->old_table);
+		ht->old_table = NULL;
+	}
+}
+
+static COLD void finish_migration(struct htable *ht)
+{
+	while (ht->old_table)
+		migrate_buckets(ht, (size_t)1 << ht->old_bits);
+}
+
 static COLD bool double_table(struct htable *ht)
 {
 	unsigned int i;
-	size_t oldnum = (size_t)1 << ht->bits;
-	uintptr_t *oldtable, e;
+	uintptr_t *oldtable;
+
+	/* Only ever one pending old table: drain it first. */
+	finish_migration(ht);
 
 	oldtable = ht->table;
 	ht->table = calloc(1 << (ht->bits+1), sizeof(size_t));
@@ -139,6 +240,7 @@ static COLD bool double_table(struct htable *ht)
 		ht->table = oldtable;
 		return false;
 	}
+	ht->old_bits = ht->bits;
 	ht->bits++;
 	ht->max = ((size_t)3 << ht->bits) / 4;
 	ht->max_with_deleted = ((size_t)9 << ht->bits) / 10;
@@ -153,14 +255,11 @@ static COLD bool double_table(struct htable *ht)
 		}
 	}
 
+	/* Don't rehash everything now; keep the old table around and let
+	 * subsequent adds/dels migrate it in small batches. */
 	if (oldtable != &ht->perfect_bit) {
-		for (i = 0; i < oldnum; i++) {
-			if (entry_is_valid(e = oldtable[i])) {
-				void *p = get_raw_ptr(ht, e);
-				ht_add(ht, p, ht->rehash(p, ht->priv));
-			}
-		}
-		free(oldtable);
+		ht->old_table = oldtable;
+		ht->old_off = 0;
 	}
 	ht->deleted = 0;
 	return true;
@@ -227,6 +326,15 @@ static COLD void update_common(struct htable *ht, const void *p)
 		ht->table[i] |= bitsdiff;
 	}
 
+	if (ht->old_table) {
+		for (i = 0; i < (size_t)1 << ht->old_bits; i++) {
+			if (!entry_is_valid(ht->old_table[i]))
+				continue;
+			ht->old_table[i] &= ~maskdiff;
+			ht->old_table[i] |= bitsdiff;
+		}
+	}
+
 	/* Take away those bits from our mask, bits and perfect bit. */
 	ht->common_mask &= ~maskdiff;
 	ht->common_bits &= ~maskdiff;
@@ -245,6 +353,17 @@ bool htable_add(struct htable *ht, size_t hash, const void *p)
 
 	ht_add(ht, p, hash);
 	ht->elems++;
+	migrate_buckets(ht, HTABLE_MIGRATE_BATCH);
+	return true;
+}
+
+bool htable_reserve(struct htable *ht, size_t entries)
+{
+	while (ht->max < entries) {
+		if (!double_table(ht))
+			return false;
+		finish_migration(ht);
+	}
 	return true;
 }
 
@@ -256,6 +375,7 @@ bool htable_del(struct htable *ht, size_t h, const void *p)
 	for (c = htable_firstval(ht,&i,h); c; c = htable_nextval(ht,&i,h)) {
 		if (c == p) {
 			htable_delval(ht, &i);
+			migrate_buckets(ht, HTABLE_MIGRATE_BATCH);
 			return true;
 		}
 	}
@@ -264,6 +384,17 @@ bool htable_del(struct htable *ht, size_t h, const void *p)
 
 void htable_delval(struct htable *ht, struct htable_iter *i)
 {
+	/* No migration here: it would move entries under a live iterator. */
+	if (i->old) {
+		assert(ht->old_table);
+		assert(i->off < (size_t)1 << ht->old_bits);
+		assert(entry_is_valid(ht->old_table[i->off]));
+
+		ht->elems--;
+		ht->old_table[i->off] = HTABLE_DELETED;
+		return;
+	}
+
 	assert(i->off < (size_t)1 << ht->bits);
 	assert(entry_is_valid(ht->table[i->off]));
 
@@ -20,6 +20,13 @@ struct htable {
 	uintptr_t common_mask, common_bits;
 	uintptr_t perfect_bit;
 	uintptr_t *table;
+	/* Incremental rehash: while old_table is non-NULL, entries still
+	 * living in the previous (half-sized) table are migrated a few
+	 * buckets at a time by each add/del instead of in one
+	 * stop-the-world pass. */
+	uintptr_t *old_table;
+	unsigned int old_bits;
+	size_t old_off;
 };
 
 /**
@@ -39,7 +46,8 @@ struct htable {
  *	static struct htable ht = HTABLE_INITIALIZER(ht, rehash, NULL);
  */
 #define HTABLE_INITIALIZER(name, rehash, priv)				\
-	{ rehash, priv, 0, 0, 0, 0, 0, -1, 0, 0, &name.perfect_bit }
+	{ rehash, priv, 0, 0, 0, 0, 0, -1, 0, 0, &name.perfect_bit,	\
+	  NULL, 0, 0 }
 
 /**
  * htable_init - initialize an empty hash table.
@@ -76,6 +84,18 @@ size_t htable_rehash(const void *elem);
  */
 bool htable_add(struct htable *ht, size_t hash, const void *p);
 
+/**
+ * htable_reserve - pre-allocate space for a number of entries.
+ * @ht: the htable
+ * @entries: the number of entries the table should hold without growing
+ *
+ * Grows the table (including any pending incremental migration) in one
+ * go so that @entries fit without further reallocation. Useful when the
+ * working-set size is known up-front and growth pauses on the hot path
+ * are unwanted. Returns false on allocation failure.
+ */
+bool htable_reserve(struct htable *ht, size_t entries);
+
 /**
  * htable_del - remove a pointer from a hash table
  * @ht: the htable
@@ -93,6 +113,8 @@ bool htable_del(struct htable *ht, size_t hash, const void *p);
  */
 struct htable_iter {
 	size_t off;
+	/* true while iterating the not-yet-migrated old table */
+	bool old;
 };
 
 /**
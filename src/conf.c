@@ -36,9 +36,11 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #include <xkbcommon/xkbcommon.h>
 #include "conf.h"
+#include "shl_dlist.h"
 #include "shl_log.h"
 #include "shl_misc.h"
 
@@ -48,17 +50,68 @@
  * Config Contexts
  */
 
+/* Sorted long-name index over the options of a context. Every option is
+ * indexed under both spellings ("foo" and "no-foo") so key lookups are a
+ * single bsearch instead of a linear scan with two strcmps per option. */
+struct conf_index {
+	const char *name;
+	struct conf_option *opt;
+	bool set;
+};
+
 struct conf_ctx {
 	struct conf_option *opts;
 	size_t onum;
 	void *mem;
+	struct conf_index *index;
+	size_t inum;
 };
 
+static int conf_index_cmp(const void *a, const void *b)
+{
+	const struct conf_index *x = a, *y = b;
+
+	return strcmp(x->name, y->name);
+}
+
+static int conf_build_index(struct conf_ctx *ctx)
+{
+	size_t i, pos;
+
+	ctx->index = malloc(sizeof(*ctx->index) * ctx->onum * 2);
+	if (!ctx->index) {
+		log_error("cannot allocate memory for config index");
+		return -ENOMEM;
+	}
+
+	pos = 0;
+	for (i = 0; i < ctx->onum; ++i) {
+		if (!ctx->opts[i].long_name)
+			continue;
+
+		ctx->index[pos].name = ctx->opts[i].long_name;
+		ctx->index[pos].opt = &ctx->opts[i];
+		ctx->index[pos].set = false;
+		++pos;
+
+		/* skip the "no-" prefix */
+		ctx->index[pos].name = &ctx->opts[i].long_name[3];
+		ctx->index[pos].opt = &ctx->opts[i];
+		ctx->index[pos].set = true;
+		++pos;
+	}
+
+	ctx->inum = pos;
+	qsort(ctx->index, ctx->inum, sizeof(*ctx->index), conf_index_cmp);
+	return 0;
+}
+
 int conf_ctx_new(struct conf_ctx **out, const struct conf_option *opts,
 		  size_t onum, void *mem)
 {
 	struct conf_ctx *ctx;
 	size_t size;
+	int ret;
 
 	if (!out || !opts || !onum)
 		return -EINVAL;
@@ -75,6 +128,12 @@ int conf_ctx_new(struct conf_ctx **out, const struct conf_option *opts,
 	ctx->mem = mem;
 	memcpy(ctx->opts, opts, onum * sizeof(*opts));
 
+	ret = conf_build_index(ctx);
+	if (ret) {
+		free(ctx);
+		return ret;
+	}
+
 	conf_ctx_reset(ctx);
 
 	*out = ctx;
@@ -87,6 +146,7 @@ void conf_ctx_free(struct conf_ctx *ctx)
 		return;
 
 	conf_ctx_reset(ctx);
+	free(ctx->index);
 	free(ctx);
 }
 
@@ -119,6 +179,9 @@ void *conf_ctx_get_mem(struct conf_ctx *ctx)
  * This calls the "copy" callback for each option inside of \ctx with the
  * corresponding option inside of \src if both have the same type. If the types
  * do not match, nothing is done.
+ * Types that provide a "share" callback alias the source value instead of
+ * duplicating it; the value is copied lazily only if \ctx re-parses the
+ * option later. Hence, \src must outlive \ctx.
  */
 int conf_ctx_parse_ctx(struct conf_ctx *ctx, const struct conf_ctx *src)
 {
@@ -141,7 +204,11 @@ int conf_ctx_parse_ctx(struct conf_ctx *ctx, const struct conf_ctx *src)
 		if (s->flags & CONF_LOCKED)
 			d->flags |= CONF_LOCKED;
 
-		if (d->type->copy) {
+		if (d->type->share) {
+			ret = d->type->share(d, s);
+			if (ret)
+				return ret;
+		} else if (d->type->copy) {
 			ret = d->type->copy(d, s);
 			if (ret)
 				return ret;
@@ -324,58 +391,46 @@ int conf_ctx_parse_argv(struct conf_ctx *ctx, int argc, char **argv)
 	return 0;
 }
 
-static int parse_kv_pair(struct conf_option *opts, size_t len,
-			 const char *key, const char *value)
+static int parse_kv_pair(struct conf_ctx *ctx, const char *key,
+			 const char *value)
 {
-	unsigned int i;
+	struct conf_index k, *e;
+	struct conf_option *opt;
 	int ret;
 	bool set;
-	struct conf_option *opt;
-
-	for (i = 0; i < len; ++i) {
-		opt = &opts[i];
-		if (!opt->long_name)
-			continue;
 
-		if (!strcmp(key, opt->long_name))
-			set = false;
-		else if (!strcmp(key, &opt->long_name[3]))
-			set = true;
-		else
-			continue;
+	k.name = key;
+	e = bsearch(&k, ctx->index, ctx->inum, sizeof(*e), conf_index_cmp);
+	if (!e) {
+		log_error("unknown config option '%s'", key);
+		return -EFAULT;
+	}
 
-		/* ignore if already set by command-line arguments */
-		if (opt->flags & CONF_LOCKED)
-			return 0;
+	opt = e->opt;
+	set = e->set;
 
-		if (opt->file) {
-			ret = opt->file(opt, set, value);
-			if (ret)
-				return ret;
-			return 0;
-		}
+	/* ignore if already set by command-line arguments */
+	if (opt->flags & CONF_LOCKED)
+		return 0;
 
-		if (opt->type->flags & CONF_HAS_ARG && !value) {
-			log_error("config option '%s' requires an argument",
-				  key);
-			return -EFAULT;
-		} else if (!(opt->type->flags & CONF_HAS_ARG) && value) {
-			log_error("config option '%s' does not take arguments",
-				  key);
-			return -EFAULT;
-		}
+	if (opt->file)
+		return opt->file(opt, set, value);
 
-		if (opt->type->parse) {
-			ret = opt->type->parse(opt, set, value);
-			if (ret)
-				return ret;
-		}
+	if (opt->type->flags & CONF_HAS_ARG && !value) {
+		log_error("config option '%s' requires an argument", key);
+		return -EFAULT;
+	} else if (!(opt->type->flags & CONF_HAS_ARG) && value) {
+		log_error("config option '%s' does not take arguments", key);
+		return -EFAULT;
+	}
 
-		return 0;
+	if (opt->type->parse) {
+		ret = opt->type->parse(opt, set, value);
+		if (ret)
+			return ret;
 	}
 
-	log_error("unknown config option '%s'", key);
-	return -EFAULT;
+	return 0;
 }
 
 static void strip_spaces(char **buf)
@@ -398,8 +453,7 @@ static void strip_spaces(char **buf)
 		*tail-- = 0;
 }
 
-static int parse_line(struct conf_option *opts, size_t olen,
-		      char **buf, size_t *size)
+static int parse_line(struct conf_ctx *ctx, char **buf, size_t *size)
 {
 	char *key;
 	char *value = NULL;
@@ -480,7 +534,7 @@ done:
 		if (value)
 			strip_spaces(&value);
 
-		ret = parse_kv_pair(opts, olen, key, value);
+		ret = parse_kv_pair(ctx, key, value);
 		if (ret)
 			return ret;
 	}
@@ -496,21 +550,20 @@ done:
 	return 0;
 }
 
-static int parse_buffer(struct conf_option *opts, size_t len,
-			char *buf, size_t size)
+static int parse_buffer(struct conf_ctx *ctx, char *buf, size_t size)
 {
 	int ret = 0;
 	struct conf_option *o;
 	unsigned int i;
 
 	while (!ret && size > 0)
-		ret = parse_line(opts, len, &buf, &size);
+		ret = parse_line(ctx, &buf, &size);
 
 	if (ret)
 		return ret;
 
-	for (i = 0; i < len; ++i) {
-		o = &opts[i];
+	for (i = 0; i < ctx->onum; ++i) {
+		o = &ctx->opts[i];
 		if (o->aftercheck) {
 			ret = o->aftercheck(o, 0, NULL, 0);
 			if (ret < 0)
@@ -524,26 +577,46 @@ static int parse_buffer(struct conf_option *opts, size_t len,
 /* chunk size when reading config files */
 #define CONF_BUFSIZE 4096
 
-/* This reads the file at \path in memory and parses it as if it was given as
- * command line options. */
-static int conf_parse_file(struct conf_option *opts, size_t len,
-			   const char *path)
-{
-	int fd, ret;
-	size_t size, pos;
-	char *buf, *tmp;
+/*
+ * Config-File Cache
+ * Pristine file contents are memoized by path and mtime so re-parsing the
+ * same file (several contexts, reloads) does not hit the disk again. The
+ * line parser modifies its buffer in-place, so every parse runs on a
+ * scratch copy of the cached content.
+ */
 
-	if (!opts || !len || !path)
-		return -EINVAL;
+struct conf_file {
+	struct shl_dlist list;
+	char *path;
+	time_t mtime;
+	off_t size;
+	char *buf;
+	size_t len;
+};
 
-	if (access(path, F_OK))
-		return 0;
+static struct shl_dlist conf_files = SHL_DLIST_INIT(conf_files);
 
-	if (access(path, R_OK)) {
-		log_error("read access to config file %s denied", path);
-		return -EACCES;
+static struct conf_file *conf_find_file(const char *path)
+{
+	struct shl_dlist *iter;
+	struct conf_file *file;
+
+	shl_dlist_for_each(iter, &conf_files) {
+		file = shl_dlist_entry(iter, struct conf_file, list);
+		if (!strcmp(file->path, path))
+			return file;
 	}
 
+	return NULL;
+}
+
+/* Read the file at \path into a freshly allocated zero-terminated buffer. */
+static int conf_read_file(const char *path, char **out, size_t *out_len)
+{
+	int fd, ret;
+	size_t size, pos;
+	char *buf, *tmp;
+
 	log_info("reading config file %s", path);
 	fd = open(path, O_RDONLY | O_CLOEXEC | O_NOCTTY);
 	if (fd < 0) {
@@ -579,7 +652,10 @@ static int conf_parse_file(struct conf_option *opts, size_t len,
 	} while (ret > 0);
 
 	buf[pos] = 0;
-	ret = parse_buffer(opts, len, buf, pos);
+	close(fd);
+	*out = buf;
+	*out_len = pos;
+	return 0;
 
 out_free:
 	free(buf);
@@ -587,6 +663,72 @@ out_free:
 	return ret;
 }
 
+/* This reads the file at \path in memory and parses it as if it was given as
+ * command line options. Unchanged files are served from the cache. */
+static int conf_parse_file(struct conf_ctx *ctx, const char *path)
+{
+	struct conf_file *file;
+	struct stat st;
+	char *buf, *scratch;
+	size_t size;
+	int ret;
+
+	if (!ctx || !path)
+		return -EINVAL;
+
+	if (stat(path, &st))
+		return 0;
+
+	if (access(path, R_OK)) {
+		log_error("read access to config file %s denied", path);
+		return -EACCES;
+	}
+
+	file = conf_find_file(path);
+	if (file && file->mtime == st.st_mtime && file->size == st.st_size) {
+		log_debug("using cached config file %s", path);
+	} else {
+		ret = conf_read_file(path, &buf, &size);
+		if (ret)
+			return ret;
+
+		if (!file) {
+			file = malloc(sizeof(*file));
+			if (!file) {
+				free(buf);
+				return -ENOMEM;
+			}
+			memset(file, 0, sizeof(*file));
+
+			file->path = strdup(path);
+			if (!file->path) {
+				free(file);
+				free(buf);
+				return -ENOMEM;
+			}
+
+			shl_dlist_link(&conf_files, &file->list);
+		} else {
+			free(file->buf);
+		}
+
+		file->buf = buf;
+		file->len = size;
+		file->mtime = st.st_mtime;
+		file->size = st.st_size;
+	}
+
+	scratch = malloc(file->len + 1);
+	if (!scratch)
+		return -ENOMEM;
+	memcpy(scratch, file->buf, file->len + 1);
+
+	ret = parse_buffer(ctx, scratch, file->len);
+
+	free(scratch);
+	return ret;
+}
+
 int conf_ctx_parse_file(struct conf_ctx *ctx, const char *format, ...)
 {
 	va_list list;
@@ -605,7 +747,7 @@ int conf_ctx_parse_file(struct conf_ctx *ctx, const char *format, ...)
 		return -ENOMEM;
 	}
 
-	ret = conf_parse_file(ctx->opts, ctx->onum, path);
+	ret = conf_parse_file(ctx, path);
 	free(path);
 	return ret;
 }
@@ -621,6 +763,8 @@ int conf_ctx_parse_file(struct conf_ctx *ctx, const char *format, ...)
  *         initial state. It must not fail.
  *   parse: This should parse a command-line option. Return 0 on success.
  *   copy: Copy data from source into destination. Return 0 on success.
+ *   share: Optional. Alias the source value instead of copying it; the
+ *          destination is marked CONF_SHARED and must never free the value.
  *
  * The backing memory is zeroed on reset so a config-type must be able to handle
  * this as "not set". Also, the "free" callback should reset it to zero (which
@@ -632,10 +776,25 @@ int conf_ctx_parse_file(struct conf_ctx *ctx, const char *format, ...)
 static void conf_free_value(struct conf_option *opt)
 {
 	if (*(void**)opt->mem) {
-		if (*(void**)opt->mem != opt->def)
+		if (*(void**)opt->mem != opt->def &&
+		    !(opt->flags & CONF_SHARED))
 			free(*(void**)opt->mem);
 		*(void**)opt->mem = NULL;
 	}
+	opt->flags &= ~CONF_SHARED;
+}
+
+/* Alias the source value instead of duplicating it. The source context owns
+ * the value; our free callbacks skip CONF_SHARED values, and re-parsing the
+ * option simply replaces the alias with an owned value. */
+static int conf_share_value(struct conf_option *opt,
+			    const struct conf_option *src)
+{
+	opt->type->free(opt);
+	*(void**)opt->mem = *(void**)src->mem;
+	if (*(void**)opt->mem && *(void**)opt->mem != opt->def)
+		opt->flags |= CONF_SHARED;
+	return 0;
 }
 
 /* Boolean Option */
@@ -780,6 +939,7 @@ const struct conf_type conf_string = {
 	.free = conf_free_value,
 	.parse = conf_parse_string,
 	.copy = conf_copy_string,
+	.share = conf_share_value,
 };
 
 /* Stringlist Option */
@@ -830,6 +990,7 @@ const struct conf_type conf_string_list = {
 	.free = conf_free_value,
 	.parse = conf_parse_string_list,
 	.copy = conf_copy_string_list,
+	.share = conf_share_value,
 };
 
 /* Grab Option */
@@ -848,6 +1009,11 @@ static void conf_free_grab(struct conf_option *opt)
 	grab = *(void**)opt->mem;
 	*(void**)opt->mem = NULL;
 
+	if (opt->flags & CONF_SHARED) {
+		opt->flags &= ~CONF_SHARED;
+		return;
+	}
+
 	if (!grab || grab == opt->def)
 		return;
 
@@ -1116,4 +1282,5 @@ const struct conf_type conf_grab = {
 	.free = conf_free_grab,
 	.parse = conf_parse_grab,
 	.copy = conf_copy_grab,
+	.share = conf_share_value,
 };
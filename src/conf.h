@@ -52,6 +52,10 @@ struct conf_type {
 	void (*free) (struct conf_option *opt);
 	int (*parse) (struct conf_option *opt, bool on, const char *arg);
 	int (*copy) (struct conf_option *opt, const struct conf_option *src);
+	/* Like copy but aliases the source value instead of duplicating it;
+	 * optional. The destination marks the option CONF_SHARED and never
+	 * frees the value, so the source context must outlive it. */
+	int (*share) (struct conf_option *opt, const struct conf_option *src);
 };
 
 /*
@@ -152,6 +156,8 @@ int conf_ctx_parse_file(struct conf_ctx *ctx, const char *format, ...);
  */
 
 #define CONF_LOCKED		0x0001
+/* value is borrowed from another context and must not be freed */
+#define CONF_SHARED		0x0002
 
 struct conf_option {
 	unsigned int flags;
@@ -115,9 +115,9 @@
  * Two sources are different for performance reasons:
  *   Idle sources: Idle sources can be registered with
  *   ev_eloop_register_idle_cb() and unregistered with
- *   ev_eloop_unregister_idle_cb(). They internally share a single
- *   file-descriptor to make them faster so you cannot get the same access as
- *   to other event sources (you cannot enable/disable them or similar).
+ *   ev_eloop_unregister_idle_cb(). They internally share a single pending
+ *   list to make them faster so you cannot get the same access as to other
+ *   event sources (you cannot enable/disable them or similar).
  *   Idle sources are called every-time ev_eloop_dispatch() is called. That is,
  *   as long as an idle-source is registered, the event-loop will not go to
  *   sleep!
@@ -155,8 +155,16 @@
  * called when a message is to be logged. The function may be called under any
  * circumstances (out-of-memory, etc...) and should always behave well.
  * Nothing is ever logged except through this callback.
+ *
+ * By default all file descriptors are multiplexed via epoll. If eloop was
+ * built with io_uring support, setting EV_ELOOP=io_uring in the environment
+ * switches new event loops to an io_uring based multiplexer which batches all
+ * source (de-)registrations into the next dispatch syscall. If the kernel
+ * does not support io_uring, the event loop transparently falls back to
+ * epoll.
  */
 
+#include <dlfcn.h>
 #include <errno.h>
 #include <inttypes.h>
 #include <pthread.h>
@@ -172,11 +180,19 @@
 #include <sys/wait.h>
 #include <time.h>
 #include <unistd.h>
+
+#ifdef BUILD_ENABLE_ELOOP_IOURING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
 #include "eloop.h"
 #include "shl_dlist.h"
 #include "shl_hook.h"
 #include "shl_llog.h"
 #include "shl_misc.h"
+#include "shl_pool.h"
 
 #define LLOG_SUBSYSTEM "eloop"
 
@@ -185,9 +201,9 @@
  * @ref: refcnt of this object
  * @llog: llog log function
  * @llog_data: llog log function user-data
- * @efd: The epoll file descriptor.
+ * @mux: The multiplexer backend used by this loop
+ * @efd: The multiplexer file descriptor (epoll or io_uring)
  * @fd: Event source around \efd so you can nest event loops
- * @cnt: Counter source used for idle events
  * @sig_list: Shared signal sources
  * @idlers: List of idle sources
  * @cur_fds: Current dispatch array of fds
@@ -199,27 +215,86 @@
  * sleep on the event loop, you will be woken up if a single event source is
  * firing up. An event loop itself is an event source so you can nest them.
  */
+struct eloop_mux;
+
 struct ev_eloop {
 	unsigned long ref;
 	llog_submit_t llog;
 	void *llog_data;
+	const struct eloop_mux *mux;
 	int efd;
 	struct ev_fd *fd;
-	int idle_fd;
+
+#ifdef BUILD_ENABLE_ELOOP_IOURING
+	struct {
+		void *sq_ring;
+		size_t sq_ring_size;
+		void *cq_ring;
+		size_t cq_ring_size;
+		struct io_uring_sqe *sqes;
+		size_t sqes_size;
+		unsigned int sq_entries;
+		unsigned int *sq_head;
+		unsigned int *sq_tail;
+		unsigned int sq_mask;
+		unsigned int *sq_array;
+		unsigned int *cq_head;
+		unsigned int *cq_tail;
+		unsigned int cq_mask;
+		struct io_uring_cqe *cqes;
+		unsigned int pending;
+		struct __kernel_timespec ts;
+		struct uring_slot *slots;
+		size_t slot_num;
+	} uring;
+#endif
+
+	/* consolidated timer subsystem; see "Timer sources" below */
+	int timer_fd;
+	struct ev_fd *timer_efd;
+	struct ev_timer **timer_heap;
+	size_t timer_num;
+	size_t timer_size;
+	size_t timer_count;
 
 	struct shl_dlist sig_list;
+	/* fds with a batched interest-mask update; see ev_fd_update() */
+	struct shl_dlist fd_updates;
 	struct shl_hook *chlds;
 	struct shl_hook *idlers;
 	struct shl_hook *pres;
 	struct shl_hook *posts;
 
 	bool dispatching;
+	/* monotonic timestamp cached once per dispatch round; see
+	 * ev_eloop_now() */
+	uint64_t now;
+	bool coarse_clock;
+	/* optional per-callback dispatch profiler; see
+	 * ev_eloop_set_profile() */
+	bool profile;
+	struct shl_dlist prof_list;
 	struct epoll_event *cur_fds;
 	size_t cur_fds_cnt;
 	size_t cur_fds_size;
 	bool exit;
 };
 
+/* per-callback record of the dispatch profiler; see "Dispatch profiler"
+ * below. The histogram counts calls per log2-microsecond bucket. */
+
+#define ELOOP_PROF_BUCKETS 20
+#define ELOOP_PROF_STALL_USECS 20000
+
+struct ev_prof {
+	struct shl_dlist list;
+	void *cb;
+	uint64_t calls;
+	uint64_t total_usecs;
+	uint64_t worst_usecs;
+	uint32_t hist[ELOOP_PROF_BUCKETS];
+};
+
 /**
  * ev_fd:
  * @ref: refcnt for object
@@ -229,8 +304,11 @@ struct ev_eloop {
  * @mask: the event mask for this fd (EV_READABLE, EV_WRITEABLE, ...)
  * @cb: the user callback
  * @data: the user data
+ * @priority: dispatch priority (EV_PRIO_HIGH, EV_PRIO_NORMAL, EV_PRIO_LOW)
  * @enabled: true if the object is currently enabled
  * @loop: NULL or pointer to eloop if bound
+ * @update_pending: true if a batched interest update is queued
+ * @update_list: link in the fd_updates list of the eloop
  *
  * File descriptors are the most basic event source. Internally, they are used
  * to implement all other kinds of event sources.
@@ -243,11 +321,17 @@ struct ev_fd {
 	int mask;
 	ev_fd_cb cb;
 	void *data;
+	int priority;
 
 	bool enabled;
 	struct ev_eloop *loop;
+	bool update_pending;
+	struct shl_dlist update_list;
 };
 
+/* batched interest-mask updates; see ev_fd_update() */
+static void eloop_flush_fd_updates(struct ev_eloop *loop);
+
 /**
  * ev_timer:
  * @ref: refcnt of this object
@@ -255,10 +339,15 @@ struct ev_fd {
  * @llog_data: llog log function user-data
  * @cb: user callback
  * @data: user data
- * @fd: the timerfd file descriptor
- * @efd: fd-source for @fd
+ * @loop: event loop this timer is bound to or NULL
+ * @deadline: next absolute expiration in nanoseconds or 0 if disarmed
+ * @interval: re-arm interval in nanoseconds or 0 for one-shot timers
+ * @slack: coalescing slack in nanoseconds; see ev_timer_set_slack()
+ * @heap_idx: 1-based position in the loop timer-heap or 0 if unqueued
+ * @enabled: whether the timer may fire
  *
- * Based on timerfd this allows firing events based on relative timeouts.
+ * This allows firing events based on relative timeouts. All timers of one
+ * event loop share a single timerfd; see the "Timer sources" section.
  */
 struct ev_timer {
 	unsigned long ref;
@@ -267,8 +356,12 @@ struct ev_timer {
 	ev_timer_cb cb;
 	void *data;
 
-	int fd;
-	struct ev_fd *efd;
+	struct ev_eloop *loop;
+	uint64_t deadline;
+	uint64_t interval;
+	uint64_t slack;
+	size_t heap_idx;
+	bool enabled;
 };
 
 /**
@@ -313,6 +406,465 @@ struct ev_signal_shared {
 	struct shl_hook *hook;
 };
 
+/*
+ * Multiplexer backends
+ * All file descriptors of an event loop are watched via one of these
+ * backends. A backend provides a pollable summary-fd in @loop->efd and fills
+ * @loop->cur_fds with epoll-events on wait() so event dispatching is shared
+ * between the backends. The @events arguments and the filled-in events use
+ * the EPOLL* constants.
+ * The epoll backend is the default. The io_uring backend is optional and can
+ * be selected at runtime; it queues all fd (de-)registrations as
+ * submission-entries which are flushed with the next wait() so a dispatch
+ * round needs only a single syscall no matter how many sources changed.
+ */
+
+struct eloop_mux {
+	const char *name;
+	int (*init) (struct ev_eloop *loop);
+	void (*destroy) (struct ev_eloop *loop);
+	int (*add_fd) (struct ev_eloop *loop, int fd, uint32_t events,
+		       void *ptr);
+	int (*update_fd) (struct ev_eloop *loop, int fd, uint32_t events,
+			  void *ptr);
+	void (*remove_fd) (struct ev_eloop *loop, int fd);
+	int (*wait) (struct ev_eloop *loop, int timeout);
+};
+
+static int epoll_mux_init(struct ev_eloop *loop)
+{
+	loop->efd = epoll_create1(EPOLL_CLOEXEC);
+	if (loop->efd < 0) {
+		llog_error(loop, "cannot create epoll-fd");
+		return -EFAULT;
+	}
+
+	return 0;
+}
+
+static void epoll_mux_destroy(struct ev_eloop *loop)
+{
+	close(loop->efd);
+}
+
+static int epoll_mux_add_fd(struct ev_eloop *loop, int fd, uint32_t events,
+			    void *ptr)
+{
+	struct epoll_event ep;
+	int ret;
+
+	memset(&ep, 0, sizeof(ep));
+	ep.events = events;
+	ep.data.ptr = ptr;
+
+	ret = epoll_ctl(loop->efd, EPOLL_CTL_ADD, fd, &ep);
+	if (ret) {
+		llog_warning(loop, "cannot add fd %d to epoll set (%d): %m",
+			     fd, errno);
+		return -EFAULT;
+	}
+
+	return 0;
+}
+
+static int epoll_mux_update_fd(struct ev_eloop *loop, int fd, uint32_t events,
+			       void *ptr)
+{
+	struct epoll_event ep;
+	int ret;
+
+	memset(&ep, 0, sizeof(ep));
+	ep.events = events;
+	ep.data.ptr = ptr;
+
+	ret = epoll_ctl(loop->efd, EPOLL_CTL_MOD, fd, &ep);
+	if (ret) {
+		llog_warning(loop, "cannot update epoll fd %d (%d): %m",
+			     fd, errno);
+		return -EFAULT;
+	}
+
+	return 0;
+}
+
+static void epoll_mux_remove_fd(struct ev_eloop *loop, int fd)
+{
+	int ret;
+
+	ret = epoll_ctl(loop->efd, EPOLL_CTL_DEL, fd, NULL);
+	if (ret && errno != EBADF)
+		llog_warning(loop, "cannot remove fd %d from epoll set (%d): %m",
+			     fd, errno);
+}
+
+static int epoll_mux_wait(struct ev_eloop *loop, int timeout)
+{
+	int count;
+
+	count = epoll_wait(loop->efd,
+			   loop->cur_fds,
+			   loop->cur_fds_size,
+			   timeout);
+	if (count < 0)
+		return -errno;
+
+	return count;
+}
+
+static const struct eloop_mux epoll_mux = {
+	.name = "epoll",
+	.init = epoll_mux_init,
+	.destroy = epoll_mux_destroy,
+	.add_fd = epoll_mux_add_fd,
+	.update_fd = epoll_mux_update_fd,
+	.remove_fd = epoll_mux_remove_fd,
+	.wait = epoll_mux_wait,
+};
+
+#ifdef BUILD_ENABLE_ELOOP_IOURING
+
+/*
+ * The io_uring backend arms a one-shot IORING_OP_POLL_ADD for every fd and
+ * re-arms it whenever it fires. Arming polls the fd immediately, so the
+ * level-triggered semantics of the epoll backend are preserved (EV_ET is
+ * treated as a hint only; delivering additional events is always safe as all
+ * edge-triggered users drain their fds until -EAGAIN anyway).
+ * All submission-entries are only queued locally and flushed by the next
+ * wait(), which makes (de-)registrations syscall-free.
+ * Completions carry the fd-number instead of the source pointer and are
+ * resolved via @slots; this way a queued cancellation cannot race a
+ * completion that still references an already freed source.
+ */
+
+/* fd-numbers are shifted by one so user_data 0 marks ignorable entries like
+ * cancellations and timeouts */
+#define URING_DATA_IGNORE 0ULL
+#define URING_DATA_OFFSET 1ULL
+
+#define URING_DEFAULT_ENTRIES 64
+
+#ifndef __NR_io_uring_setup
+#  define __NR_io_uring_setup 425
+#endif
+#ifndef __NR_io_uring_enter
+#  define __NR_io_uring_enter 426
+#endif
+
+struct uring_slot {
+	void *ptr;
+	uint32_t events;
+};
+
+static int sys_io_uring_setup(unsigned int entries, struct io_uring_params *p)
+{
+	return syscall(__NR_io_uring_setup, entries, p);
+}
+
+static int sys_io_uring_enter(int fd, unsigned int to_submit,
+			      unsigned int min_complete, unsigned int flags)
+{
+	return syscall(__NR_io_uring_enter, fd, to_submit, min_complete,
+		       flags, NULL, 0);
+}
+
+static struct io_uring_sqe *uring_get_sqe(struct ev_eloop *loop)
+{
+	unsigned int head, tail;
+	struct io_uring_sqe *sqe;
+	int ret;
+
+	tail = *loop->uring.sq_tail;
+	head = __atomic_load_n(loop->uring.sq_head, __ATOMIC_ACQUIRE);
+	if (tail - head >= loop->uring.sq_entries) {
+		/* queue full; flush pending entries without waiting */
+		ret = sys_io_uring_enter(loop->efd, loop->uring.pending,
+					 0, 0);
+		if (ret < 0) {
+			llog_warning(loop, "cannot submit io_uring entries (%d): %m",
+				     errno);
+			return NULL;
+		}
+		loop->uring.pending = 0;
+
+		head = __atomic_load_n(loop->uring.sq_head, __ATOMIC_ACQUIRE);
+		if (tail - head >= loop->uring.sq_entries)
+			return NULL;
+	}
+
+	sqe = &loop->uring.sqes[tail & loop->uring.sq_mask];
+	memset(sqe, 0, sizeof(*sqe));
+	loop->uring.sq_array[tail & loop->uring.sq_mask] =
+						tail & loop->uring.sq_mask;
+	__atomic_store_n(loop->uring.sq_tail, tail + 1, __ATOMIC_RELEASE);
+	++loop->uring.pending;
+
+	return sqe;
+}
+
+static int uring_arm(struct ev_eloop *loop, int fd, uint32_t events)
+{
+	struct io_uring_sqe *sqe;
+
+	sqe = uring_get_sqe(loop);
+	if (!sqe)
+		return -EFAULT;
+
+	sqe->opcode = IORING_OP_POLL_ADD;
+	sqe->fd = fd;
+	/* EPOLLET does not fit into the 16bit poll-mask and is dropped */
+	sqe->poll_events = events & 0xffff;
+	sqe->user_data = fd + URING_DATA_OFFSET;
+
+	return 0;
+}
+
+static void uring_disarm(struct ev_eloop *loop, int fd)
+{
+	struct io_uring_sqe *sqe;
+
+	sqe = uring_get_sqe(loop);
+	if (!sqe)
+		return;
+
+	sqe->opcode = IORING_OP_POLL_REMOVE;
+	sqe->fd = -1;
+	sqe->addr = fd + URING_DATA_OFFSET;
+	sqe->user_data = URING_DATA_IGNORE;
+}
+
+static int uring_mux_init(struct ev_eloop *loop)
+{
+	struct io_uring_params p;
+	int fd, ret;
+
+	memset(&p, 0, sizeof(p));
+	fd = sys_io_uring_setup(URING_DEFAULT_ENTRIES, &p);
+	if (fd < 0) {
+		ret = -errno;
+		llog_warning(loop, "cannot setup io_uring (%d): %m", errno);
+		return ret;
+	}
+
+	loop->uring.sq_ring_size = p.sq_off.array +
+				   p.sq_entries * sizeof(unsigned int);
+	loop->uring.cq_ring_size = p.cq_off.cqes +
+				   p.cq_entries * sizeof(struct io_uring_cqe);
+	if (p.features & IORING_FEAT_SINGLE_MMAP) {
+		if (loop->uring.cq_ring_size > loop->uring.sq_ring_size)
+			loop->uring.sq_ring_size = loop->uring.cq_ring_size;
+		loop->uring.cq_ring_size = loop->uring.sq_ring_size;
+	}
+
+	loop->uring.sq_ring = mmap(NULL, loop->uring.sq_ring_size,
+				   PROT_READ | PROT_WRITE,
+				   MAP_SHARED | MAP_POPULATE, fd,
+				   IORING_OFF_SQ_RING);
+	if (loop->uring.sq_ring == MAP_FAILED) {
+		ret = -errno;
+		llog_warning(loop, "cannot map io_uring sq-ring (%d): %m",
+			     errno);
+		goto err_close;
+	}
+
+	if (p.features & IORING_FEAT_SINGLE_MMAP) {
+		loop->uring.cq_ring = loop->uring.sq_ring;
+	} else {
+		loop->uring.cq_ring = mmap(NULL, loop->uring.cq_ring_size,
+					   PROT_READ | PROT_WRITE,
+					   MAP_SHARED | MAP_POPULATE, fd,
+					   IORING_OFF_CQ_RING);
+		if (loop->uring.cq_ring == MAP_FAILED) {
+			ret = -errno;
+			llog_warning(loop, "cannot map io_uring cq-ring (%d): %m",
+				     errno);
+			goto err_sq;
+		}
+	}
+
+	loop->uring.sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+	loop->uring.sqes = mmap(NULL, loop->uring.sqes_size,
+				PROT_READ | PROT_WRITE,
+				MAP_SHARED | MAP_POPULATE, fd,
+				IORING_OFF_SQES);
+	if (loop->uring.sqes == MAP_FAILED) {
+		ret = -errno;
+		llog_warning(loop, "cannot map io_uring sqes (%d): %m", errno);
+		goto err_cq;
+	}
+
+	loop->uring.sq_entries = p.sq_entries;
+	loop->uring.sq_head = (void*)((char*)loop->uring.sq_ring +
+				      p.sq_off.head);
+	loop->uring.sq_tail = (void*)((char*)loop->uring.sq_ring +
+				      p.sq_off.tail);
+	loop->uring.sq_mask = *(unsigned int*)((char*)loop->uring.sq_ring +
+					       p.sq_off.ring_mask);
+	loop->uring.sq_array = (void*)((char*)loop->uring.sq_ring +
+				       p.sq_off.array);
+	loop->uring.cq_head = (void*)((char*)loop->uring.cq_ring +
+				      p.cq_off.head);
+	loop->uring.cq_tail = (void*)((char*)loop->uring.cq_ring +
+				      p.cq_off.tail);
+	loop->uring.cq_mask = *(unsigned int*)((char*)loop->uring.cq_ring +
+					       p.cq_off.ring_mask);
+	loop->uring.cqes = (void*)((char*)loop->uring.cq_ring +
+				   p.cq_off.cqes);
+	loop->uring.pending = 0;
+	loop->uring.slots = NULL;
+	loop->uring.slot_num = 0;
+
+	loop->efd = fd;
+	return 0;
+
+err_cq:
+	if (loop->uring.cq_ring != loop->uring.sq_ring)
+		munmap(loop->uring.cq_ring, loop->uring.cq_ring_size);
+err_sq:
+	munmap(loop->uring.sq_ring, loop->uring.sq_ring_size);
+err_close:
+	close(fd);
+	return ret;
+}
+
+static void uring_mux_destroy(struct ev_eloop *loop)
+{
+	free(loop->uring.slots);
+	munmap(loop->uring.sqes, loop->uring.sqes_size);
+	if (loop->uring.cq_ring != loop->uring.sq_ring)
+		munmap(loop->uring.cq_ring, loop->uring.cq_ring_size);
+	munmap(loop->uring.sq_ring, loop->uring.sq_ring_size);
+	close(loop->efd);
+}
+
+static int uring_mux_add_fd(struct ev_eloop *loop, int fd, uint32_t events,
+			    void *ptr)
+{
+	struct uring_slot *slots;
+	size_t num;
+
+	if ((size_t)fd >= loop->uring.slot_num) {
+		num = fd + 16;
+		slots = realloc(loop->uring.slots, sizeof(*slots) * num);
+		if (!slots)
+			return llog_ENOMEM(loop);
+		memset(&slots[loop->uring.slot_num], 0,
+		       sizeof(*slots) * (num - loop->uring.slot_num));
+		loop->uring.slots = slots;
+		loop->uring.slot_num = num;
+	}
+
+	loop->uring.slots[fd].ptr = ptr;
+	loop->uring.slots[fd].events = events;
+
+	return uring_arm(loop, fd, events);
+}
+
+static int uring_mux_update_fd(struct ev_eloop *loop, int fd, uint32_t events,
+			       void *ptr)
+{
+	if ((size_t)fd >= loop->uring.slot_num || !loop->uring.slots[fd].ptr)
+		return llog_EINVAL(loop);
+
+	loop->uring.slots[fd].ptr = ptr;
+	loop->uring.slots[fd].events = events;
+
+	uring_disarm(loop, fd);
+	return uring_arm(loop, fd, events);
+}
+
+static void uring_mux_remove_fd(struct ev_eloop *loop, int fd)
+{
+	if ((size_t)fd >= loop->uring.slot_num || !loop->uring.slots[fd].ptr)
+		return;
+
+	loop->uring.slots[fd].ptr = NULL;
+	uring_disarm(loop, fd);
+}
+
+static int uring_mux_wait(struct ev_eloop *loop, int timeout)
+{
+	struct io_uring_sqe *sqe;
+	struct io_uring_cqe *cqe;
+	unsigned int head, tail;
+	uint64_t data;
+	int count, ret, fd;
+	void *ptr;
+
+	if (timeout > 0) {
+		loop->uring.ts.tv_sec = timeout / 1000;
+		loop->uring.ts.tv_nsec = (timeout % 1000) * 1000000LL;
+
+		sqe = uring_get_sqe(loop);
+		if (!sqe)
+			return -EFAULT;
+
+		sqe->opcode = IORING_OP_TIMEOUT;
+		sqe->fd = -1;
+		sqe->addr = (unsigned long)&loop->uring.ts;
+		sqe->len = 1;
+		sqe->off = 1;
+		sqe->user_data = URING_DATA_IGNORE;
+	}
+
+	ret = sys_io_uring_enter(loop->efd, loop->uring.pending,
+				 timeout ? 1 : 0, IORING_ENTER_GETEVENTS);
+	if (ret < 0)
+		return -errno;
+	loop->uring.pending = 0;
+
+	count = 0;
+	head = *loop->uring.cq_head;
+	tail = __atomic_load_n(loop->uring.cq_tail, __ATOMIC_ACQUIRE);
+	while (head != tail) {
+		cqe = &loop->uring.cqes[head & loop->uring.cq_mask];
+		++head;
+
+		data = cqe->user_data;
+		if (data == URING_DATA_IGNORE || cqe->res == -ECANCELED)
+			continue;
+
+		fd = data - URING_DATA_OFFSET;
+		if (fd < 0 || (size_t)fd >= loop->uring.slot_num)
+			continue;
+		ptr = loop->uring.slots[fd].ptr;
+		if (!ptr)
+			continue;
+
+		if (count >= (int)loop->cur_fds_size) {
+			/* no space left; re-arming polls the fd right away
+			 * so the event fires again in the next round */
+			uring_arm(loop, fd, loop->uring.slots[fd].events);
+			continue;
+		}
+
+		if (cqe->res < 0) {
+			/* do not re-arm broken fds; the owner is expected to
+			 * remove the source when it sees the error */
+			loop->cur_fds[count].events = EPOLLERR;
+		} else {
+			uring_arm(loop, fd, loop->uring.slots[fd].events);
+			loop->cur_fds[count].events = cqe->res;
+		}
+		loop->cur_fds[count].data.ptr = ptr;
+		++count;
+	}
+	__atomic_store_n(loop->uring.cq_head, head, __ATOMIC_RELEASE);
+
+	return count;
+}
+
+static const struct eloop_mux uring_mux = {
+	.name = "io_uring",
+	.init = uring_mux_init,
+	.destroy = uring_mux_destroy,
+	.add_fd = uring_mux_add_fd,
+	.update_fd = uring_mux_update_fd,
+	.remove_fd = uring_mux_remove_fd,
+	.wait = uring_mux_wait,
+};
+
+#endif /* BUILD_ENABLE_ELOOP_IOURING */
+
 /*
  * Shared signals
  * signalfd allows us to conveniently listen for incoming signals. However, if
@@ -488,13 +1040,13 @@ static void signal_free(struct ev_signal_shared *sig)
  * occur. Even shared signals are quite rare.
  * Anyway, you must take this into account when nesting eloops.
  *
- * For the curious reader: We implement idle sources with counter sources. That
- * is, whenever there is an idle source we increase the counter source. Hence,
- * the next dispatch call will call the counter source and this will call all
- * registered idle source. If the idle sources do not unregister them, then we
- * directly increase the counter again and the next dispatch round will call
- * all idle sources again. This, however, has the side-effect that idle sources
- * are _not_ called before other fd events but are rather mixed in between.
+ * For the curious reader: Idle sources are a plain in-memory list. As long as
+ * the list is non-empty, the dispatcher polls with a zero timeout and calls
+ * all idle sources after the fd events of the round have been handled. This
+ * avoids the eventfd write/read pair that a counter-based implementation
+ * would pay on every idle-driven round. The trade-off is that an idle source
+ * registered on a nested eloop does not make the parent loop's fd readable;
+ * like shared signals, idle sources do not propagate across eloop boundaries.
  */
 
 static void eloop_event(struct ev_fd *fd, int mask, void *data)
@@ -541,49 +1093,6 @@ static int write_eventfd(llog_submit_t llog, void *llog_data, int fd,
 	return 0;
 }
 
-static void eloop_idle_event(struct ev_eloop *loop, unsigned int mask)
-{
-	int ret;
-	uint64_t val;
-
-	if (mask & (EV_HUP | EV_ERR)) {
-		llog_warning(loop, "HUP/ERR on eventfd");
-		goto err_out;
-	}
-
-	if (!(mask & EV_READABLE))
-		return;
-
-	ret = read(loop->idle_fd, &val, sizeof(val));
-	if (ret < 0) {
-		if (errno != EAGAIN) {
-			llog_warning(loop, "reading eventfd failed (%d): %m",
-				     errno);
-			goto err_out;
-		}
-	} else if (ret == 0) {
-		llog_warning(loop, "EOF on eventfd");
-		goto err_out;
-	} else if (ret != sizeof(val)) {
-		llog_warning(loop, "read %d bytes instead of 8 on eventfd",
-			     ret);
-		goto err_out;
-	} else if (val > 0) {
-		shl_hook_call(loop->idlers, loop, NULL);
-		if (shl_hook_num(loop->idlers) > 0)
-			write_eventfd(loop->llog, loop->llog_data,
-				      loop->idle_fd, 1);
-	}
-
-	return;
-
-err_out:
-	ret = epoll_ctl(loop->efd, EPOLL_CTL_DEL, loop->idle_fd, NULL);
-	if (ret)
-		llog_warning(loop, "cannot remove fd %d from epollset (%d): %m",
-			     loop->idle_fd, errno);
-}
-
 /**
  * ev_eloop_new:
  * @out: Storage for the result
@@ -600,7 +1109,7 @@ int ev_eloop_new(struct ev_eloop **out, ev_log_t log, void *log_data)
 {
 	struct ev_eloop *loop;
 	int ret;
-	struct epoll_event ep;
+	const char *env;
 
 	if (!out)
 		return llog_dEINVAL(log, log_data);
@@ -613,7 +1122,10 @@ int ev_eloop_new(struct ev_eloop **out, ev_log_t log, void *log_data)
 	loop->ref = 1;
 	loop->llog = log;
 	loop->llog_data = log_data;
+	loop->timer_fd = -1;
 	shl_dlist_init(&loop->sig_list);
+	shl_dlist_init(&loop->fd_updates);
+	shl_dlist_init(&loop->prof_list);
 
 	loop->cur_fds_size = 32;
 	loop->cur_fds = malloc(sizeof(struct epoll_event) *
@@ -639,11 +1151,26 @@ int ev_eloop_new(struct ev_eloop **out, ev_log_t log, void *log_data)
 	if (ret)
 		goto err_pres;
 
-	loop->efd = epoll_create1(EPOLL_CLOEXEC);
-	if (loop->efd < 0) {
-		ret = -errno;
-		llog_error(loop, "cannot create epoll-fd");
-		goto err_posts;
+	loop->mux = &epoll_mux;
+	env = getenv("EV_ELOOP");
+#ifdef BUILD_ENABLE_ELOOP_IOURING
+	if (env && !strcmp(env, "io_uring")) {
+		ret = uring_mux.init(loop);
+		if (ret)
+			llog_warning(loop, "cannot initialize io_uring backend (%d), falling back to epoll",
+				     ret);
+		else
+			loop->mux = &uring_mux;
+	}
+#else
+	if (env && !strcmp(env, "io_uring"))
+		llog_warning(loop, "io_uring backend not compiled in, using epoll");
+#endif
+
+	if (loop->mux == &epoll_mux) {
+		ret = epoll_mux.init(loop);
+		if (ret)
+			goto err_posts;
 	}
 
 	ret = ev_fd_new(&loop->fd, loop->efd, EV_READABLE, eloop_event, loop,
@@ -651,35 +1178,12 @@ int ev_eloop_new(struct ev_eloop **out, ev_log_t log, void *log_data)
 	if (ret)
 		goto err_close;
 
-	loop->idle_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
-	if (loop->idle_fd < 0) {
-		llog_error(loop, "cannot create eventfd (%d): %m", errno);
-		ret = -EFAULT;
-		goto err_fd;
-	}
-
-	memset(&ep, 0, sizeof(ep));
-	ep.events |= EPOLLIN;
-	ep.data.ptr = loop;
-
-	ret = epoll_ctl(loop->efd, EPOLL_CTL_ADD, loop->idle_fd, &ep);
-	if (ret) {
-		llog_warning(loop, "cannot add fd %d to epoll set (%d): %m",
-			     loop->idle_fd, errno);
-		ret = -EFAULT;
-		goto err_idle_fd;
-	}
-
-	llog_debug(loop, "new eloop object %p", loop);
+	llog_debug(loop, "new eloop object %p (%s)", loop, loop->mux->name);
 	*out = loop;
 	return 0;
 
-err_idle_fd:
-	close(loop->idle_fd);
-err_fd:
-	ev_fd_unref(loop->fd);
 err_close:
-	close(loop->efd);
+	loop->mux->destroy(loop);
 err_posts:
 	shl_hook_free(loop->posts);
 err_pres:
@@ -723,7 +1227,7 @@ SHL_EXPORT
 void ev_eloop_unref(struct ev_eloop *loop)
 {
 	struct ev_signal_shared *sig;
-	int ret;
+	struct ev_prof *prof;
 
 	if (!loop)
 		return;
@@ -744,14 +1248,17 @@ void ev_eloop_unref(struct ev_eloop *loop)
 		signal_free(sig);
 	}
 
-	ret = epoll_ctl(loop->efd, EPOLL_CTL_DEL, loop->idle_fd, NULL);
-	if (ret)
-		llog_warning(loop, "cannot remove fd %d from epollset (%d): %m",
-			     loop->idle_fd, errno);
-	close(loop->idle_fd);
+	while (!shl_dlist_empty(&loop->prof_list)) {
+		prof = shl_dlist_entry(loop->prof_list.next, struct ev_prof,
+				       list);
+		shl_dlist_unlink(&prof->list);
+		free(prof);
+	}
+
+	free(loop->timer_heap);
 
 	ev_fd_unref(loop->fd);
-	close(loop->efd);
+	loop->mux->destroy(loop);
 	shl_hook_free(loop->posts);
 	shl_hook_free(loop->pres);
 	shl_hook_free(loop->idlers);
@@ -786,6 +1293,138 @@ void ev_eloop_flush_fd(struct ev_eloop *loop, struct ev_fd *fd)
 	}
 }
 
+/*
+ * Dispatch profiler
+ * The loop is single-threaded, so when a seat hitches exactly one callback
+ * stalled the round. When profiling is enabled every fd callback is timed
+ * (the timer, signal, child and counter sources all dispatch through fds)
+ * and accounted to a per-callback record with a log2-microsecond histogram;
+ * a single call overrunning ELOOP_PROF_STALL_USECS is reported right away.
+ * ev_eloop_dump_profile() prints the accumulated records with symbolized
+ * callback pointers.
+ */
+
+/* the profiler must not use the coarse per-round clock; it measures
+ * durations well below its resolution */
+static uint64_t prof_stamp(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+/* best-effort name for a callback pointer; the main binary is linked with
+ * -rdynamic so its symbols resolve, everything else shows as raw address */
+static const char *prof_symbol(void *cb, char *buf, size_t size)
+{
+	Dl_info info;
+
+	if (dladdr(cb, &info) && info.dli_sname)
+		snprintf(buf, size, "%s+0x%lx", info.dli_sname,
+			 (unsigned long)((char*)cb - (char*)info.dli_saddr));
+	else
+		snprintf(buf, size, "%p", cb);
+
+	return buf;
+}
+
+static void prof_account(struct ev_eloop *loop, void *cb, uint64_t usecs)
+{
+	struct shl_dlist *iter;
+	struct ev_prof *prof;
+	unsigned int bucket;
+	char sym[128];
+
+	shl_dlist_for_each(iter, &loop->prof_list) {
+		prof = shl_dlist_entry(iter, struct ev_prof, list);
+		if (prof->cb == cb)
+			break;
+	}
+	if (iter == &loop->prof_list) {
+		prof = malloc(sizeof(*prof));
+		if (!prof)
+			return;
+		memset(prof, 0, sizeof(*prof));
+		prof->cb = cb;
+		shl_dlist_link(&loop->prof_list, &prof->list);
+	}
+
+	++prof->calls;
+	prof->total_usecs += usecs;
+	if (usecs > prof->worst_usecs)
+		prof->worst_usecs = usecs;
+
+	bucket = 0;
+	while (usecs >> (bucket + 1) && bucket < ELOOP_PROF_BUCKETS - 1)
+		++bucket;
+	++prof->hist[bucket];
+
+	if (usecs >= ELOOP_PROF_STALL_USECS)
+		llog_warning(loop,
+			     "callback %s stalled the loop for %" PRIu64 "us",
+			     prof_symbol(cb, sym, sizeof(sym)), usecs);
+}
+
+/**
+ * ev_eloop_set_profile:
+ * @loop: event loop to be modified
+ * @enable: true to profile dispatched callbacks
+ *
+ * Enable or disable the dispatch profiler on @loop. Profiling adds two
+ * clock_gettime() calls per dispatched callback; records accumulate until
+ * the loop is destroyed and survive disabling.
+ */
+SHL_EXPORT
+void ev_eloop_set_profile(struct ev_eloop *loop, bool enable)
+{
+	if (!loop)
+		return;
+
+	loop->profile = enable;
+}
+
+/**
+ * ev_eloop_dump_profile:
+ * @loop: event loop to be dumped
+ *
+ * Log one line per profiled callback with call count, average and worst
+ * dispatch time and the log2-microsecond histogram. A no-op if profiling
+ * was never enabled on @loop.
+ */
+SHL_EXPORT
+void ev_eloop_dump_profile(struct ev_eloop *loop)
+{
+	struct shl_dlist *iter;
+	struct ev_prof *prof;
+	char sym[128], hist[ELOOP_PROF_BUCKETS * 12], *pos;
+	unsigned int i, num;
+
+	if (!loop)
+		return;
+
+	shl_dlist_for_each(iter, &loop->prof_list) {
+		prof = shl_dlist_entry(iter, struct ev_prof, list);
+
+		/* trim trailing empty buckets */
+		for (num = ELOOP_PROF_BUCKETS; num > 1; --num)
+			if (prof->hist[num - 1])
+				break;
+
+		pos = hist;
+		for (i = 0; i < num; ++i)
+			pos += snprintf(pos, sizeof(hist) - (pos - hist),
+					"%s%" PRIu32, i ? " " : "",
+					prof->hist[i]);
+
+		llog_info(loop,
+			  "%s: %" PRIu64 " calls, avg %" PRIu64 "us, worst %" PRIu64 "us, hist: %s",
+			  prof_symbol(prof->cb, sym, sizeof(sym)),
+			  prof->calls, prof->total_usecs / prof->calls,
+			  prof->worst_usecs, hist);
+	}
+}
+
 static unsigned int convert_mask(uint32_t mask)
 {
 	unsigned int res = 0;
@@ -820,12 +1459,23 @@ static unsigned int convert_mask(uint32_t mask)
  *
  * Returns: 0 on success, otherwise negative error code
  */
+
+static void eloop_update_now(struct ev_eloop *loop)
+{
+	struct timespec ts;
+
+	clock_gettime(loop->coarse_clock ? CLOCK_MONOTONIC_COARSE
+					 : CLOCK_MONOTONIC, &ts);
+	loop->now = ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
 SHL_EXPORT
 int ev_eloop_dispatch(struct ev_eloop *loop, int timeout)
 {
 	struct epoll_event *ep;
 	struct ev_fd *fd;
-	int i, count, mask, ret;
+	uint64_t start;
+	int i, count, mask, ret, prio;
 
 	if (!loop)
 		return -EINVAL;
@@ -840,17 +1490,27 @@ int ev_eloop_dispatch(struct ev_eloop *loop, int timeout)
 
 	shl_hook_call(loop->pres, loop, NULL);
 
-	count = epoll_wait(loop->efd,
-			   loop->cur_fds,
-			   loop->cur_fds_size,
-			   timeout);
+	/* pending idle sources must not make us sleep */
+	if (timeout != 0 && shl_hook_num(loop->idlers) > 0)
+		timeout = 0;
+
+	/* apply batched interest updates before we poll */
+	eloop_flush_fd_updates(loop);
+
+	count = loop->mux->wait(loop, timeout);
+
+	/* all callbacks of this round share one timestamp; see
+	 * ev_eloop_now() */
+	eloop_update_now(loop);
+
 	if (count < 0) {
-		if (errno == EINTR) {
+		if (count == -EINTR) {
 			ret = 0;
 			goto out_dispatch;
 		} else {
-			llog_warn(loop, "epoll_wait dispatching failed: %m");
-			ret = -errno;
+			llog_warn(loop, "event-loop dispatching failed: %d",
+				  count);
+			ret = count;
 			goto out_dispatch;
 		}
 	} else if (count > loop->cur_fds_size) {
@@ -860,20 +1520,34 @@ int ev_eloop_dispatch(struct ev_eloop *loop, int timeout)
 	ep = loop->cur_fds;
 	loop->cur_fds_cnt = count;
 
-	for (i = 0; i < count; ++i) {
-		if (ep[i].data.ptr == loop) {
-			mask = convert_mask(ep[i].events);
-			eloop_idle_event(loop, mask);
-		} else {
+	/*
+	 * Dispatch in priority order so latency-critical sources (keyboard,
+	 * VT) preempt bulk sources like PTY floods within the same round.
+	 */
+	for (prio = EV_PRIO_HIGH; prio >= EV_PRIO_LOW; --prio) {
+		for (i = 0; i < count; ++i) {
 			fd = ep[i].data.ptr;
 			if (!fd || !fd->cb || !fd->enabled)
 				continue;
+			if (fd->priority != prio)
+				continue;
 
 			mask = convert_mask(ep[i].events);
-			fd->cb(fd, mask, fd->data);
+			if (loop->profile) {
+				start = prof_stamp();
+				fd->cb(fd, mask, fd->data);
+				prof_account(loop, (void*)fd->cb,
+					     prof_stamp() - start);
+			} else {
+				fd->cb(fd, mask, fd->data);
+			}
 		}
 	}
 
+	/* idle sources always run last, after all fd events of the round */
+	if (shl_hook_num(loop->idlers) > 0)
+		shl_hook_call(loop->idlers, loop, NULL);
+
 	if (count == loop->cur_fds_size) {
 		ep = realloc(loop->cur_fds, sizeof(struct epoll_event) *
 			     loop->cur_fds_size * 2);
@@ -946,7 +1620,49 @@ int ev_eloop_run(struct ev_eloop *loop, int timeout)
 		}
 	}
 
-	return 0;
+	return 0;
+}
+
+/**
+ * ev_eloop_now:
+ * @loop: event loop
+ *
+ * Returns the current CLOCK_MONOTONIC time in microseconds. During dispatch
+ * this is a cached value captured once after the event-multiplexer returned,
+ * so all callbacks of one round see the same timestamp and per-event time
+ * queries cost a memory load instead of a syscall. Outside of dispatch the
+ * clock is read directly.
+ *
+ * Returns: monotonic timestamp in microseconds, 0 if @loop is NULL
+ */
+SHL_EXPORT
+uint64_t ev_eloop_now(struct ev_eloop *loop)
+{
+	if (!loop)
+		return 0;
+
+	if (!loop->dispatching || !loop->now)
+		eloop_update_now(loop);
+
+	return loop->now;
+}
+
+/**
+ * ev_eloop_set_coarse_clock:
+ * @loop: event loop
+ * @coarse: true to read CLOCK_MONOTONIC_COARSE instead of CLOCK_MONOTONIC
+ *
+ * The coarse clock avoids the timekeeping overhead on architectures without
+ * fast vDSO clocks at the cost of tick-granularity (usually 1-4ms) for
+ * ev_eloop_now(). Timer sources are unaffected.
+ */
+SHL_EXPORT
+void ev_eloop_set_coarse_clock(struct ev_eloop *loop, bool coarse)
+{
+	if (!loop)
+		return;
+
+	loop->coarse_clock = coarse;
 }
 
 /**
@@ -1094,6 +1810,10 @@ void ev_eloop_rm_eloop(struct ev_eloop *rm)
  * called until you enable it again.
  */
 
+/* FD sources churn in bursts (clients connecting, one-shot watches); recycle
+ * them through a pool instead of hitting the allocator every time. */
+static struct shl_pool fd_pool = SHL_POOL_INIT(sizeof(struct ev_fd), 64);
+
 /**
  * ev_fd_new:
  * @out: Storage for result
@@ -1121,7 +1841,7 @@ int ev_fd_new(struct ev_fd **out, int rfd, int mask, ev_fd_cb cb, void *data,
 	if (!out || rfd < 0)
 		return llog_dEINVAL(log, log_data);
 
-	fd = malloc(sizeof(*fd));
+	fd = shl_pool_alloc(&fd_pool);
 	if (!fd)
 		return llog_dEINVAL(log, log_data);
 
@@ -1173,74 +1893,91 @@ void ev_fd_unref(struct ev_fd *fd)
 	if (--fd->ref)
 		return;
 
-	free(fd);
+	shl_pool_free(&fd_pool, fd);
 }
 
-static int fd_epoll_add(struct ev_fd *fd)
+static uint32_t fd_mux_events(struct ev_fd *fd)
 {
-	struct epoll_event ep;
-	int ret;
-
-	if (!fd->loop)
-		return 0;
+	uint32_t events = 0;
 
-	memset(&ep, 0, sizeof(ep));
 	if (fd->mask & EV_READABLE)
-		ep.events |= EPOLLIN;
+		events |= EPOLLIN;
 	if (fd->mask & EV_WRITEABLE)
-		ep.events |= EPOLLOUT;
+		events |= EPOLLOUT;
 	if (fd->mask & EV_ET)
-		ep.events |= EPOLLET;
-	ep.data.ptr = fd;
-
-	ret = epoll_ctl(fd->loop->efd, EPOLL_CTL_ADD, fd->fd, &ep);
-	if (ret) {
-		llog_warning(fd, "cannot add fd %d to epoll set (%d): %m",
-			     fd->fd, errno);
-		return -EFAULT;
-	}
+		events |= EPOLLET;
 
-	return 0;
+	return events;
 }
 
-static void fd_epoll_remove(struct ev_fd *fd)
+static int fd_mux_add(struct ev_fd *fd)
 {
-	int ret;
+	if (!fd->loop)
+		return 0;
+
+	return fd->loop->mux->add_fd(fd->loop, fd->fd, fd_mux_events(fd),
+				     fd);
+}
 
+static void fd_mux_remove(struct ev_fd *fd)
+{
 	if (!fd->loop)
 		return;
 
-	ret = epoll_ctl(fd->loop->efd, EPOLL_CTL_DEL, fd->fd, NULL);
-	if (ret && errno != EBADF)
-		llog_warning(fd, "cannot remove fd %d from epoll set (%d): %m",
-			     fd->fd, errno);
+	fd->loop->mux->remove_fd(fd->loop, fd->fd);
 }
 
-static int fd_epoll_update(struct ev_fd *fd)
+static int fd_mux_update(struct ev_fd *fd)
 {
-	struct epoll_event ep;
-	int ret;
-
 	if (!fd->loop)
 		return 0;
 
-	memset(&ep, 0, sizeof(ep));
-	if (fd->mask & EV_READABLE)
-		ep.events |= EPOLLIN;
-	if (fd->mask & EV_WRITEABLE)
-		ep.events |= EPOLLOUT;
-	if (fd->mask & EV_ET)
-		ep.events |= EPOLLET;
-	ep.data.ptr = fd;
+	return fd->loop->mux->update_fd(fd->loop, fd->fd, fd_mux_events(fd),
+					fd);
+}
 
-	ret = epoll_ctl(fd->loop->efd,  EPOLL_CTL_MOD, fd->fd, &ep);
-	if (ret) {
-		llog_warning(fd, "cannot update epoll fd %d (%d): %m",
-			     fd->fd, errno);
-		return -EFAULT;
-	}
+/*
+ * Interest-mask updates are not pushed into the mux immediately but queued
+ * on the eloop and applied in one go right before the next wait. Busy PTYs
+ * toggle EV_WRITEABLE on every queued write, which used to cost one
+ * epoll_ctl() syscall per toggle; with batching an arbitrary number of mask
+ * changes within one dispatch round collapses into at most one update per
+ * fd. This is safe because the mask only matters once we poll again; for
+ * edge-triggered fds the deferred update also re-arms the fd right before
+ * the wait, exactly when it is needed.
+ */
 
-	return 0;
+static void fd_update_queue(struct ev_fd *fd)
+{
+	if (fd->update_pending)
+		return;
+
+	shl_dlist_link_tail(&fd->loop->fd_updates, &fd->update_list);
+	fd->update_pending = true;
+}
+
+static void fd_update_cancel(struct ev_fd *fd)
+{
+	if (!fd->update_pending)
+		return;
+
+	shl_dlist_unlink(&fd->update_list);
+	fd->update_pending = false;
+}
+
+static void eloop_flush_fd_updates(struct ev_eloop *loop)
+{
+	struct ev_fd *fd;
+
+	while (!shl_dlist_empty(&loop->fd_updates)) {
+		fd = shl_dlist_entry(loop->fd_updates.next, struct ev_fd,
+				     update_list);
+		shl_dlist_unlink(&fd->update_list);
+		fd->update_pending = false;
+
+		if (fd->enabled && fd->loop)
+			fd_mux_update(fd);
+	}
 }
 
 /**
@@ -1262,10 +1999,13 @@ int ev_fd_enable(struct ev_fd *fd)
 	if (fd->enabled)
 		return 0;
 
-	ret = fd_epoll_add(fd);
+	ret = fd_mux_add(fd);
 	if (ret)
 		return ret;
 
+	/* adding registers the current mask; drop any stale queued update */
+	fd_update_cancel(fd);
+
 	fd->enabled = true;
 	return 0;
 }
@@ -1284,7 +2024,8 @@ void ev_fd_disable(struct ev_fd *fd)
 		return;
 
 	fd->enabled = false;
-	fd_epoll_remove(fd);
+	fd_update_cancel(fd);
+	fd_mux_remove(fd);
 }
 
 /**
@@ -1335,38 +2076,50 @@ void ev_fd_set_cb_data(struct ev_fd *fd, ev_fd_cb cb, void *data)
 	fd->data = data;
 }
 
+/**
+ * ev_fd_set_priority:
+ * @fd: FD object
+ * @priority: new priority (%EV_PRIO_HIGH, %EV_PRIO_NORMAL or %EV_PRIO_LOW)
+ *
+ * This changes the dispatch priority of @fd. Within one dispatch round all
+ * pending events of higher-priority sources are delivered before any event
+ * of lower-priority sources. New sources default to %EV_PRIO_NORMAL.
+ */
+SHL_EXPORT
+void ev_fd_set_priority(struct ev_fd *fd, int priority)
+{
+	if (!fd)
+		return;
+
+	fd->priority = priority;
+}
+
 /**
  * ev_fd_update:
  * @fd: FD object
  * @mask: Bitmask of %EV_READABLE and %EV_WRITEABLE
  *
- * This resets the event mask of @fd to @mask.
+ * This resets the event mask of @fd to @mask. The update is not pushed into
+ * the kernel immediately but batched and applied right before the event loop
+ * polls again; repeated mask changes within one dispatch round therefore cost
+ * at most one syscall. Errors while applying the batched update are logged.
  *
  * Returns: 0 on success, otherwise negative error code
  */
 SHL_EXPORT
 int ev_fd_update(struct ev_fd *fd, int mask)
 {
-	int ret;
-	int omask;
-
 	if (!fd)
 		return -EINVAL;
 	if (fd->mask == mask && !(mask & EV_ET))
 		return 0;
 
-	omask = fd->mask;
 	fd->mask = mask;
 
-	if (!fd->enabled)
+	if (!fd->enabled || !fd->loop)
 		return 0;
 
-	ret = fd_epoll_update(fd);
-	if (ret) {
-		fd->mask = omask;
-		return ret;
-	}
-
+	fd_update_queue(fd);
 	return 0;
 }
 
@@ -1438,7 +2191,7 @@ int ev_eloop_add_fd(struct ev_eloop *loop, struct ev_fd *fd)
 	fd->loop = loop;
 
 	if (fd->enabled) {
-		ret = fd_epoll_add(fd);
+		ret = fd_mux_add(fd);
 		if (ret) {
 			fd->loop = NULL;
 			return ret;
@@ -1470,8 +2223,9 @@ void ev_eloop_rm_fd(struct ev_fd *fd)
 		return;
 
 	loop = fd->loop;
+	fd_update_cancel(fd);
 	if (fd->enabled)
-		fd_epoll_remove(fd);
+		fd_mux_remove(fd);
 
 	/*
 	 * If we are currently dispatching events, we need to remove ourself
@@ -1499,69 +2253,279 @@ void ev_eloop_rm_fd(struct ev_fd *fd)
  * was last called (in case the application couldn't call the callback fast
  * enough). The timeout can be specified with nano-seconds precision. However,
  * real precision depends on the operating-system and hardware.
+ *
+ * All timers of one event loop share a single timerfd. Armed timers are kept
+ * in a binary min-heap ordered by their wakeup-time and the timerfd is always
+ * programmed to the earliest wakeup. When it fires, every timer whose deadline
+ * has passed is dispatched, so deadlines that are close together cost only one
+ * wakeup. The wakeup-time of a timer is its deadline plus an optional slack
+ * (see ev_timer_set_slack()); a timer with slack may be delayed by up to that
+ * amount so it can ride along with an earlier wakeup of another timer.
  */
 
-static int timer_drain(struct ev_timer *timer, uint64_t *out)
+static uint64_t timer_now(void)
 {
-	int len;
-	uint64_t expirations;
+	struct timespec ts;
 
-	if (out)
-		*out = 0;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
 
-	len = read(timer->fd, &expirations, sizeof(expirations));
-	if (len < 0) {
-		if (errno == EAGAIN) {
-			return 0;
-		} else {
-			llog_warning(timer, "cannot read timerfd (%d): %m",
-				     errno);
-			return errno;
-		}
-	} else if (len == 0) {
-		llog_warning(timer, "EOF on timer source");
-		return -EFAULT;
-	} else if (len != sizeof(expirations)) {
-		llog_warn(timer, "invalid size %d read on timerfd", len);
-		return -EFAULT;
-	} else {
-		if (out)
-			*out = expirations;
-		return 0;
+static uint64_t timer_wakeup(struct ev_timer *timer)
+{
+	return timer->deadline + timer->slack;
+}
+
+static int timer_arm(struct ev_timer *timer, const struct itimerspec *spec)
+{
+	uint64_t value;
+
+	if (spec->it_value.tv_nsec < 0 ||
+	    spec->it_value.tv_nsec >= 1000000000LL ||
+	    spec->it_interval.tv_nsec < 0 ||
+	    spec->it_interval.tv_nsec >= 1000000000LL)
+		return llog_EINVAL(timer);
+
+	value = spec->it_value.tv_sec * 1000000000ULL +
+		spec->it_value.tv_nsec;
+	timer->interval = spec->it_interval.tv_sec * 1000000000ULL +
+			  spec->it_interval.tv_nsec;
+	timer->deadline = value ? timer_now() + value : 0;
+
+	return 0;
+}
+
+static int timer_queue(struct ev_eloop *loop, struct ev_timer *timer)
+{
+	struct ev_timer **heap;
+	size_t i, size;
+
+	if (loop->timer_num + 1 >= loop->timer_size) {
+		size = loop->timer_size ? loop->timer_size * 2 : 16;
+		heap = realloc(loop->timer_heap, sizeof(*heap) * size);
+		if (!heap)
+			return llog_ENOMEM(loop);
+		loop->timer_heap = heap;
+		loop->timer_size = size;
+	}
+
+	i = ++loop->timer_num;
+	while (i > 1 && timer_wakeup(timer) <
+			timer_wakeup(loop->timer_heap[i / 2])) {
+		loop->timer_heap[i] = loop->timer_heap[i / 2];
+		loop->timer_heap[i]->heap_idx = i;
+		i /= 2;
+	}
+	loop->timer_heap[i] = timer;
+	timer->heap_idx = i;
+
+	return 0;
+}
+
+static void timer_dequeue(struct ev_eloop *loop, struct ev_timer *timer)
+{
+	struct ev_timer *last;
+	size_t i, child;
+
+	i = timer->heap_idx;
+	timer->heap_idx = 0;
+	last = loop->timer_heap[loop->timer_num--];
+	if (last == timer)
+		return;
+
+	/* sift the detached tail-entry down from the vacated slot... */
+	while ((child = i * 2) <= loop->timer_num) {
+		if (child < loop->timer_num &&
+		    timer_wakeup(loop->timer_heap[child + 1]) <
+		    timer_wakeup(loop->timer_heap[child]))
+			++child;
+		if (timer_wakeup(last) <=
+		    timer_wakeup(loop->timer_heap[child]))
+			break;
+		loop->timer_heap[i] = loop->timer_heap[child];
+		loop->timer_heap[i]->heap_idx = i;
+		i = child;
+	}
+
+	/* ...and up, in case the slot was in an unrelated subtree */
+	while (i > 1 && timer_wakeup(last) <
+			timer_wakeup(loop->timer_heap[i / 2])) {
+		loop->timer_heap[i] = loop->timer_heap[i / 2];
+		loop->timer_heap[i]->heap_idx = i;
+		i /= 2;
 	}
+
+	loop->timer_heap[i] = last;
+	last->heap_idx = i;
 }
 
-static void timer_cb(struct ev_fd *fd, int mask, void *data)
+static void timer_rearm(struct ev_eloop *loop)
 {
-	struct ev_timer *timer = data;
-	uint64_t expirations;
+	struct itimerspec spec;
+	uint64_t wakeup;
 	int ret;
 
+	if (loop->timer_fd < 0)
+		return;
+
+	memset(&spec, 0, sizeof(spec));
+	if (loop->timer_num) {
+		wakeup = timer_wakeup(loop->timer_heap[1]);
+		spec.it_value.tv_sec = wakeup / 1000000000ULL;
+		spec.it_value.tv_nsec = wakeup % 1000000000ULL;
+	}
+
+	ret = timerfd_settime(loop->timer_fd, TFD_TIMER_ABSTIME, &spec, NULL);
+	if (ret)
+		llog_warning(loop, "cannot set timerfd (%d): %m", errno);
+}
+
+static int timer_sync(struct ev_timer *timer)
+{
+	struct ev_eloop *loop = timer->loop;
+	int ret = 0;
+
+	if (!loop)
+		return 0;
+
+	if (timer->heap_idx)
+		timer_dequeue(loop, timer);
+	if (timer->enabled && timer->deadline)
+		ret = timer_queue(loop, timer);
+	timer_rearm(loop);
+
+	return ret;
+}
+
+static void timer_fd_event(struct ev_fd *fd, int mask, void *data)
+{
+	struct ev_eloop *loop = data;
+	struct ev_timer *timer;
+	uint64_t now, expirations, buf;
+	size_t i;
+
 	if (mask & (EV_HUP | EV_ERR)) {
 		llog_warn(fd, "HUP/ERR on timer source");
-		goto err_cb;
+		return;
 	}
 
 	if (mask & EV_READABLE) {
-		ret = timer_drain(timer, &expirations);
-		if (ret)
-			goto err_cb;
-		if (expirations > 0) {
-			if (timer->cb)
-				timer->cb(timer, expirations, timer->data);
+		if (read(loop->timer_fd, &buf, sizeof(buf)) < 0 &&
+		    errno != EAGAIN)
+			llog_warning(loop, "cannot read timerfd (%d): %m",
+				     errno);
+	}
+
+	now = timer_now();
+
+	/*
+	 * Dispatch every timer whose deadline has passed, not just the one
+	 * the timerfd was programmed for; this is what coalesces wakeups.
+	 * Callbacks may add, remove or re-arm arbitrary timers, so restart
+	 * the scan after each one. This always terminates as dispatched
+	 * timers get their deadline pushed past @now or are dequeued.
+	 */
+rescan:
+	for (i = 1; i <= loop->timer_num; ++i) {
+		timer = loop->timer_heap[i];
+		if (timer->deadline > now)
+			continue;
+
+		if (timer->interval) {
+			expirations = 1 + (now - timer->deadline) /
+					  timer->interval;
+			timer->deadline += expirations * timer->interval;
+			timer_dequeue(loop, timer);
+			timer_queue(loop, timer);
+		} else {
+			expirations = 1;
+			timer->deadline = 0;
+			timer_dequeue(loop, timer);
 		}
+
+		ev_timer_ref(timer);
+		if (timer->cb)
+			timer->cb(timer, expirations, timer->data);
+		ev_timer_unref(timer);
+
+		goto rescan;
+	}
+
+	timer_rearm(loop);
+}
+
+static int timer_ensure_fd(struct ev_eloop *loop)
+{
+	int ret;
+
+	if (loop->timer_fd >= 0)
+		return 0;
+
+	loop->timer_fd = timerfd_create(CLOCK_MONOTONIC,
+					TFD_CLOEXEC | TFD_NONBLOCK);
+	if (loop->timer_fd < 0) {
+		llog_error(loop, "cannot create timerfd (%d): %m", errno);
+		loop->timer_fd = -1;
+		return -EFAULT;
+	}
+
+	ret = ev_eloop_new_fd(loop, &loop->timer_efd, loop->timer_fd,
+			      EV_READABLE, timer_fd_event, loop);
+	if (ret) {
+		close(loop->timer_fd);
+		loop->timer_fd = -1;
+		return ret;
+	}
+
+	return 0;
+}
+
+static void timer_drop_fd(struct ev_eloop *loop)
+{
+	int fd;
+
+	if (loop->timer_fd < 0)
+		return;
+
+	fd = loop->timer_fd;
+	loop->timer_fd = -1;
+	ev_eloop_rm_fd(loop->timer_efd);
+	loop->timer_efd = NULL;
+	close(fd);
+}
+
+static int timer_drain(struct ev_timer *timer, uint64_t *out)
+{
+	uint64_t now, expirations;
+
+	if (out)
+		*out = 0;
+
+	if (!timer->deadline)
+		return 0;
+
+	now = timer_now();
+	if (now < timer->deadline)
+		return 0;
+
+	if (timer->interval) {
+		expirations = 1 + (now - timer->deadline) / timer->interval;
+		timer->deadline += expirations * timer->interval;
+	} else {
+		expirations = 1;
+		timer->deadline = 0;
 	}
 
-	return;
+	if (out)
+		*out = expirations;
 
-err_cb:
-	ev_timer_disable(timer);
-	if (timer->cb)
-		timer->cb(timer, 0, timer->data);
+	return timer_sync(timer);
 }
 
 static const struct itimerspec ev_timer_zero;
 
+static struct shl_pool timer_pool = SHL_POOL_INIT(sizeof(struct ev_timer), 16);
+
 /**
  * ev_timer_new:
  * @out: Timer pointer where to store the new timer
@@ -1590,7 +2554,7 @@ int ev_timer_new(struct ev_timer **out, const struct itimerspec *spec,
 	if (!spec)
 		spec = &ev_timer_zero;
 
-	timer = malloc(sizeof(*timer));
+	timer = shl_pool_alloc(&timer_pool);
 	if (!timer)
 		return llog_dENOMEM(log, log_data);
 
@@ -1600,34 +2564,16 @@ int ev_timer_new(struct ev_timer **out, const struct itimerspec *spec,
 	timer->llog_data = log_data;
 	timer->cb = cb;
 	timer->data = data;
+	timer->enabled = true;
 
-	timer->fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
-	if (timer->fd < 0) {
-		llog_error(timer, "cannot create timerfd (%d): %m", errno);
-		ret = -EFAULT;
-		goto err_free;
-	}
-
-	ret = timerfd_settime(timer->fd, 0, spec, NULL);
+	ret = timer_arm(timer, spec);
 	if (ret) {
-		llog_warn(timer, "cannot set timerfd (%d): %m", errno);
-		ret = -EFAULT;
-		goto err_close;
+		shl_pool_free(&timer_pool, timer);
+		return ret;
 	}
 
-	ret = ev_fd_new(&timer->efd, timer->fd, EV_READABLE, timer_cb, timer,
-			timer->llog, timer->llog_data);
-	if (ret)
-		goto err_close;
-
 	*out = timer;
 	return 0;
-
-err_close:
-	close(timer->fd);
-err_free:
-	free(timer);
-	return ret;
 }
 
 /**
@@ -1663,17 +2609,15 @@ void ev_timer_unref(struct ev_timer *timer)
 	if (--timer->ref)
 		return;
 
-	ev_fd_unref(timer->efd);
-	close(timer->fd);
-	free(timer);
+	shl_pool_free(&timer_pool, timer);
 }
 
 /**
  * ev_timer_enable:
  * @timer: Timer object
  *
- * Enable the timer. This calls ev_fd_enable() on the fd that implements this
- * timer.
+ * Enable the timer. If it is armed, it is queued in the event loop again and
+ * may fire.
  *
  * Returns: 0 on success negative error code on failure
  */
@@ -1683,25 +2627,30 @@ int ev_timer_enable(struct ev_timer *timer)
 	if (!timer)
 		return -EINVAL;
 
-	return ev_fd_enable(timer->efd);
+	if (timer->enabled)
+		return 0;
+
+	timer->enabled = true;
+	return timer_sync(timer);
 }
 
 /**
  * ev_timer_disable:
  * @timer: Timer object
  *
- * Disable the timer. This calls ev_fd_disable() on the fd that implements this
- * timer.
+ * Disable the timer. It stays armed but will not fire until it is enabled
+ * again.
  *
  * Returns: 0 on success and negative error code on failure
  */
 SHL_EXPORT
 void ev_timer_disable(struct ev_timer *timer)
 {
-	if (!timer)
+	if (!timer || !timer->enabled)
 		return;
 
-	ev_fd_disable(timer->efd);
+	timer->enabled = false;
+	timer_sync(timer);
 }
 
 /**
@@ -1715,7 +2664,7 @@ void ev_timer_disable(struct ev_timer *timer)
 SHL_EXPORT
 bool ev_timer_is_enabled(struct ev_timer *timer)
 {
-	return timer && ev_fd_is_enabled(timer->efd);
+	return timer && timer->enabled;
 }
 
 /**
@@ -1729,7 +2678,7 @@ bool ev_timer_is_enabled(struct ev_timer *timer)
 SHL_EXPORT
 bool ev_timer_is_bound(struct ev_timer *timer)
 {
-	return timer && ev_fd_is_bound(timer->efd);
+	return timer && timer->loop;
 }
 
 /**
@@ -1751,6 +2700,26 @@ void ev_timer_set_cb_data(struct ev_timer *timer, ev_timer_cb cb, void *data)
 	timer->data = data;
 }
 
+/**
+ * ev_timer_set_slack:
+ * @timer: Timer object
+ * @slack: Slack in nanoseconds
+ *
+ * This allows the timer to fire up to @slack nanoseconds after its deadline
+ * so it can share a single wakeup with other timers that expire nearby. Use
+ * it for timers where exact timing does not matter, like cursor blinking.
+ * The default is 0, which keeps timerfd-like precision.
+ */
+SHL_EXPORT
+void ev_timer_set_slack(struct ev_timer *timer, uint64_t slack)
+{
+	if (!timer || timer->slack == slack)
+		return;
+
+	timer->slack = slack;
+	timer_sync(timer);
+}
+
 /**
  * ev_timer_update:
  * @timer: Timer object
@@ -1772,13 +2741,11 @@ int ev_timer_update(struct ev_timer *timer, const struct itimerspec *spec)
 	if (!spec)
 		spec = &ev_timer_zero;
 
-	ret = timerfd_settime(timer->fd, 0, spec, NULL);
-	if (ret) {
-		llog_warn(timer, "cannot set timerfd (%d): %m", errno);
-		return -EFAULT;
-	}
+	ret = timer_arm(timer, spec);
+	if (ret)
+		return ret;
 
-	return 0;
+	return timer_sync(timer);
 }
 
 /**
@@ -1789,8 +2756,6 @@ int ev_timer_update(struct ev_timer *timer, const struct itimerspec *spec)
  * This reads the current expiration-count from the timer object @timer and
  * saves it in @expirations (if it is non-NULL). This can be used to clear the
  * timer after an idle-period or similar.
- * Note that the timer_cb() callback function automatically calls this before
- * calling the user-supplied callback.
  *
  * Returns: 0 on success, negative error code on failure.
  */
@@ -1864,14 +2829,25 @@ int ev_eloop_add_timer(struct ev_eloop *loop, struct ev_timer *timer)
 	if (!timer)
 		return llog_EINVAL(loop);
 
-	if (ev_fd_is_bound(timer->efd))
+	if (timer->loop)
 		return -EALREADY;
 
-	ret = ev_eloop_add_fd(loop, timer->efd);
+	ret = timer_ensure_fd(loop);
 	if (ret)
 		return ret;
 
+	timer->loop = loop;
+	ret = timer_sync(timer);
+	if (ret) {
+		timer->loop = NULL;
+		if (!loop->timer_count)
+			timer_drop_fd(loop);
+		return ret;
+	}
+
+	++loop->timer_count;
 	ev_timer_ref(timer);
+	ev_eloop_ref(loop);
 	return 0;
 }
 
@@ -1885,11 +2861,24 @@ int ev_eloop_add_timer(struct ev_eloop *loop, struct ev_timer *timer)
 SHL_EXPORT
 void ev_eloop_rm_timer(struct ev_timer *timer)
 {
-	if (!timer || !ev_fd_is_bound(timer->efd))
+	struct ev_eloop *loop;
+
+	if (!timer || !timer->loop)
 		return;
 
-	ev_eloop_rm_fd(timer->efd);
+	loop = timer->loop;
+	if (timer->heap_idx) {
+		timer_dequeue(loop, timer);
+		timer_rearm(loop);
+	}
+	timer->loop = NULL;
+
+	/* the shared timerfd pins the loop; drop it with the last timer */
+	if (!--loop->timer_count)
+		timer_drop_fd(loop);
+
 	ev_timer_unref(timer);
+	ev_eloop_unref(loop);
 }
 
 /*
@@ -2396,17 +3385,7 @@ int ev_eloop_register_idle_cb(struct ev_eloop *eloop, ev_idle_cb cb,
 	else
 		ret = shl_hook_add_cast(eloop->idlers, cb, data, os);
 
-	if (ret)
-		return ret;
-
-	ret = write_eventfd(eloop->llog, eloop->llog_data, eloop->idle_fd, 1);
-	if (ret) {
-		llog_warning(eloop, "cannot increase eloop idle-counter");
-		shl_hook_rm_cast(eloop->idlers, cb, data);
-		return ret;
-	}
-
-	return 0;
+	return ret;
 }
 
 /**
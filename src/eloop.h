@@ -172,12 +172,33 @@ enum ev_eloop_flags {
 	EV_ET = 0x10,
 };
 
+/**
+ * ev_priority:
+ * @EV_PRIO_LOW: dispatched after all other sources
+ * @EV_PRIO_NORMAL: default priority
+ * @EV_PRIO_HIGH: dispatched before all other sources
+ *
+ * Within one dispatch round, events of high-priority fd sources are always
+ * delivered before normal ones and those before low-priority ones. Use this
+ * for latency-critical sources like keyboard input so they are not queued
+ * behind large bulk reads.
+ */
+enum ev_priority {
+	EV_PRIO_LOW = -1,
+	EV_PRIO_NORMAL = 0,
+	EV_PRIO_HIGH = 1,
+};
+
 int ev_eloop_new(struct ev_eloop **out, ev_log_t log, void *log_data);
 void ev_eloop_ref(struct ev_eloop *loop);
 void ev_eloop_unref(struct ev_eloop *loop);
 
 void ev_eloop_flush_fd(struct ev_eloop *loop, struct ev_fd *fd);
 int ev_eloop_dispatch(struct ev_eloop *loop, int timeout);
+uint64_t ev_eloop_now(struct ev_eloop *loop);
+void ev_eloop_set_coarse_clock(struct ev_eloop *loop, bool coarse);
+void ev_eloop_set_profile(struct ev_eloop *loop, bool enable);
+void ev_eloop_dump_profile(struct ev_eloop *loop);
 int ev_eloop_run(struct ev_eloop *loop, int timeout);
 void ev_eloop_exit(struct ev_eloop *loop);
 int ev_eloop_get_fd(struct ev_eloop *loop);
@@ -200,6 +221,7 @@ void ev_fd_disable(struct ev_fd *fd);
 bool ev_fd_is_enabled(struct ev_fd *fd);
 bool ev_fd_is_bound(struct ev_fd *fd);
 void ev_fd_set_cb_data(struct ev_fd *fd, ev_fd_cb cb, void *data);
+void ev_fd_set_priority(struct ev_fd *fd, int priority);
 int ev_fd_update(struct ev_fd *fd, int mask);
 
 int ev_eloop_new_fd(struct ev_eloop *loop, struct ev_fd **out, int rfd,
@@ -219,6 +241,7 @@ void ev_timer_disable(struct ev_timer *timer);
 bool ev_timer_is_enabled(struct ev_timer *timer);
 bool ev_timer_is_bound(struct ev_timer *timer);
 void ev_timer_set_cb_data(struct ev_timer *timer, ev_timer_cb cb, void *data);
+void ev_timer_set_slack(struct ev_timer *timer, uint64_t slack);
 int ev_timer_update(struct ev_timer *timer, const struct itimerspec *spec);
 int ev_timer_drain(struct ev_timer *timer, uint64_t *expirations);
 
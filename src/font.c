@@ -59,6 +59,7 @@
 #include "font.h"
 #include "kmscon_module.h"
 #include "shl_dlist.h"
+#include "shl_hook.h"
 #include "shl_log.h"
 #include "shl_misc.h"
 #include "shl_register.h"
@@ -67,6 +68,21 @@
 
 static struct shl_register font_reg = SHL_REGISTER_INIT(font_reg);
 
+/*
+ * Global font cache
+ * All loaded fonts are linked into a process-wide list keyed by backend and
+ * requested attributes. Repeated lookups with matching attributes share one
+ * font object and thus one glyph storage, so glyph memory scales with the
+ * used glyph set instead of the number of displays or seats.
+ */
+static pthread_mutex_t font_mutex = PTHREAD_MUTEX_INITIALIZER;
+static struct shl_dlist font__list = SHL_DLIST_INIT(font__list);
+
+/* protects the ready-hooks of all fonts; separate from font_mutex as the
+ * hooks are called from backend worker threads which must not contend with
+ * font lookups */
+static pthread_mutex_t ready_mutex = PTHREAD_MUTEX_INITIALIZER;
+
 /**
  * kmscon_font_attr_normalize:
  * @attr: Attribute to normalize
@@ -193,26 +209,71 @@ void kmscon_font_unregister(const char *name)
 	shl_register_remove(&font_reg, name);
 }
 
-static int new_font(struct kmscon_font *font,
+static struct kmscon_font *find_cached(const struct kmscon_font_ops *ops,
+				       const struct kmscon_font_attr *attr)
+{
+	struct shl_dlist *iter;
+	struct kmscon_font *font;
+
+	shl_dlist_for_each(iter, &font__list) {
+		font = shl_dlist_entry(iter, struct kmscon_font, list);
+		if (font->ops == ops &&
+		    kmscon_font_attr_match(&font->req_attr, attr)) {
+			++font->ref;
+			return font;
+		}
+	}
+
+	return NULL;
+}
+
+static int new_font(struct kmscon_font **out,
 		    const struct kmscon_font_attr *attr, const char *backend)
 {
 	struct shl_register_record *record;
+	struct kmscon_font *font;
 	const char *name = backend ? backend : "<default>";
 	int ret;
 
-	memset(font, 0, sizeof(*font));
-	font->ref = 1;
-
 	if (backend)
 		record = shl_register_find(&font_reg, backend);
 	else
 		record = shl_register_first(&font_reg);
 
+	/* the backend may live in a module that is loaded on demand */
+	if (!record && backend && !kmscon_load_module(backend))
+		record = shl_register_find(&font_reg, backend);
+
 	if (!record) {
 		log_error("requested backend '%s' not found", name);
 		return -ENOENT;
 	}
 
+	font = find_cached(record->data, attr);
+	if (font) {
+		shl_register_record_unref(record);
+		*out = font;
+		return 0;
+	}
+
+	font = malloc(sizeof(*font));
+	if (!font) {
+		log_error("cannot allocate memory for new font");
+		shl_register_record_unref(record);
+		return -ENOMEM;
+	}
+	memset(font, 0, sizeof(*font));
+	font->ref = 1;
+	memcpy(&font->req_attr, attr, sizeof(*attr));
+
+	ret = shl_hook_new(&font->ready_hook);
+	if (ret) {
+		log_error("cannot allocate ready-hook");
+		shl_register_record_unref(record);
+		free(font);
+		return ret;
+	}
+
 	font->record = record;
 	font->ops = record->data;
 
@@ -224,9 +285,13 @@ static int new_font(struct kmscon_font *font,
 	if (ret) {
 		log_warning("backend %s cannot create font", name);
 		shl_register_record_unref(record);
+		shl_hook_free(font->ready_hook);
+		free(font);
 		return ret;
 	}
 
+	shl_dlist_link(&font__list, &font->list);
+	*out = font;
 	return 0;
 }
 
@@ -244,6 +309,11 @@ static int new_font(struct kmscon_font *font,
  * Stores a pointer to the new font in @out and returns 0. Otherwise, @out is
  * not touched and an error is returned.
  *
+ * Fonts are cached process-wide. If a font with the same backend and matching
+ * attributes was already loaded, the existing object is returned with an
+ * increased reference count. Hence, all displays and seats that use the same
+ * font-attributes share a single font object and a single glyph storage.
+ *
  * The attributes in @attr are not always matched. There are even font backends
  * which have only one fixed font and always return this one so you cannot rely
  * on this behavior. That is, this function cannot be used to get an exact
@@ -309,6 +379,7 @@ int kmscon_font_find(struct kmscon_font **out,
 		     const char *backend)
 {
 	struct kmscon_font *font;
+	struct kmscon_font_attr req;
 	int ret;
 
 	if (!out || !attr)
@@ -319,19 +390,20 @@ int kmscon_font_find(struct kmscon_font **out,
 		  attr->bold, attr->italic, attr->height,
 		  attr->width);
 
-	font = malloc(sizeof(*font));
-	if (!font) {
-		log_error("cannot allocate memory for new font");
-		return -ENOMEM;
-	}
+	/* normalize before matching so equivalent requests share one font */
+	memcpy(&req, attr, sizeof(req));
+	kmscon_font_attr_normalize(&req);
 
-	ret = new_font(font, attr, backend);
-	if (ret) {
-		if (backend)
-			ret = new_font(font, attr, NULL);
-		if (ret)
-			goto err_free;
-	}
+	pthread_mutex_lock(&font_mutex);
+
+	ret = new_font(&font, &req, backend);
+	if (ret && backend)
+		ret = new_font(&font, &req, NULL);
+
+	pthread_mutex_unlock(&font_mutex);
+
+	if (ret)
+		return ret;
 
 	log_debug("using: be: %s nm: %s ppi: %u pt: %u b: %d i: %d he: %u wt: %u",
 		  font->ops->name, font->attr.name, font->attr.ppi,
@@ -339,10 +411,6 @@ int kmscon_font_find(struct kmscon_font **out,
 		  font->attr.height, font->attr.width);
 	*out = font;
 	return 0;
-
-err_free:
-	free(font);
-	return ret;
 }
 
 /**
@@ -356,7 +424,9 @@ void kmscon_font_ref(struct kmscon_font *font)
 	if (!font || !font->ref)
 		return;
 
+	pthread_mutex_lock(&font_mutex);
 	++font->ref;
+	pthread_mutex_unlock(&font_mutex);
 }
 
 /**
@@ -368,16 +438,99 @@ void kmscon_font_ref(struct kmscon_font *font)
  */
 void kmscon_font_unref(struct kmscon_font *font)
 {
-	if (!font || !font->ref || --font->ref)
+	if (!font || !font->ref)
+		return;
+
+	pthread_mutex_lock(&font_mutex);
+	if (--font->ref) {
+		pthread_mutex_unlock(&font_mutex);
 		return;
+	}
+	shl_dlist_unlink(&font->list);
+	pthread_mutex_unlock(&font_mutex);
 
 	log_debug("freeing font");
 	if (font->ops->destroy)
 		font->ops->destroy(font);
 	shl_register_record_unref(font->record);
+	shl_hook_free(font->ready_hook);
 	free(font);
 }
 
+/**
+ * kmscon_font_register_ready_cb:
+ * @font: Valid font object
+ * @cb: Callback to call when deferred glyphs become available
+ * @data: User-supplied data passed to @cb
+ *
+ * Backends may rasterize glyphs asynchronously. In that case,
+ * kmscon_font_render() returns -EAGAIN and the caller should draw a
+ * replacement glyph instead (but must not cache it). Once the real glyph is
+ * available, all registered ready-callbacks are called so the caller can
+ * redraw the affected cells.
+ *
+ * Note that @cb may be called from a backend worker thread. It must only do
+ * thread-safe wake-ups (like incrementing an eloop-counter) and must not call
+ * back into the font API.
+ *
+ * Returns: 0 on success, negative error code on failure
+ */
+SHL_EXPORT
+int kmscon_font_register_ready_cb(struct kmscon_font *font,
+				  kmscon_font_ready_cb cb, void *data)
+{
+	int ret;
+
+	if (!font || !cb)
+		return -EINVAL;
+
+	pthread_mutex_lock(&ready_mutex);
+	ret = shl_hook_add_cast(font->ready_hook, cb, data, false);
+	pthread_mutex_unlock(&ready_mutex);
+
+	return ret;
+}
+
+/**
+ * kmscon_font_unregister_ready_cb:
+ * @font: Valid font object
+ * @cb: Callback that was passed to kmscon_font_register_ready_cb()
+ * @data: User-supplied data that was passed to kmscon_font_register_ready_cb()
+ *
+ * Removes a previously registered ready-callback. After this returns, @cb is
+ * guaranteed to no longer be called, even from backend worker threads.
+ */
+SHL_EXPORT
+void kmscon_font_unregister_ready_cb(struct kmscon_font *font,
+				     kmscon_font_ready_cb cb, void *data)
+{
+	if (!font || !cb)
+		return;
+
+	pthread_mutex_lock(&ready_mutex);
+	shl_hook_rm_cast(font->ready_hook, cb, data);
+	pthread_mutex_unlock(&ready_mutex);
+}
+
+/**
+ * kmscon_font_ready:
+ * @font: Valid font object
+ *
+ * Called by font backends when a glyph that was deferred with -EAGAIN became
+ * available. This invokes all registered ready-callbacks. Backends may call
+ * this from their worker threads.
+ */
+SHL_EXPORT
+void kmscon_font_ready(struct kmscon_font *font)
+{
+	if (!font)
+		return;
+
+	pthread_mutex_lock(&ready_mutex);
+	shl_hook_call(font->ready_hook, font, NULL);
+	pthread_mutex_unlock(&ready_mutex);
+}
+
 /**
  * kmscon_font_render:
  * @font: Valid font object
@@ -391,6 +544,10 @@ void kmscon_font_unref(struct kmscon_font *font)
  * is cached internally and removed when the last reference to this font is
  * dropped.
  * If the glyph is no available in this font-set, then -ERANGE is returned.
+ * If the backend rasterizes the glyph in the background, -EAGAIN is returned;
+ * the caller should draw a replacement glyph but must not cache it under the
+ * requested ID. See kmscon_font_register_ready_cb() for how to get notified
+ * once the glyph is available.
  *
  * Returns: 0 on success, negative error code on failure
  */
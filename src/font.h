@@ -33,6 +33,7 @@
 #include <errno.h>
 #include <stdlib.h>
 #include "kmscon_module.h"
+#include "shl_dlist.h"
 #include "uterm_video.h"
 
 /* fonts */
@@ -42,6 +43,9 @@ struct kmscon_glyph;
 struct kmscon_font;
 struct kmscon_font_ops;
 
+typedef void (*kmscon_font_ready_cb) (struct kmscon_font *font, void *unused,
+				      void *data);
+
 #define KMSCON_FONT_MAX_NAME 128
 #define KMSCON_FONT_DEFAULT_NAME "monospace"
 #define KMSCON_FONT_DEFAULT_PPI 72
@@ -68,10 +72,21 @@ struct kmscon_glyph {
 
 struct kmscon_font {
 	unsigned long ref;
+	struct shl_dlist list;
 	struct shl_register_record *record;
 	const struct kmscon_font_ops *ops;
 	struct kmscon_font_attr attr;
+	/* attributes the font was requested with; used as cache key as the
+	 * backend may adjust @attr to the real font metrics */
+	struct kmscon_font_attr req_attr;
 	unsigned int baseline;
+	struct shl_hook *ready_hook;
+	/* glyph-cache statistics; only maintained by backends that cache
+	 * rendered glyphs, table-based backends leave them at zero */
+	struct {
+		uint64_t hits;
+		uint64_t misses;
+	} stats;
 	void *data;
 };
 
@@ -99,6 +114,12 @@ int kmscon_font_find(struct kmscon_font **out,
 void kmscon_font_ref(struct kmscon_font *font);
 void kmscon_font_unref(struct kmscon_font *font);
 
+int kmscon_font_register_ready_cb(struct kmscon_font *font,
+				  kmscon_font_ready_cb cb, void *data);
+void kmscon_font_unregister_ready_cb(struct kmscon_font *font,
+				     kmscon_font_ready_cb cb, void *data);
+void kmscon_font_ready(struct kmscon_font *font);
+
 int kmscon_font_render(struct kmscon_font *font,
 		       uint32_t id, const uint32_t *ch, size_t len,
 		       const struct kmscon_glyph **out);
@@ -40,11 +40,14 @@
  *
  * There is also no sophisticated font handling in here so this should only be
  * used as last fallback when external libraries failed. However, this also
- * means this backend is _very_ fast as no rendering is needed. Everything is
- * pre-rendered. See the big array at the end of this file for the bitmap.
+ * means this backend is _very_ fast as no rendering is needed. The glyphs are
+ * stored bit-packed (see the array at the end of this file) and expanded to
+ * the 8bit-grey format the renderers expect exactly once on first use.
  */
 
 #include <errno.h>
+#include <pthread.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include "font.h"
@@ -53,8 +56,10 @@
 
 #define LOG_SUBSYSTEM "font_8x16"
 
-/* forward declaration; see end of file for real array */
-static const struct kmscon_glyph kmscon_font_8x16_glyphs[256];
+/* see end of file for the bitmap and the expansion helper */
+static struct kmscon_glyph kmscon_font_8x16_glyphs[256];
+static pthread_once_t expand_once = PTHREAD_ONCE_INIT;
+static void expand_glyphs(void);
 
 static int kmscon_font_8x16_init(struct kmscon_font *out,
 				 const struct kmscon_font_attr *attr)
@@ -63,6 +68,8 @@ static int kmscon_font_8x16_init(struct kmscon_font *out,
 
 	log_debug("loading static 8x16 font");
 
+	pthread_once(&expand_once, expand_glyphs);
+
 	memset(&out->attr, 0, sizeof(out->attr));
 	memcpy(out->attr.name, name, sizeof(name));
 	out->attr.bold = false;
@@ -115,11013 +122,815 @@ struct kmscon_font_ops kmscon_font_8x16_ops = {
 	.render_inval = kmscon_font_8x16_render_inval,
 };
 
-static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
-	{ /* 0 0x00 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 1 0x01 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 2 0x02 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 3 0x03 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 4 0x04 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 5 0x05 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 6 0x06 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 7 0x07 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 8 0x08 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-			},
-		},
-	},
-	{ /* 9 0x09 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 10 0x0a */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-			},
-		},
-	},
-	{ /* 11 0x0b */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 12 0x0c */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 13 0x0d */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 14 0x0e */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 15 0x0f */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 16 0x10 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 17 0x11 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 18 0x12 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 19 0x13 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 20 0x14 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 21 0x15 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 22 0x16 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 23 0x17 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 24 0x18 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 25 0x19 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 26 0x1a */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 27 0x1b */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 28 0x1c */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 29 0x1d */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 30 0x1e */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 31 0x1f */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 32 0x20 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 33 0x21 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 34 0x22 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 35 0x23 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 36 0x24 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 37 0x25 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 38 0x26 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 39 0x27 '*/
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 40 0x28 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 41 0x29 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 42 0x2a */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 43 0x2b */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 44 0x2c */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 45 0x2d */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 46 0x2e */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 47 0x2f */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 48 0x30 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 49 0x31 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 50 0x32 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 51 0x33 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 52 0x34 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 53 0x35 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 54 0x36 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 55 0x37 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 56 0x38 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 57 0x39 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 58 0x3a */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 59 0x3b */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 60 0x3c */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 61 0x3d */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 62 0x3e */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 63 0x3f */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 64 0x40 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 65 0x41 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 66 0x42 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 67 0x43 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 68 0x44 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 69 0x45 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 70 0x46 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 71 0x47 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 72 0x48 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 73 0x49 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 74 0x4a */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 75 0x4b */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 76 0x4c */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 77 0x4d */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 78 0x4e */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 79 0x4f */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 80 0x50 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 81 0x51 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 82 0x52 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 83 0x53 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 84 0x54 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 85 0x55 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 86 0x56 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 87 0x57 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 88 0x58 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 89 0x59 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 90 0x5a */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 91 0x5b */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 92 0x5c */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 93 0x5d */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 94 0x5e */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 95 0x5f */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 96 0x60 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 97 0x61 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 98 0x62 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 99 0x63 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 100 0x64 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 101 0x65 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 102 0x66 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 103 0x67 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 104 0x68 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 105 0x69 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 106 0x6a */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 107 0x6b */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 108 0x6c */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 109 0x6d */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 110 0x6e */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 111 0x6f */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 112 0x70 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 113 0x71 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 114 0x72 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 115 0x73 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 116 0x74 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 117 0x75 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 118 0x76 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 119 0x77 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 120 0x78 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 121 0x79 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 122 0x7a */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 123 0x7b */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 124 0x7c */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 125 0x7d */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 126 0x7e */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 127 0x7f */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 128 0x80 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 129 0x81 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 130 0x82 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 131 0x83 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 132 0x84 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 133 0x85 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 134 0x86 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 135 0x87 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 136 0x88 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 137 0x89 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 138 0x8a */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 139 0x8b */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 140 0x8c */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 141 0x8d */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 142 0x8e */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 143 0x8f */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 144 0x90 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 145 0x91 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 146 0x92 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 147 0x93 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 148 0x94 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 149 0x95 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 150 0x96 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 151 0x97 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 152 0x98 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 153 0x99 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 154 0x9a */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 155 0x9b */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 156 0x9c */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 157 0x9d */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 158 0x9e */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 159 0x9f */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 160 0xa0 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 161 0xa1 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 162 0xa2 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 163 0xa3 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 164 0xa4 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 165 0xa5 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 166 0xa6 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 167 0xa7 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 168 0xa8 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 169 0xa9 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 170 0xaa */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 171 0xab */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 172 0xac */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 173 0xad */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 174 0xae */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 175 0xaf */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 176 0xb0 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 177 0xb1 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0xff, 0x00, 0xff, 0x00,
-			},
-		},
-	},
-	{ /* 178 0xb2 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-			},
-		},
-	},
-	{ /* 179 0xb3 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 180 0xb4 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 181 0xb5 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 182 0xb6 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-			},
-		},
-	},
-	{ /* 183 0xb7 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-			},
-		},
-	},
-	{ /* 184 0xb8 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 185 0xb9 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-			},
-		},
-	},
-	{ /* 186 0xba */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-			},
-		},
-	},
-	{ /* 187 0xbb */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-			},
-		},
-	},
-	{ /* 188 0xbc */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 189 0xbd */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 190 0xbe */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 191 0xbf */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 192 0xc0 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 193 0xc1 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 194 0xc2 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 195 0xc3 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 196 0xc4 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 197 0xc5 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 198 0xc6 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 199 0xc7 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-			},
-		},
-	},
-	{ /* 200 0xc8 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 201 0xc9 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-			},
-		},
-	},
-	{ /* 202 0xca */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 203 0xcb */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-			},
-		},
-	},
-	{ /* 204 0xcc */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-			},
-		},
-	},
-	{ /* 205 0xcd */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 206 0xce */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-			},
-		},
-	},
-	{ /* 207 0xcf */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 208 0xd0 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 209 0xd1 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 210 0xd2 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-			},
-		},
-	},
-	{ /* 211 0xd3 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 212 0xd4 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 213 0xd5 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 214 0xd6 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-			},
-		},
-	},
-	{ /* 215 0xd7 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-			},
-		},
-	},
-	{ /* 216 0xd8 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 217 0xd9 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 218 0xda */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 219 0xdb */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-			},
-		},
-	},
-	{ /* 220 0xdc */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-			},
-		},
-	},
-	{ /* 221 0xdd */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 222 0xde */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-			},
-		},
-	},
-	{ /* 223 0xdf */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 224 0xe0 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 225 0xe1 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 226 0xe2 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 227 0xe3 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 228 0xe4 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 229 0xe5 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 230 0xe6 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 231 0xe7 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 232 0xe8 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 233 0xe9 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 234 0xea */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 235 0xeb */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 236 0xec */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 237 0xed */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 238 0xee */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 239 0xef */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 240 0xf0 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 241 0xf1 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 242 0xf2 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 243 0xf3 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 244 0xf4 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 245 0xf5 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 246 0xf6 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 247 0xf7 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 248 0xf8 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 249 0xf9 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 250 0xfa */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 251 0xfb */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 252 0xfc */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 253 0xfd */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 254 0xfe */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 255 0xff */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
+/*
+ * The font bitmap. One bit per pixel, one byte per row, the most significant
+ * bit is the leftmost pixel.
+ */
+
+static const uint8_t kmscon_font_8x16_data[256][16] = {
+	/* 0 0x00 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 1 0x01 */
+	{ 0x00, 0x00, 0x7e, 0x81, 0xa5, 0x81, 0x81, 0xbd,
+	  0x99, 0x81, 0x81, 0x7e, 0x00, 0x00, 0x00, 0x00, },
+	/* 2 0x02 */
+	{ 0x00, 0x00, 0x7e, 0xff, 0xdb, 0xff, 0xff, 0xc3,
+	  0xe7, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, },
+	/* 3 0x03 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x6c, 0xfe, 0xfe, 0xfe,
+	  0xfe, 0x7c, 0x38, 0x10, 0x00, 0x00, 0x00, 0x00, },
+	/* 4 0x04 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x7c, 0xfe,
+	  0x7c, 0x38, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 5 0x05 */
+	{ 0x00, 0x00, 0x00, 0x18, 0x3c, 0x3c, 0xe7, 0xe7,
+	  0xe7, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, },
+	/* 6 0x06 */
+	{ 0x00, 0x00, 0x00, 0x18, 0x3c, 0x7e, 0xff, 0xff,
+	  0x7e, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, },
+	/* 7 0x07 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3c,
+	  0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 8 0x08 */
+	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xc3,
+	  0xc3, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, },
+	/* 9 0x09 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x66, 0x42,
+	  0x42, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 10 0x0a */
+	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x99, 0xbd,
+	  0xbd, 0x99, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, },
+	/* 11 0x0b */
+	{ 0x00, 0x00, 0x1e, 0x0e, 0x1a, 0x32, 0x78, 0xcc,
+	  0xcc, 0xcc, 0xcc, 0x78, 0x00, 0x00, 0x00, 0x00, },
+	/* 12 0x0c */
+	{ 0x00, 0x00, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x3c,
+	  0x18, 0x7e, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, },
+	/* 13 0x0d */
+	{ 0x00, 0x00, 0x3f, 0x33, 0x3f, 0x30, 0x30, 0x30,
+	  0x30, 0x70, 0xf0, 0xe0, 0x00, 0x00, 0x00, 0x00, },
+	/* 14 0x0e */
+	{ 0x00, 0x00, 0x7f, 0x63, 0x7f, 0x63, 0x63, 0x63,
+	  0x63, 0x67, 0xe7, 0xe6, 0xc0, 0x00, 0x00, 0x00, },
+	/* 15 0x0f */
+	{ 0x00, 0x00, 0x00, 0x18, 0x18, 0xdb, 0x3c, 0xe7,
+	  0x3c, 0xdb, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, },
+	/* 16 0x10 */
+	{ 0x00, 0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xfe, 0xf8,
+	  0xf0, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, },
+	/* 17 0x11 */
+	{ 0x00, 0x02, 0x06, 0x0e, 0x1e, 0x3e, 0xfe, 0x3e,
+	  0x1e, 0x0e, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, },
+	/* 18 0x12 */
+	{ 0x00, 0x00, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18,
+	  0x7e, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 19 0x13 */
+	{ 0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+	  0x66, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, },
+	/* 20 0x14 */
+	{ 0x00, 0x00, 0x7f, 0xdb, 0xdb, 0xdb, 0x7b, 0x1b,
+	  0x1b, 0x1b, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, },
+	/* 21 0x15 */
+	{ 0x00, 0x7c, 0xc6, 0x60, 0x38, 0x6c, 0xc6, 0xc6,
+	  0x6c, 0x38, 0x0c, 0xc6, 0x7c, 0x00, 0x00, 0x00, },
+	/* 22 0x16 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	  0xfe, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, },
+	/* 23 0x17 */
+	{ 0x00, 0x00, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18,
+	  0x7e, 0x3c, 0x18, 0x7e, 0x00, 0x00, 0x00, 0x00, },
+	/* 24 0x18 */
+	{ 0x00, 0x00, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18,
+	  0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, },
+	/* 25 0x19 */
+	{ 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	  0x18, 0x7e, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, },
+	/* 26 0x1a */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0c, 0xfe,
+	  0x0c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 27 0x1b */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x60, 0xfe,
+	  0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 28 0x1c */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0,
+	  0xc0, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 29 0x1d */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x6c, 0xfe,
+	  0x6c, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 30 0x1e */
+	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x38, 0x7c,
+	  0x7c, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 31 0x1f */
+	{ 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x7c, 0x7c,
+	  0x38, 0x38, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 32 0x20 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 33 0x21 */
+	{ 0x00, 0x00, 0x18, 0x3c, 0x3c, 0x3c, 0x18, 0x18,
+	  0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, },
+	/* 34 0x22 */
+	{ 0x00, 0x66, 0x66, 0x66, 0x24, 0x00, 0x00, 0x00,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 35 0x23 */
+	{ 0x00, 0x00, 0x00, 0x6c, 0x6c, 0xfe, 0x6c, 0x6c,
+	  0x6c, 0xfe, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, },
+	/* 36 0x24 */
+	{ 0x18, 0x18, 0x7c, 0xc6, 0xc2, 0xc0, 0x7c, 0x06,
+	  0x06, 0x86, 0xc6, 0x7c, 0x18, 0x18, 0x00, 0x00, },
+	/* 37 0x25 */
+	{ 0x00, 0x00, 0x00, 0x00, 0xc2, 0xc6, 0x0c, 0x18,
+	  0x30, 0x60, 0xc6, 0x86, 0x00, 0x00, 0x00, 0x00, },
+	/* 38 0x26 */
+	{ 0x00, 0x00, 0x38, 0x6c, 0x6c, 0x38, 0x76, 0xdc,
+	  0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, },
+	/* 39 0x27 '*/
+	{ 0x00, 0x30, 0x30, 0x30, 0x60, 0x00, 0x00, 0x00,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 40 0x28 */
+	{ 0x00, 0x00, 0x0c, 0x18, 0x30, 0x30, 0x30, 0x30,
+	  0x30, 0x30, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, },
+	/* 41 0x29 */
+	{ 0x00, 0x00, 0x30, 0x18, 0x0c, 0x0c, 0x0c, 0x0c,
+	  0x0c, 0x0c, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, },
+	/* 42 0x2a */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x3c, 0xff,
+	  0x3c, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 43 0x2b */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x7e,
+	  0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 44 0x2c */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	  0x00, 0x18, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, },
+	/* 45 0x2d */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 46 0x2e */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	  0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, },
+	/* 47 0x2f */
+	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x0c, 0x18,
+	  0x30, 0x60, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, },
+	/* 48 0x30 */
+	{ 0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xd6, 0xd6,
+	  0xc6, 0xc6, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, },
+	/* 49 0x31 */
+	{ 0x00, 0x00, 0x18, 0x38, 0x78, 0x18, 0x18, 0x18,
+	  0x18, 0x18, 0x18, 0x7e, 0x00, 0x00, 0x00, 0x00, },
+	/* 50 0x32 */
+	{ 0x00, 0x00, 0x7c, 0xc6, 0x06, 0x0c, 0x18, 0x30,
+	  0x60, 0xc0, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00, },
+	/* 51 0x33 */
+	{ 0x00, 0x00, 0x7c, 0xc6, 0x06, 0x06, 0x3c, 0x06,
+	  0x06, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, },
+	/* 52 0x34 */
+	{ 0x00, 0x00, 0x0c, 0x1c, 0x3c, 0x6c, 0xcc, 0xfe,
+	  0x0c, 0x0c, 0x0c, 0x1e, 0x00, 0x00, 0x00, 0x00, },
+	/* 53 0x35 */
+	{ 0x00, 0x00, 0xfe, 0xc0, 0xc0, 0xc0, 0xfc, 0x06,
+	  0x06, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, },
+	/* 54 0x36 */
+	{ 0x00, 0x00, 0x38, 0x60, 0xc0, 0xc0, 0xfc, 0xc6,
+	  0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, },
+	/* 55 0x37 */
+	{ 0x00, 0x00, 0xfe, 0xc6, 0x06, 0x06, 0x0c, 0x18,
+	  0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, },
+	/* 56 0x38 */
+	{ 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0xc6,
+	  0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, },
+	/* 57 0x39 */
+	{ 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7e, 0x06,
+	  0x06, 0x06, 0x0c, 0x78, 0x00, 0x00, 0x00, 0x00, },
+	/* 58 0x3a */
+	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00,
+	  0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 59 0x3b */
+	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00,
+	  0x00, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, },
+	/* 60 0x3c */
+	{ 0x00, 0x00, 0x00, 0x06, 0x0c, 0x18, 0x30, 0x60,
+	  0x30, 0x18, 0x0c, 0x06, 0x00, 0x00, 0x00, 0x00, },
+	/* 61 0x3d */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00,
+	  0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 62 0x3e */
+	{ 0x00, 0x00, 0x00, 0x60, 0x30, 0x18, 0x0c, 0x06,
+	  0x0c, 0x18, 0x30, 0x60, 0x00, 0x00, 0x00, 0x00, },
+	/* 63 0x3f */
+	{ 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0x0c, 0x18, 0x18,
+	  0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, },
+	/* 64 0x40 */
+	{ 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xde, 0xde,
+	  0xde, 0xdc, 0xc0, 0x7c, 0x00, 0x00, 0x00, 0x00, },
+	/* 65 0x41 */
+	{ 0x00, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe,
+	  0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, },
+	/* 66 0x42 */
+	{ 0x00, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x66,
+	  0x66, 0x66, 0x66, 0xfc, 0x00, 0x00, 0x00, 0x00, },
+	/* 67 0x43 */
+	{ 0x00, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc0,
+	  0xc0, 0xc2, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00, },
+	/* 68 0x44 */
+	{ 0x00, 0x00, 0xf8, 0x6c, 0x66, 0x66, 0x66, 0x66,
+	  0x66, 0x66, 0x6c, 0xf8, 0x00, 0x00, 0x00, 0x00, },
+	/* 69 0x45 */
+	{ 0x00, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68,
+	  0x60, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00, },
+	/* 70 0x46 */
+	{ 0x00, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68,
+	  0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00, },
+	/* 71 0x47 */
+	{ 0x00, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xde,
+	  0xc6, 0xc6, 0x66, 0x3a, 0x00, 0x00, 0x00, 0x00, },
+	/* 72 0x48 */
+	{ 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xfe, 0xc6,
+	  0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, },
+	/* 73 0x49 */
+	{ 0x00, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18,
+	  0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, },
+	/* 74 0x4a */
+	{ 0x00, 0x00, 0x1e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+	  0xcc, 0xcc, 0xcc, 0x78, 0x00, 0x00, 0x00, 0x00, },
+	/* 75 0x4b */
+	{ 0x00, 0x00, 0xe6, 0x66, 0x66, 0x6c, 0x78, 0x78,
+	  0x6c, 0x66, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00, },
+	/* 76 0x4c */
+	{ 0x00, 0x00, 0xf0, 0x60, 0x60, 0x60, 0x60, 0x60,
+	  0x60, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00, },
+	/* 77 0x4d */
+	{ 0x00, 0x00, 0xc6, 0xee, 0xfe, 0xfe, 0xd6, 0xc6,
+	  0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, },
+	/* 78 0x4e */
+	{ 0x00, 0x00, 0xc6, 0xe6, 0xf6, 0xfe, 0xde, 0xce,
+	  0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, },
+	/* 79 0x4f */
+	{ 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6,
+	  0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, },
+	/* 80 0x50 */
+	{ 0x00, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x60,
+	  0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00, },
+	/* 81 0x51 */
+	{ 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6,
+	  0xc6, 0xd6, 0xde, 0x7c, 0x0c, 0x0e, 0x00, 0x00, },
+	/* 82 0x52 */
+	{ 0x00, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x6c,
+	  0x66, 0x66, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00, },
+	/* 83 0x53 */
+	{ 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0x60, 0x38, 0x0c,
+	  0x06, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, },
+	/* 84 0x54 */
+	{ 0x00, 0x00, 0x7e, 0x7e, 0x5a, 0x18, 0x18, 0x18,
+	  0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, },
+	/* 85 0x55 */
+	{ 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6,
+	  0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, },
+	/* 86 0x56 */
+	{ 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6,
+	  0xc6, 0x6c, 0x38, 0x10, 0x00, 0x00, 0x00, 0x00, },
+	/* 87 0x57 */
+	{ 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xd6, 0xd6,
+	  0xd6, 0xfe, 0xee, 0x6c, 0x00, 0x00, 0x00, 0x00, },
+	/* 88 0x58 */
+	{ 0x00, 0x00, 0xc6, 0xc6, 0x6c, 0x7c, 0x38, 0x38,
+	  0x7c, 0x6c, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, },
+	/* 89 0x59 */
+	{ 0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18,
+	  0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, },
+	/* 90 0x5a */
+	{ 0x00, 0x00, 0xfe, 0xc6, 0x86, 0x0c, 0x18, 0x30,
+	  0x60, 0xc2, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00, },
+	/* 91 0x5b */
+	{ 0x00, 0x00, 0x3c, 0x30, 0x30, 0x30, 0x30, 0x30,
+	  0x30, 0x30, 0x30, 0x3c, 0x00, 0x00, 0x00, 0x00, },
+	/* 92 0x5c */
+	{ 0x00, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0x70, 0x38,
+	  0x1c, 0x0e, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, },
+	/* 93 0x5d */
+	{ 0x00, 0x00, 0x3c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+	  0x0c, 0x0c, 0x0c, 0x3c, 0x00, 0x00, 0x00, 0x00, },
+	/* 94 0x5e */
+	{ 0x10, 0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 95 0x5f */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, },
+	/* 96 0x60 */
+	{ 0x00, 0x30, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 97 0x61 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0c, 0x7c,
+	  0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, },
+	/* 98 0x62 */
+	{ 0x00, 0x00, 0xe0, 0x60, 0x60, 0x78, 0x6c, 0x66,
+	  0x66, 0x66, 0x66, 0x7c, 0x00, 0x00, 0x00, 0x00, },
+	/* 99 0x63 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0,
+	  0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, },
+	/* 100 0x64 */
+	{ 0x00, 0x00, 0x1c, 0x0c, 0x0c, 0x3c, 0x6c, 0xcc,
+	  0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, },
+	/* 101 0x65 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xfe,
+	  0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, },
+	/* 102 0x66 */
+	{ 0x00, 0x00, 0x1c, 0x36, 0x32, 0x30, 0x78, 0x30,
+	  0x30, 0x30, 0x30, 0x78, 0x00, 0x00, 0x00, 0x00, },
+	/* 103 0x67 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xcc, 0xcc,
+	  0xcc, 0xcc, 0xcc, 0x7c, 0x0c, 0xcc, 0x78, 0x00, },
+	/* 104 0x68 */
+	{ 0x00, 0x00, 0xe0, 0x60, 0x60, 0x6c, 0x76, 0x66,
+	  0x66, 0x66, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00, },
+	/* 105 0x69 */
+	{ 0x00, 0x00, 0x18, 0x18, 0x00, 0x38, 0x18, 0x18,
+	  0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, },
+	/* 106 0x6a */
+	{ 0x00, 0x00, 0x06, 0x06, 0x00, 0x0e, 0x06, 0x06,
+	  0x06, 0x06, 0x06, 0x06, 0x66, 0x66, 0x3c, 0x00, },
+	/* 107 0x6b */
+	{ 0x00, 0x00, 0xe0, 0x60, 0x60, 0x66, 0x6c, 0x78,
+	  0x78, 0x6c, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00, },
+	/* 108 0x6c */
+	{ 0x00, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18,
+	  0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, },
+	/* 109 0x6d */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0xfe, 0xd6,
+	  0xd6, 0xd6, 0xd6, 0xc6, 0x00, 0x00, 0x00, 0x00, },
+	/* 110 0x6e */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x66, 0x66,
+	  0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, },
+	/* 111 0x6f */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6,
+	  0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, },
+	/* 112 0x70 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x66, 0x66,
+	  0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xf0, 0x00, },
+	/* 113 0x71 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xcc, 0xcc,
+	  0xcc, 0xcc, 0xcc, 0x7c, 0x0c, 0x0c, 0x1e, 0x00, },
+	/* 114 0x72 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x76, 0x66,
+	  0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00, },
+	/* 115 0x73 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0x60,
+	  0x38, 0x0c, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, },
+	/* 116 0x74 */
+	{ 0x00, 0x00, 0x10, 0x30, 0x30, 0xfc, 0x30, 0x30,
+	  0x30, 0x30, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00, },
+	/* 117 0x75 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc,
+	  0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, },
+	/* 118 0x76 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6,
+	  0xc6, 0xc6, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, },
+	/* 119 0x77 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xd6,
+	  0xd6, 0xd6, 0xfe, 0x6c, 0x00, 0x00, 0x00, 0x00, },
+	/* 120 0x78 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x6c, 0x38,
+	  0x38, 0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00, },
+	/* 121 0x79 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6,
+	  0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x0c, 0xf8, 0x00, },
+	/* 122 0x7a */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xcc, 0x18,
+	  0x30, 0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00, },
+	/* 123 0x7b */
+	{ 0x00, 0x00, 0x0e, 0x18, 0x18, 0x18, 0x70, 0x18,
+	  0x18, 0x18, 0x18, 0x0e, 0x00, 0x00, 0x00, 0x00, },
+	/* 124 0x7c */
+	{ 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	  0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, },
+	/* 125 0x7d */
+	{ 0x00, 0x00, 0x70, 0x18, 0x18, 0x18, 0x0e, 0x18,
+	  0x18, 0x18, 0x18, 0x70, 0x00, 0x00, 0x00, 0x00, },
+	/* 126 0x7e */
+	{ 0x00, 0x76, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 127 0x7f */
+	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x6c, 0xc6,
+	  0xc6, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 128 0x80 */
+	{ 0x00, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc0,
+	  0xc0, 0xc2, 0x66, 0x3c, 0x18, 0x70, 0x00, 0x00, },
+	/* 129 0x81 */
+	{ 0x00, 0x00, 0xcc, 0x00, 0x00, 0xcc, 0xcc, 0xcc,
+	  0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, },
+	/* 130 0x82 */
+	{ 0x00, 0x0c, 0x18, 0x30, 0x00, 0x7c, 0xc6, 0xfe,
+	  0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, },
+	/* 131 0x83 */
+	{ 0x00, 0x10, 0x38, 0x6c, 0x00, 0x78, 0x0c, 0x7c,
+	  0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, },
+	/* 132 0x84 */
+	{ 0x00, 0x00, 0xcc, 0x00, 0x00, 0x78, 0x0c, 0x7c,
+	  0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, },
+	/* 133 0x85 */
+	{ 0x00, 0x60, 0x30, 0x18, 0x00, 0x78, 0x0c, 0x7c,
+	  0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, },
+	/* 134 0x86 */
+	{ 0x00, 0x38, 0x6c, 0x38, 0x00, 0x78, 0x0c, 0x7c,
+	  0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, },
+	/* 135 0x87 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0,
+	  0xc0, 0xc0, 0xc6, 0x7c, 0x18, 0x70, 0x00, 0x00, },
+	/* 136 0x88 */
+	{ 0x00, 0x10, 0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xfe,
+	  0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, },
+	/* 137 0x89 */
+	{ 0x00, 0x00, 0xc6, 0x00, 0x00, 0x7c, 0xc6, 0xfe,
+	  0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, },
+	/* 138 0x8a */
+	{ 0x00, 0x60, 0x30, 0x18, 0x00, 0x7c, 0xc6, 0xfe,
+	  0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, },
+	/* 139 0x8b */
+	{ 0x00, 0x00, 0x66, 0x00, 0x00, 0x38, 0x18, 0x18,
+	  0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, },
+	/* 140 0x8c */
+	{ 0x00, 0x18, 0x3c, 0x66, 0x00, 0x38, 0x18, 0x18,
+	  0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, },
+	/* 141 0x8d */
+	{ 0x00, 0x60, 0x30, 0x18, 0x00, 0x38, 0x18, 0x18,
+	  0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, },
+	/* 142 0x8e */
+	{ 0x00, 0xc6, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6,
+	  0xfe, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, },
+	/* 143 0x8f */
+	{ 0x38, 0x6c, 0x38, 0x10, 0x38, 0x6c, 0xc6, 0xfe,
+	  0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, },
+	/* 144 0x90 */
+	{ 0x0c, 0x18, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78,
+	  0x68, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00, },
+	/* 145 0x91 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x36, 0x36,
+	  0x7e, 0xd8, 0xd8, 0x6e, 0x00, 0x00, 0x00, 0x00, },
+	/* 146 0x92 */
+	{ 0x00, 0x00, 0x3e, 0x6c, 0xcc, 0xcc, 0xfe, 0xcc,
+	  0xcc, 0xcc, 0xcc, 0xce, 0x00, 0x00, 0x00, 0x00, },
+	/* 147 0x93 */
+	{ 0x00, 0x10, 0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xc6,
+	  0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, },
+	/* 148 0x94 */
+	{ 0x00, 0x00, 0xc6, 0x00, 0x00, 0x7c, 0xc6, 0xc6,
+	  0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, },
+	/* 149 0x95 */
+	{ 0x00, 0x60, 0x30, 0x18, 0x00, 0x7c, 0xc6, 0xc6,
+	  0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, },
+	/* 150 0x96 */
+	{ 0x00, 0x30, 0x78, 0xcc, 0x00, 0xcc, 0xcc, 0xcc,
+	  0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, },
+	/* 151 0x97 */
+	{ 0x00, 0x60, 0x30, 0x18, 0x00, 0xcc, 0xcc, 0xcc,
+	  0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, },
+	/* 152 0x98 */
+	{ 0x00, 0x00, 0xc6, 0x00, 0x00, 0xc6, 0xc6, 0xc6,
+	  0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x0c, 0x78, 0x00, },
+	/* 153 0x99 */
+	{ 0x00, 0xc6, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6,
+	  0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, },
+	/* 154 0x9a */
+	{ 0x00, 0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6,
+	  0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, },
+	/* 155 0x9b */
+	{ 0x00, 0x18, 0x18, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0,
+	  0xc6, 0x7c, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, },
+	/* 156 0x9c */
+	{ 0x00, 0x38, 0x6c, 0x64, 0x60, 0xf0, 0x60, 0x60,
+	  0x60, 0x60, 0xe6, 0xfc, 0x00, 0x00, 0x00, 0x00, },
+	/* 157 0x9d */
+	{ 0x00, 0x00, 0x66, 0x66, 0x3c, 0x18, 0x7e, 0x18,
+	  0x7e, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, },
+	/* 158 0x9e */
+	{ 0x00, 0xf8, 0xcc, 0xcc, 0xf8, 0xc4, 0xcc, 0xde,
+	  0xcc, 0xcc, 0xcc, 0xc6, 0x00, 0x00, 0x00, 0x00, },
+	/* 159 0x9f */
+	{ 0x00, 0x0e, 0x1b, 0x18, 0x18, 0x18, 0x7e, 0x18,
+	  0x18, 0x18, 0xd8, 0x70, 0x00, 0x00, 0x00, 0x00, },
+	/* 160 0xa0 */
+	{ 0x00, 0x18, 0x30, 0x60, 0x00, 0x78, 0x0c, 0x7c,
+	  0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, },
+	/* 161 0xa1 */
+	{ 0x00, 0x0c, 0x18, 0x30, 0x00, 0x38, 0x18, 0x18,
+	  0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, },
+	/* 162 0xa2 */
+	{ 0x00, 0x18, 0x30, 0x60, 0x00, 0x7c, 0xc6, 0xc6,
+	  0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, },
+	/* 163 0xa3 */
+	{ 0x00, 0x18, 0x30, 0x60, 0x00, 0xcc, 0xcc, 0xcc,
+	  0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, },
+	/* 164 0xa4 */
+	{ 0x00, 0x00, 0x76, 0xdc, 0x00, 0xdc, 0x66, 0x66,
+	  0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, },
+	/* 165 0xa5 */
+	{ 0x76, 0xdc, 0x00, 0xc6, 0xe6, 0xf6, 0xfe, 0xde,
+	  0xce, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, },
+	/* 166 0xa6 */
+	{ 0x00, 0x00, 0x3c, 0x6c, 0x6c, 0x3e, 0x00, 0x7e,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 167 0xa7 */
+	{ 0x00, 0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x7c,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 168 0xa8 */
+	{ 0x00, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x60,
+	  0xc0, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, },
+	/* 169 0xa9 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0,
+	  0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 170 0xaa */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06,
+	  0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 171 0xab */
+	{ 0x00, 0x60, 0xe0, 0x62, 0x66, 0x6c, 0x18, 0x30,
+	  0x60, 0xdc, 0x86, 0x0c, 0x18, 0x3e, 0x00, 0x00, },
+	/* 172 0xac */
+	{ 0x00, 0x60, 0xe0, 0x62, 0x66, 0x6c, 0x18, 0x30,
+	  0x66, 0xce, 0x9a, 0x3f, 0x06, 0x06, 0x00, 0x00, },
+	/* 173 0xad */
+	{ 0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18,
+	  0x3c, 0x3c, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, },
+	/* 174 0xae */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x6c, 0xd8,
+	  0x6c, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 175 0xaf */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x6c, 0x36,
+	  0x6c, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 176 0xb0 */
+	{ 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44,
+	  0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, },
+	/* 177 0xb1 */
+	{ 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa,
+	  0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, },
+	/* 178 0xb2 */
+	{ 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77,
+	  0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, },
+	/* 179 0xb3 */
+	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, },
+	/* 180 0xb4 */
+	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8,
+	  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, },
+	/* 181 0xb5 */
+	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0xf8,
+	  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, },
+	/* 182 0xb6 */
+	{ 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xf6,
+	  0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, },
+	/* 183 0xb7 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe,
+	  0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, },
+	/* 184 0xb8 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0xf8,
+	  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, },
+	/* 185 0xb9 */
+	{ 0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xf6,
+	  0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, },
+	/* 186 0xba */
+	{ 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+	  0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, },
+	/* 187 0xbb */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0xf6,
+	  0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, },
+	/* 188 0xbc */
+	{ 0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xfe,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 189 0xbd */
+	{ 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xfe,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 190 0xbe */
+	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0xf8,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 191 0xbf */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
+	  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, },
+	/* 192 0xc0 */
+	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 193 0xc1 */
+	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 194 0xc2 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+	  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, },
+	/* 195 0xc3 */
+	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f,
+	  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, },
+	/* 196 0xc4 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 197 0xc5 */
+	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff,
+	  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, },
+	/* 198 0xc6 */
+	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f,
+	  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, },
+	/* 199 0xc7 */
+	{ 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37,
+	  0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, },
+	/* 200 0xc8 */
+	{ 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x3f,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 201 0xc9 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x37,
+	  0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, },
+	/* 202 0xca */
+	{ 0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xff,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 203 0xcb */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xf7,
+	  0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, },
+	/* 204 0xcc */
+	{ 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x37,
+	  0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, },
+	/* 205 0xcd */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 206 0xce */
+	{ 0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xf7,
+	  0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, },
+	/* 207 0xcf */
+	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0xff,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 208 0xd0 */
+	{ 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xff,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 209 0xd1 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff,
+	  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, },
+	/* 210 0xd2 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+	  0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, },
+	/* 211 0xd3 */
+	{ 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x3f,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 212 0xd4 */
+	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 213 0xd5 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x1f,
+	  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, },
+	/* 214 0xd6 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f,
+	  0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, },
+	/* 215 0xd7 */
+	{ 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xff,
+	  0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, },
+	/* 216 0xd8 */
+	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0xff,
+	  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, },
+	/* 217 0xd9 */
+	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 218 0xda */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+	  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, },
+	/* 219 0xdb */
+	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, },
+	/* 220 0xdc */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+	  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, },
+	/* 221 0xdd */
+	{ 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	  0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, },
+	/* 222 0xde */
+	{ 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, },
+	/* 223 0xdf */
+	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 224 0xe0 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0xd8,
+	  0xd8, 0xd8, 0xdc, 0x76, 0x00, 0x00, 0x00, 0x00, },
+	/* 225 0xe1 */
+	{ 0x00, 0x00, 0x78, 0xcc, 0xcc, 0xcc, 0xd8, 0xcc,
+	  0xc6, 0xc6, 0xc6, 0xcc, 0x00, 0x00, 0x00, 0x00, },
+	/* 226 0xe2 */
+	{ 0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xc0, 0xc0, 0xc0,
+	  0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, },
+	/* 227 0xe3 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x6c, 0x6c,
+	  0x6c, 0x6c, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, },
+	/* 228 0xe4 */
+	{ 0x00, 0x00, 0xfe, 0xc6, 0x60, 0x30, 0x18, 0x18,
+	  0x30, 0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00, },
+	/* 229 0xe5 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xd8, 0xd8,
+	  0xd8, 0xd8, 0xd8, 0x70, 0x00, 0x00, 0x00, 0x00, },
+	/* 230 0xe6 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x66,
+	  0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xc0, 0x00, },
+	/* 231 0xe7 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0x18, 0x18,
+	  0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, },
+	/* 232 0xe8 */
+	{ 0x00, 0x00, 0x7e, 0x18, 0x3c, 0x66, 0x66, 0x66,
+	  0x66, 0x3c, 0x18, 0x7e, 0x00, 0x00, 0x00, 0x00, },
+	/* 233 0xe9 */
+	{ 0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6,
+	  0xc6, 0xc6, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, },
+	/* 234 0xea */
+	{ 0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0x6c,
+	  0x6c, 0x6c, 0x6c, 0xee, 0x00, 0x00, 0x00, 0x00, },
+	/* 235 0xeb */
+	{ 0x00, 0x00, 0x1e, 0x30, 0x18, 0x0c, 0x3e, 0x66,
+	  0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00, },
+	/* 236 0xec */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xdb, 0xdb,
+	  0xdb, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 237 0xed */
+	{ 0x00, 0x00, 0x00, 0x03, 0x06, 0x7e, 0xdb, 0xdb,
+	  0xf3, 0x7e, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00, },
+	/* 238 0xee */
+	{ 0x00, 0x00, 0x1c, 0x30, 0x60, 0x60, 0x7c, 0x60,
+	  0x60, 0x60, 0x30, 0x1c, 0x00, 0x00, 0x00, 0x00, },
+	/* 239 0xef */
+	{ 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6,
+	  0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, },
+	/* 240 0xf0 */
+	{ 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe,
+	  0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 241 0xf1 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x7e, 0x18,
+	  0x18, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, },
+	/* 242 0xf2 */
+	{ 0x00, 0x00, 0x00, 0x30, 0x18, 0x0c, 0x06, 0x0c,
+	  0x18, 0x30, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, },
+	/* 243 0xf3 */
+	{ 0x00, 0x00, 0x00, 0x0c, 0x18, 0x30, 0x60, 0x30,
+	  0x18, 0x0c, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, },
+	/* 244 0xf4 */
+	{ 0x00, 0x00, 0x0e, 0x1b, 0x1b, 0x18, 0x18, 0x18,
+	  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, },
+	/* 245 0xf5 */
+	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	  0x18, 0xd8, 0xd8, 0xd8, 0x70, 0x00, 0x00, 0x00, },
+	/* 246 0xf6 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x7e,
+	  0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 247 0xf7 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0x00,
+	  0x76, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 248 0xf8 */
+	{ 0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 249 0xf9 */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 250 0xfa */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 251 0xfb */
+	{ 0x00, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xec,
+	  0x6c, 0x6c, 0x3c, 0x1c, 0x00, 0x00, 0x00, 0x00, },
+	/* 252 0xfc */
+	{ 0x00, 0x6c, 0x36, 0x36, 0x36, 0x36, 0x36, 0x00,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 253 0xfd */
+	{ 0x00, 0x3c, 0x66, 0x0c, 0x18, 0x32, 0x7e, 0x00,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 254 0xfe */
+	{ 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x7e,
+	  0x7e, 0x7e, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, },
+	/* 255 0xff */
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, },
 };
+
+/*
+ * Glyph expansion
+ * The renderers expect 8bit-grey buffers, so the bit-packed rows above are
+ * expanded once on first font init. A 256-entry LUT maps each row byte to
+ * its ready-made 8-pixel span, which is then written with a single 8-byte
+ * store per glyph row.
+ */
+
+static uint64_t glyph_buffer[256 * 16];
+
+static void expand_glyphs(void)
+{
+	static uint64_t lut[256];
+	struct kmscon_glyph *g;
+	unsigned int i, j;
+	uint64_t *dst;
+
+	for (i = 0; i < 256; ++i)
+		for (j = 0; j < 8; ++j)
+			if (i & (0x80 >> j))
+				((uint8_t*)&lut[i])[j] = 0xff;
+
+	for (i = 0; i < 256; ++i) {
+		g = &kmscon_font_8x16_glyphs[i];
+		g->width = 1;
+		g->buf.width = 8;
+		g->buf.height = 16;
+		g->buf.stride = 8;
+		g->buf.format = UTERM_FORMAT_GREY;
+		g->buf.data = (uint8_t*)&glyph_buffer[i * 16];
+
+		dst = &glyph_buffer[i * 16];
+		for (j = 0; j < 16; ++j)
+			dst[j] = lut[kmscon_font_8x16_data[i][j]];
+	}
+}
@@ -34,6 +34,9 @@
  * font-face. Therefore, rendering should be very fast. Also, when loading a
  * glyph it pre-renders all common (mostly ASCII) characters, so it can measure
  * the font and return a valid font hight/width.
+ * Glyphs that are not cached yet are rasterized by a background worker; the
+ * render callback returns -EAGAIN until the glyph is done and then notifies
+ * the font owner via kmscon_font_ready().
  *
  * This is a _full_ font backend, that is, it provides every feature you expect
  * from a font renderer. It does glyph substitution if a specific font face does
@@ -44,18 +47,25 @@
  */
 
 #include <errno.h>
+#include <fcntl.h>
 #include <glib.h>
+#include <inttypes.h>
 #include <libtsm.h>
 #include <pango/pango.h>
 #include <pango/pangoft2.h>
 #include <pthread.h>
 #include <stdbool.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include "font.h"
+#include "mem.h"
 #include "shl_dlist.h"
-#include "shl_hashtable.h"
+#include "shl_hashmap.h"
 #include "shl_log.h"
+#include "shl_sched.h"
 #include "uterm_video.h"
 
 #define LOG_SUBSYSTEM "font_pango"
@@ -68,14 +78,38 @@ struct face {
 	struct kmscon_font_attr real_attr;
 	unsigned int baseline;
 	PangoContext *ctx;
+	/* shared shaping layout; protected by the manager lock */
+	PangoLayout *layout;
 	pthread_mutex_t glyph_lock;
-	struct shl_hashtable *glyphs;
+	struct shl_hashmap *glyphs;
+	/* IDs queued for background rasterization; protected by glyph_lock */
+	struct shl_hashmap *pending;
+	/* single-codepoint glyphs eligible for the on-disk bitmap cache;
+	 * protected by glyph_lock */
+	uint32_t *persist;
+	unsigned int persist_num;
+	bool disk_dirty;
+	struct mem_cache mem;
+};
+
+struct glyph_job {
+	struct shl_dlist list;
+	struct face *face;
+	struct kmscon_font *font;
+	uint32_t id;
+	size_t len;
+	uint32_t ch[];
 };
 
 static pthread_mutex_t manager_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t manager_cond = PTHREAD_COND_INITIALIZER;
 static unsigned long manager__refcnt;
 static PangoFontMap *manager__lib;
 static struct shl_dlist manager__list = SHL_DLIST_INIT(manager__list);
+static struct shl_dlist manager__queue = SHL_DLIST_INIT(manager__queue);
+static pthread_t manager__worker;
+static bool manager__worker_running;
+static bool manager__stop;
 
 static void manager_lock()
 {
@@ -87,8 +121,12 @@ static void manager_unlock()
 	pthread_mutex_unlock(&manager_mutex);
 }
 
+static void *manager_worker(void *arg);
+
 static int manager__ref()
 {
+	int ret;
+
 	if (!manager__refcnt++) {
 		manager__lib = pango_ft2_font_map_new();
 		if (!manager__lib) {
@@ -96,6 +134,14 @@ static int manager__ref()
 			--manager__refcnt;
 			return -EFAULT;
 		}
+
+		manager__stop = false;
+		ret = pthread_create(&manager__worker, NULL, manager_worker,
+				     NULL);
+		if (ret)
+			log_warning("cannot start glyph rasterization worker, rendering glyphs synchronously");
+		else
+			manager__worker_running = true;
 	}
 
 	return 0;
@@ -104,13 +150,31 @@ static int manager__ref()
 static void manager__unref()
 {
 	if (!--manager__refcnt) {
+		if (manager__worker_running) {
+			manager__stop = true;
+			pthread_cond_signal(&manager_cond);
+			/* no faces are left so no new jobs can show up; drop
+			 * the lock so the worker can run to completion */
+			manager_unlock();
+			pthread_join(manager__worker, NULL);
+			manager_lock();
+			manager__worker_running = false;
+		}
 		g_object_unref(manager__lib);
 		manager__lib = NULL;
 	}
 }
 
-static int get_glyph(struct face *face, struct kmscon_glyph **out,
-		     uint32_t id, const uint32_t *ch, size_t len)
+/*
+ * Rasterize the glyph for @ch into a freshly allocated buffer. The caller
+ * must hold the manager lock as pango contexts cannot be used concurrently.
+ * The per-face layout is reused across calls so each rasterization only pays
+ * for itemization and shaping of the cluster itself, not for setting up a
+ * fresh layout; bulk output of uncached complex-script clusters is dominated
+ * by exactly this per-call overhead.
+ */
+static int render_glyph(struct face *face, struct kmscon_glyph **out,
+			const uint32_t *ch, size_t len)
 {
 	struct kmscon_glyph *glyph;
 	PangoLayout *layout;
@@ -118,52 +182,42 @@ static int get_glyph(struct face *face, struct kmscon_glyph **out,
 	PangoLayoutLine *line;
 	FT_Bitmap bitmap;
 	unsigned int cwidth;
-	size_t ulen, cnt;
-	char *val;
-	bool res;
+	size_t ulen, cnt, i;
+	char buf[128], *val;
 	int ret;
 
-	if (!len)
-		return -ERANGE;
 	cwidth = tsm_ucs4_get_width(*ch);
 	if (!cwidth)
 		return -ERANGE;
 
-	pthread_mutex_lock(&face->glyph_lock);
-	res = shl_hashtable_find(face->glyphs, (void**)&glyph,
-				 (void*)(long)id);
-	pthread_mutex_unlock(&face->glyph_lock);
-	if (res) {
-		*out = glyph;
-		return 0;
-	}
-
-	manager_lock();
-
 	glyph = malloc(sizeof(*glyph));
 	if (!glyph) {
 		log_error("cannot allocate memory for new glyph");
-		ret = -ENOMEM;
-		goto out_unlock;
+		return -ENOMEM;
 	}
 	memset(glyph, 0, sizeof(*glyph));
 	glyph->width = cwidth;
 
-	layout = pango_layout_new(face->ctx);
-
-	/* render one line only */
-	pango_layout_set_height(layout, 0);
-
-	/* no line spacing */
-	pango_layout_set_spacing(layout, 0);
-
-	val = tsm_ucs4_to_utf8_alloc(ch, len, &ulen);
-	if (!val) {
-		ret = -ERANGE;
-		goto out_glyph;
+	layout = face->layout;
+
+	/* clusters are short, so the utf8 text almost always fits on the
+	 * stack; only fall back to the allocating conversion for absurdly
+	 * long combining-sequences */
+	if (len <= sizeof(buf) / 4) {
+		ulen = 0;
+		for (i = 0; i < len; ++i)
+			ulen += tsm_ucs4_to_utf8(ch[i], &buf[ulen]);
+		val = buf;
+	} else {
+		val = tsm_ucs4_to_utf8_alloc(ch, len, &ulen);
+		if (!val) {
+			ret = -ERANGE;
+			goto out_glyph;
+		}
 	}
 	pango_layout_set_text(layout, val, ulen);
-	free(val);
+	if (val != buf)
+		free(val);
 
 	cnt = pango_layout_get_line_count(layout);
 	if (cnt == 0) {
@@ -201,25 +255,11 @@ static int get_glyph(struct face *face, struct kmscon_glyph **out,
 
 	pango_ft2_render_layout_line(&bitmap, line, -rec.x, face->baseline);
 
-	pthread_mutex_lock(&face->glyph_lock);
-	ret = shl_hashtable_insert(face->glyphs, (void*)(long)id, glyph);
-	pthread_mutex_unlock(&face->glyph_lock);
-	if (ret) {
-		log_error("cannot add glyph to hashtable");
-		goto out_buffer;
-	}
-
 	*out = glyph;
-	goto out_layout;
+	return 0;
 
-out_buffer:
-	free(glyph->buf.data);
 out_glyph:
 	free(glyph);
-out_layout:
-	g_object_unref(layout);
-out_unlock:
-	manager_unlock();
 	return ret;
 }
 
@@ -231,6 +271,472 @@ static void free_glyph(void *data)
 	free(glyph);
 }
 
+/* glyph-cache byte estimate; called with the glyph lock held */
+static void face_account_glyph(struct face *face,
+			       const struct kmscon_glyph *glyph)
+{
+	face->mem.bytes += sizeof(*glyph) +
+			   glyph->buf.stride * glyph->buf.height;
+}
+
+/* Drop all cached glyphs of @face; called under memory pressure. Renderer
+ * caches referencing the glyph buffers register on a higher level and are
+ * shrunk first, so nothing points into the table anymore. Queued jobs are
+ * unaffected and re-populate the fresh table. */
+static void face_shrink(struct mem_cache *mem)
+{
+	struct face *face = shl_dlist_entry(mem, struct face, mem);
+	struct shl_hashmap *glyphs;
+	int ret;
+
+	ret = shl_hashmap_new(&glyphs, shl_map_direct_hash,
+				shl_map_direct_equal, NULL, free_glyph);
+	if (ret)
+		return;
+
+	pthread_mutex_lock(&face->glyph_lock);
+	shl_hashmap_free(face->glyphs);
+	face->glyphs = glyphs;
+	face->mem.bytes = 0;
+	pthread_mutex_unlock(&face->glyph_lock);
+}
+
+/*
+ * On-disk glyph bitmap cache
+ * Rasterizing the common-glyph working set costs the same freetype work on
+ * every boot for every seat, and font bring-up dominates time-to-first-
+ * prompt. Faces therefore persist their single-codepoint glyph bitmaps to
+ * /var/cache/kmscon, keyed by font description, size and dpi, and preload
+ * them on creation. Composed symbols get session-dependent IDs and cannot
+ * be keyed across runs, so only plain codepoints are saved. The bitmaps
+ * are validated against the measured cell metrics; a face whose metrics
+ * changed (different font on disk) rejects the file wholesale.
+ */
+
+#define FONT_CACHE_DIR "/var/cache/kmscon"
+#define FONT_CACHE_MAGIC 0x544e464bU
+#define FONT_CACHE_PERSIST_MAX 512
+
+struct glyph_cache_header {
+	uint32_t magic;
+	uint32_t count;
+	/* cell metrics the bitmaps assume */
+	uint32_t width;
+	uint32_t height;
+};
+
+struct glyph_cache_glyph {
+	uint32_t ch;
+	/* width in cells; the bitmap payload follows the entry */
+	uint32_t width;
+};
+
+static char *face_cache_path(struct face *face)
+{
+	const struct kmscon_font_attr *a = &face->attr;
+	uint32_t hash = 5381;
+	const char *p;
+	char *path;
+	int ret;
+
+	for (p = a->name; *p; ++p)
+		hash = hash * 33 + (unsigned char)*p;
+	hash = hash * 33 + a->bold;
+	hash = hash * 33 + a->italic;
+	hash = hash * 33 + a->points;
+	hash = hash * 33 + a->height;
+	hash = hash * 33 + a->ppi;
+
+	ret = asprintf(&path, "%s/font-%08" PRIx32 ".glyphs",
+		       FONT_CACHE_DIR, hash);
+	if (ret < 0)
+		return NULL;
+
+	return path;
+}
+
+/* remember a freshly rendered glyph for the next save; called with the
+ * glyph lock held */
+static void face_mark_persist(struct face *face, const uint32_t *ch,
+			      size_t len)
+{
+	if (len != 1 || !face->persist ||
+	    face->persist_num >= FONT_CACHE_PERSIST_MAX)
+		return;
+
+	face->persist[face->persist_num++] = ch[0];
+	face->disk_dirty = true;
+}
+
+/* Write the current persistable working set to disk. Called with the
+ * manager lock held; takes the glyph lock itself. */
+static void face_disk_save(struct face *face)
+{
+	struct glyph_cache_header hdr;
+	struct glyph_cache_glyph ent;
+	struct kmscon_glyph *glyph;
+	char *path, *tmp;
+	unsigned int i;
+	uint32_t num = 0;
+	size_t len;
+	int fd, ret;
+
+	if (!face->disk_dirty)
+		return;
+
+	path = face_cache_path(face);
+	if (!path)
+		return;
+
+	ret = asprintf(&tmp, "%s.tmp", path);
+	if (ret < 0) {
+		free(path);
+		return;
+	}
+
+	if (mkdir(FONT_CACHE_DIR, 0755) < 0 && errno != EEXIST)
+		goto out_free;
+
+	fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+	if (fd < 0)
+		goto out_free;
+
+	/* placeholder header; rewritten once the count is known */
+	memset(&hdr, 0, sizeof(hdr));
+	if (write(fd, &hdr, sizeof(hdr)) != (ssize_t)sizeof(hdr))
+		goto err_drop;
+
+	pthread_mutex_lock(&face->glyph_lock);
+	face->disk_dirty = false;
+
+	for (i = 0; i < face->persist_num; ++i) {
+		/* may have been dropped under memory pressure */
+		if (!shl_hashmap_find(face->glyphs, (void**)&glyph,
+				      (void*)(long)face->persist[i]))
+			continue;
+
+		ent.ch = face->persist[i];
+		ent.width = glyph->width;
+		len = glyph->buf.stride * glyph->buf.height;
+
+		if (write(fd, &ent, sizeof(ent)) != (ssize_t)sizeof(ent) ||
+		    write(fd, glyph->buf.data, len) != (ssize_t)len) {
+			pthread_mutex_unlock(&face->glyph_lock);
+			goto err_drop;
+		}
+		++num;
+	}
+
+	pthread_mutex_unlock(&face->glyph_lock);
+
+	hdr.magic = FONT_CACHE_MAGIC;
+	hdr.count = num;
+	hdr.width = face->real_attr.width;
+	hdr.height = face->real_attr.height;
+	if (lseek(fd, 0, SEEK_SET) != 0 ||
+	    write(fd, &hdr, sizeof(hdr)) != (ssize_t)sizeof(hdr))
+		goto err_drop;
+	close(fd);
+
+	if (rename(tmp, path) < 0)
+		unlink(tmp);
+	else
+		log_debug("cached %" PRIu32 " glyph bitmaps for '%s'",
+			  num, face->attr.name);
+
+	goto out_free;
+
+err_drop:
+	close(fd);
+	unlink(tmp);
+out_free:
+	free(tmp);
+	free(path);
+}
+
+/* Preload the working set of the previous run. Called during face setup
+ * before the face is visible to anyone, so no locking is needed. */
+static void face_disk_load(struct face *face)
+{
+	struct glyph_cache_header hdr;
+	struct glyph_cache_glyph ent;
+	struct kmscon_glyph *glyph;
+	unsigned int i;
+	size_t len;
+	int fd, ret, num = 0;
+	char *path;
+
+	path = face_cache_path(face);
+	if (!path)
+		return;
+
+	fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0) {
+		free(path);
+		return;
+	}
+
+	if (read(fd, &hdr, sizeof(hdr)) != (ssize_t)sizeof(hdr) ||
+	    hdr.magic != FONT_CACHE_MAGIC ||
+	    hdr.count > FONT_CACHE_PERSIST_MAX ||
+	    hdr.width != face->real_attr.width ||
+	    hdr.height != face->real_attr.height)
+		goto err_drop;
+
+	for (i = 0; i < hdr.count; ++i) {
+		if (read(fd, &ent, sizeof(ent)) != (ssize_t)sizeof(ent) ||
+		    !ent.width || ent.width > 2)
+			goto err_drop;
+
+		glyph = malloc(sizeof(*glyph));
+		if (!glyph)
+			goto err_drop;
+		memset(glyph, 0, sizeof(*glyph));
+		glyph->width = ent.width;
+		glyph->buf.width = face->real_attr.width * ent.width;
+		glyph->buf.height = face->real_attr.height;
+		glyph->buf.stride = glyph->buf.width;
+		glyph->buf.format = UTERM_FORMAT_GREY;
+
+		len = glyph->buf.stride * glyph->buf.height;
+		glyph->buf.data = malloc(len);
+		if (!glyph->buf.data) {
+			free(glyph);
+			goto err_drop;
+		}
+
+		if (read(fd, glyph->buf.data, len) != (ssize_t)len) {
+			free_glyph(glyph);
+			goto err_drop;
+		}
+
+		ret = shl_hashmap_insert(face->glyphs, (void*)(long)ent.ch,
+					 glyph);
+		if (ret) {
+			free_glyph(glyph);
+			continue;
+		}
+
+		face_account_glyph(face, glyph);
+		face_mark_persist(face, &ent.ch, 1);
+		++num;
+	}
+
+	/* everything loaded is already on disk */
+	face->disk_dirty = false;
+
+	close(fd);
+	free(path);
+	if (num)
+		log_debug("preloaded %d glyph bitmaps for '%s'",
+			  num, face->attr.name);
+	return;
+
+err_drop:
+	close(fd);
+	unlink(path);
+	free(path);
+}
+
+/*
+ * Glyph rasterization worker
+ * Rasterizing a screenful of uncached glyphs takes long enough to cause
+ * visible stutter if done on the display event-loop. Therefore, cache misses
+ * return -EAGAIN and queue the glyph here; the worker rasterizes it in the
+ * background and notifies the font owners so the affected cells are redrawn.
+ * The pango calls still run under the manager lock as pango contexts are not
+ * thread-safe; the point is to move them off the event-loop, not to
+ * parallelize them.
+ */
+static void *manager_worker(void *arg)
+{
+	struct glyph_job *job;
+	struct kmscon_glyph *glyph;
+	struct shl_dlist *iter;
+	struct face *face;
+	int ret;
+
+	shl_sched_prepare_worker();
+
+	manager_lock();
+
+	while (!manager__stop) {
+		if (shl_dlist_empty(&manager__queue)) {
+			/* flush dirty faces to disk while we have nothing
+			 * better to do anyway */
+			shl_dlist_for_each(iter, &manager__list) {
+				face = shl_dlist_entry(iter, struct face,
+						       list);
+				face_disk_save(face);
+			}
+
+			pthread_cond_wait(&manager_cond, &manager_mutex);
+			continue;
+		}
+
+		job = shl_dlist_entry(manager__queue.next, struct glyph_job,
+				      list);
+		shl_dlist_unlink(&job->list);
+		face = job->face;
+
+		ret = render_glyph(face, &glyph, job->ch, job->len);
+
+		pthread_mutex_lock(&face->glyph_lock);
+		shl_hashmap_remove(face->pending, (void*)(long)job->id);
+		if (!ret) {
+			ret = shl_hashmap_insert(face->glyphs,
+						   (void*)(long)job->id,
+						   glyph);
+			if (ret) {
+				log_error("cannot add glyph to hashtable");
+				free_glyph(glyph);
+			} else {
+				face_account_glyph(face, glyph);
+				face_mark_persist(face, job->ch, job->len);
+			}
+		}
+		pthread_mutex_unlock(&face->glyph_lock);
+
+		if (!ret)
+			kmscon_font_ready(job->font);
+
+		free(job);
+	}
+
+	manager_unlock();
+	return NULL;
+}
+
+/*
+ * Drop all queued jobs of @font. The job currently processed by the worker
+ * cannot be affected as the worker holds the manager lock while processing;
+ * after this returns, @font is guaranteed to no longer be accessed.
+ */
+static void manager_cancel_jobs(struct kmscon_font *font)
+{
+	struct shl_dlist *iter, *tmp;
+	struct glyph_job *job;
+
+	manager_lock();
+
+	shl_dlist_for_each_safe(iter, tmp, &manager__queue) {
+		job = shl_dlist_entry(iter, struct glyph_job, list);
+		if (job->font != font)
+			continue;
+
+		shl_dlist_unlink(&job->list);
+		pthread_mutex_lock(&job->face->glyph_lock);
+		shl_hashmap_remove(job->face->pending,
+				     (void*)(long)job->id);
+		pthread_mutex_unlock(&job->face->glyph_lock);
+		free(job);
+	}
+
+	manager_unlock();
+}
+
+static int get_glyph(struct face *face, struct kmscon_font *font,
+		     struct kmscon_glyph **out, uint32_t id,
+		     const uint32_t *ch, size_t len)
+{
+	struct kmscon_glyph *glyph;
+	struct glyph_job *job = NULL;
+	bool res;
+	int ret;
+
+	if (!len)
+		return -ERANGE;
+	if (!tsm_ucs4_get_width(*ch))
+		return -ERANGE;
+
+	/* Prepare a job upfront so the cache lookup covers the queueing,
+	 * too. @font is NULL for the replacement glyphs which must always be
+	 * rendered synchronously as they back deferred glyphs.
+	 * manager__worker_running is written only while no faces exist, so
+	 * reading it without the manager lock is fine. */
+	if (font && manager__worker_running) {
+		job = malloc(sizeof(*job) + len * sizeof(uint32_t));
+		if (job) {
+			memset(job, 0, sizeof(*job));
+			job->face = face;
+			job->font = font;
+			job->id = id;
+			job->len = len;
+			memcpy(job->ch, ch, len * sizeof(uint32_t));
+		}
+	}
+
+	pthread_mutex_lock(&face->glyph_lock);
+	res = shl_hashmap_find(face->glyphs, (void**)&glyph,
+				 (void*)(long)id);
+	/* the glyph-lock also serializes the statistic updates */
+	if (font) {
+		if (res)
+			++font->stats.hits;
+		else
+			++font->stats.misses;
+	}
+	if (res) {
+		pthread_mutex_unlock(&face->glyph_lock);
+		free(job);
+		*out = glyph;
+		return 0;
+	}
+
+	if (job) {
+		res = shl_hashmap_find(face->pending, (void**)&glyph,
+					 (void*)(long)id);
+		if (res) {
+			/* already queued */
+			pthread_mutex_unlock(&face->glyph_lock);
+			free(job);
+			return -EAGAIN;
+		}
+
+		ret = shl_hashmap_insert(face->pending, (void*)(long)id,
+					   job);
+		pthread_mutex_unlock(&face->glyph_lock);
+		if (ret) {
+			/* fall back to synchronous rendering */
+			free(job);
+		} else {
+			manager_lock();
+			shl_dlist_link_tail(&manager__queue, &job->list);
+			pthread_cond_signal(&manager_cond);
+			manager_unlock();
+			return -EAGAIN;
+		}
+	} else {
+		pthread_mutex_unlock(&face->glyph_lock);
+	}
+
+	manager_lock();
+
+	ret = render_glyph(face, &glyph, ch, len);
+	if (!ret) {
+		pthread_mutex_lock(&face->glyph_lock);
+		ret = shl_hashmap_insert(face->glyphs, (void*)(long)id,
+					   glyph);
+		if (!ret) {
+			face_account_glyph(face, glyph);
+			face_mark_persist(face, ch, len);
+		}
+		pthread_mutex_unlock(&face->glyph_lock);
+		if (ret) {
+			log_error("cannot add glyph to hashtable");
+			free_glyph(glyph);
+		}
+	}
+
+	manager_unlock();
+
+	if (ret)
+		return ret;
+
+	*out = glyph;
+	return 0;
+}
+
 static int manager_get_face(struct face **out, struct kmscon_font_attr *attr)
 {
 	struct shl_dlist *iter;
@@ -273,13 +779,28 @@ static int manager_get_face(struct face **out, struct kmscon_font_attr *attr)
 		goto err_free;
 	}
 
-	ret = shl_hashtable_new(&face->glyphs, shl_direct_hash,
-				shl_direct_equal, NULL, free_glyph);
+	ret = shl_hashmap_new(&face->glyphs, shl_map_direct_hash,
+				shl_map_direct_equal, NULL, free_glyph);
 	if (ret) {
 		log_error("cannot allocate hashtable");
 		goto err_lock;
 	}
 
+	ret = shl_hashmap_new(&face->pending, shl_map_direct_hash,
+				shl_map_direct_equal, NULL, NULL);
+	if (ret) {
+		log_error("cannot allocate hashtable");
+		goto err_glyphs;
+	}
+
+	face->persist = malloc(FONT_CACHE_PERSIST_MAX *
+			       sizeof(*face->persist));
+	if (!face->persist) {
+		log_error("cannot allocate memory for glyph cache index");
+		ret = -ENOMEM;
+		goto err_pending;
+	}
+
 	face->ctx = pango_font_map_create_context(manager__lib);
 	pango_context_set_base_dir(face->ctx, PANGO_DIRECTION_LTR);
 	pango_context_set_language(face->ctx, pango_language_get_default());
@@ -312,7 +833,9 @@ static int manager_get_face(struct face **out, struct kmscon_font_attr *attr)
 	face->real_attr.height = rec.height;
 	face->real_attr.width = rec.width / num + 1;
 	face->baseline = PANGO_PIXELS_CEIL(pango_layout_get_baseline(layout));
-	g_object_unref(layout);
+
+	/* keep the measuring layout as the shared shaping layout */
+	face->layout = layout;
 
 	kmscon_font_attr_normalize(&face->real_attr);
 	if (!face->real_attr.height || !face->real_attr.width) {
@@ -333,14 +856,26 @@ static int manager_get_face(struct face **out, struct kmscon_font_attr *attr)
 		}
 	}
 
+	face_disk_load(face);
+
+	face->mem.name = "pango-glyphs";
+	face->mem.level = 0;
+	face->mem.shrink = face_shrink;
+	mem_cache_register(&face->mem);
+
 	shl_dlist_link(&manager__list, &face->list);
 	*out = face;
 	ret = 0;
 	goto out_unlock;
 
 err_face:
+	g_object_unref(face->layout);
 	g_object_unref(face->ctx);
-	shl_hashtable_free(face->glyphs);
+	free(face->persist);
+err_pending:
+	shl_hashmap_free(face->pending);
+err_glyphs:
+	shl_hashmap_free(face->glyphs);
 err_lock:
 	pthread_mutex_destroy(&face->glyph_lock);
 err_free:
@@ -357,9 +892,14 @@ static void manager_put_face(struct face *face)
 	manager_lock();
 
 	if (!--face->ref) {
+		face_disk_save(face);
+		mem_cache_unregister(&face->mem);
 		shl_dlist_unlink(&face->list);
-		shl_hashtable_free(face->glyphs);
+		free(face->persist);
+		shl_hashmap_free(face->pending);
+		shl_hashmap_free(face->glyphs);
 		pthread_mutex_destroy(&face->glyph_lock);
+		g_object_unref(face->layout);
 		g_object_unref(face->ctx);
 		free(face);
 		manager__unref();
@@ -395,6 +935,7 @@ static void kmscon_font_pango_destroy(struct kmscon_font *font)
 
 	log_debug("unloading pango font");
 	face = font->data;
+	manager_cancel_jobs(font);
 	manager_put_face(face);
 }
 
@@ -405,7 +946,7 @@ static int kmscon_font_pango_render(struct kmscon_font *font, uint32_t id,
 	struct kmscon_glyph *glyph;
 	int ret;
 
-	ret = get_glyph(font->data, &glyph, id, ch, len);
+	ret = get_glyph(font->data, font, &glyph, id, ch, len);
 	if (ret)
 		return ret;
 
@@ -417,15 +958,31 @@ static int kmscon_font_pango_render_empty(struct kmscon_font *font,
 					  const struct kmscon_glyph **out)
 {
 	static const uint32_t empty_char = ' ';
-	return kmscon_font_pango_render(font, empty_char, &empty_char, 1, out);
+	struct kmscon_glyph *glyph;
+	int ret;
+
+	ret = get_glyph(font->data, NULL, &glyph, empty_char, &empty_char, 1);
+	if (ret)
+		return ret;
+
+	*out = glyph;
+	return 0;
 }
 
 static int kmscon_font_pango_render_inval(struct kmscon_font *font,
 					  const struct kmscon_glyph **out)
 {
 	static const uint32_t question_mark = '?';
-	return kmscon_font_pango_render(font, question_mark, &question_mark, 1,
-					out);
+	struct kmscon_glyph *glyph;
+	int ret;
+
+	ret = get_glyph(font->data, NULL, &glyph, question_mark,
+			&question_mark, 1);
+	if (ret)
+		return ret;
+
+	*out = glyph;
+	return 0;
 }
 
 struct kmscon_font_ops kmscon_font_pango_ops = {
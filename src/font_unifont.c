@@ -30,19 +30,25 @@
  * @include: font.h
  *
  * This is a fixed font renderer backend that supports just one font which is
- * statically compiled into the file. This bitmap font has 8x16 and 16x16
- * glyphs. This can statically compile in any font defined as a unifont style
- * hex format. This font is from the GNU unifont project available at:
+ * loaded from a binary data file. This bitmap font has 8x16 and 16x16
+ * glyphs. The data file can be generated from any font defined as a unifont
+ * style hex format. This font is from the GNU unifont project available at:
  *   http://unifoundry.com/unifont.html
  *
  * This file is heavily based on font_8x16.c
  */
 
+#include <endian.h>
 #include <errno.h>
+#include <fcntl.h>
 #include <pthread.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include "font.h"
+#include "font_unifont_data.h"
 #include "shl_hashtable.h"
 #include "shl_log.h"
 #include "uterm_video.h"
@@ -50,23 +56,96 @@
 #define LOG_SUBSYSTEM "font_unifont"
 
 /*
- * Glyph data is linked to the binary externally as binary data. The data layout
- * is a size-byte followed by 32 data bytes. The data bytes are padded with 0 if
- * the size is smaller than 32.
- * Sizes bigger than 32 are not used.
+ * Glyph store
+ * The glyph data lives in a binary file generated by genunifont which is
+ * mmap()ed read-only on first use; see font_unifont_data.h for the layout.
+ * Glyphs are paged in by the kernel on demand, so only the few hundred
+ * glyphs a session actually touches ever become resident instead of the
+ * whole ~65k set.
  */
 
-struct unifont_data {
-	uint8_t len;
-	uint8_t data[32];
-} __attribute__((__packed__));
+#ifndef BUILD_UNIFONT_PATH
+#  define BUILD_UNIFONT_PATH "/usr/share/kmscon/font_unifont_data.bin"
+#endif
 
-extern const struct unifont_data _binary_src_font_unifont_data_bin_start[];
-extern const struct unifont_data _binary_src_font_unifont_data_bin_end[];
+static struct {
+	void *map;
+	size_t size;
+	const uint32_t *index;
+	const struct unifont_data *glyphs;
+	uint32_t count;
+} store;
+
+/* call with cache_mutex locked */
+static int store_open(void)
+{
+	const struct unifont_header *hdr;
+	struct stat st;
+	int fd, ret;
+
+	fd = open(BUILD_UNIFONT_PATH, O_RDONLY | O_CLOEXEC);
+	if (fd < 0) {
+		log_error("cannot open unifont data %s: %m",
+			  BUILD_UNIFONT_PATH);
+		return -errno;
+	}
+
+	ret = fstat(fd, &st);
+	if (ret) {
+		log_error("cannot stat unifont data %s: %m",
+			  BUILD_UNIFONT_PATH);
+		ret = -errno;
+		goto err_close;
+	}
+
+	if ((size_t)st.st_size < sizeof(*hdr)) {
+		ret = -EFAULT;
+		goto err_invalid;
+	}
+
+	store.size = st.st_size;
+	store.map = mmap(NULL, store.size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (store.map == MAP_FAILED) {
+		log_error("cannot mmap unifont data %s: %m",
+			  BUILD_UNIFONT_PATH);
+		ret = -errno;
+		goto err_close;
+	}
+
+	hdr = store.map;
+	store.count = le32toh(hdr->count);
+	if (le32toh(hdr->magic) != UNIFONT_MAGIC ||
+	    store.size < sizeof(*hdr) + store.count * (sizeof(uint32_t) +
+						sizeof(struct unifont_data))) {
+		munmap(store.map, store.size);
+		ret = -EFAULT;
+		goto err_invalid;
+	}
+
+	store.index = (void*)((char*)store.map + sizeof(*hdr));
+	store.glyphs = (void*)(&store.index[store.count]);
+
+	close(fd);
+	return 0;
+
+err_invalid:
+	log_error("unifont data %s is invalid", BUILD_UNIFONT_PATH);
+err_close:
+	memset(&store, 0, sizeof(store));
+	close(fd);
+	return ret;
+}
+
+/* call with cache_mutex locked */
+static void store_close(void)
+{
+	munmap(store.map, store.size);
+	memset(&store, 0, sizeof(store));
+}
 
 /*
  * Global glyph cache
- * The linked binary glyph data cannot be directly passed to the caller as it
+ * The mmap()ed glyph data cannot be directly passed to the caller as it
  * has the wrong format. Hence, use a glyph-cache with all used glyphs and add
  * new ones as soon as they are used.
  */
@@ -75,11 +154,21 @@ static pthread_mutex_t cache_mutex = PTHREAD_MUTEX_INITIALIZER;
 static struct shl_hashtable *cache;
 static unsigned long cache_refnum;
 
-static void cache_ref(void)
+static int cache_ref(void)
 {
+	int ret = 0;
+
 	pthread_mutex_lock(&cache_mutex);
+	if (!cache_refnum) {
+		ret = store_open();
+		if (ret)
+			goto out_unlock;
+	}
 	++cache_refnum;
+
+out_unlock:
 	pthread_mutex_unlock(&cache_mutex);
+	return ret;
 }
 
 static void cache_unref(void)
@@ -88,6 +177,7 @@ static void cache_unref(void)
 	if (!--cache_refnum) {
 		shl_hashtable_free(cache);
 		cache = NULL;
+		store_close();
 	}
 	pthread_mutex_unlock(&cache_mutex);
 }
@@ -110,7 +200,8 @@ static int find_glyph(uint32_t id, const struct kmscon_glyph **out)
 	struct kmscon_glyph *g;
 	int ret;
 	bool res;
-	const struct unifont_data *start, *end, *d;
+	const struct unifont_data *d;
+	uint32_t low, high, mid;
 	unsigned int i, w;
 
 	pthread_mutex_lock(&cache_mutex);
@@ -122,6 +213,11 @@ static int find_glyph(uint32_t id, const struct kmscon_glyph **out)
 			log_error("cannot create unifont hashtable: %d", ret);
 			goto out_unlock;
 		}
+
+		/* size the cache from the font's coverage so it never has to
+		 * rehash on the render path; growth still works if this
+		 * best-effort pre-allocation fails */
+		shl_hashtable_reserve(cache, store.count);
 	} else {
 		res = shl_hashtable_find(cache, (void**)out,
 					 (void*)(long)id);
@@ -131,20 +227,24 @@ static int find_glyph(uint32_t id, const struct kmscon_glyph **out)
 		}
 	}
 
-	if (id > 0xffff) {
-		ret = -ERANGE;
-		goto out_unlock;
+	/* binary search in the sorted codepoint index */
+	low = 0;
+	high = store.count;
+	while (low < high) {
+		mid = low + (high - low) / 2;
+		if (le32toh(store.index[mid]) < id)
+			low = mid + 1;
+		else
+			high = mid;
 	}
 
-	start = _binary_src_font_unifont_data_bin_start;
-	end = _binary_src_font_unifont_data_bin_end;
-	d = &start[id];
-
-	if (d >= end) {
+	if (low == store.count || le32toh(store.index[low]) != id) {
 		ret = -ERANGE;
 		goto out_unlock;
 	}
 
+	d = &store.glyphs[low];
+
 	switch (d->len) {
 	case 16:
 		w = 1;
@@ -209,17 +309,13 @@ static int kmscon_font_unifont_init(struct kmscon_font *out,
 				    const struct kmscon_font_attr *attr)
 {
 	static const char name[] = "static-unifont";
-	const struct unifont_data *start, *end;
+	int ret;
 
 	log_debug("loading static unifont font");
 
-	start = _binary_src_font_unifont_data_bin_start;
-	end = _binary_src_font_unifont_data_bin_end;
-	if (start == end) {
-		log_error("unifont glyph information not found in binary");
-		return -EFAULT;
-	}
-
+	ret = cache_ref();
+	if (ret)
+		return ret;
 
 	memset(&out->attr, 0, sizeof(out->attr));
 	memcpy(out->attr.name, name, sizeof(name));
@@ -230,7 +326,6 @@ static int kmscon_font_unifont_init(struct kmscon_font *out,
 	kmscon_font_attr_normalize(&out->attr);
 	out->baseline = 4;
 
-	cache_ref();
 	return 0;
 }
 
@@ -0,0 +1,63 @@
+/*
+ * kmscon - Unifont data file format
+ *
+ * Copyright (c) 2012 Ted Kotz <ted@kotz.us>
+ * Copyright (c) 2012-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Unifont data file format
+ * This is shared between the genunifont generator and the font_unifont
+ * renderer. The file starts with a header, followed by a sorted array of
+ * the codepoints of all contained glyphs, followed by one glyph record per
+ * codepoint in the same order. A glyph is found by binary-searching the
+ * codepoint array; its record sits at the matching position in the record
+ * array.
+ * All multi-byte fields are stored little-endian so the file can be
+ * generated on the build host during cross-compilation.
+ */
+
+#ifndef FONT_UNIFONT_DATA_H
+#define FONT_UNIFONT_DATA_H
+
+#include <stdint.h>
+
+/* "UFNT" in little-endian */
+#define UNIFONT_MAGIC 0x544e4655U
+
+struct unifont_header {
+	uint32_t magic;
+	uint32_t count;
+} __attribute__((__packed__));
+
+/*
+ * A single glyph. @len is the number of valid data bytes, either 16 for
+ * 8x16 glyphs or 32 for 16x16 glyphs. The data bytes are padded with 0 if
+ * the glyph is smaller than 32 bytes.
+ */
+
+struct unifont_data {
+	uint8_t len;
+	uint8_t data[32];
+} __attribute__((__packed__));
+
+#endif /* FONT_UNIFONT_DATA_H */
@@ -26,8 +26,9 @@
 
 /*
  * Unifont Generator
- * This converts the hex-encoded Unifont data into a C-array that is used by the
- * unifont-font-renderer.
+ * This converts the hex-encoded Unifont data into the binary data file that
+ * is mmap()ed by the unifont-font-renderer. See font_unifont_data.h for the
+ * file format.
  */
 
 #include <errno.h>
@@ -35,6 +36,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include "font_unifont_data.h"
 
 #define MAX_DATA_SIZE 255
 
@@ -58,29 +60,30 @@ static uint8_t hex_val(char c)
 	return 0;
 }
 
-static void print_unifont_glyph(FILE *out, const struct unifont_glyph *g)
+static void write_u32(FILE *out, uint32_t val)
 {
+	uint8_t le[4];
+
+	le[0] = val & 0xff;
+	le[1] = (val >> 8) & 0xff;
+	le[2] = (val >> 16) & 0xff;
+	le[3] = (val >> 24) & 0xff;
+	fwrite(le, 1, sizeof(le), out);
+}
+
+static void write_unifont_glyph(FILE *out, const struct unifont_glyph *g)
+{
+	struct unifont_data d;
 	size_t i;
-	uint8_t val;
-
-	switch (g->len) {
-	case 32:
-	case 64:
-		break;
-	default:
-		fprintf(stderr, "genunifont: invalid data size %d for %x",
-			g->len, g->codepoint);
-		return;
-	}
 
-	fprintf(out, "%c", g->len / 2);
+	memset(&d, 0, sizeof(d));
+	d.len = g->len / 2;
 	for (i = 0; i < g->len; i += 2) {
-		val = hex_val(g->data[i]) << 4;
-		val |= hex_val(g->data[i + 1]);
-		fprintf(out, "%c", val);
+		d.data[i / 2] = hex_val(g->data[i]) << 4;
+		d.data[i / 2] |= hex_val(g->data[i + 1]);
 	}
-	for ( ; i < 64; i += 2)
-		fprintf(out, "%c", 0);
+
+	fwrite(&d, 1, sizeof(d), out);
 }
 
 static int build_unifont_glyph(struct unifont_glyph *g, const char *buf)
@@ -106,19 +109,21 @@ static int build_unifont_glyph(struct unifont_glyph *g, const char *buf)
 		++g->len;
 	}
 
+	if (g->len != 32 && g->len != 64) {
+		fprintf(stderr, "genunifont: invalid data size %d for %x\n",
+			g->len, g->codepoint);
+		return -EFAULT;
+	}
+
 	return 0;
 }
 
 static int parse_single_file(FILE *out, FILE *in)
 {
-	static const struct unifont_glyph replacement = {
-		.codepoint = 0,
-		.len = 32,
-		.data = "0000007E665A5A7A76767E76767E0000"
-	};
 	char buf[MAX_DATA_SIZE];
 	struct unifont_glyph *g, **iter, *list, *last;
-	int ret, num;
+	uint32_t num;
+	int ret;
 	long status_max, status_cur;
 	unsigned long perc_prev, perc_now;
 
@@ -201,17 +206,21 @@ static int parse_single_file(FILE *out, FILE *in)
 
 	fprintf(stderr, "\b\b\b\b%3d%%\n", 100);
 
-	/* print all glyph-data to output file */
+	/* write header and sorted codepoint index */
 	num = 0;
+	for (g = list; g; g = g->next)
+		++num;
+
+	write_u32(out, UNIFONT_MAGIC);
+	write_u32(out, num);
+	for (g = list; g; g = g->next)
+		write_u32(out, g->codepoint);
+
+	/* write all glyph records to output file */
 	while (list) {
 		g = list;
 		list = g->next;
-
-		/* print replacements if glyphs are missing */
-		while (num++ < g->codepoint)
-			print_unifont_glyph(out, &replacement);
-
-		print_unifont_glyph(out, g);
+		write_unifont_glyph(out, g);
 		free(g);
 	}
 
@@ -69,6 +69,19 @@ static void print_help()
 		"\t                                    Path to config directory\n"
 		"\t    --listen                [off]   Listen for new seats and spawn\n"
 		"\t                                    sessions accordingly (daemon mode)\n"
+		"\t    --per-seat-process      [off]   Run every seat in a separate\n"
+		"\t                                    worker process\n"
+		"\t    --mem-limit <MB>        [0]     Drop internal caches whenever the\n"
+		"\t                                    resident memory of the process\n"
+		"\t                                    exceeds this budget (0: off)\n"
+		"\t    --cpu-affinity <cpus>   [-]     Pin the dispatch thread to this\n"
+		"\t                                    CPU list (e.g.: 0-3,6)\n"
+		"\t    --worker-affinity <cpus> [-]    Pin render/raster worker threads\n"
+		"\t                                    to this CPU list (default:\n"
+		"\t                                    --cpu-affinity)\n"
+		"\t    --rt-prio <prio>        [0]     Run the dispatch thread with this\n"
+		"\t                                    SCHED_FIFO priority (0: off)\n"
+		"\t    --nice <nice>           [0]     Nice level of the process\n"
 		"\n"
 		"Seat Options:\n"
 		"\t    --vt <vt>               [auto]  Select which VT to run on\n"
@@ -98,6 +111,13 @@ static void print_help()
 		"\t                              Select the used color palette\n"
 		"\t    --sb-size <num>         [1000]\n"
 		"\t                              Size of the scrollback-buffer in lines\n"
+		"\t    --record-dir </foo/bar> [-]\n"
+		"\t                              Record terminal output into files in\n"
+		"\t                              this directory\n"
+		"\t    --record-size <MB>      [64]\n"
+		"\t                              Start a new recording file once the\n"
+		"\t                              current one exceeds this size (0: no\n"
+		"\t                              rotation)\n"
 		"\n"
 		"Input Options:\n"
 		"\t    --xkb-model <model>        [-]  Set XkbModel for input devices\n"
@@ -110,6 +130,9 @@ static void print_help()
 		"\t                                 Initial delay for key-repeat in ms\n"
 		"\t    --xkb-repeat-rate <msecs>  [50]\n"
 		"\t                                 Delay between two key-repeats in ms\n"
+		"\t    --input-batch-size <num>   [64]\n"
+		"\t                                 Input events read per syscall from\n"
+		"\t                                 a device\n"
 		"\n"
 		"Grabs / Keyboard-Shortcuts:\n"
 		"\t    --grab-scroll-up <grab>     [<Shift>Up]\n"
@@ -134,13 +157,19 @@ static void print_help()
 		"\t                                  Close current session\n"
 		"\t    --grab-terminal-new <grab>  [<Ctrl><Logo>Return]\n"
 		"\t                                  Create new terminal session\n"
+		"\t    --grab-dump-stats <grab>    [<Ctrl><Logo>F12]\n"
+		"\t                                  Dump render statistics to the log\n"
+		"\t    --grab-hud <grab>           [<Ctrl><Logo>F11]\n"
+		"\t                                  Toggle the on-screen performance HUD\n"
 		"\n"
 		"Video Options:\n"
 		"\t    --drm                   [on]    Use DRM if available\n"
 		"\t    --hwaccel               [off]   Use 3D hardware-acceleration if\n"
 		"\t                                    available\n"
 		"\t    --gpus={all,aux,primary}[all]   GPU selection mode\n"
-		"\t    --render-engine <eng>   [-]     Console renderer\n"
+		"\t    --render-engine <eng>   [-]     Console renderer; \"auto\" selects\n"
+		"\t                                    the fastest backend via a one-time\n"
+		"\t                                    benchmark on the first start\n"
 		"\t    --render-timing         [off]   Print renderer timing information\n"
 		"\n"
 		"Font Options:\n"
@@ -530,6 +559,12 @@ static struct conf_grab def_grab_session_close =
 static struct conf_grab def_grab_terminal_new =
 		CONF_SINGLE_GRAB(SHL_CONTROL_MASK | SHL_LOGO_MASK, XKB_KEY_Return);
 
+static struct conf_grab def_grab_dump_stats =
+		CONF_SINGLE_GRAB(SHL_CONTROL_MASK | SHL_LOGO_MASK, XKB_KEY_F12);
+
+static struct conf_grab def_grab_hud =
+		CONF_SINGLE_GRAB(SHL_CONTROL_MASK | SHL_LOGO_MASK, XKB_KEY_F11);
+
 int kmscon_conf_new(struct conf_ctx **out)
 {
 	struct conf_ctx *ctx;
@@ -552,6 +587,12 @@ int kmscon_conf_new(struct conf_ctx **out)
 		CONF_OPTION_BOOL(0, "silent", &conf->silent, false),
 		CONF_OPTION_STRING('c', "configdir", &conf->configdir, "/etc/kmscon"),
 		CONF_OPTION_BOOL_FULL(0, "listen", aftercheck_listen, NULL, NULL, &conf->listen, false),
+		CONF_OPTION_BOOL(0, "per-seat-process", &conf->per_seat_process, false),
+		CONF_OPTION_UINT(0, "mem-limit", &conf->mem_limit, 0),
+		CONF_OPTION_STRING(0, "cpu-affinity", &conf->cpu_affinity, NULL),
+		CONF_OPTION_STRING(0, "worker-affinity", &conf->worker_affinity, NULL),
+		CONF_OPTION_UINT(0, "rt-prio", &conf->rt_prio, 0),
+		CONF_OPTION_INT(0, "nice", &conf->nice_level, 0),
 
 		/* Seat Options */
 		CONF_OPTION(0, 0, "vt", &conf_vt, aftercheck_vt, NULL, NULL, &conf->vt, NULL),
@@ -569,6 +610,8 @@ int kmscon_conf_new(struct conf_ctx **out)
 		CONF_OPTION_BOOL(0, "reset-env", &conf->reset_env, true),
 		CONF_OPTION_STRING(0, "palette", &conf->palette, NULL),
 		CONF_OPTION_UINT(0, "sb-size", &conf->sb_size, 1000),
+		CONF_OPTION_STRING(0, "record-dir", &conf->record_dir, NULL),
+		CONF_OPTION_UINT(0, "record-size", &conf->record_size, 64),
 
 		/* Input Options */
 		CONF_OPTION_STRING(0, "xkb-model", &conf->xkb_model, ""),
@@ -578,6 +621,7 @@ int kmscon_conf_new(struct conf_ctx **out)
 		CONF_OPTION_STRING(0, "xkb-keymap", &conf->xkb_keymap, ""),
 		CONF_OPTION_UINT(0, "xkb-repeat-delay", &conf->xkb_repeat_delay, 250),
 		CONF_OPTION_UINT(0, "xkb-repeat-rate", &conf->xkb_repeat_rate, 50),
+		CONF_OPTION_UINT(0, "input-batch-size", &conf->input_batch_size, 64),
 
 		/* Grabs / Keyboard-Shortcuts */
 		CONF_OPTION_GRAB(0, "grab-scroll-up", &conf->grab_scroll_up, &def_grab_scroll_up),
@@ -591,6 +635,8 @@ int kmscon_conf_new(struct conf_ctx **out)
 		CONF_OPTION_GRAB(0, "grab-session-dummy", &conf->grab_session_dummy, &def_grab_session_dummy),
 		CONF_OPTION_GRAB(0, "grab-session-close", &conf->grab_session_close, &def_grab_session_close),
 		CONF_OPTION_GRAB(0, "grab-terminal-new", &conf->grab_terminal_new, &def_grab_terminal_new),
+		CONF_OPTION_GRAB(0, "grab-dump-stats", &conf->grab_dump_stats, &def_grab_dump_stats),
+		CONF_OPTION_GRAB(0, "grab-hud", &conf->grab_hud, &def_grab_hud),
 
 		/* Video Options */
 		CONF_OPTION_BOOL_FULL(0, "drm", aftercheck_drm, NULL, NULL, &conf->drm, true),
@@ -62,6 +62,18 @@ struct kmscon_conf_t {
 	char *configdir;
 	/* listen mode */
 	bool listen;
+	/* fork a worker process per seat */
+	bool per_seat_process;
+	/* memory budget in megabytes; 0 disables cache eviction */
+	unsigned int mem_limit;
+	/* CPU list for the dispatch thread; NULL keeps the inherited set */
+	char *cpu_affinity;
+	/* CPU list for worker threads; NULL falls back to cpu_affinity */
+	char *worker_affinity;
+	/* SCHED_FIFO priority of the dispatch thread; 0 disables */
+	unsigned int rt_prio;
+	/* nice level of the process; 0 keeps the inherited level */
+	int nice_level;
 
 	/* Seat Options */
 	/* VT number to run on */
@@ -92,6 +104,10 @@ struct kmscon_conf_t {
 	char *palette;
 	/* terminal scroll-back buffer size */
 	unsigned int sb_size;
+	/* directory for terminal output recordings; NULL disables */
+	char *record_dir;
+	/* size limit of a single recording file in megabytes */
+	unsigned int record_size;
 
 	/* Input Options */
 	/* input KBD model */
@@ -108,6 +124,8 @@ struct kmscon_conf_t {
 	unsigned int xkb_repeat_delay;
 	/* keyboard key-repeat rate */
 	unsigned int xkb_repeat_rate;
+	/* input events read per syscall from a device */
+	unsigned int input_batch_size;
 
 	/* Grabs / Keyboard-Shortcuts */
 	/* scroll-up grab */
@@ -132,6 +150,10 @@ struct kmscon_conf_t {
 	struct conf_grab *grab_session_close;
 	/* terminal-new grab */
 	struct conf_grab *grab_terminal_new;
+	/* dump-stats grab */
+	struct conf_grab *grab_dump_stats;
+	/* performance-HUD grab */
+	struct conf_grab *grab_hud;
 
 	/* Video Options */
 	/* use DRM if available */
@@ -40,6 +40,11 @@
 struct display {
 	struct shl_dlist list;
 	struct uterm_display *disp;
+	/* number of buffers of the swap cycle already holding the rendered
+	 * frame; once all are filled, exposes only re-flip */
+	unsigned int filled;
+	unsigned int mode_w;
+	unsigned int mode_h;
 };
 
 struct kmscon_dummy {
@@ -48,16 +53,34 @@ struct kmscon_dummy {
 	bool active;
 };
 
+/* The content is static, so it only has to be drawn until every buffer of
+ * the swap cycle holds it; afterwards exposes and activations merely flip
+ * the retained buffers and parked seats consume no render CPU. A mode
+ * switch invalidates the retained frames. */
 static void dummy_redraw(struct kmscon_dummy *dummy, struct display *d)
 {
 	struct uterm_mode *mode;
-	unsigned int w, h;
+	unsigned int w, h, bufs;
 
 	mode = uterm_display_get_current(d->disp);
 	w = uterm_mode_get_width(mode);
 	h = uterm_mode_get_height(mode);
 
-	uterm_display_fill(d->disp, 0, 0, 0, 0, 0, w, h);
+	if (w != d->mode_w || h != d->mode_h) {
+		d->filled = 0;
+		d->mode_w = w;
+		d->mode_h = h;
+	}
+
+	/* a backend reporting no fixed buffer cycle gives no content
+	 * guarantees, so keep redrawing there */
+	bufs = uterm_display_get_bufs(d->disp);
+
+	if (!bufs || d->filled < bufs) {
+		uterm_display_fill(d->disp, 0, 0, 0, 0, 0, w, h);
+		++d->filled;
+	}
+
 	uterm_display_swap(d->disp, false);
 }
 
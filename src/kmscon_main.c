@@ -24,21 +24,30 @@
  */
 
 #include <errno.h>
+#include <inttypes.h>
 #include <paths.h>
+#include <pthread.h>
+#include <sched.h>
 #include <signal.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/inotify.h>
+#include <sys/resource.h>
 #include <sys/signalfd.h>
+#include <sys/wait.h>
+#include <unistd.h>
 #include "conf.h"
 #include "eloop.h"
 #include "kmscon_conf.h"
 #include "kmscon_module.h"
 #include "kmscon_seat.h"
+#include "mem.h"
 #include "shl_dlist.h"
 #include "shl_log.h"
 #include "shl_misc.h"
+#include "shl_sched.h"
 #include "text.h"
 #include "uterm_input.h"
 #include "uterm_monitor.h"
@@ -65,15 +74,44 @@ struct app_seat {
 	struct conf_ctx *conf_ctx;
 	struct kmscon_conf_t *conf;
 	struct shl_dlist videos;
+
+	/* worker process in --per-seat-process mode; 0 otherwise. Such
+	 * seats have no local kmscon_seat object and no video devices. */
+	pid_t pid;
+};
+
+/* A video device found during the initial scan. Its blocking warm-up runs
+ * on a worker thread while the scan continues; the object itself is created
+ * on the main thread once the thread is joined. */
+struct app_pending_video {
+	struct shl_dlist list;
+	struct app_seat *seat;
+	const struct uterm_video_module *mode;
+	pthread_t thread;
+
+	unsigned int type;
+	unsigned int flags;
+	char *node;
+	struct uterm_monitor_dev *udev;
 };
 
 struct kmscon_app {
 	struct conf_ctx *conf_ctx;
 	struct kmscon_conf_t *conf;
+	/* original command line; re-executed for per-seat workers */
+	int argc;
+	char **argv;
 	bool exiting;
+	bool scanning;
+	struct shl_dlist pending_videos;
 
 	struct ev_eloop *eloop;
 	unsigned int vt_exit_count;
+	/* periodic RSS check against --mem-limit; NULL if disabled */
+	struct ev_timer *mem_timer;
+	/* inotify watch on configdir for live reload; NULL if unavailable */
+	struct ev_fd *conf_wfd;
+	int conf_fd;
 
 	struct uterm_vt_master *vtm;
 	struct uterm_monitor *mon;
@@ -152,6 +190,57 @@ static int app_seat_event(struct kmscon_seat *s, unsigned int event,
 	return 0;
 }
 
+/* Spawn a worker process for @seat in --per-seat-process mode. The worker
+ * re-executes the binary instead of running on the forked state, so it gets
+ * a fresh address space, eloop and caches; a renderer crash or memory leak
+ * on one seat cannot affect the others. Arguments appended to the original
+ * command line override earlier ones, so we can pass it through verbatim
+ * and only restrict the worker to its single seat. */
+static int app_seat_spawn(struct kmscon_app *app, struct app_seat *seat)
+{
+	char **argv;
+	sigset_t mask;
+	pid_t pid;
+	int i;
+
+	argv = malloc(sizeof(char*) * (app->argc + 4));
+	if (!argv) {
+		log_error("cannot allocate memory for worker argv on seat %s",
+			  seat->name);
+		return -ENOMEM;
+	}
+
+	for (i = 0; i < app->argc; ++i)
+		argv[i] = app->argv[i];
+	argv[i++] = "--no-per-seat-process";
+	argv[i++] = "--seats";
+	argv[i++] = seat->name;
+	argv[i] = NULL;
+
+	pid = fork();
+	if (pid < 0) {
+		log_error("cannot fork worker for seat %s (%d): %m",
+			  seat->name, errno);
+		free(argv);
+		return -errno;
+	} else if (!pid) {
+		/* the eloop blocks its signals; give the worker a clean mask */
+		sigemptyset(&mask);
+		sigprocmask(SIG_SETMASK, &mask, NULL);
+
+		execvp(app->argv[0], argv);
+		log_error("cannot exec %s for seat %s (%d): %m",
+			  app->argv[0], seat->name, errno);
+		_exit(127);
+	}
+
+	free(argv);
+	seat->pid = pid;
+	log_info("spawned worker process %d for seat %s", (int)pid,
+		 seat->name);
+	return 0;
+}
+
 static int app_seat_new(struct kmscon_app *app, const char *sname,
 			struct uterm_monitor_seat *useat)
 {
@@ -207,29 +296,40 @@ static int app_seat_new(struct kmscon_app *app, const char *sname,
 		goto err_free;
 	}
 
-	types = UTERM_VT_FAKE;
-	if (!app->conf->listen)
-		types |= UTERM_VT_REAL;
-
-	ret = kmscon_seat_new(&seat->seat, app->conf_ctx, app->eloop, app->vtm,
-			      types, sname, app_seat_event, seat);
-	if (ret) {
-		if (ret == -ERANGE)
-			log_debug("ignoring seat %s as it already has a seat manager",
-				  sname);
-		else
-			log_error("cannot create seat object on seat %s: %d",
-				  sname, ret);
-		goto err_name;
+	if (app->conf->per_seat_process) {
+		ret = app_seat_spawn(app, seat);
+		if (ret)
+			goto err_name;
+		/* the worker parses its own seat configuration */
+		seat->conf_ctx = app->conf_ctx;
+		seat->conf = app->conf;
+	} else {
+		types = UTERM_VT_FAKE;
+		if (!app->conf->listen)
+			types |= UTERM_VT_REAL;
+
+		ret = kmscon_seat_new(&seat->seat, app->conf_ctx, app->eloop,
+				      app->vtm, types, sname, app_seat_event,
+				      seat);
+		if (ret) {
+			if (ret == -ERANGE)
+				log_debug("ignoring seat %s as it already has a seat manager",
+					  sname);
+			else
+				log_error("cannot create seat object on seat %s: %d",
+					  sname, ret);
+			goto err_name;
+		}
+		seat->conf_ctx = kmscon_seat_get_conf(seat->seat);
+		seat->conf = conf_ctx_get_mem(seat->conf_ctx);
 	}
-	seat->conf_ctx = kmscon_seat_get_conf(seat->seat);
-	seat->conf = conf_ctx_get_mem(seat->conf_ctx);
 
 	uterm_monitor_set_seat_data(seat->useat, seat);
 	shl_dlist_link(&app->seats, &seat->list);
 	++app->running_seats;
 
-	kmscon_seat_startup(seat->seat);
+	if (seat->seat)
+		kmscon_seat_startup(seat->seat);
 
 	return 0;
 
@@ -246,6 +346,8 @@ static void app_seat_free(struct app_seat *seat)
 
 	shl_dlist_unlink(&seat->list);
 	uterm_monitor_set_seat_data(seat->useat, NULL);
+	if (seat->pid > 0)
+		kill(seat->pid, SIGTERM);
 	kmscon_seat_free(seat->seat);
 	free(seat->name);
 	free(seat);
@@ -318,6 +420,71 @@ static bool app_seat_gpu_is_ignored(struct app_seat *seat,
 	return false;
 }
 
+static const struct uterm_video_module *
+app_seat_video_mode(struct app_seat *seat, unsigned int type)
+{
+	if (type == UTERM_MONITOR_DRM) {
+		if (seat->conf->hwaccel)
+			return UTERM_VIDEO_DRM3D;
+		return UTERM_VIDEO_DRM2D;
+	}
+
+	return UTERM_VIDEO_FBDEV;
+}
+
+static void *app_video_prepare_thread(void *data)
+{
+	struct app_pending_video *pv = data;
+	int ret;
+
+	shl_sched_prepare_worker();
+
+	ret = uterm_video_prepare(pv->mode, pv->node);
+	if (ret)
+		log_debug("cannot prepare video device %s on seat %s: %d",
+			  pv->node, pv->seat->name, ret);
+
+	return NULL;
+}
+
+static int app_seat_queue_video(struct app_seat *seat,
+				unsigned int type,
+				unsigned int flags,
+				const char *node,
+				struct uterm_monitor_dev *udev)
+{
+	struct app_pending_video *pv;
+	int ret;
+
+	pv = malloc(sizeof(*pv));
+	if (!pv)
+		return -EAGAIN;
+	memset(pv, 0, sizeof(*pv));
+	pv->seat = seat;
+	pv->mode = app_seat_video_mode(seat, type);
+	pv->type = type;
+	pv->flags = flags;
+	pv->udev = udev;
+
+	pv->node = strdup(node);
+	if (!pv->node) {
+		free(pv);
+		return -EAGAIN;
+	}
+
+	ret = pthread_create(&pv->thread, NULL, app_video_prepare_thread, pv);
+	if (ret) {
+		free(pv->node);
+		free(pv);
+		return -EAGAIN;
+	}
+
+	log_debug("probing video device %s on seat %s in the background",
+		  node, seat->name);
+	shl_dlist_link_tail(&seat->app->pending_videos, &pv->list);
+	return 0;
+}
+
 static int app_seat_add_video(struct app_seat *seat,
 			      unsigned int type,
 			      unsigned int flags,
@@ -338,6 +505,13 @@ static int app_seat_add_video(struct app_seat *seat,
 				    node))
 		return -ERANGE;
 
+	if (seat->app->scanning) {
+		ret = app_seat_queue_video(seat, type, flags, node, udev);
+		if (ret != -EAGAIN)
+			return ret;
+		/* no worker thread; set the device up synchronously */
+	}
+
 	log_debug("new video device %s on seat %s", node, seat->name);
 
 	vid = malloc(sizeof(*vid));
@@ -358,14 +532,7 @@ static int app_seat_add_video(struct app_seat *seat,
 		goto err_free;
 	}
 
-	if (type == UTERM_MONITOR_DRM) {
-		if (seat->conf->hwaccel)
-			mode = UTERM_VIDEO_DRM3D;
-		else
-			mode = UTERM_VIDEO_DRM2D;
-	} else {
-		mode = UTERM_VIDEO_FBDEV;
-	}
+	mode = app_seat_video_mode(seat, type);
 
 	ret = uterm_video_new(&vid->video, seat->app->eloop, node, mode);
 	if (ret) {
@@ -404,6 +571,27 @@ err_free:
 	return ret;
 }
 
+/* Wait for the warm-up threads spawned during the scan and register their
+ * devices. The expensive probing already ran in parallel, so this serial
+ * pass is quick. */
+static void app_flush_pending_videos(struct kmscon_app *app)
+{
+	struct app_pending_video *pv;
+
+	while (!shl_dlist_empty(&app->pending_videos)) {
+		pv = shl_dlist_entry(app->pending_videos.next,
+				     struct app_pending_video, list);
+		shl_dlist_unlink(&pv->list);
+
+		pthread_join(pv->thread, NULL);
+		app_seat_add_video(pv->seat, pv->type, pv->flags, pv->node,
+				   pv->udev);
+
+		free(pv->node);
+		free(pv);
+	}
+}
+
 static void app_seat_remove_video(struct app_seat *seat, struct app_video *vid)
 {
 	struct uterm_display *disp;
@@ -446,7 +634,8 @@ static void app_monitor_event(struct uterm_monitor *mon,
 		break;
 	case UTERM_MONITOR_NEW_DEV:
 		seat = ev->seat_data;
-		if (!seat)
+		/* seat workers manage their own devices */
+		if (!seat || app->conf->per_seat_process)
 			return;
 
 		switch (ev->dev_type) {
@@ -467,7 +656,7 @@ static void app_monitor_event(struct uterm_monitor *mon,
 		break;
 	case UTERM_MONITOR_FREE_DEV:
 		seat = ev->seat_data;
-		if (!seat)
+		if (!seat || app->conf->per_seat_process)
 			return;
 
 		switch (ev->dev_type) {
@@ -485,7 +674,7 @@ static void app_monitor_event(struct uterm_monitor *mon,
 		break;
 	case UTERM_MONITOR_HOTPLUG_DEV:
 		seat = ev->seat_data;
-		if (!seat)
+		if (!seat || app->conf->per_seat_process)
 			return;
 
 		switch (ev->dev_type) {
@@ -495,15 +684,77 @@ static void app_monitor_event(struct uterm_monitor *mon,
 			if (!vid)
 				return;
 
-			log_debug("video hotplug event on device %s on seat %s",
-				  vid->node, seat->name);
-			uterm_video_poll(vid->video);
+			log_debug("video hotplug event on device %s on seat %s (connector %u)",
+				  vid->node, seat->name, ev->hotplug_conn);
+			uterm_video_poll_connector(vid->video,
+						   ev->hotplug_conn);
 			break;
 		}
 		break;
 	}
 }
 
+/* Interval of the memory watchdog. The caches only shed re-creatable data,
+ * so a coarse period is fine; it merely bounds how long the process may
+ * stay above the configured budget. */
+#define MEM_CHECK_PERIOD_SEC 10
+
+static void app_mem_event(struct ev_timer *timer, uint64_t num, void *data)
+{
+	struct kmscon_app *app = data;
+	uint64_t limit, rss;
+
+	limit = (uint64_t)app->conf->mem_limit * 1024 * 1024;
+	rss = mem_get_rss();
+	if (!rss || rss <= limit)
+		return;
+
+	log_info("resident memory %" PRIu64 "M exceeds budget of %uM; dropping caches (%" PRIu64 "M accounted)",
+		 rss / (1024 * 1024), app->conf->mem_limit,
+		 mem_cache_total() / (1024 * 1024));
+	mem_cache_shrink_all();
+}
+
+/* Reap per-seat workers. A dead worker is the multi-process analogue of a
+ * seat HUP: we stop tracking the seat but keep running the others, so a
+ * crash stays contained to its seat. The seat object itself is freed by the
+ * monitor once the seat goes away. */
+static void app_child_event(struct ev_eloop *eloop,
+			    struct ev_child_data *chld,
+			    void *data)
+{
+	struct kmscon_app *app = data;
+	struct shl_dlist *iter;
+	struct app_seat *seat;
+
+	shl_dlist_for_each(iter, &app->seats) {
+		seat = shl_dlist_entry(iter, struct app_seat, list);
+		if (seat->pid != chld->pid)
+			continue;
+
+		if (WIFSIGNALED(chld->status))
+			log_warning("worker for seat %s (pid %d) died by signal %d",
+				    seat->name, (int)chld->pid,
+				    WTERMSIG(chld->status));
+		else
+			log_info("worker for seat %s (pid %d) exited with status %d",
+				 seat->name, (int)chld->pid,
+				 WEXITSTATUS(chld->status));
+
+		seat->pid = 0;
+
+		if (!app->conf->listen) {
+			--app->running_seats;
+			if (!app->running_seats) {
+				log_debug("no more running seat workers; exiting...");
+				ev_eloop_exit(app->eloop);
+			}
+		}
+
+		return;
+	}
+}
+
 static void app_sig_generic(struct ev_eloop *eloop,
 			    struct signalfd_siginfo *info,
 			    void *data)
@@ -520,9 +771,121 @@ static void app_sig_ignore(struct ev_eloop *eloop,
 {
 }
 
+/* config files we react to: the main file and any per-seat file */
+static bool conf_watch_hit(const char *name)
+{
+	size_t len = strlen(name);
+
+	if (!strcmp(name, "kmscon.conf"))
+		return true;
+
+	return len > 10 && !strcmp(&name[len - 10], ".seat.conf");
+}
+
+/*
+ * Live configuration reload. When a config file in the configdir is
+ * replaced or written, the main configuration is re-parsed from scratch
+ * (command-line options keep their precedence) and every local seat
+ * replays its seat file on top of it. Sessions are then told via
+ * KMSCON_SESSION_RECONF and apply what they can in place; displays,
+ * PTYs and sessions stay alive throughout.
+ */
+static void app_conf_event(struct ev_fd *fd, int mask, void *data)
+{
+	struct kmscon_app *app = data;
+	struct app_seat *seat;
+	struct shl_dlist *iter;
+	char buf[4096] __attribute__((aligned(8)));
+	struct inotify_event *ev;
+	ssize_t len;
+	size_t off;
+	bool hit = false;
+	int ret;
+
+	if (!(mask & EV_READABLE))
+		return;
+
+	len = read(app->conf_fd, buf, sizeof(buf));
+	if (len <= 0)
+		return;
+
+	off = 0;
+	while (off + sizeof(*ev) <= (size_t)len) {
+		ev = (struct inotify_event*)&buf[off];
+		if (ev->len && conf_watch_hit(ev->name))
+			hit = true;
+		off += sizeof(*ev) + ev->len;
+	}
+
+	if (!hit)
+		return;
+
+	log_info("configuration changed, reloading");
+
+	conf_ctx_reset(app->conf_ctx);
+	ret = kmscon_conf_load_main(app->conf_ctx, app->argc, app->argv);
+	if (ret)
+		log_error("cannot reload main configuration, falling back to defaults: %d",
+			  ret);
+
+	/* The reset above freed the values the seat contexts alias via
+	 * CONF_SHARED, so the seats must re-share even if the re-parse
+	 * failed; otherwise they keep dereferencing freed memory. The
+	 * reset context holds the defaults, which is the best we can
+	 * offer for a broken config file. */
+	shl_dlist_for_each(iter, &app->seats) {
+		seat = shl_dlist_entry(iter, struct app_seat, list);
+		if (!seat->seat)
+			continue;
+		kmscon_seat_reload_conf(seat->seat);
+	}
+}
+
+/* Watch the configdir for live reload. Best-effort: a missing directory
+ * or an exhausted watch limit only disables reloads. */
+static void app_setup_conf_watch(struct kmscon_app *app)
+{
+	int ret;
+
+	app->conf_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (app->conf_fd < 0) {
+		log_warning("cannot create inotify object (%d): %m", errno);
+		return;
+	}
+
+	ret = inotify_add_watch(app->conf_fd, app->conf->configdir,
+				IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+	if (ret < 0) {
+		log_warning("cannot watch configdir %s (%d): %m",
+			    app->conf->configdir, errno);
+		goto err_close;
+	}
+
+	ret = ev_eloop_new_fd(app->eloop, &app->conf_wfd, app->conf_fd,
+			      EV_READABLE, app_conf_event, app);
+	if (ret) {
+		log_warning("cannot add configdir watch to eloop: %d", ret);
+		goto err_close;
+	}
+
+	return;
+
+err_close:
+	close(app->conf_fd);
+	app->conf_fd = -1;
+}
+
 static void destroy_app(struct kmscon_app *app)
 {
 	uterm_monitor_unref(app->mon);
+	if (app->conf->per_seat_process)
+		ev_eloop_unregister_child_cb(app->eloop, app_child_event, app);
+	if (app->mem_timer)
+		ev_eloop_rm_timer(app->mem_timer);
+	if (app->conf_wfd) {
+		ev_eloop_rm_fd(app->conf_wfd);
+		close(app->conf_fd);
+	}
 	uterm_vt_master_unref(app->vtm);
 	ev_eloop_unregister_signal_cb(app->eloop, SIGPIPE, app_sig_ignore,
 				      app);
@@ -535,9 +898,11 @@ static void destroy_app(struct kmscon_app *app)
 
 static int setup_app(struct kmscon_app *app)
 {
+	struct itimerspec spec;
 	int ret;
 
 	shl_dlist_init(&app->seats);
+	shl_dlist_init(&app->pending_videos);
 
 	ret = ev_eloop_new(&app->eloop, log_llog, NULL);
 	if (ret) {
@@ -566,6 +931,31 @@ static int setup_app(struct kmscon_app *app)
 		goto err_app;
 	}
 
+	if (app->conf->per_seat_process) {
+		ret = ev_eloop_register_child_cb(app->eloop, app_child_event,
+						 app);
+		if (ret) {
+			log_error("cannot register child reaper: %d", ret);
+			goto err_app;
+		}
+	}
+
+	if (app->conf->mem_limit) {
+		memset(&spec, 0, sizeof(spec));
+		spec.it_value.tv_sec = MEM_CHECK_PERIOD_SEC;
+		spec.it_interval.tv_sec = MEM_CHECK_PERIOD_SEC;
+
+		ret = ev_eloop_new_timer(app->eloop, &app->mem_timer, &spec,
+					 app_mem_event, app);
+		if (ret) {
+			log_error("cannot create memory watchdog timer: %d",
+				  ret);
+			goto err_app;
+		}
+	}
+
+	app_setup_conf_watch(app);
+
 	ret = uterm_vt_master_new(&app->vtm, app->eloop);
 	if (ret) {
 		log_error("cannot create VT master: %d", ret);
@@ -579,7 +969,11 @@ static int setup_app(struct kmscon_app *app)
 	}
 
 	log_debug("scanning for devices...");
+	app->scanning = true;
 	uterm_monitor_scan(app->mon);
+	app->scanning = false;
+
+	app_flush_pending_videos(app);
 
 	return 0;
 
@@ -588,6 +982,54 @@ err_app:
 	return ret;
 }
 
+/*
+ * Apply the CPU affinity and scheduling configuration. This must run before
+ * any thread is spawned so workers inherit the right CPU set by default.
+ * All of it is best-effort tuning: a typo or missing privileges must not
+ * keep the console from coming up, so we only warn on failure.
+ */
+static void setup_scheduling(struct kmscon_conf_t *conf)
+{
+	struct sched_param param;
+	const char *cpus;
+	int ret;
+
+	if (conf->cpu_affinity) {
+		ret = shl_sched_apply_cpus(conf->cpu_affinity);
+		if (ret)
+			log_warning("cannot apply cpu-affinity '%s': %d",
+				    conf->cpu_affinity, ret);
+	}
+
+	cpus = conf->worker_affinity ? : conf->cpu_affinity;
+	if (cpus) {
+		ret = shl_sched_set_worker_cpus(cpus);
+		if (ret)
+			log_warning("cannot apply worker-affinity '%s': %d",
+				    cpus, ret);
+	}
+
+	if (conf->nice_level) {
+		errno = 0;
+		if (setpriority(PRIO_PROCESS, 0, conf->nice_level) && errno)
+			log_warning("cannot set nice level %d (%d): %m",
+				    conf->nice_level, errno);
+	}
+
+	if (conf->rt_prio) {
+		memset(&param, 0, sizeof(param));
+		param.sched_priority = conf->rt_prio;
+		ret = pthread_setschedparam(pthread_self(), SCHED_FIFO,
+					    &param);
+		if (ret)
+			log_warning("cannot enable SCHED_FIFO prio %u (%d): %s",
+				    conf->rt_prio, ret, strerror(ret));
+		else
+			log_info("dispatch thread runs SCHED_FIFO prio %u",
+				 conf->rt_prio);
+	}
+}
+
 int main(int argc, char **argv)
 {
 	int ret;
@@ -613,6 +1055,8 @@ int main(int argc, char **argv)
 		return 0;
 	}
 
+	setup_scheduling(conf);
+
 	kmscon_load_modules();
 	kmscon_font_register(&kmscon_font_8x16_ops);
 	kmscon_text_register(&kmscon_text_bblit_ops);
@@ -620,6 +1064,8 @@ int main(int argc, char **argv)
 	memset(&app, 0, sizeof(app));
 	app.conf_ctx = conf_ctx;
 	app.conf = conf;
+	app.argc = argc;
+	app.argv = argv;
 
 	ret = setup_app(&app);
 	if (ret)
@@ -41,6 +41,26 @@
 
 static struct shl_dlist module_list = SHL_DLIST_INIT(module_list);
 
+/*
+ * Global modules are no longer loaded eagerly. Instead, kmscon_load_modules()
+ * only indexes the module directory and kmscon_load_module() opens a module
+ * the first time a backend of the same name is requested. Our modules are
+ * installed as "mod-<name>.so" where <name> matches the backend they register
+ * (mod-pango registers the "pango" font backend, mod-gltex the "gltex" text
+ * backend, ...), so the file name doubles as the manifest and boots that never
+ * select a backend never pay for its dependencies. Files that do not follow
+ * this naming scheme are loaded eagerly as before.
+ */
+
+struct module_file {
+	struct shl_dlist list;
+	char *name;
+	char *file;
+	struct kmscon_module *module;
+};
+
+static struct shl_dlist module_files = SHL_DLIST_INIT(module_files);
+
 int kmscon_module_open(struct kmscon_module **out, const char *file)
 {
 	int ret;
@@ -177,6 +197,68 @@ void kmscon_module_unload(struct kmscon_module *module)
 	module->loaded = false;
 }
 
+static int module_file_new(const char *name, size_t len, const char *file)
+{
+	struct module_file *ent;
+
+	ent = malloc(sizeof(*ent));
+	if (!ent)
+		return -ENOMEM;
+	memset(ent, 0, sizeof(*ent));
+
+	ent->name = strndup(name, len);
+	if (!ent->name) {
+		free(ent);
+		return -ENOMEM;
+	}
+
+	ent->file = strdup(file);
+	if (!ent->file) {
+		free(ent->name);
+		free(ent);
+		return -ENOMEM;
+	}
+
+	shl_dlist_link_tail(&module_files, &ent->list);
+	return 0;
+}
+
+int kmscon_load_module(const char *name)
+{
+	struct shl_dlist *iter;
+	struct module_file *ent;
+	struct kmscon_module *mod;
+	int ret;
+
+	if (!name)
+		return -EINVAL;
+
+	shl_dlist_for_each(iter, &module_files) {
+		ent = shl_dlist_entry(iter, struct module_file, list);
+		if (strcmp(ent->name, name))
+			continue;
+
+		if (ent->module)
+			return 0;
+
+		ret = kmscon_module_open(&mod, ent->file);
+		if (ret)
+			return ret;
+
+		ret = kmscon_module_load(mod);
+		if (ret) {
+			kmscon_module_unref(mod);
+			return ret;
+		}
+
+		shl_dlist_link(&module_list, &mod->list);
+		ent->module = mod;
+		return 0;
+	}
+
+	return -ENOENT;
+}
+
 void kmscon_load_modules(void)
 {
 	int ret;
@@ -184,10 +266,12 @@ void kmscon_load_modules(void)
 	struct dirent *buf, *de;
 	char *file;
 	struct kmscon_module *mod;
+	size_t len;
 
-	log_debug("loading global modules from %s", BUILD_MODULE_DIR);
+	log_debug("indexing global modules in %s", BUILD_MODULE_DIR);
 
-	if (!shl_dlist_empty(&module_list)) {
+	if (!shl_dlist_empty(&module_files) ||
+	    !shl_dlist_empty(&module_list)) {
 		log_error("trying to load global modules twice");
 		return;
 	}
@@ -240,6 +324,18 @@ void kmscon_load_modules(void)
 			continue;
 		}
 
+		/* "mod-<name>.so" modules are indexed for on-demand loading,
+		 * everything else is loaded right away */
+		if (!strncmp(de->d_name, "mod-", 4)) {
+			len = strlen(de->d_name) - 4 - 3;
+			ret = module_file_new(&de->d_name[4], len, file);
+			free(file);
+			if (ret)
+				log_error("cannot index module %s: %d",
+					  de->d_name, ret);
+			continue;
+		}
+
 		ret = kmscon_module_open(&mod, file);
 		free(file);
 
@@ -262,6 +358,7 @@ void kmscon_load_modules(void)
 void kmscon_unload_modules(void)
 {
 	struct kmscon_module *module;
+	struct module_file *ent;
 
 	log_debug("unloading modules");
 
@@ -272,4 +369,13 @@ void kmscon_unload_modules(void)
 		kmscon_module_unload(module);
 		kmscon_module_unref(module);
 	}
+
+	while (!shl_dlist_empty(&module_files)) {
+		ent = shl_dlist_entry(module_files.prev, struct module_file,
+				      list);
+		shl_dlist_unlink(&ent->list);
+		free(ent->name);
+		free(ent->file);
+		free(ent);
+	}
 }
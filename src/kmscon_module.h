@@ -49,6 +49,11 @@
  * release the resources as there might still be users of it. Only when
  * "module_exit" is called, kmscon guarantees that there are no more users and
  * the module can release its resources.
+ *
+ * Global modules are not opened at startup. kmscon_load_modules() only indexes
+ * the module directory and kmscon_load_module() loads the module providing a
+ * given backend name on first use, so unused backends never pull in their
+ * dependencies.
  */
 
 #ifndef KMSCON_MODULE_H
@@ -66,6 +71,7 @@ int kmscon_module_load(struct kmscon_module *module);
 void kmscon_module_unload(struct kmscon_module *module);
 
 void kmscon_load_modules(void);
+int kmscon_load_module(const char *name);
 void kmscon_unload_modules(void);
 
 #endif /* KMSCON_MODULE_H */
@@ -30,9 +30,11 @@
  */
 
 #include <errno.h>
+#include <inttypes.h>
 #include <stdlib.h>
 #include <string.h>
 #include "conf.h"
+#include "shl_timer.h"
 #include "eloop.h"
 #include "kmscon_conf.h"
 #include "kmscon_dummy.h"
@@ -57,10 +59,20 @@ struct kmscon_session {
 
 	struct ev_timer *timer;
 
+	/* framebuffer snapshots taken at deactivation; see
+	 * session_take_snapshots() */
+	struct shl_dlist snapshots;
+
 	kmscon_session_cb_t cb;
 	void *data;
 };
 
+struct kmscon_snapshot {
+	struct shl_dlist list;
+	struct uterm_display *disp;
+	struct uterm_video_buffer buf;
+};
+
 struct kmscon_display {
 	struct shl_dlist list;
 	struct kmscon_seat *seat;
@@ -79,6 +91,8 @@ struct kmscon_seat {
 	struct uterm_vt_master *vtm;
 	struct conf_ctx *conf_ctx;
 	struct kmscon_conf_t *conf;
+	/* main configuration the seat conf inherits from; owned by main */
+	struct conf_ctx *main_conf;
 
 	char *name;
 	struct uterm_input *input;
@@ -90,6 +104,8 @@ struct kmscon_seat {
 
 	bool awake;
 	bool foreground;
+	/* terminal session is spawned on first input; see seat_input_event */
+	bool pending_terminal;
 	struct kmscon_session *current_sess;
 	struct kmscon_session *scheduled_sess;
 	struct kmscon_session *dummy_sess;
@@ -282,6 +298,95 @@ static int seat_go_awake(struct kmscon_seat *seat)
 	return 0;
 }
 
+/*
+ * Session snapshots
+ * When a session is deactivated, the last frame of every display is copied
+ * aside. On re-activation it is blitted back and flipped before the session
+ * gets to render, so switching sessions instantly shows the old content
+ * instead of a blank screen until the real redraw lands. Backends that
+ * cannot export their framebuffer simply get no snapshot.
+ */
+
+static void session_drop_snapshots(struct kmscon_session *sess,
+				   struct uterm_display *disp)
+{
+	struct shl_dlist *iter, *tmp;
+	struct kmscon_snapshot *snap;
+
+	shl_dlist_for_each_safe(iter, tmp, &sess->snapshots) {
+		snap = shl_dlist_entry(iter, struct kmscon_snapshot, list);
+		if (disp && snap->disp != disp)
+			continue;
+		shl_dlist_unlink(&snap->list);
+		uterm_display_unref(snap->disp);
+		free(snap->buf.data);
+		free(snap);
+	}
+}
+
+static void session_take_snapshots(struct kmscon_session *sess)
+{
+	struct kmscon_seat *seat = sess->seat;
+	struct shl_dlist *iter;
+	struct kmscon_display *d;
+	struct kmscon_snapshot *snap;
+	struct uterm_video_buffer buf;
+	int ret;
+
+	session_drop_snapshots(sess, NULL);
+
+	shl_dlist_for_each(iter, &seat->displays) {
+		d = shl_dlist_entry(iter, struct kmscon_display, list);
+
+		ret = uterm_display_snapshot(d->disp, &buf);
+		if (ret)
+			continue;
+
+		snap = malloc(sizeof(*snap));
+		if (!snap)
+			continue;
+		memset(snap, 0, sizeof(*snap));
+
+		snap->buf = buf;
+		snap->buf.data = malloc(buf.height * buf.stride);
+		if (!snap->buf.data) {
+			free(snap);
+			continue;
+		}
+		memcpy(snap->buf.data, buf.data, buf.height * buf.stride);
+
+		snap->disp = d->disp;
+		uterm_display_ref(snap->disp);
+		shl_dlist_link(&sess->snapshots, &snap->list);
+	}
+}
+
+static void session_show_snapshots(struct kmscon_session *sess)
+{
+	struct shl_dlist *iter;
+	struct kmscon_snapshot *snap;
+	struct uterm_mode *mode;
+	int ret;
+
+	shl_dlist_for_each(iter, &sess->snapshots) {
+		snap = shl_dlist_entry(iter, struct kmscon_snapshot, list);
+
+		/* a mode-change invalidates the snapshot */
+		mode = uterm_display_get_current(snap->disp);
+		if (!mode ||
+		    uterm_mode_get_width(mode) != snap->buf.width ||
+		    uterm_mode_get_height(mode) != snap->buf.height)
+			continue;
+
+		ret = uterm_display_blit(snap->disp, &snap->buf, 0, 0);
+		if (ret)
+			continue;
+		uterm_display_swap(snap->disp, false);
+	}
+
+	session_drop_snapshots(sess, NULL);
+}
+
 static int seat_run(struct kmscon_seat *seat)
 {
 	int ret;
@@ -315,6 +420,8 @@ static int seat_run(struct kmscon_seat *seat)
 		}
 	}
 
+	session_show_snapshots(session);
+
 	ret = session_call_activate(session);
 	if (ret) {
 		log_warning("cannot activate session %p: %d", session, ret);
@@ -343,6 +450,7 @@ static int seat_pause(struct kmscon_seat *seat, bool force)
 	if (!seat->current_sess)
 		return 0;
 
+	session_take_snapshots(seat->current_sess);
 	seat->current_sess->deactivating = true;
 	ret = session_call_deactivate(seat->current_sess);
 	if (ret) {
@@ -514,6 +622,11 @@ static void seat_remove_display(struct kmscon_seat *seat,
 		}
 	}
 
+	shl_dlist_for_each(iter, &seat->sessions) {
+		s = shl_dlist_entry(iter, struct kmscon_session, list);
+		session_drop_snapshots(s, d->disp);
+	}
+
 	uterm_display_unref(d->disp);
 	free(d);
 }
@@ -541,12 +654,25 @@ static int seat_vt_event(struct uterm_vt *vt, struct uterm_vt_event *ev,
 	int ret;
 
 	switch (ev->action) {
-	case UTERM_VT_ACTIVATE:
+	case UTERM_VT_ACTIVATE: {
+		struct shl_timer timer;
+		uint64_t wake_usecs;
+
+		/* per-stage timing so switch-latency regressions show up in
+		 * the debug log: the wake stage re-inits the video devices,
+		 * the run stage restores snapshots and activates the session */
+		shl_timer_reset(&timer);
 		ret = seat_go_awake(seat);
 		if (ret)
 			return ret;
+		wake_usecs = shl_timer_elapsed(&timer);
+
+		shl_timer_reset(&timer);
 		seat_run(seat);
+		log_debug("seat %s activation stages: %" PRIu64 "us wake-up, %" PRIu64 "us session-run",
+			  seat->name, wake_usecs, shl_timer_elapsed(&timer));
 		break;
+	}
 	case UTERM_VT_DEACTIVATE:
 		seat->async_schedule = SCHEDULE_VT;
 		ret = seat_pause(seat, false);
@@ -579,6 +705,26 @@ static void seat_input_event(struct uterm_input *input,
 	if (ev->handled || !seat->awake)
 		return;
 
+	/* Seats start with only the cheap dummy session; the full terminal
+	 * (login process, PTY, renderer, fonts) is spawned once somebody
+	 * actually types on the seat. The triggering keypress only wakes
+	 * the seat up; it is not delivered to the new terminal. */
+	if (seat->pending_terminal) {
+		seat->pending_terminal = false;
+		ret = kmscon_terminal_register(&s, seat,
+					       uterm_vt_get_num(seat->vt));
+		if (ret == -EOPNOTSUPP) {
+			log_notice("terminal support not compiled in");
+		} else if (ret) {
+			log_error("cannot register terminal session: %d",
+				  ret);
+		} else {
+			s->enabled = true;
+			seat->scheduled_sess = s;
+			seat_switch(seat);
+		}
+	}
+
 	if (conf_grab_matches(seat->conf->grab_session_next,
 			      ev->mods, ev->num_syms, ev->keysyms)) {
 		ev->handled = true;
@@ -674,6 +820,7 @@ int kmscon_seat_new(struct kmscon_seat **out,
 	seat->vtm = vtm;
 	seat->cb = cb;
 	seat->data = data;
+	seat->main_conf = main_conf;
 	shl_dlist_init(&seat->displays);
 	shl_dlist_init(&seat->sessions);
 
@@ -723,6 +870,8 @@ int kmscon_seat_new(struct kmscon_seat **out,
 	if (ret)
 		goto err_conf;
 
+	uterm_input_set_batch_size(seat->input, seat->conf->input_batch_size);
+
 	ret = uterm_input_register_cb(seat->input, seat_input_event, seat);
 	if (ret)
 		goto err_input;
@@ -814,14 +963,23 @@ void kmscon_seat_startup(struct kmscon_seat *seat)
 	}
 
 	if (seat->conf->terminal_session) {
-		ret = kmscon_terminal_register(&s, seat,
-					       uterm_vt_get_num(seat->vt));
-		if (ret == -EOPNOTSUPP)
-			log_notice("terminal support not compiled in");
-		else if (ret)
-			log_error("cannot register terminal session");
-		else
-			kmscon_session_enable(s);
+		if (seat->dummy_sess) {
+			/* Spawning a login process, PTY, renderer and font
+			 * instances for every seat at startup is wasteful on
+			 * multi-seat machines where most seats stay idle
+			 * between reboots. Show the static dummy screen and
+			 * create the terminal on the first keypress. */
+			seat->pending_terminal = true;
+		} else {
+			ret = kmscon_terminal_register(&s, seat,
+						uterm_vt_get_num(seat->vt));
+			if (ret == -EOPNOTSUPP)
+				log_notice("terminal support not compiled in");
+			else if (ret)
+				log_error("cannot register terminal session");
+			else
+				kmscon_session_enable(s);
+		}
 	}
 
 	if (seat->conf->switchvt ||
@@ -925,6 +1083,38 @@ struct conf_ctx *kmscon_seat_get_conf(struct kmscon_seat *seat)
 	return seat->conf_ctx;
 }
 
+/*
+ * Re-parse the seat configuration in place and tell all sessions about it.
+ * The conf object the sessions hold stays valid; only the values change.
+ * Command-line options keep their precedence, the replay runs through the
+ * same parser chain as the initial startup.
+ */
+int kmscon_seat_reload_conf(struct kmscon_seat *seat)
+{
+	struct shl_dlist *iter;
+	struct kmscon_session *sess;
+	int ret;
+
+	if (!seat)
+		return -EINVAL;
+
+	conf_ctx_reset(seat->conf_ctx);
+	ret = kmscon_conf_load_seat(seat->conf_ctx, seat->main_conf,
+				    seat->name);
+	if (ret) {
+		log_error("cannot reload configuration on seat %s: %d",
+			  seat->name, ret);
+		return ret;
+	}
+
+	shl_dlist_for_each(iter, &seat->sessions) {
+		sess = shl_dlist_entry(iter, struct kmscon_session, list);
+		session_call(sess, KMSCON_SESSION_RECONF, NULL);
+	}
+
+	return 0;
+}
+
 void kmscon_seat_schedule(struct kmscon_seat *seat, unsigned int id)
 {
 	struct shl_dlist *iter;
@@ -984,6 +1174,7 @@ int kmscon_seat_register_session(struct kmscon_seat *seat,
 	sess->cb = cb;
 	sess->data = data;
 	sess->foreground = true;
+	shl_dlist_init(&sess->snapshots);
 
 	/* register new sessions next to the current one */
 	if (seat->current_sess)
@@ -1045,6 +1236,7 @@ void kmscon_session_unregister(struct kmscon_session *sess)
 		}
 	}
 
+	session_drop_snapshots(sess, NULL);
 	shl_dlist_unlink(&sess->list);
 	--seat->session_count;
 	sess->seat = NULL;
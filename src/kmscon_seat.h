@@ -61,6 +61,9 @@ enum kmscon_session_event_type {
 	KMSCON_SESSION_DISPLAY_REFRESH,
 	KMSCON_SESSION_ACTIVATE,
 	KMSCON_SESSION_DEACTIVATE,
+	/* the seat configuration was reloaded; sessions re-read the conf
+	 * object they hold and apply what they can without a restart */
+	KMSCON_SESSION_RECONF,
 	KMSCON_SESSION_UNREGISTER,
 };
 
@@ -97,6 +100,7 @@ const char *kmscon_seat_get_name(struct kmscon_seat *seat);
 struct uterm_input *kmscon_seat_get_input(struct kmscon_seat *seat);
 struct ev_eloop *kmscon_seat_get_eloop(struct kmscon_seat *seat);
 struct conf_ctx *kmscon_seat_get_conf(struct kmscon_seat *seat);
+int kmscon_seat_reload_conf(struct kmscon_seat *seat);
 
 void kmscon_seat_schedule(struct kmscon_seat *seat, unsigned int id);
 
@@ -33,8 +33,10 @@
 #include <errno.h>
 #include <inttypes.h>
 #include <libtsm.h>
+#include <pthread.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 #include "conf.h"
 #include "eloop.h"
 #include "kmscon_conf.h"
@@ -43,6 +45,9 @@
 #include "pty.h"
 #include "shl_dlist.h"
 #include "shl_log.h"
+#include "shl_ring.h"
+#include "shl_sched.h"
+#include "shl_timer.h"
 #include "text.h"
 #include "uterm_input.h"
 #include "uterm_video.h"
@@ -57,14 +62,32 @@ struct screen {
 
 	bool swapping;
 	bool pending;
+
+	/* render-worker bookkeeping; see redraw_screens() */
+	struct shl_dlist job;
+	tsm_age_t job_age;
+	bool rendered;
+
+	/* clone-mode sharing; see mirror_screen() */
+	struct screen *mirror_of;
+	bool mirrored;
+	bool mirror_broken;
+
+	/* hardware cursor plane; see cursor_enable() */
+	bool hw_cursor;
+	struct uterm_video_buffer cursor_buf;
 };
 
+#define RENDER_POOL_MAX 8
+
 struct kmscon_terminal {
 	unsigned long ref;
 	struct ev_eloop *eloop;
 	struct uterm_input *input;
 	bool opened;
 	bool awake;
+	/* a reloaded conf changed the font while the video slept */
+	bool pending_font;
 
 	struct conf_ctx *conf_ctx;
 	struct kmscon_conf_t *conf;
@@ -82,6 +105,52 @@ struct kmscon_terminal {
 	struct kmscon_font_attr font_attr;
 	struct kmscon_font *font;
 	struct kmscon_font *bold_font;
+	struct ev_counter *font_ready;
+
+	/* render worker pool; see redraw_screens() */
+	pthread_mutex_t pool_lock;
+	pthread_cond_t pool_cond;
+	pthread_cond_t pool_done;
+	struct shl_dlist pool_jobs;
+	unsigned int pool_pending;
+	unsigned int pool_threads;
+	pthread_t pool_tids[RENDER_POOL_MAX];
+	bool pool_stop;
+
+	/* hardware cursor; see cursor_enable() */
+	struct ev_timer *cursor_timer;
+	bool hw_cursor;
+	bool cursor_drawn;
+	unsigned int cursor_x;
+	unsigned int cursor_y;
+
+	/* blinking cells; see blink_sync() */
+	struct ev_timer *blink_timer;
+	bool blink_armed;
+	bool blink_phase;
+
+	/* overload governor; see overload_account() */
+	struct ev_timer *degrade_timer;
+	unsigned int load_score;
+	bool degraded;
+	bool degrade_armed;
+
+	/* performance HUD; see hud_draw() */
+	bool hud;
+	struct ev_timer *hud_timer;
+	struct shl_timer hud_rate_timer;
+	uint64_t hud_pty_bytes;
+	uint64_t hud_pty_rate;
+	uint64_t hud_frame_usecs;
+
+	/* background parse throttle; see pty_input() */
+	struct shl_ring *backlog;
+	struct ev_timer *backlog_timer;
+	size_t backlog_len;
+	bool backlog_armed;
+
+	/* the scheduled redraw must treat the buffer contents as unknown */
+	bool redraw_test;
 };
 
 static void do_clear_margins(struct screen *scr)
@@ -111,29 +180,483 @@ static void do_clear_margins(struct screen *scr)
 				   sw, dh);
 }
 
-static void do_redraw_screen(struct screen *scr)
-{
-	int ret;
+static void hud_draw(struct screen *scr, uint64_t cells);
+static void hud_account(struct kmscon_terminal *term, uint64_t usecs);
 
-	if (!scr->term->awake)
-		return;
+/* The render phase of a redraw. Screens own independent kmscon_text and
+ * display state and only read the shared console, so this may run off the
+ * eloop thread as long as nobody writes to the console concurrently. */
+static tsm_age_t do_render_screen(struct screen *scr)
+{
+	tsm_age_t age;
+	uint64_t cells;
 
-	scr->pending = false;
 	do_clear_margins(scr);
 
+	cells = scr->txt->stats.cells;
 	kmscon_text_prepare(scr->txt);
-	tsm_screen_draw(scr->term->console, kmscon_text_draw_cb, scr->txt);
+	age = tsm_screen_draw(scr->term->console, kmscon_text_draw_cb,
+			      scr->txt);
+	if (kmscon_text_shift_stale(scr->txt, age)) {
+		/* the declared scroll was clamped away by tsm; the buffer
+		 * was shifted wrongly so redraw the frame from scratch */
+		kmscon_text_abort(scr->txt);
+		kmscon_text_prepare(scr->txt);
+		age = tsm_screen_draw(scr->term->console, kmscon_text_draw_cb,
+				      scr->txt);
+	}
+	if (scr->term->hud)
+		hud_draw(scr, scr->txt->stats.cells - cells);
 	kmscon_text_render(scr->txt);
 
+	return age;
+}
+
+static void do_swap_screen(struct screen *scr, tsm_age_t age)
+{
+	struct shl_timer timer;
+	int ret;
+
+	shl_timer_reset(&timer);
 	ret = uterm_display_swap(scr->disp, false);
-	if (ret) {
+	kmscon_text_record_swap(scr->txt, shl_timer_elapsed(&timer));
+	if (ret == -EBUSY) {
+		/* A page-flip is still pending even though we did not expect
+		 * one (a hotplug-modeset or wakeup might have scheduled it
+		 * behind our back). Register interest in the frame so the
+		 * page-flip event re-renders it instead of dropping it. */
+		kmscon_text_damage_all(scr->txt);
+		scr->swapping = true;
+		scr->pending = true;
+		return;
+	} else if (ret) {
 		log_warning("cannot swap display %p", scr->disp);
+		kmscon_text_damage_all(scr->txt);
 		return;
 	}
 
+	kmscon_text_set_age(scr->txt, age);
 	scr->swapping = true;
 }
 
+/*
+ * Hardware cursor
+ * If every display of the terminal provides a cursor plane, the cursor is
+ * not rendered into the framebuffer at all: tsm is told to skip it and a
+ * small solid block is shown on the plane instead. Moving the cursor is
+ * then a single plane update and blinking toggles the plane twice a second
+ * without touching a single cell. If any display lacks cursor support we
+ * fall back to the rendered cursor everywhere so it never shows up twice.
+ */
+
+#define CURSOR_BLINK_PERIOD_MS 500
+#define CURSOR_BLINK_SLACK_MS 50
+
+static int screen_set_cursor(struct screen *scr, bool show)
+{
+	if (!show)
+		return uterm_display_set_cursor(scr->disp, NULL);
+
+	if (!scr->cursor_buf.data)
+		return -ENOMEM;
+
+	return uterm_display_set_cursor(scr->disp, &scr->cursor_buf);
+}
+
+static int screen_init_cursor(struct screen *scr)
+{
+	struct kmscon_terminal *term = scr->term;
+	unsigned int w, h, i;
+	uint32_t *px;
+
+	w = term->font->attr.width;
+	h = term->font->attr.height;
+
+	free(scr->cursor_buf.data);
+	scr->cursor_buf.data = malloc(w * h * 4);
+	if (!scr->cursor_buf.data)
+		return -ENOMEM;
+
+	scr->cursor_buf.width = w;
+	scr->cursor_buf.height = h;
+	scr->cursor_buf.stride = w * 4;
+	scr->cursor_buf.format = UTERM_FORMAT_XRGB32;
+
+	px = (uint32_t*)scr->cursor_buf.data;
+	for (i = 0; i < w * h; ++i)
+		px[i] = 0x00ffffff;
+
+	return 0;
+}
+
+static void cursor_arm_timer(struct kmscon_terminal *term)
+{
+	struct itimerspec spec;
+
+	/* the overload governor keeps the cursor solid */
+	if (term->degraded)
+		return;
+
+	memset(&spec, 0, sizeof(spec));
+	spec.it_value.tv_nsec = CURSOR_BLINK_PERIOD_MS * 1000000L;
+	spec.it_interval.tv_nsec = CURSOR_BLINK_PERIOD_MS * 1000000L;
+	ev_timer_update(term->cursor_timer, &spec);
+}
+
+/*
+ * Re-position the cursor plane after a redraw. The cursor is kept solid
+ * while it moves; blinking resumes half a period after the last movement.
+ */
+static void cursor_sync(struct kmscon_terminal *term)
+{
+	struct shl_dlist *iter;
+	struct screen *scr;
+	unsigned int x, y;
+	bool show;
+
+	if (!term->hw_cursor)
+		return;
+
+	x = tsm_screen_get_cursor_x(term->console);
+	y = tsm_screen_get_cursor_y(term->console);
+	if (term->cursor_drawn && x == term->cursor_x && y == term->cursor_y)
+		return;
+
+	show = !term->cursor_drawn;
+	term->cursor_drawn = true;
+	term->cursor_x = x;
+	term->cursor_y = y;
+	cursor_arm_timer(term);
+
+	shl_dlist_for_each(iter, &term->screens) {
+		scr = shl_dlist_entry(iter, struct screen, list);
+		if (!scr->hw_cursor)
+			continue;
+		if (show)
+			screen_set_cursor(scr, true);
+		uterm_display_move_cursor(scr->disp,
+					  x * scr->txt->font->attr.width,
+					  y * scr->txt->font->attr.height);
+	}
+}
+
+static void cursor_timer_event(struct ev_timer *timer, uint64_t num,
+			       void *data)
+{
+	struct kmscon_terminal *term = data;
+	struct shl_dlist *iter;
+	struct screen *scr;
+
+	if (!term->awake || !term->hw_cursor)
+		return;
+
+	term->cursor_drawn = !term->cursor_drawn;
+	shl_dlist_for_each(iter, &term->screens) {
+		scr = shl_dlist_entry(iter, struct screen, list);
+		if (scr->hw_cursor)
+			screen_set_cursor(scr, term->cursor_drawn);
+	}
+}
+
+/*
+ * Probe all screens for cursor-plane support and switch between the plane
+ * cursor and the rendered cursor accordingly. Must be called whenever the
+ * set of screens, the font or the video wakeup-state changes.
+ */
+static void cursor_enable(struct kmscon_terminal *term)
+{
+	struct shl_dlist *iter;
+	struct screen *scr;
+	bool hw;
+
+	if (!term->awake)
+		return;
+
+	hw = !shl_dlist_empty(&term->screens);
+	shl_dlist_for_each(iter, &term->screens) {
+		scr = shl_dlist_entry(iter, struct screen, list);
+		scr->hw_cursor = !screen_set_cursor(scr, true);
+		if (!scr->hw_cursor)
+			hw = false;
+	}
+
+	if (!hw) {
+		shl_dlist_for_each(iter, &term->screens) {
+			scr = shl_dlist_entry(iter, struct screen, list);
+			if (scr->hw_cursor)
+				screen_set_cursor(scr, false);
+			scr->hw_cursor = false;
+		}
+	}
+
+	term->hw_cursor = hw;
+	term->cursor_drawn = false;
+	if (hw) {
+		tsm_screen_set_flags(term->console, TSM_SCREEN_HIDE_CURSOR);
+		cursor_sync(term);
+	} else {
+		tsm_screen_reset_flags(term->console, TSM_SCREEN_HIDE_CURSOR);
+		ev_timer_update(term->cursor_timer, NULL);
+	}
+}
+
+/*
+ * Blinking cells
+ * The text renderers track the set of cells carrying the blink attribute, so
+ * the blink timer runs only while that set is non-empty and an idle terminal
+ * without blinking content causes no periodic wakeups. A tick merely toggles
+ * the phase and redraws; the age-based damage tracking reduces that redraw to
+ * repainting the tracked cells.
+ */
+
+static void redraw_screens(struct kmscon_terminal *term);
+
+static void blink_disarm(struct kmscon_terminal *term)
+{
+	struct shl_dlist *iter;
+	struct screen *scr;
+
+	ev_timer_update(term->blink_timer, NULL);
+	term->blink_armed = false;
+
+	/* leave the cells visible while the timer is off */
+	term->blink_phase = true;
+	shl_dlist_for_each(iter, &term->screens) {
+		scr = shl_dlist_entry(iter, struct screen, list);
+		kmscon_text_set_blink(scr->txt, true);
+	}
+}
+
+/* Called after every redraw to arm/disarm the timer according to the set of
+ * blinking cells the renderers saw. */
+static void blink_sync(struct kmscon_terminal *term)
+{
+	struct shl_dlist *iter;
+	struct screen *scr;
+	struct itimerspec spec;
+	bool need = false;
+
+	shl_dlist_for_each(iter, &term->screens) {
+		scr = shl_dlist_entry(iter, struct screen, list);
+		if (kmscon_text_blink_num(scr->txt)) {
+			need = true;
+			break;
+		}
+	}
+
+	/* the overload governor suspends blinking */
+	if (term->degraded)
+		need = false;
+
+	if (need == term->blink_armed)
+		return;
+
+	if (!need) {
+		blink_disarm(term);
+		return;
+	}
+
+	term->blink_armed = true;
+	memset(&spec, 0, sizeof(spec));
+	spec.it_value.tv_nsec = CURSOR_BLINK_PERIOD_MS * 1000000L;
+	spec.it_interval.tv_nsec = CURSOR_BLINK_PERIOD_MS * 1000000L;
+	ev_timer_update(term->blink_timer, &spec);
+}
+
+static void blink_timer_event(struct ev_timer *timer, uint64_t num,
+			      void *data)
+{
+	struct kmscon_terminal *term = data;
+	struct shl_dlist *iter;
+	struct screen *scr;
+
+	if (!term->awake)
+		return;
+
+	term->blink_phase = !term->blink_phase;
+	shl_dlist_for_each(iter, &term->screens) {
+		scr = shl_dlist_entry(iter, struct screen, list);
+		kmscon_text_set_blink(scr->txt, term->blink_phase);
+	}
+
+	redraw_screens(term);
+}
+
+/*
+ * Overload governor
+ * On a flooded high-resolution software-rendered seat a single redraw can
+ * take longer than the refresh interval; redrawing at full rate then makes
+ * the eloop fall ever further behind and input latency grows without bound.
+ * Every redraw round is timed and scored: over-budget rounds raise the load
+ * score, cheap rounds lower it. Above the entry threshold the terminal
+ * degrades: PTY-coalesced redraws are paced down to half the refresh rate
+ * and the blink timers (cells and cursor plane) stop so periodic frames no
+ * longer pile onto the overload. Input-triggered redraws are never paced --
+ * keeping those immediate is the point of the exercise. The exit threshold
+ * sits far below the entry one so one lucky frame cannot flap the governor.
+ */
+
+/* uterm modes carry no refresh rate; assume the ubiquitous 60Hz */
+#define OVERLOAD_BUDGET_US 16667
+#define OVERLOAD_ENTER 8
+#define OVERLOAD_SCORE_MAX 16
+
+static void overload_enter(struct kmscon_terminal *term)
+{
+	struct shl_dlist *iter;
+	struct screen *scr;
+
+	term->degraded = true;
+	log_debug("sustained overload, degrading terminal %p", term);
+
+	/* stop the periodic timers; blinking cells stay visible and the
+	 * cursor plane stays solid */
+	blink_disarm(term);
+	ev_timer_update(term->cursor_timer, NULL);
+	if (term->hw_cursor && !term->cursor_drawn) {
+		term->cursor_drawn = true;
+		shl_dlist_for_each(iter, &term->screens) {
+			scr = shl_dlist_entry(iter, struct screen, list);
+			if (scr->hw_cursor)
+				screen_set_cursor(scr, true);
+		}
+	}
+}
+
+static void overload_leave(struct kmscon_terminal *term)
+{
+	term->degraded = false;
+	log_debug("overload over, restoring terminal %p", term);
+
+	if (term->hw_cursor)
+		cursor_arm_timer(term);
+	blink_sync(term);
+}
+
+static void overload_account(struct kmscon_terminal *term, uint64_t usecs)
+{
+	if (usecs > OVERLOAD_BUDGET_US) {
+		term->load_score += 2;
+		if (term->load_score > OVERLOAD_SCORE_MAX)
+			term->load_score = OVERLOAD_SCORE_MAX;
+	} else if (term->load_score) {
+		--term->load_score;
+	}
+
+	if (!term->degraded && term->load_score >= OVERLOAD_ENTER)
+		overload_enter(term);
+	else if (term->degraded && !term->load_score)
+		overload_leave(term);
+}
+
+/*
+ * Clone-mode sharing
+ * Screens on displays with identical mode geometry produce identical frames:
+ * they share the console and font and derive cols/rows from the mode, so
+ * rendering the grid once per clone is pure waste. The first such screen
+ * renders normally and the clones copy its displayed frame via
+ * snapshot+blit (a memcpy for the software backends, a texture upload for
+ * drm3d) instead of walking the cell grid again. If a backend pair cannot
+ * snapshot or blit, the clone is demoted to independent rendering for good.
+ * Clones never update their kmscon_text damage state, so whenever one goes
+ * back to rendering its buffer ages are stale and must be discarded.
+ */
+
+/* Find an earlier same-geometry screen of this round that @scr can copy
+ * from; only screens that render themselves qualify as sources. */
+static struct screen *find_mirror_source(struct screen *scr)
+{
+	struct uterm_mode *mode, *omode;
+	struct shl_dlist *iter;
+	struct screen *other;
+
+	if (scr->mirror_broken)
+		return NULL;
+
+	mode = uterm_display_get_current(scr->disp);
+	if (!mode)
+		return NULL;
+
+	shl_dlist_for_each(iter, &scr->term->screens) {
+		other = shl_dlist_entry(iter, struct screen, list);
+		if (other == scr)
+			break;
+
+		if (!other->rendered || other->mirror_of)
+			continue;
+
+		omode = uterm_display_get_current(other->disp);
+		if (!omode)
+			continue;
+
+		if (uterm_mode_get_width(omode) !=
+					uterm_mode_get_width(mode) ||
+		    uterm_mode_get_height(omode) !=
+					uterm_mode_get_height(mode))
+			continue;
+
+		return other;
+	}
+
+	return NULL;
+}
+
+/* Copy the newest frame of the mirror-source onto @scr and flip. Runs after
+ * the source swapped, so the snapshot is the frame we want to clone. */
+static void mirror_screen(struct screen *scr)
+{
+	struct uterm_video_buffer buf;
+	int ret;
+
+	ret = uterm_display_snapshot(scr->mirror_of->disp, &buf);
+	if (!ret)
+		ret = uterm_display_blit(scr->disp, &buf, 0, 0);
+	if (ret) {
+		log_debug("cannot mirror display %p from %p (%d), rendering independently",
+			  scr->disp, scr->mirror_of->disp, ret);
+		scr->mirror_of = NULL;
+		scr->mirror_broken = true;
+		kmscon_text_damage_all(scr->txt);
+		do_swap_screen(scr, do_render_screen(scr));
+		return;
+	}
+
+	/* the blitted frame matches no recorded age */
+	do_swap_screen(scr, 0);
+}
+
+static void redraw_screen(struct screen *scr);
+
+static void do_redraw_screen(struct screen *scr)
+{
+	struct shl_dlist *iter;
+	struct screen *other;
+
+	if (!scr->term->awake)
+		return;
+
+	scr->pending = false;
+
+	if (scr->mirror_of) {
+		mirror_screen(scr);
+		cursor_sync(scr->term);
+		blink_sync(scr->term);
+		return;
+	}
+
+	do_swap_screen(scr, do_render_screen(scr));
+
+	/* clones copy our displayed frame; let them catch up */
+	shl_dlist_for_each(iter, &scr->term->screens) {
+		other = shl_dlist_entry(iter, struct screen, list);
+		if (other->mirror_of == scr)
+			redraw_screen(other);
+	}
+
+	cursor_sync(scr->term);
+	blink_sync(scr->term);
+}
+
 static void redraw_screen(struct screen *scr)
 {
 	if (!scr->term->awake)
@@ -145,6 +668,201 @@ static void redraw_screen(struct screen *scr)
 		do_redraw_screen(scr);
 }
 
+/*
+ * Render worker pool
+ * With multiple displays, rendering them serially lets one slow display
+ * throttle all others. Each screen owns independent per-display state, so
+ * the render phase runs on worker threads, one job per screen. The eloop
+ * thread blocks until all jobs finished, which keeps the shared console
+ * read-only while the workers iterate it; the font backends are thread-safe
+ * already. Only the page-flip submission runs on the eloop thread afterwards.
+ * Only backends that declare thread_render are dispatched to the pool; the
+ * others (gltex binds the display-shared EGL context to the calling thread)
+ * render on the eloop thread while the workers run.
+ */
+static void *render_pool_thread(void *data)
+{
+	struct kmscon_terminal *term = data;
+	struct screen *scr;
+
+	shl_sched_prepare_worker();
+
+	pthread_mutex_lock(&term->pool_lock);
+	while (!term->pool_stop) {
+		if (shl_dlist_empty(&term->pool_jobs)) {
+			pthread_cond_wait(&term->pool_cond, &term->pool_lock);
+			continue;
+		}
+
+		scr = shl_dlist_entry(term->pool_jobs.next, struct screen,
+				      job);
+		shl_dlist_unlink(&scr->job);
+		pthread_mutex_unlock(&term->pool_lock);
+
+		scr->job_age = do_render_screen(scr);
+
+		pthread_mutex_lock(&term->pool_lock);
+		if (!--term->pool_pending)
+			pthread_cond_signal(&term->pool_done);
+	}
+	pthread_mutex_unlock(&term->pool_lock);
+
+	return NULL;
+}
+
+static void render_pool_start(struct kmscon_terminal *term, unsigned int num)
+{
+	long cpus;
+	int ret;
+
+	if (term->pool_threads)
+		return;
+
+	cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	if (cpus < 2)
+		return;
+	if (num > (unsigned long)cpus)
+		num = cpus;
+	if (num > RENDER_POOL_MAX)
+		num = RENDER_POOL_MAX;
+
+	while (term->pool_threads < num) {
+		ret = pthread_create(&term->pool_tids[term->pool_threads],
+				     NULL, render_pool_thread, term);
+		if (ret) {
+			log_warning("cannot create render worker: %d", ret);
+			break;
+		}
+		++term->pool_threads;
+	}
+
+	log_debug("started %u render workers", term->pool_threads);
+}
+
+static void render_pool_stop(struct kmscon_terminal *term)
+{
+	unsigned int i;
+
+	if (!term->pool_threads)
+		return;
+
+	pthread_mutex_lock(&term->pool_lock);
+	term->pool_stop = true;
+	pthread_cond_broadcast(&term->pool_cond);
+	pthread_mutex_unlock(&term->pool_lock);
+
+	for (i = 0; i < term->pool_threads; ++i)
+		pthread_join(term->pool_tids[i], NULL);
+	term->pool_threads = 0;
+	term->pool_stop = false;
+}
+
+/* Redraw all screens that can render right now; screens with a page-flip in
+ * flight are marked pending as in redraw_screen(). Multiple ready screens
+ * render in parallel on the worker pool, then swap serially. */
+static void redraw_screens(struct kmscon_terminal *term)
+{
+	struct shl_dlist *iter;
+	struct shl_timer timer;
+	struct screen *scr;
+	unsigned int num = 0, pool_num = 0;
+	uint64_t usecs;
+
+	shl_dlist_for_each(iter, &term->screens) {
+		scr = shl_dlist_entry(iter, struct screen, list);
+		scr->mirror_of = NULL;
+		if (scr->swapping) {
+			scr->pending = true;
+			continue;
+		}
+		scr->pending = false;
+		scr->rendered = true;
+
+		scr->mirror_of = find_mirror_source(scr);
+		if (scr->mirror_of) {
+			scr->mirrored = true;
+			continue;
+		}
+
+		if (scr->mirrored) {
+			/* the buffers hold copied frames; the recorded ages
+			 * are meaningless */
+			kmscon_text_damage_all(scr->txt);
+			scr->mirrored = false;
+		}
+
+		++num;
+		if (scr->txt->ops->thread_render)
+			++pool_num;
+	}
+
+	if (!num)
+		return;
+
+	shl_timer_reset(&timer);
+
+	if (pool_num > 1)
+		render_pool_start(term, pool_num);
+
+	if (pool_num > 1 && term->pool_threads) {
+		pthread_mutex_lock(&term->pool_lock);
+		term->pool_pending = pool_num;
+		shl_dlist_for_each(iter, &term->screens) {
+			scr = shl_dlist_entry(iter, struct screen, list);
+			if (scr->rendered && !scr->mirror_of &&
+			    scr->txt->ops->thread_render)
+				shl_dlist_link_tail(&term->pool_jobs,
+						    &scr->job);
+		}
+		pthread_cond_broadcast(&term->pool_cond);
+		pthread_mutex_unlock(&term->pool_lock);
+
+		/* thread-bound backends render here while the workers run */
+		shl_dlist_for_each(iter, &term->screens) {
+			scr = shl_dlist_entry(iter, struct screen, list);
+			if (scr->rendered && !scr->mirror_of &&
+			    !scr->txt->ops->thread_render)
+				scr->job_age = do_render_screen(scr);
+		}
+
+		pthread_mutex_lock(&term->pool_lock);
+		while (term->pool_pending)
+			pthread_cond_wait(&term->pool_done, &term->pool_lock);
+		pthread_mutex_unlock(&term->pool_lock);
+	} else {
+		shl_dlist_for_each(iter, &term->screens) {
+			scr = shl_dlist_entry(iter, struct screen, list);
+			if (scr->rendered && !scr->mirror_of)
+				scr->job_age = do_render_screen(scr);
+		}
+	}
+
+	shl_dlist_for_each(iter, &term->screens) {
+		scr = shl_dlist_entry(iter, struct screen, list);
+		if (scr->rendered && !scr->mirror_of) {
+			scr->rendered = false;
+			do_swap_screen(scr, scr->job_age);
+		}
+	}
+
+	/* clones copy the frames their sources just flipped */
+	shl_dlist_for_each(iter, &term->screens) {
+		scr = shl_dlist_entry(iter, struct screen, list);
+		if (scr->rendered && scr->mirror_of) {
+			scr->rendered = false;
+			mirror_screen(scr);
+		}
+	}
+
+	usecs = shl_timer_elapsed(&timer);
+	overload_account(term, usecs);
+	if (term->hud)
+		hud_account(term, usecs);
+
+	cursor_sync(term);
+	blink_sync(term);
+}
+
 static void redraw_all(struct kmscon_terminal *term)
 {
 	struct shl_dlist *iter;
@@ -155,10 +873,274 @@ static void redraw_all(struct kmscon_terminal *term)
 
 	shl_dlist_for_each(iter, &term->screens) {
 		scr = shl_dlist_entry(iter, struct screen, list);
-		redraw_screen(scr);
+		kmscon_text_dirty(scr->txt);
+	}
+
+	redraw_screens(term);
+}
+
+/*
+ * Redraw after a pure scrollback movement of @lines cell-rows (positive if
+ * the content moved up). This keeps the scroll fast-path of the renderers
+ * usable; any other change must go through redraw_all().
+ */
+static void scroll_all(struct kmscon_terminal *term, int lines)
+{
+	struct shl_dlist *iter;
+	struct screen *scr;
+
+	if (!term->awake)
+		return;
+
+	shl_dlist_for_each(iter, &term->screens) {
+		scr = shl_dlist_entry(iter, struct screen, list);
+		kmscon_text_set_shift(scr->txt, lines);
+	}
+
+	redraw_screens(term);
+}
+
+static void redraw_all_test(struct kmscon_terminal *term);
+
+static void redraw_dispatch(struct kmscon_terminal *term)
+{
+	if (term->redraw_test) {
+		term->redraw_test = false;
+		redraw_all_test(term);
+	} else {
+		redraw_all(term);
 	}
 }
 
+static void redraw_idle_event(struct ev_eloop *eloop, void *unused, void *data)
+{
+	struct kmscon_terminal *term = data;
+
+	redraw_dispatch(term);
+}
+
+static void degrade_timer_event(struct ev_timer *timer, uint64_t num,
+				void *data)
+{
+	struct kmscon_terminal *term = data;
+
+	term->degrade_armed = false;
+	if (!term->awake)
+		return;
+
+	redraw_dispatch(term);
+}
+
+/*
+ * Coalesce PTY-triggered redraws into a single redraw_all() per eloop round.
+ * The idle-callback fires after all pending events of the current round were
+ * dispatched, so this adds no noticeable latency for interactive input while
+ * output floods no longer trigger a full redraw per PTY read. While the
+ * overload governor is engaged, redraws are paced by a timer at half the
+ * assumed refresh rate instead, so an over-budget frame gets a full budget
+ * of slack before the next one starts.
+ */
+static void schedule_redraw(struct kmscon_terminal *term)
+{
+	struct itimerspec spec;
+	int ret;
+
+	if (term->degraded) {
+		if (term->degrade_armed)
+			return;
+
+		memset(&spec, 0, sizeof(spec));
+		spec.it_value.tv_nsec = 2 * OVERLOAD_BUDGET_US * 1000L;
+		ret = ev_timer_update(term->degrade_timer, &spec);
+		if (!ret) {
+			term->degrade_armed = true;
+			return;
+		}
+	}
+
+	ret = ev_eloop_register_idle_cb(term->eloop, redraw_idle_event, term,
+					EV_ONESHOT | EV_SINGLE);
+	if (ret)
+		redraw_all(term);
+}
+
+/*
+ * Performance HUD
+ * A hotkey-toggled overlay in the top-right corner showing the frame time,
+ * damage coverage, glyph-cache hit rate and PTY throughput of the terminal.
+ * Attaching profilers to a seat mid-incident is impractical; the HUD gives
+ * the same first-order numbers on the console itself.
+ *
+ * The HUD cells are drawn directly through kmscon_text after the console
+ * iteration of each frame. Direct draws bypass the age-based damage
+ * tracking, so the overlay is repainted on every rendered frame and never
+ * leaves stale pixels in any buffer of the swap-cycle. While the HUD is
+ * visible a periodic timer schedules a redraw so the numbers stay live even
+ * on an otherwise idle terminal.
+ */
+
+#define HUD_REFRESH_PERIOD_MS 500
+#define HUD_LINE_MAX 32
+
+static void hud_draw_line(struct kmscon_text *txt, unsigned int posy,
+			  const char *line)
+{
+	struct tsm_screen_attr attr;
+	unsigned int posx, len, i;
+	uint32_t ch;
+
+	len = strlen(line);
+	if (len > txt->cols)
+		return;
+	posx = txt->cols - len;
+
+	memset(&attr, 0, sizeof(attr));
+	attr.fccode = -1;
+	attr.bccode = -1;
+	attr.fr = 255;
+	attr.fg = 255;
+	attr.fb = 255;
+	attr.br = 64;
+	attr.bg = 64;
+	attr.bb = 64;
+
+	for (i = 0; i < len; ++i) {
+		ch = line[i];
+		kmscon_text_draw(txt, ch, &ch, 1, 1, posx + i, posy, &attr);
+	}
+}
+
+/* @cells is the number of cells the console iteration of this frame drew;
+ * runs on the render workers, which only read the terminal state */
+static void hud_draw(struct screen *scr, uint64_t cells)
+{
+	struct kmscon_terminal *term = scr->term;
+	struct kmscon_text *txt = scr->txt;
+	struct kmscon_font *font = txt->font;
+	char line[HUD_LINE_MAX];
+	uint64_t total, lookups;
+	unsigned int percent;
+
+	if (txt->rows < 5 || txt->cols < 20)
+		return;
+
+	snprintf(line, sizeof(line), " frame %6" PRIu64 "us ",
+		 term->hud_frame_usecs);
+	hud_draw_line(txt, 0, line);
+
+	total = (uint64_t)txt->cols * txt->rows;
+	percent = cells * 100 / total;
+	if (percent > 100)
+		percent = 100;
+	snprintf(line, sizeof(line), " damage %4u%% ", percent);
+	hud_draw_line(txt, 1, line);
+
+	/* fixed-table font backends never miss and record no stats */
+	lookups = font->stats.hits + font->stats.misses;
+	percent = lookups ? font->stats.hits * 100 / lookups : 100;
+	snprintf(line, sizeof(line), " glyphs %4u%% ", percent);
+	hud_draw_line(txt, 2, line);
+
+	snprintf(line, sizeof(line), " pty %4" PRIu64 "KB/s ",
+		 term->hud_pty_rate / 1024);
+	hud_draw_line(txt, 3, line);
+}
+
+/* Update the HUD counters after a redraw round that took @usecs. The PTY
+ * rate is averaged since the last update but at least over one refresh
+ * period, so bursts of coalesced redraws do not make it jitter. */
+static void hud_account(struct kmscon_terminal *term, uint64_t usecs)
+{
+	uint64_t window;
+
+	term->hud_frame_usecs = usecs;
+
+	window = shl_timer_elapsed(&term->hud_rate_timer);
+	if (window < HUD_REFRESH_PERIOD_MS * 1000)
+		return;
+
+	term->hud_pty_rate = term->hud_pty_bytes * 1000000 / window;
+	term->hud_pty_bytes = 0;
+	shl_timer_reset(&term->hud_rate_timer);
+}
+
+static void hud_timer_event(struct ev_timer *timer, uint64_t num, void *data)
+{
+	struct kmscon_terminal *term = data;
+
+	if (!term->awake)
+		return;
+
+	schedule_redraw(term);
+}
+
+static void hud_arm(struct kmscon_terminal *term)
+{
+	struct itimerspec spec;
+
+	memset(&spec, 0, sizeof(spec));
+	spec.it_value.tv_nsec = HUD_REFRESH_PERIOD_MS * 1000000L;
+	spec.it_interval.tv_nsec = HUD_REFRESH_PERIOD_MS * 1000000L;
+	ev_timer_update(term->hud_timer, &spec);
+}
+
+static void hud_toggle(struct kmscon_terminal *term)
+{
+	struct shl_dlist *iter;
+	struct screen *scr;
+
+	term->hud = !term->hud;
+
+	if (term->hud) {
+		shl_timer_reset(&term->hud_rate_timer);
+		term->hud_pty_bytes = 0;
+		term->hud_pty_rate = 0;
+		term->hud_frame_usecs = 0;
+		hud_arm(term);
+	} else {
+		ev_timer_update(term->hud_timer, NULL);
+	}
+
+	/* the overlay cells are invisible to the damage tracking, so every
+	 * buffer of the swap-cycle must be repainted from scratch */
+	shl_dlist_for_each(iter, &term->screens) {
+		scr = shl_dlist_entry(iter, struct screen, list);
+		kmscon_text_damage_all(scr->txt);
+	}
+	redraw_all(term);
+}
+
+static void font_ready_event(struct ev_counter *cnt, uint64_t num, void *data)
+{
+	struct kmscon_terminal *term = data;
+	struct shl_dlist *iter;
+	struct screen *scr;
+
+	if (!term->awake)
+		return;
+
+	/* a deferred glyph landed; we do not know which cells show its
+	 * placeholder so damage everything once */
+	shl_dlist_for_each(iter, &term->screens) {
+		scr = shl_dlist_entry(iter, struct screen, list);
+		kmscon_text_damage_all(scr->txt);
+	}
+
+	redraw_screens(term);
+}
+
+/*
+ * Called by the font backend when a background-rasterized glyph becomes
+ * available. This may run on the backend's worker thread so only poke the
+ * eloop-counter, which is thread-safe.
+ */
+static void font_event(struct kmscon_font *font, void *unused, void *data)
+{
+	struct kmscon_terminal *term = data;
+
+	ev_counter_inc(term->font_ready, 1);
+}
+
 static void redraw_all_test(struct kmscon_terminal *term)
 {
 	struct shl_dlist *iter;
@@ -171,8 +1153,11 @@ static void redraw_all_test(struct kmscon_terminal *term)
 		scr = shl_dlist_entry(iter, struct screen, list);
 		if (uterm_display_is_swapping(scr->disp))
 			scr->swapping = true;
-		redraw_screen(scr);
+		/* buffer contents are unknown after refresh/activation */
+		kmscon_text_damage_all(scr->txt);
 	}
+
+	redraw_screens(term);
 }
 
 static void display_event(struct uterm_display *disp,
@@ -248,6 +1233,15 @@ static int font_set(struct kmscon_terminal *term)
 		kmscon_font_ref(bold_font);
 	}
 
+	kmscon_font_register_ready_cb(font, font_event, term);
+	if (bold_font != font)
+		kmscon_font_register_ready_cb(bold_font, font_event, term);
+
+	if (term->bold_font && term->bold_font != term->font)
+		kmscon_font_unregister_ready_cb(term->bold_font, font_event,
+						term);
+	if (term->font)
+		kmscon_font_unregister_ready_cb(term->font, font_event, term);
 	kmscon_font_unref(term->bold_font);
 	kmscon_font_unref(term->font);
 	term->font = font;
@@ -263,6 +1257,10 @@ static int font_set(struct kmscon_terminal *term)
 			log_warning("cannot change text-renderer font: %d",
 				    ret);
 
+		ret = screen_init_cursor(ent);
+		if (ret)
+			log_warning("cannot resize cursor image: %d", ret);
+
 		terminal_resize(term,
 				kmscon_text_get_cols(ent->txt),
 				kmscon_text_get_rows(ent->txt),
@@ -270,6 +1268,7 @@ static int font_set(struct kmscon_terminal *term)
 	}
 
 	terminal_resize(term, 0, 0, true, true);
+	cursor_enable(term);
 	return 0;
 }
 
@@ -279,6 +1278,7 @@ static int add_display(struct kmscon_terminal *term, struct uterm_display *disp)
 	struct screen *scr;
 	int ret;
 	const char *be;
+	char ename[32];
 	bool opengl;
 
 	shl_dlist_for_each(iter, &term->screens) {
@@ -303,12 +1303,21 @@ static int add_display(struct kmscon_terminal *term, struct uterm_display *disp)
 	}
 
 	ret = uterm_display_use(scr->disp, &opengl);
-	if (term->conf->render_engine)
+	if (term->conf->render_engine &&
+	    !strcmp(term->conf->render_engine, "auto")) {
+		/* benchmarked once per device and then read back from disk */
+		if (kmscon_text_autoselect(term->font, term->bold_font,
+					   scr->disp, ename, sizeof(ename)))
+			be = (ret >= 0 && opengl) ? "gltex" : "bbulk";
+		else
+			be = ename;
+	} else if (term->conf->render_engine) {
 		be = term->conf->render_engine;
-	else if (ret >= 0 && opengl)
+	} else if (ret >= 0 && opengl) {
 		be = "gltex";
-	else
+	} else {
 		be = "bbulk";
+	}
 
 	ret = kmscon_text_new(&scr->txt, be);
 	if (ret) {
@@ -323,6 +1332,12 @@ static int add_display(struct kmscon_terminal *term, struct uterm_display *disp)
 		goto err_text;
 	}
 
+	kmscon_text_set_blink(scr->txt, term->blink_phase);
+
+	ret = screen_init_cursor(scr);
+	if (ret)
+		log_warning("cannot create cursor image: %d", ret);
+
 	terminal_resize(term,
 			kmscon_text_get_cols(scr->txt),
 			kmscon_text_get_rows(scr->txt),
@@ -331,6 +1346,7 @@ static int add_display(struct kmscon_terminal *term, struct uterm_display *disp)
 	shl_dlist_link(&term->screens, &scr->list);
 
 	log_debug("added display %p to terminal %p", disp, term);
+	cursor_enable(term);
 	redraw_screen(scr);
 	uterm_display_ref(scr->disp);
 	return 0;
@@ -352,6 +1368,18 @@ static void free_screen(struct screen *scr, bool update)
 
 	log_debug("destroying terminal screen %p", scr);
 	shl_dlist_unlink(&scr->list);
+
+	/* demote clones of this screen; they re-pick a source or render
+	 * themselves on their next redraw */
+	shl_dlist_for_each(iter, &term->screens) {
+		ent = shl_dlist_entry(iter, struct screen, list);
+		if (ent->mirror_of == scr)
+			ent->mirror_of = NULL;
+	}
+
+	if (scr->hw_cursor)
+		screen_set_cursor(scr, false);
+	free(scr->cursor_buf.data);
 	kmscon_text_unref(scr->txt);
 	uterm_display_unregister_cb(scr->disp, display_event, scr);
 	uterm_display_unref(scr->disp);
@@ -371,6 +1399,7 @@ static void free_screen(struct screen *scr, bool update)
 	}
 
 	terminal_resize(term, 0, 0, true, true);
+	cursor_enable(term);
 }
 
 static void rm_display(struct kmscon_terminal *term, struct uterm_display *disp)
@@ -396,6 +1425,8 @@ static void input_event(struct uterm_input *input,
 			void *data)
 {
 	struct kmscon_terminal *term = data;
+	struct shl_dlist *iter;
+	struct screen *scr;
 
 	if (!term->opened || !term->awake || ev->handled)
 		return;
@@ -403,14 +1434,29 @@ static void input_event(struct uterm_input *input,
 	if (conf_grab_matches(term->conf->grab_scroll_up,
 			      ev->mods, ev->num_syms, ev->keysyms)) {
 		tsm_screen_sb_up(term->console, 1);
-		redraw_all(term);
+		scroll_all(term, -1);
 		ev->handled = true;
 		return;
 	}
 	if (conf_grab_matches(term->conf->grab_scroll_down,
 			      ev->mods, ev->num_syms, ev->keysyms)) {
 		tsm_screen_sb_down(term->console, 1);
-		redraw_all(term);
+		scroll_all(term, 1);
+		ev->handled = true;
+		return;
+	}
+	if (conf_grab_matches(term->conf->grab_dump_stats,
+			      ev->mods, ev->num_syms, ev->keysyms)) {
+		shl_dlist_for_each(iter, &term->screens) {
+			scr = shl_dlist_entry(iter, struct screen, list);
+			kmscon_text_dump_stats(scr->txt);
+		}
+		ev->handled = true;
+		return;
+	}
+	if (conf_grab_matches(term->conf->grab_hud,
+			      ev->mods, ev->num_syms, ev->keysyms)) {
+		hud_toggle(term);
 		ev->handled = true;
 		return;
 	}
@@ -505,24 +1551,127 @@ static void terminal_close(struct kmscon_terminal *term)
 	term->opened = false;
 }
 
+/*
+ * Background parse throttle
+ * An inactive terminal parses PTY output purely to keep its state current;
+ * nothing is rendered from it. Feeding the parser at full rate lets a chatty
+ * background session steal CPU from the foreground one, so while the terminal
+ * is not awake its PTY data is buffered and parsed in one large batch per
+ * timer tick. The backlog is bounded: above the high-water mark it is parsed
+ * immediately since dropping bytes would corrupt the emulation state.
+ */
+
+#define BACKLOG_PERIOD_MS 250
+#define BACKLOG_MAX (1024 * 1024)
+
+static void backlog_drain(struct kmscon_terminal *term)
+{
+	const char *buf;
+	size_t len;
+
+	while ((buf = shl_ring_peek(term->backlog, &len, 0))) {
+		tsm_vte_input(term->vte, buf, len);
+		shl_ring_drop(term->backlog, len);
+	}
+	term->backlog_len = 0;
+
+	if (term->backlog_armed) {
+		ev_timer_update(term->backlog_timer, NULL);
+		term->backlog_armed = false;
+	}
+}
+
+static void backlog_timer_event(struct ev_timer *timer, uint64_t num,
+				void *data)
+{
+	struct kmscon_terminal *term = data;
+
+	backlog_drain(term);
+}
+
+static void backlog_arm(struct kmscon_terminal *term)
+{
+	struct itimerspec spec;
+
+	memset(&spec, 0, sizeof(spec));
+	spec.it_value.tv_nsec = BACKLOG_PERIOD_MS * 1000000L;
+	spec.it_interval.tv_nsec = BACKLOG_PERIOD_MS * 1000000L;
+	ev_timer_update(term->backlog_timer, &spec);
+	term->backlog_armed = true;
+}
+
 static void terminal_destroy(struct kmscon_terminal *term)
 {
 	log_debug("free terminal object %p", term);
 
 	terminal_close(term);
+	render_pool_stop(term);
 	rm_all_screens(term);
+	ev_eloop_unregister_idle_cb(term->eloop, redraw_idle_event, term,
+				    EV_SINGLE);
 	uterm_input_unregister_cb(term->input, input_event, term);
 	ev_eloop_rm_fd(term->ptyfd);
 	kmscon_pty_unref(term->pty);
+	if (term->bold_font != term->font)
+		kmscon_font_unregister_ready_cb(term->bold_font, font_event,
+						term);
+	kmscon_font_unregister_ready_cb(term->font, font_event, term);
 	kmscon_font_unref(term->bold_font);
 	kmscon_font_unref(term->font);
+	shl_ring_free(term->backlog);
+	ev_eloop_rm_timer(term->hud_timer);
+	ev_eloop_rm_timer(term->degrade_timer);
+	ev_eloop_rm_timer(term->backlog_timer);
+	ev_eloop_rm_timer(term->blink_timer);
+	ev_eloop_rm_timer(term->cursor_timer);
+	ev_eloop_rm_counter(term->font_ready);
 	tsm_vte_unref(term->vte);
 	tsm_screen_unref(term->console);
 	uterm_input_unref(term->input);
 	ev_eloop_unref(term->eloop);
+	pthread_cond_destroy(&term->pool_done);
+	pthread_cond_destroy(&term->pool_cond);
+	pthread_mutex_destroy(&term->pool_lock);
 	free(term);
 }
 
+/*
+ * Apply a live configuration reload. Only options that work without
+ * tearing down displays or sessions are picked up: font, color palette
+ * and scrollback size; everything else still requires a restart. Font
+ * changes need the video awake so the renderers can rebuild their
+ * buffers and are deferred to the next activation while we sleep.
+ */
+static void terminal_reconf(struct kmscon_terminal *term)
+{
+	struct kmscon_font_attr attr;
+	int ret;
+
+	tsm_screen_set_max_sb(term->console, term->conf->sb_size);
+	tsm_vte_set_palette(term->vte, term->conf->palette);
+
+	memset(&attr, 0, sizeof(attr));
+	strncpy(attr.name, term->conf->font_name, KMSCON_FONT_MAX_NAME - 1);
+	attr.ppi = term->conf->font_ppi;
+	attr.points = term->conf->font_size;
+
+	if (strcmp(attr.name, term->font_attr.name) ||
+	    attr.ppi != term->font_attr.ppi ||
+	    attr.points != term->font_attr.points) {
+		term->font_attr = attr;
+		if (term->awake) {
+			ret = font_set(term);
+			if (ret)
+				log_warning("cannot apply new font: %d", ret);
+		} else {
+			term->pending_font = true;
+		}
+	} else if (term->awake) {
+		/* a palette change only needs a repaint */
+		redraw_all(term);
+	}
+}
+
 static int session_event(struct kmscon_session *session,
 			 struct kmscon_session_event *ev, void *data)
 {
@@ -540,12 +1689,35 @@ static int session_event(struct kmscon_session *session,
 		break;
 	case KMSCON_SESSION_ACTIVATE:
 		term->awake = true;
+		/* catch up on output parsed lazily while inactive */
+		backlog_drain(term);
 		if (!term->opened)
 			terminal_open(term);
-		redraw_all_test(term);
+		if (term->pending_font) {
+			term->pending_font = false;
+			font_set(term);
+		}
+		/* the cursor plane state is unknown after a VT switch */
+		cursor_enable(term);
+		if (term->hud)
+			hud_arm(term);
+		/* The seat may just have blitted a snapshot of our last
+		 * frame; defer the real redraw to an idle-callback so the
+		 * switch stays perceptually instant even if the first
+		 * full redraw is slow. */
+		term->redraw_test = true;
+		schedule_redraw(term);
 		break;
 	case KMSCON_SESSION_DEACTIVATE:
 		term->awake = false;
+		ev_timer_update(term->cursor_timer, NULL);
+		ev_timer_update(term->degrade_timer, NULL);
+		term->degrade_armed = false;
+		ev_timer_update(term->hud_timer, NULL);
+		blink_disarm(term);
+		break;
+	case KMSCON_SESSION_RECONF:
+		terminal_reconf(term);
 		break;
 	case KMSCON_SESSION_UNREGISTER:
 		terminal_destroy(term);
@@ -559,13 +1731,42 @@ static void pty_input(struct kmscon_pty *pty, const char *u8, size_t len,
 								void *data)
 {
 	struct kmscon_terminal *term = data;
+	int ret;
+
+	term->hud_pty_bytes += len;
 
 	if (!len) {
+		/* finish parsing what the child wrote before it died */
+		backlog_drain(term);
 		terminal_close(term);
 		terminal_open(term);
+	} else if (!term->awake) {
+		ret = shl_ring_write(term->backlog, u8, len);
+		if (!ret) {
+			term->backlog_len += len;
+			if (term->backlog_len >= BACKLOG_MAX)
+				backlog_drain(term);
+			else if (!term->backlog_armed)
+				backlog_arm(term);
+			return;
+		}
+
+		/* cannot buffer; parse directly like a foreground session */
+		tsm_vte_input(term->vte, u8, len);
 	} else {
+		/*
+		 * For flood workloads this call is dominated by the per-byte
+		 * parser loop in libtsm. A pre-scanner that feeds clean
+		 * printable runs past the state machine needs a bulk-print
+		 * entry in libtsm itself; the public API gives us neither the
+		 * parser state nor the current attribute, so any fast-path on
+		 * this side would corrupt colors or mid-sequence input. Until
+		 * libtsm grows such an entry point we hand the buffer over
+		 * unsplit, which at least keeps its per-call overhead off the
+		 * per-byte path.
+		 */
 		tsm_vte_input(term->vte, u8, len);
-		redraw_all(term);
+		schedule_redraw(term);
 	}
 }
 
@@ -602,6 +1803,10 @@ int kmscon_terminal_register(struct kmscon_session **out,
 	term->eloop = kmscon_seat_get_eloop(seat);
 	term->input = kmscon_seat_get_input(seat);
 	shl_dlist_init(&term->screens);
+	shl_dlist_init(&term->pool_jobs);
+	pthread_mutex_init(&term->pool_lock, NULL);
+	pthread_cond_init(&term->pool_cond, NULL);
+	pthread_cond_init(&term->pool_done, NULL);
 
 	term->conf_ctx = kmscon_seat_get_conf(seat);
 	term->conf = conf_ctx_get_mem(term->conf_ctx);
@@ -622,10 +1827,53 @@ int kmscon_terminal_register(struct kmscon_session **out,
 		goto err_con;
 	tsm_vte_set_palette(term->vte, term->conf->palette);
 
-	ret = font_set(term);
+	ret = ev_eloop_new_counter(term->eloop, &term->font_ready,
+				   font_ready_event, term);
 	if (ret)
 		goto err_vte;
 
+	ret = ev_eloop_new_timer(term->eloop, &term->cursor_timer, NULL,
+				 cursor_timer_event, term);
+	if (ret)
+		goto err_counter;
+
+	/* blinking is not timing-critical; let it share wakeups */
+	ev_timer_set_slack(term->cursor_timer, CURSOR_BLINK_SLACK_MS * 1000000ULL);
+
+	ret = ev_eloop_new_timer(term->eloop, &term->blink_timer, NULL,
+				 blink_timer_event, term);
+	if (ret)
+		goto err_timer;
+
+	ev_timer_set_slack(term->blink_timer, CURSOR_BLINK_SLACK_MS * 1000000ULL);
+	term->blink_phase = true;
+
+	ret = ev_eloop_new_timer(term->eloop, &term->backlog_timer, NULL,
+				 backlog_timer_event, term);
+	if (ret)
+		goto err_blink;
+
+	/* batching is the whole point; late ticks are fine */
+	ev_timer_set_slack(term->backlog_timer, CURSOR_BLINK_SLACK_MS * 1000000ULL);
+
+	ret = ev_eloop_new_timer(term->eloop, &term->degrade_timer, NULL,
+				 degrade_timer_event, term);
+	if (ret)
+		goto err_backlog_timer;
+
+	ret = ev_eloop_new_timer(term->eloop, &term->hud_timer, NULL,
+				 hud_timer_event, term);
+	if (ret)
+		goto err_degrade;
+
+	ret = shl_ring_new(&term->backlog);
+	if (ret)
+		goto err_hud;
+
+	ret = font_set(term);
+	if (ret)
+		goto err_backlog;
+
 	ret = kmscon_pty_new(&term->pty, pty_input, term);
 	if (ret)
 		goto err_font;
@@ -654,6 +1902,14 @@ int kmscon_terminal_register(struct kmscon_session **out,
 			goto err_pty;
 	}
 
+	if (term->conf->record_dir) {
+		ret = kmscon_pty_set_record(term->pty, term->conf->record_dir,
+				(uint64_t)term->conf->record_size
+					* 1024 * 1024);
+		if (ret)
+			goto err_pty;
+	}
+
 	ret = ev_eloop_new_fd(term->eloop, &term->ptyfd,
 			      kmscon_pty_get_fd(term->pty),
 			      EV_READABLE, pty_event, term);
@@ -684,8 +1940,26 @@ err_ptyfd:
 err_pty:
 	kmscon_pty_unref(term->pty);
 err_font:
+	if (term->bold_font != term->font)
+		kmscon_font_unregister_ready_cb(term->bold_font, font_event,
+						term);
+	kmscon_font_unregister_ready_cb(term->font, font_event, term);
 	kmscon_font_unref(term->bold_font);
 	kmscon_font_unref(term->font);
+err_backlog:
+	shl_ring_free(term->backlog);
+err_hud:
+	ev_eloop_rm_timer(term->hud_timer);
+err_degrade:
+	ev_eloop_rm_timer(term->degrade_timer);
+err_backlog_timer:
+	ev_eloop_rm_timer(term->backlog_timer);
+err_blink:
+	ev_eloop_rm_timer(term->blink_timer);
+err_timer:
+	ev_eloop_rm_timer(term->cursor_timer);
+err_counter:
+	ev_eloop_rm_counter(term->font_ready);
 err_vte:
 	tsm_vte_unref(term->vte);
 err_con:
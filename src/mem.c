@@ -0,0 +1,118 @@
+/*
+ * Memory Accounting
+ *
+ * Copyright (c) 2012-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * SECTION:mem.c
+ * @short_description: Memory Accounting
+ * @include: mem.h
+ *
+ * See mem.h for the registry semantics. The registry is kept sorted by
+ * descending level so one pass over the list shrinks dependent caches before
+ * the caches they point into.
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "mem.h"
+#include "shl_dlist.h"
+#include "shl_log.h"
+
+#define LOG_SUBSYSTEM "mem"
+
+static struct shl_dlist mem_caches = SHL_DLIST_INIT(mem_caches);
+
+void mem_cache_register(struct mem_cache *cache)
+{
+	struct shl_dlist *iter;
+	struct mem_cache *c;
+
+	if (!cache)
+		return;
+
+	shl_dlist_for_each(iter, &mem_caches) {
+		c = shl_dlist_entry(iter, struct mem_cache, list);
+		if (c->level <= cache->level)
+			break;
+	}
+
+	shl_dlist_link(iter->prev, &cache->list);
+}
+
+void mem_cache_unregister(struct mem_cache *cache)
+{
+	if (!cache)
+		return;
+
+	shl_dlist_unlink(&cache->list);
+}
+
+uint64_t mem_cache_total(void)
+{
+	struct shl_dlist *iter;
+	struct mem_cache *c;
+	uint64_t total = 0;
+
+	shl_dlist_for_each(iter, &mem_caches) {
+		c = shl_dlist_entry(iter, struct mem_cache, list);
+		total += c->bytes;
+	}
+
+	return total;
+}
+
+void mem_cache_shrink_all(void)
+{
+	struct shl_dlist *iter;
+	struct mem_cache *c;
+
+	shl_dlist_for_each(iter, &mem_caches) {
+		c = shl_dlist_entry(iter, struct mem_cache, list);
+		if (!c->shrink)
+			continue;
+
+		log_debug("shrinking cache %s (%" PRIu64 " bytes)",
+			  c->name, c->bytes);
+		c->shrink(c);
+	}
+}
+
+uint64_t mem_get_rss(void)
+{
+	FILE *f;
+	unsigned long long size, rss;
+
+	f = fopen("/proc/self/statm", "re");
+	if (!f)
+		return 0;
+
+	if (fscanf(f, "%llu %llu", &size, &rss) != 2)
+		rss = 0;
+	fclose(f);
+
+	return (uint64_t)rss * getpagesize();
+}
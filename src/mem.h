@@ -0,0 +1,66 @@
+/*
+ * Memory Accounting
+ *
+ * Copyright (c) 2012-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Memory Accounting
+ * Central registry for the in-process caches (glyph tables, atlas textures,
+ * ...). Every cache registers a mem_cache entry and keeps its byte counter
+ * up-to-date; under memory pressure all re-creatable contents can be dropped
+ * through the shrink callbacks. The registry lives in the main binary so
+ * dynamically loaded modules share it via the exported symbols.
+ */
+
+#ifndef KMSCON_MEM_H
+#define KMSCON_MEM_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "shl_dlist.h"
+
+struct mem_cache {
+	struct shl_dlist list;
+	/* static human-readable identifier used for logging */
+	const char *name;
+	/* caches holding references into another cache must register with a
+	 * higher level than their dependency; higher levels are shrunk
+	 * first so no dangling references survive a shrink round */
+	unsigned int level;
+	/* current payload size; maintained by the owner and only meant for
+	 * reporting, so concurrent updates need no locking here */
+	uint64_t bytes;
+	/* drop re-creatable contents; called from the main thread. May be
+	 * NULL for caches that only report their size. */
+	void (*shrink) (struct mem_cache *cache);
+};
+
+void mem_cache_register(struct mem_cache *cache);
+void mem_cache_unregister(struct mem_cache *cache);
+uint64_t mem_cache_total(void);
+void mem_cache_shrink_all(void);
+
+/* current resident-set-size of the process in bytes; 0 if unknown */
+uint64_t mem_get_rss(void);
+
+#endif /* KMSCON_MEM_H */
@@ -28,13 +28,19 @@
 #include <inttypes.h>
 #include <pthread.h>
 #include <pty.h>
+#include <sched.h>
 #include <signal.h>
+#include <spawn.h>
 #include <stdbool.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/ioctl.h>
+#include <sys/stat.h>
 #include <sys/signalfd.h>
+#include <sys/uio.h>
 #include <termios.h>
+#include <time.h>
 #include <unistd.h>
 #include "eloop.h"
 #include "pty.h"
@@ -45,6 +51,8 @@
 #define LOG_SUBSYSTEM "pty"
 
 #define KMSCON_NREAD 16384
+/* upper bound for the adaptive read buffer; see buf_adapt() */
+#define KMSCON_NREAD_MAX (256 * 1024)
 
 struct kmscon_pty {
 	unsigned long ref;
@@ -54,7 +62,9 @@ struct kmscon_pty {
 	pid_t child;
 	struct ev_fd *efd;
 	struct shl_ring *msgbuf;
-	char io_buf[KMSCON_NREAD];
+	/* adaptive read buffer; KMSCON_NREAD when idle, grown under floods */
+	char *io_buf;
+	size_t io_size;
 
 	kmscon_pty_input_cb input_cb;
 	void *data;
@@ -65,6 +75,20 @@ struct kmscon_pty {
 	char *seat;
 	char *vtnr;
 	bool env_reset;
+
+	/* optional flight recorder; see kmscon_pty_set_record() */
+	char *record_dir;
+	uint64_t record_limit;
+	int record_fd;
+	uint64_t record_size;
+};
+
+/* framing of recorded chunks; the timestamp is CLOCK_REALTIME so recordings
+ * can be correlated with other logs of the machine */
+struct pty_record_hdr {
+	uint64_t tv_sec;
+	uint32_t tv_nsec;
+	uint32_t len;
 };
 
 int kmscon_pty_new(struct kmscon_pty **out, kmscon_pty_input_cb input_cb,
@@ -82,13 +106,21 @@ int kmscon_pty_new(struct kmscon_pty **out, kmscon_pty_input_cb input_cb,
 
 	memset(pty, 0, sizeof(*pty));
 	pty->fd = -1;
+	pty->record_fd = -1;
 	pty->ref = 1;
 	pty->input_cb = input_cb;
 	pty->data = data;
 
+	pty->io_buf = malloc(KMSCON_NREAD);
+	if (!pty->io_buf) {
+		ret = -ENOMEM;
+		goto err_free;
+	}
+	pty->io_size = KMSCON_NREAD;
+
 	ret = ev_eloop_new(&pty->eloop, log_llog, NULL);
 	if (ret)
-		goto err_free;
+		goto err_buf;
 
 	ret = shl_ring_new(&pty->msgbuf);
 	if (ret)
@@ -100,6 +132,8 @@ int kmscon_pty_new(struct kmscon_pty **out, kmscon_pty_input_cb input_cb,
 
 err_eloop:
 	ev_eloop_unref(pty->eloop);
+err_buf:
+	free(pty->io_buf);
 err_free:
 	free(pty);
 	return ret;
@@ -120,11 +154,13 @@ void kmscon_pty_unref(struct kmscon_pty *pty)
 
 	log_debug("free pty object");
 	kmscon_pty_close(pty);
+	free(pty->record_dir);
 	free(pty->vtnr);
 	free(pty->seat);
 	free(pty->argv);
 	free(pty->colorterm);
 	free(pty->term);
+	free(pty->io_buf);
 	shl_ring_free(pty->msgbuf);
 	ev_eloop_unref(pty->eloop);
 	free(pty);
@@ -220,6 +256,24 @@ void kmscon_pty_set_env_reset(struct kmscon_pty *pty, bool do_reset)
 	pty->env_reset = do_reset;
 }
 
+int kmscon_pty_set_record(struct kmscon_pty *pty, const char *dir,
+			  uint64_t max_size)
+{
+	char *t;
+
+	if (!pty || !dir)
+		return -EINVAL;
+
+	t = strdup(dir);
+	if (!t)
+		return -ENOMEM;
+	free(pty->record_dir);
+	pty->record_dir = t;
+	pty->record_limit = max_size;
+
+	return 0;
+}
+
 int kmscon_pty_get_fd(struct kmscon_pty *pty)
 {
 	if (!pty)
@@ -241,6 +295,228 @@ static bool pty_is_open(struct kmscon_pty *pty)
 	return pty->fd >= 0;
 }
 
+#ifdef POSIX_SPAWN_SETSID
+
+/* Prepare the slave side of \master: unlock it, set the termios attributes
+ * and the window size, and return the slave path in \slave_name. */
+static int pty_setup_slave(int master, struct winsize *ws,
+			   char *slave_name, size_t size)
+{
+	struct termios attr;
+	int slave, ret;
+
+	ret = grantpt(master);
+	if (ret < 0) {
+		log_err("grantpt failed: %m");
+		return -errno;
+	}
+
+	ret = unlockpt(master);
+	if (ret < 0) {
+		log_err("cannot unlock pty: %m");
+		return -errno;
+	}
+
+	ret = ptsname_r(master, slave_name, size);
+	if (ret) {
+		log_err("cannot find slave name: %m");
+		return -errno;
+	}
+
+	slave = open(slave_name, O_RDWR | O_NOCTTY | O_CLOEXEC);
+	if (slave < 0) {
+		log_err("cannot open slave: %m");
+		return -errno;
+	}
+
+	if (tcgetattr(slave, &attr) < 0) {
+		log_err("cannot get terminal attributes: %m");
+		ret = -errno;
+		goto err_slave;
+	}
+
+	/* erase character should be normal backspace */
+	attr.c_cc[VERASE] = 010;
+
+	if (tcsetattr(slave, TCSANOW, &attr) < 0) {
+		log_err("cannot set terminal attributes: %m");
+		ret = -errno;
+		goto err_slave;
+	}
+
+	if (ws) {
+		ret = ioctl(slave, TIOCSWINSZ, ws);
+		if (ret)
+			log_warn("cannot set slave window size: %m");
+	}
+
+	close(slave);
+	return 0;
+
+err_slave:
+	close(slave);
+	return ret;
+}
+
+/* Build the environment vector for the child. The result is one contiguous
+ * allocation released with a single free(). */
+static int pty_setup_env(struct kmscon_pty *pty, char ***out)
+{
+	char **tmp, *vars[4], *e;
+	size_t num, i, pos, vnum;
+	int ret;
+
+	num = 0;
+	if (!pty->env_reset && environ)
+		while (environ[num])
+			++num;
+
+	vnum = 0;
+	ret = asprintf(&vars[vnum], "TERM=%s",
+		       pty->term ? pty->term : "vt220");
+	if (ret < 0)
+		goto err_vars;
+	++vnum;
+
+	if (pty->colorterm) {
+		ret = asprintf(&vars[vnum], "COLORTERM=%s", pty->colorterm);
+		if (ret < 0)
+			goto err_vars;
+		++vnum;
+	}
+
+	if (pty->seat) {
+		ret = asprintf(&vars[vnum], "XDG_SEAT=%s", pty->seat);
+		if (ret < 0)
+			goto err_vars;
+		++vnum;
+	}
+
+	if (pty->vtnr) {
+		ret = asprintf(&vars[vnum], "XDG_VTNR=%s", pty->vtnr);
+		if (ret < 0)
+			goto err_vars;
+		++vnum;
+	}
+
+	tmp = malloc(sizeof(*tmp) * (num + vnum + 1));
+	if (!tmp) {
+		ret = -1;
+		goto err_vars;
+	}
+
+	/* inherited entries come first but must not shadow our own */
+	pos = 0;
+	for (i = 0; i < num; ++i) {
+		e = environ[i];
+		if (!strncmp(e, "TERM=", 5))
+			continue;
+		if (pty->colorterm && !strncmp(e, "COLORTERM=", 10))
+			continue;
+		if (pty->seat && !strncmp(e, "XDG_SEAT=", 9))
+			continue;
+		if (pty->vtnr && !strncmp(e, "XDG_VTNR=", 9))
+			continue;
+		tmp[pos++] = e;
+	}
+	for (i = 0; i < vnum; ++i)
+		tmp[pos++] = vars[i];
+	tmp[pos] = NULL;
+
+	ret = shl_dup_array(out, tmp);
+	free(tmp);
+	while (vnum--)
+		free(vars[vnum]);
+	return ret;
+
+err_vars:
+	while (vnum--)
+		free(vars[vnum]);
+	return -ENOMEM;
+}
+
+/*
+ * Spawn the client via posix_spawn() instead of fork()+exec(). Forking the
+ * full kmscon process copies the page-tables of all glyph caches and can
+ * take tens of milliseconds on loaded systems; posix_spawn() uses a
+ * vfork-like path that avoids this. POSIX_SPAWN_SETSID puts the child into
+ * a fresh session and opening the slave as first tty of that session makes
+ * it the controlling tty -- the same setup the manual fork path performed.
+ */
+static int pty_spawn(struct kmscon_pty *pty, int master,
+			unsigned short width, unsigned short height)
+{
+	static char *def_argv[] = { "/bin/login", NULL };
+	static char *def_argv_p[] = { "/bin/login", "-p", NULL };
+	posix_spawn_file_actions_t fa;
+	posix_spawnattr_t attr;
+	struct sched_param param;
+	struct winsize ws;
+	char slave_name[128];
+	char **env, **argv;
+	sigset_t sigset;
+	pid_t pid;
+	int ret;
+
+	memset(&ws, 0, sizeof(ws));
+	ws.ws_col = width;
+	ws.ws_row = height;
+
+	ret = pty_setup_slave(master, &ws, slave_name, sizeof(slave_name));
+	if (ret)
+		return ret;
+
+	argv = pty->argv;
+	if (!argv)
+		argv = pty->env_reset ? def_argv_p : def_argv;
+
+	ret = pty_setup_env(pty, &env);
+	if (ret)
+		return ret;
+
+	posix_spawnattr_init(&attr);
+	sigemptyset(&sigset);
+	posix_spawnattr_setsigmask(&attr, &sigset);
+	sigfillset(&sigset);
+	posix_spawnattr_setsigdefault(&attr, &sigset);
+	/* --rt-prio runs the dispatch thread with SCHED_FIFO; the session
+	 * must not inherit that or a CPU-bound job in it starves the
+	 * machine */
+	memset(&param, 0, sizeof(param));
+	posix_spawnattr_setschedpolicy(&attr, SCHED_OTHER);
+	posix_spawnattr_setschedparam(&attr, &param);
+	posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETSID |
+					POSIX_SPAWN_SETSIGMASK |
+					POSIX_SPAWN_SETSIGDEF |
+					POSIX_SPAWN_SETSCHEDULER);
+
+	posix_spawn_file_actions_init(&fa);
+	posix_spawn_file_actions_addopen(&fa, STDIN_FILENO, slave_name,
+					 O_RDWR, 0);
+	posix_spawn_file_actions_adddup2(&fa, STDIN_FILENO, STDOUT_FILENO);
+	posix_spawn_file_actions_adddup2(&fa, STDIN_FILENO, STDERR_FILENO);
+
+	/* the master is O_CLOEXEC so it is not leaked into the child */
+	ret = posix_spawn(&pid, argv[0], &fa, &attr, argv, env);
+
+	posix_spawn_file_actions_destroy(&fa);
+	posix_spawnattr_destroy(&attr);
+	free(env);
+
+	if (ret) {
+		errno = ret;
+		log_err("cannot spawn child %s: %m", argv[0]);
+		return -ret;
+	}
+
+	log_debug("spawned child %d", pid);
+	pty->fd = master;
+	pty->child = pid;
+	return 0;
+}
+
+#else /* !POSIX_SPAWN_SETSID */
+
 static void __attribute__((noreturn))
 exec_child(const char *term, const char *colorterm, char **argv,
 	   const char *seat, const char *vtnr, bool env_reset)
@@ -292,6 +568,7 @@ static void setup_child(int master, struct winsize *ws)
 	char slave_name[128];
 	int slave = -1, i;
 	struct termios attr;
+	struct sched_param param;
 
 	/* The child should not inherit our signal mask. */
 	sigemptyset(&sigset);
@@ -299,6 +576,12 @@ static void setup_child(int master, struct winsize *ws)
 	if (ret)
 		log_warn("cannot reset blocked signals: %m");
 
+	/* Nor the realtime policy --rt-prio may have set. */
+	memset(&param, 0, sizeof(param));
+	ret = sched_setscheduler(0, SCHED_OTHER, &param);
+	if (ret)
+		log_warn("cannot reset scheduling policy: %m");
+
 	for (i = 1; i < SIGUNUSED; ++i)
 		signal(i, SIG_DFL);
 
@@ -409,14 +692,19 @@ static int pty_spawn(struct kmscon_pty *pty, int master,
 	return 0;
 }
 
+#endif /* !POSIX_SPAWN_SETSID */
+
 static int send_buf(struct kmscon_pty *pty)
 {
-	const char *buf;
-	size_t len;
-	int ret;
-
-	while ((buf = shl_ring_peek(pty->msgbuf, &len, 0))) {
-		ret = write(pty->fd, buf, len);
+	struct iovec vec[32];
+	size_t num;
+	ssize_t ret;
+
+	/* Gather all pending segments into a single writev() so large pastes
+	 * do not degenerate into one syscall per SHL_RING_SIZE chunk. */
+	while ((num = shl_ring_peek_all(pty->msgbuf, vec,
+					sizeof(vec) / sizeof(*vec)))) {
+		ret = writev(pty->fd, vec, num);
 		if (ret > 0) {
 			shl_ring_drop(pty->msgbuf, ret);
 			continue;
@@ -436,30 +724,158 @@ static int send_buf(struct kmscon_pty *pty)
 	return 0;
 }
 
+static int record_open(struct kmscon_pty *pty)
+{
+	char *path;
+	int ret, fd;
+
+	ret = asprintf(&path, "%s/kmscon-%d-%llu.rec", pty->record_dir,
+		       (int)pty->child, (unsigned long long)time(NULL));
+	if (ret < 0)
+		return -ENOMEM;
+
+	fd = open(path, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0600);
+	if (fd < 0) {
+		ret = -errno;
+		log_warning("cannot open record file %s (%d): %m",
+			    path, errno);
+		free(path);
+		return ret;
+	}
+
+	log_debug("recording pty of child %d into %s", pty->child, path);
+	free(path);
+	pty->record_fd = fd;
+	pty->record_size = 0;
+	return 0;
+}
+
+/* Append one chunk to the recording. The data already sits in io_buf for the
+ * parser, so a single writev() with the frame header in front is all that is
+ * needed; the payload is not copied again. On any error the recorder is
+ * disabled to keep the input path unaffected. */
+static void record_write(struct kmscon_pty *pty, const char *u8, size_t len)
+{
+	struct pty_record_hdr hdr;
+	struct timespec ts;
+	struct iovec vec[2];
+	ssize_t l;
+
+	if (pty->record_fd < 0)
+		return;
+
+	if (pty->record_limit &&
+	    pty->record_size + sizeof(hdr) + len > pty->record_limit) {
+		close(pty->record_fd);
+		pty->record_fd = -1;
+		if (record_open(pty))
+			goto err_disable;
+	}
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+	hdr.tv_sec = ts.tv_sec;
+	hdr.tv_nsec = ts.tv_nsec;
+	hdr.len = len;
+
+	vec[0].iov_base = &hdr;
+	vec[0].iov_len = sizeof(hdr);
+	vec[1].iov_base = (void*)u8;
+	vec[1].iov_len = len;
+
+	l = writev(pty->record_fd, vec, 2);
+	if (l < 0) {
+		log_warning("cannot write record file (%d): %m", errno);
+		goto err_disable;
+	} else if ((size_t)l != sizeof(hdr) + len) {
+		log_warning("short write on record file; disabling recorder");
+		goto err_disable;
+	}
+
+	pty->record_size += l;
+	return;
+
+err_disable:
+	close(pty->record_fd);
+	pty->record_fd = -1;
+	free(pty->record_dir);
+	pty->record_dir = NULL;
+}
+
+/*
+ * Size the read buffer after the pending byte count. Flood workloads
+ * (cat of a big file) move their data in a few large reads instead of
+ * many buffer-sized round-trips; once the backlog is gone the buffer
+ * falls back to the default so quiet seats keep a small footprint. The
+ * buffer holds no data between rounds, so swapping it is free.
+ */
+static void buf_adapt(struct kmscon_pty *pty)
+{
+	int pending;
+	size_t want;
+	char *buf;
+
+	if (ioctl(pty->fd, FIONREAD, &pending) < 0 || pending < 0)
+		return;
+
+	want = KMSCON_NREAD;
+	while (want < (size_t)pending && want < KMSCON_NREAD_MAX)
+		want *= 2;
+
+	if (want == pty->io_size)
+		return;
+	/* don't bounce between sizes on every partially-filled round */
+	if (want < pty->io_size && (size_t)pending > pty->io_size / 4)
+		return;
+
+	buf = malloc(want);
+	if (!buf)
+		return;
+
+	free(pty->io_buf);
+	pty->io_buf = buf;
+	pty->io_size = want;
+}
+
 static int read_buf(struct kmscon_pty *pty)
 {
 	ssize_t len, num;
+	size_t pos;
 	int mask;
 
-	/* Use a maximum of 50 steps to avoid staying here forever.
-	 * TODO: recheck where else a user might flush our queues and try to
-	 * install an explicit policy. */
-	num = 50;
+	buf_adapt(pty);
+
+	/* PTYs tend to return line-sized chunks so coalesce consecutive reads
+	 * into io_buf and push it to the caller in big batches. This avoids
+	 * paying the per-call parser and redraw overhead for every few bytes
+	 * under heavy output floods.
+	 * Yield after a few full buffers so one flooding PTY cannot monopolize
+	 * a dispatch round; the edge-trigger re-arm below gets us called again
+	 * next round, after high-priority sources like the keyboard ran. */
+	num = 8;
 	do {
-		len = read(pty->fd, pty->io_buf, sizeof(pty->io_buf));
-		if (len > 0) {
-			if (pty->input_cb)
-				pty->input_cb(pty, pty->io_buf, len, pty->data);
-		} else if (len == 0) {
+		pos = 0;
+		do {
+			len = read(pty->fd, &pty->io_buf[pos],
+				   pty->io_size - pos);
+			if (len > 0)
+				pos += len;
+		} while (len > 0 && pos < pty->io_size);
+
+		if (pos && pty->input_cb)
+			pty->input_cb(pty, pty->io_buf, pos, pty->data);
+		if (pos)
+			record_write(pty, pty->io_buf, pos);
+
+		if (len == 0) {
 			log_debug("HUP during read on pty of child %d",
 				  pty->child);
 			break;
-		} else if (errno != EWOULDBLOCK) {
+		} else if (len < 0 && errno != EWOULDBLOCK) {
 			log_debug("cannot read from pty of child %d (%d): %m",
 				  pty->child, errno);
 			break;
 		}
-	} while (len > 0 && --num);
+	} while (pos == pty->io_size && --num);
 
 	if (!num) {
 		log_debug("cannot read application data fast enough");
@@ -550,6 +966,11 @@ int kmscon_pty_open(struct kmscon_pty *pty, unsigned short width,
 	if (ret)
 		goto err_sig;
 
+	/* recording failures must never prevent the session from starting */
+	if (pty->record_dir && record_open(pty))
+		log_warning("cannot start recording pty of child %d",
+			    pty->child);
+
 	return 0;
 
 err_sig:
@@ -570,6 +991,10 @@ void kmscon_pty_close(struct kmscon_pty *pty)
 	ev_eloop_rm_fd(pty->efd);
 	pty->efd = NULL;
 	ev_eloop_unregister_child_cb(pty->eloop, sig_child, pty);
+	if (pty->record_fd >= 0) {
+		close(pty->record_fd);
+		pty->record_fd = -1;
+	}
 	close(pty->fd);
 	pty->fd = -1;
 }
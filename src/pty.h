@@ -43,6 +43,7 @@
 #define KMSCON_PTY_H
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 struct kmscon_pty;
@@ -60,6 +61,11 @@ int kmscon_pty_set_argv(struct kmscon_pty *pty, char **argv);
 int kmscon_pty_set_seat(struct kmscon_pty *pty, const char *seat);
 int kmscon_pty_set_vtnr(struct kmscon_pty *pty, unsigned int vtnr);
 void kmscon_pty_set_env_reset(struct kmscon_pty *pty, bool do_reset);
+/* record all child output into files below @dir; each chunk is framed with a
+ * timestamped header and files are rotated once they exceed @max_size bytes
+ * (0: no rotation) */
+int kmscon_pty_set_record(struct kmscon_pty *pty, const char *dir,
+			  uint64_t max_size);
 
 int kmscon_pty_get_fd(struct kmscon_pty *pty);
 void kmscon_pty_dispatch(struct kmscon_pty *pty);
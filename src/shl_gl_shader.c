@@ -34,9 +34,13 @@
 #include <errno.h>
 #include <GLES2/gl2.h>
 #include <GLES2/gl2ext.h>
+#include <inttypes.h>
 #include <stdbool.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include "shl_gl.h"
 #include "shl_llog.h"
 
@@ -105,6 +109,241 @@ bool gl_has_error(struct gl_shader *shader)
 	return false;
 }
 
+/*
+ * Program binary cache
+ * Compiling and linking the shaders from source costs up to ~100ms per
+ * display on common drivers, paid again on every seat activation and VT
+ * switch-back. If the driver supports GL_OES_get_program_binary, linked
+ * programs are therefore saved to disk and reloaded with a single
+ * glProgramBinaryOES() call on the next init. Cache files are keyed by a
+ * hash of the driver identification strings, the shader sources and the
+ * attribute bindings, so driver updates or source changes simply miss the
+ * cache. A stale or rejected binary falls back to the source path and is
+ * overwritten with a fresh one.
+ */
+
+struct shader_cache_header {
+	uint32_t magic;
+	uint32_t format;
+	uint32_t len;
+};
+
+#define SHADER_CACHE_MAGIC 0x4c475348U
+
+static uint32_t shader_cache_hash(uint32_t hash, const char *data, size_t len)
+{
+	size_t i;
+
+	for (i = 0; i < len; ++i)
+		hash = (hash << 5) + hash + (uint8_t)data[i];
+
+	return hash;
+}
+
+static uint32_t shader_cache_key(const char *vert, int vert_len,
+				 const char *frag, int frag_len,
+				 char **attr, size_t attr_count)
+{
+	uint32_t hash = 5381;
+	const char *str;
+	size_t i;
+
+	str = (const char*)glGetString(GL_VENDOR);
+	if (str)
+		hash = shader_cache_hash(hash, str, strlen(str));
+	str = (const char*)glGetString(GL_RENDERER);
+	if (str)
+		hash = shader_cache_hash(hash, str, strlen(str));
+	str = (const char*)glGetString(GL_VERSION);
+	if (str)
+		hash = shader_cache_hash(hash, str, strlen(str));
+
+	hash = shader_cache_hash(hash, vert, vert_len);
+	hash = shader_cache_hash(hash, frag, frag_len);
+	for (i = 0; i < attr_count; ++i)
+		hash = shader_cache_hash(hash, attr[i], strlen(attr[i]));
+
+	return hash;
+}
+
+static bool shader_cache_supported(void)
+{
+	const char *ext;
+	GLint num = 0;
+
+	ext = (const char*)glGetString(GL_EXTENSIONS);
+	if (!ext || !strstr(ext, "GL_OES_get_program_binary"))
+		return false;
+
+	glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS_OES, &num);
+	return num > 0;
+}
+
+static int shader_cache_dir(char *path, size_t size)
+{
+	const char *base;
+	int ret;
+
+	base = getenv("XDG_CACHE_HOME");
+	if (base && *base)
+		ret = snprintf(path, size, "%s/kmscon", base);
+	else if ((base = getenv("HOME")) && *base)
+		ret = snprintf(path, size, "%s/.cache/kmscon", base);
+	else
+		ret = snprintf(path, size, "/var/cache/kmscon");
+
+	if (ret < 0 || (size_t)ret >= size)
+		return -EINVAL;
+
+	return 0;
+}
+
+static int shader_cache_path(char *path, size_t size, uint32_t key)
+{
+	size_t len;
+	int ret;
+
+	ret = shader_cache_dir(path, size);
+	if (ret)
+		return ret;
+
+	len = strlen(path);
+	ret = snprintf(&path[len], size - len, "/gl-%08" PRIx32 ".bin", key);
+	if (ret < 0 || (size_t)ret >= size - len)
+		return -EINVAL;
+
+	return 0;
+}
+
+/* Try to bring @shader->program to the linked state from the cache file of
+ * @key. Returns 0 on success, negative error code if the cache misses or
+ * the driver rejects the stored binary. */
+static int shader_cache_load(struct gl_shader *shader, uint32_t key)
+{
+	struct shader_cache_header hdr;
+	char path[512];
+	uint8_t *bin;
+	GLint status = 0;
+	FILE *f;
+	int ret;
+
+	ret = shader_cache_path(path, sizeof(path), key);
+	if (ret)
+		return ret;
+
+	f = fopen(path, "rbe");
+	if (!f)
+		return -ENOENT;
+
+	if (fread(&hdr, sizeof(hdr), 1, f) != 1 ||
+	    hdr.magic != SHADER_CACHE_MAGIC ||
+	    !hdr.len || hdr.len > 16 * 1024 * 1024) {
+		ret = -EFAULT;
+		goto err_close;
+	}
+
+	bin = malloc(hdr.len);
+	if (!bin) {
+		ret = -ENOMEM;
+		goto err_close;
+	}
+
+	if (fread(bin, 1, hdr.len, f) != hdr.len) {
+		ret = -EFAULT;
+		goto err_free;
+	}
+
+	fclose(f);
+
+	gl_clear_error();
+	glProgramBinaryOES(shader->program, hdr.format, bin, hdr.len);
+	free(bin);
+
+	glGetProgramiv(shader->program, GL_LINK_STATUS, &status);
+	if (status == GL_FALSE || gl_has_error(shader)) {
+		llog_debug(shader, "stale shader binary %s", path);
+		unlink(path);
+		return -EFAULT;
+	}
+
+	llog_debug(shader, "loaded shader binary %s", path);
+	return 0;
+
+err_free:
+	free(bin);
+err_close:
+	fclose(f);
+	unlink(path);
+	return ret;
+}
+
+static void shader_cache_save(struct gl_shader *shader, uint32_t key)
+{
+	struct shader_cache_header hdr;
+	char path[512], tmp[512 + 16];
+	GLsizei len = 0;
+	GLenum format = 0;
+	GLint size = 0;
+	uint8_t *bin;
+	FILE *f;
+	int ret;
+
+	glGetProgramiv(shader->program, GL_PROGRAM_BINARY_LENGTH_OES, &size);
+	if (size <= 0)
+		return;
+
+	bin = malloc(size);
+	if (!bin)
+		return;
+
+	gl_clear_error();
+	glGetProgramBinaryOES(shader->program, size, &len, &format, bin);
+	if (!len || glGetError() != GL_NO_ERROR)
+		goto out_free;
+
+	ret = shader_cache_dir(path, sizeof(path));
+	if (ret)
+		goto out_free;
+	mkdir(path, 0755);
+
+	ret = shader_cache_path(path, sizeof(path), key);
+	if (ret)
+		goto out_free;
+
+	ret = snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+	if (ret < 0 || (size_t)ret >= sizeof(tmp))
+		goto out_free;
+
+	f = fopen(tmp, "wbe");
+	if (!f)
+		goto out_free;
+
+	memset(&hdr, 0, sizeof(hdr));
+	hdr.magic = SHADER_CACHE_MAGIC;
+	hdr.format = format;
+	hdr.len = len;
+
+	if (fwrite(&hdr, sizeof(hdr), 1, f) != 1 ||
+	    fwrite(bin, 1, len, f) != (size_t)len) {
+		fclose(f);
+		unlink(tmp);
+		goto out_free;
+	}
+
+	if (fclose(f)) {
+		unlink(tmp);
+		goto out_free;
+	}
+
+	if (rename(tmp, path))
+		unlink(tmp);
+	else
+		llog_debug(shader, "saved shader binary %s", path);
+
+out_free:
+	free(bin);
+}
+
 static int compile_shader(struct gl_shader *shader, GLenum type,
 			  const char *source, int len)
 {
@@ -142,6 +381,8 @@ int gl_shader_new(struct gl_shader **out, const char *vert, int vert_len,
 	int ret, i;
 	char msg[512];
 	GLint status = 1;
+	uint32_t key = 0;
+	bool use_cache;
 
 	if (!out || !vert || !frag)
 		return -EINVAL;
@@ -156,11 +397,22 @@ int gl_shader_new(struct gl_shader **out, const char *vert, int vert_len,
 
 	llog_debug(shader, "new shader");
 
+	use_cache = shader_cache_supported();
+	if (use_cache) {
+		key = shader_cache_key(vert, vert_len, frag, frag_len,
+				       attr, attr_count);
+		shader->program = glCreateProgram();
+		if (!shader_cache_load(shader, key)) {
+			*out = shader;
+			return 0;
+		}
+	}
+
 	shader->vshader = compile_shader(shader, GL_VERTEX_SHADER, vert,
 					 vert_len);
 	if (shader->vshader == GL_NONE) {
 		ret = -EFAULT;
-		goto err_free;
+		goto err_program;
 	}
 
 	shader->fshader = compile_shader(shader, GL_FRAGMENT_SHADER, frag,
@@ -170,7 +422,8 @@ int gl_shader_new(struct gl_shader **out, const char *vert, int vert_len,
 		goto err_vshader;
 	}
 
-	shader->program = glCreateProgram();
+	if (!shader->program)
+		shader->program = glCreateProgram();
 	glAttachShader(shader->program, shader->vshader);
 	glAttachShader(shader->program, shader->fshader);
 
@@ -193,15 +446,18 @@ int gl_shader_new(struct gl_shader **out, const char *vert, int vert_len,
 		goto err_link;
 	}
 
+	if (use_cache)
+		shader_cache_save(shader, key);
+
 	*out = shader;
 	return 0;
 
 err_link:
-	glDeleteProgram(shader->program);
 	glDeleteShader(shader->fshader);
 err_vshader:
 	glDeleteShader(shader->vshader);
-err_free:
+err_program:
+	glDeleteProgram(shader->program);
 	free(shader);
 	return ret;
 }
@@ -0,0 +1,287 @@
+/*
+ * shl - Open-Addressing Hash Map
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * An open-addressing hash map with inline key/value slots
+ * Unlike shl_hashtable, which allocates a shl_hashentry per insert and chases
+ * pointers on every lookup, this map keeps all slots in one flat array. It
+ * uses robin-hood linear probing with backward-shift deletion, so lookups are
+ * a short linear scan over adjacent cache lines and no per-entry allocation
+ * ever happens. Use it for hot lookup paths like the glyph caches; use
+ * shl_hashtable when stable entry pointers are needed.
+ */
+
+#ifndef SHL_HASHMAP_H
+#define SHL_HASHMAP_H
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef unsigned int (*shl_map_hash_cb) (const void *data);
+typedef bool (*shl_map_equal_cb) (const void *data1, const void *data2);
+typedef void (*shl_map_free_cb) (void *data);
+
+/* hash 0 marks an empty slot */
+struct shl_hashmap_slot {
+	size_t hash;
+	void *key;
+	void *value;
+};
+
+struct shl_hashmap {
+	struct shl_hashmap_slot *slots;
+	size_t size;
+	size_t num;
+	shl_map_hash_cb hash_cb;
+	shl_map_equal_cb equal_cb;
+	shl_map_free_cb free_key;
+	shl_map_free_cb free_value;
+};
+
+#define SHL_HASHMAP_INITIAL_SIZE 32
+
+static inline unsigned int shl_map_direct_hash(const void *data)
+{
+	return (unsigned int)(unsigned long)data;
+}
+
+static inline bool shl_map_direct_equal(const void *data1, const void *data2)
+{
+	return data1 == data2;
+}
+
+/* Spread the user hash over the whole table; direct integer keys are often
+ * sequential (unicode codepoints) and would otherwise cluster. Zero is
+ * reserved for empty slots. */
+static inline size_t shl_hashmap_mix(unsigned int hash)
+{
+	size_t h;
+
+	h = (size_t)hash * 2654435761UL;
+	return h ? h : 1;
+}
+
+/* distance of the slot at index @idx from its home position */
+static inline size_t shl_hashmap_dist(struct shl_hashmap *map, size_t idx)
+{
+	return (idx - map->slots[idx].hash) & (map->size - 1);
+}
+
+static inline int shl_hashmap_new(struct shl_hashmap **out,
+				  shl_map_hash_cb hash_cb,
+				  shl_map_equal_cb equal_cb,
+				  shl_map_free_cb free_key,
+				  shl_map_free_cb free_value)
+{
+	struct shl_hashmap *map;
+
+	if (!out || !hash_cb || !equal_cb)
+		return -EINVAL;
+
+	map = malloc(sizeof(*map));
+	if (!map)
+		return -ENOMEM;
+	memset(map, 0, sizeof(*map));
+	map->hash_cb = hash_cb;
+	map->equal_cb = equal_cb;
+	map->free_key = free_key;
+	map->free_value = free_value;
+
+	map->size = SHL_HASHMAP_INITIAL_SIZE;
+	map->slots = calloc(map->size, sizeof(*map->slots));
+	if (!map->slots) {
+		free(map);
+		return -ENOMEM;
+	}
+
+	*out = map;
+	return 0;
+}
+
+static inline void shl_hashmap_free(struct shl_hashmap *map)
+{
+	size_t i;
+
+	if (!map)
+		return;
+
+	for (i = 0; i < map->size; ++i) {
+		if (!map->slots[i].hash)
+			continue;
+		if (map->free_key)
+			map->free_key(map->slots[i].key);
+		if (map->free_value)
+			map->free_value(map->slots[i].value);
+	}
+
+	free(map->slots);
+	free(map);
+}
+
+/* Insert into @slots without growing; @slots must have a free slot. Robin-hood
+ * probing: a slot further from its home position than the probed entry steals
+ * the slot and the probe continues with the evicted entry. */
+static inline void shl_hashmap_place(struct shl_hashmap_slot *slots,
+				     size_t size, size_t hash,
+				     void *key, void *value)
+{
+	size_t mask = size - 1;
+	size_t idx = hash & mask;
+	size_t dist = 0, d;
+	struct shl_hashmap_slot tmp, cur;
+
+	cur.hash = hash;
+	cur.key = key;
+	cur.value = value;
+
+	while (slots[idx].hash) {
+		d = (idx - slots[idx].hash) & mask;
+		if (d < dist) {
+			tmp = slots[idx];
+			slots[idx] = cur;
+			cur = tmp;
+			dist = d;
+		}
+		idx = (idx + 1) & mask;
+		++dist;
+	}
+
+	slots[idx] = cur;
+}
+
+static inline int shl_hashmap_grow(struct shl_hashmap *map)
+{
+	struct shl_hashmap_slot *slots;
+	size_t size, i;
+
+	size = map->size << 1;
+	slots = calloc(size, sizeof(*slots));
+	if (!slots)
+		return -ENOMEM;
+
+	for (i = 0; i < map->size; ++i) {
+		if (!map->slots[i].hash)
+			continue;
+		shl_hashmap_place(slots, size, map->slots[i].hash,
+				  map->slots[i].key, map->slots[i].value);
+	}
+
+	free(map->slots);
+	map->slots = slots;
+	map->size = size;
+	return 0;
+}
+
+static inline int shl_hashmap_insert(struct shl_hashmap *map, void *key,
+				     void *value)
+{
+	int ret;
+
+	if (!map)
+		return -EINVAL;
+
+	/* grow at 75% load to keep probe sequences short */
+	if (map->num * 4 >= map->size * 3) {
+		ret = shl_hashmap_grow(map);
+		if (ret)
+			return ret;
+	}
+
+	shl_hashmap_place(map->slots, map->size,
+			  shl_hashmap_mix(map->hash_cb(key)), key, value);
+	++map->num;
+	return 0;
+}
+
+static inline void shl_hashmap_remove(struct shl_hashmap *map, void *key)
+{
+	size_t mask, idx, next, dist = 0, hash;
+
+	if (!map)
+		return;
+
+	mask = map->size - 1;
+	hash = shl_hashmap_mix(map->hash_cb(key));
+	idx = hash & mask;
+
+	while (map->slots[idx].hash) {
+		if (shl_hashmap_dist(map, idx) < dist)
+			return;
+		if (map->slots[idx].hash == hash &&
+		    map->equal_cb(key, map->slots[idx].key))
+			break;
+		idx = (idx + 1) & mask;
+		++dist;
+	}
+
+	if (!map->slots[idx].hash)
+		return;
+
+	/* backward-shift deletion; no tombstones, probes stay short */
+	next = (idx + 1) & mask;
+	while (map->slots[next].hash && shl_hashmap_dist(map, next)) {
+		map->slots[idx] = map->slots[next];
+		idx = next;
+		next = (next + 1) & mask;
+	}
+
+	map->slots[idx].hash = 0;
+	--map->num;
+}
+
+static inline bool shl_hashmap_find(struct shl_hashmap *map, void **out,
+				    void *key)
+{
+	size_t mask, idx, dist = 0, hash;
+
+	if (!map)
+		return false;
+
+	mask = map->size - 1;
+	hash = shl_hashmap_mix(map->hash_cb(key));
+	idx = hash & mask;
+
+	while (map->slots[idx].hash) {
+		/* a richer slot means the key cannot be further down */
+		if (shl_hashmap_dist(map, idx) < dist)
+			return false;
+		if (map->slots[idx].hash == hash &&
+		    map->equal_cb(key, map->slots[idx].key)) {
+			if (out)
+				*out = map->slots[idx].value;
+			return true;
+		}
+		idx = (idx + 1) & mask;
+		++dist;
+	}
+
+	return false;
+}
+
+#endif /* SHL_HASHMAP_H */
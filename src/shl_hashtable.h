@@ -36,6 +36,7 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 #include "external/htable.h"
 
 struct shl_hashtable;
@@ -67,6 +68,22 @@ static inline bool shl_direct_equal(const void *data1, const void *data2)
 	return data1 == data2;
 }
 
+static inline unsigned int shl_string_hash(const void *data)
+{
+	const char *str = data;
+	unsigned int hash = 5381;
+
+	while (*str)
+		hash = hash * 33 + *str++;
+
+	return hash;
+}
+
+static inline bool shl_string_equal(const void *data1, const void *data2)
+{
+	return !strcmp(data1, data2);
+}
+
 static size_t shl_rehash(const void *ele, void *priv)
 {
 	struct shl_hashtable *tbl = priv;
@@ -101,6 +118,18 @@ static inline int shl_hashtable_new(struct shl_hashtable **out,
 	return 0;
 }
 
+static inline int shl_hashtable_reserve(struct shl_hashtable *tbl,
+					size_t entries)
+{
+	if (!tbl)
+		return -EINVAL;
+
+	if (!htable_reserve(&tbl->tbl, entries))
+		return -ENOMEM;
+
+	return 0;
+}
+
 static inline void shl_hashtable_free(struct shl_hashtable *tbl)
 {
 	struct htable_iter i;
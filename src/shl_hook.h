@@ -26,6 +26,15 @@
 
 /*
  * Simply hook-implementation
+ * Entries are kept in a contiguous array so *_call() iterates linearly
+ * through memory instead of chasing list pointers. The first few entries
+ * live inline in the hook object itself, so the common case (a handful of
+ * callbacks per hook) never touches the allocator after shl_hook_new().
+ *
+ * Mutation during dispatch is safe: removed entries are only marked dead
+ * while a call is in progress and compacted afterwards, and every entry
+ * carries the generation it was added in, so callbacks registered from
+ * within a dispatch run only from the next dispatch on.
  */
 
 #ifndef SHL_HOOK_H
@@ -37,7 +46,6 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
-#include "shl_dlist.h"
 
 struct shl_hook;
 struct shl_hook_entry;
@@ -52,18 +60,25 @@ typedef void (*shl_hook_cb) (void *parent, void *arg, void *data);
 #define shl_hook_rm_all_cast(hook, cb, data) \
 	shl_hook_rm_all((hook), (shl_hook_cb)(cb), (data))
 
+/* number of entries stored inline in struct shl_hook */
+#define SHL_HOOK_INLINE_NUM 4
+
 struct shl_hook_entry {
-	struct shl_dlist list;
-	shl_hook_cb cb;
+	shl_hook_cb cb;		/* NULL if removed during a dispatch */
 	void *data;
+	unsigned int gen;	/* generation the entry was added in */
 	bool oneshot;
 };
 
 struct shl_hook {
-	unsigned int num;
-	struct shl_dlist entries;
-	struct shl_dlist *cur_entry;
+	unsigned int num;	/* live entries */
+	unsigned int used;	/* used slots, including dead ones */
+	unsigned int size;	/* allocated slots */
+	unsigned int gen;	/* bumped at the start of each dispatch */
+	struct shl_hook_entry *entries;
+	bool in_call;
 	bool dead;
+	struct shl_hook_entry inline_entries[SHL_HOOK_INLINE_NUM];
 };
 
 static inline int shl_hook_new(struct shl_hook **out)
@@ -77,7 +92,8 @@ static inline int shl_hook_new(struct shl_hook **out)
 	if (!hook)
 		return -ENOMEM;
 	memset(hook, 0, sizeof(*hook));
-	shl_dlist_init(&hook->entries);
+	hook->entries = hook->inline_entries;
+	hook->size = SHL_HOOK_INLINE_NUM;
 
 	*out = hook;
 	return 0;
@@ -85,24 +101,16 @@ static inline int shl_hook_new(struct shl_hook **out)
 
 static inline void shl_hook_free(struct shl_hook *hook)
 {
-	struct shl_hook_entry *entry;
-
 	if (!hook)
 		return;
 
-	if (hook->cur_entry) {
+	if (hook->in_call) {
 		hook->dead = true;
 		return;
 	}
 
-	while (!shl_dlist_empty(&hook->entries)) {
-		entry = shl_dlist_entry(hook->entries.prev,
-					struct shl_hook_entry,
-					list);
-		shl_dlist_unlink(&entry->list);
-		free(entry);
-	}
-
+	if (hook->entries != hook->inline_entries)
+		free(hook->entries);
 	free(hook);
 }
 
@@ -117,20 +125,34 @@ static inline unsigned int shl_hook_num(struct shl_hook *hook)
 static inline int shl_hook_add(struct shl_hook *hook, shl_hook_cb cb,
 			       void *data, bool oneshot)
 {
-	struct shl_hook_entry *entry;
+	struct shl_hook_entry *entry, *tmp;
+	unsigned int size;
 
 	if (!hook || !cb)
 		return -EINVAL;
 
-	entry = malloc(sizeof(*entry));
-	if (!entry)
-		return -ENOMEM;
-	memset(entry, 0, sizeof(*entry));
+	if (hook->used >= hook->size) {
+		size = hook->size * 2;
+		if (hook->entries == hook->inline_entries) {
+			tmp = malloc(size * sizeof(*tmp));
+			if (!tmp)
+				return -ENOMEM;
+			memcpy(tmp, hook->entries,
+			       hook->used * sizeof(*tmp));
+		} else {
+			tmp = realloc(hook->entries, size * sizeof(*tmp));
+			if (!tmp)
+				return -ENOMEM;
+		}
+		hook->entries = tmp;
+		hook->size = size;
+	}
+
+	entry = &hook->entries[hook->used++];
 	entry->cb = cb;
 	entry->data = data;
+	entry->gen = hook->gen;
 	entry->oneshot = oneshot;
-
-	shl_dlist_link_tail(&hook->entries, &entry->list);
 	hook->num++;
 	return 0;
 }
@@ -142,13 +164,13 @@ static inline int shl_hook_add_single(struct shl_hook *hook, shl_hook_cb cb,
 				      void *data, bool oneshot)
 {
 	struct shl_hook_entry *entry;
-	struct shl_dlist *iter;
+	unsigned int i;
 
 	if (!hook || !cb)
 		return -EINVAL;
 
-	shl_dlist_for_each(iter, &hook->entries) {
-		entry = shl_dlist_entry(iter, struct shl_hook_entry, list);
+	for (i = 0; i < hook->used; ++i) {
+		entry = &hook->entries[i];
 		if (entry->cb == cb && entry->data == data)
 			return 0;
 	}
@@ -156,24 +178,32 @@ static inline int shl_hook_add_single(struct shl_hook *hook, shl_hook_cb cb,
 	return shl_hook_add(hook, cb, data, oneshot);
 }
 
+static inline void shl_hook__drop(struct shl_hook *hook, unsigned int idx)
+{
+	/* if *_call() is running we must not disturb it */
+	if (hook->in_call) {
+		hook->entries[idx].cb = NULL;
+	} else {
+		memmove(&hook->entries[idx], &hook->entries[idx + 1],
+			(hook->used - idx - 1) * sizeof(*hook->entries));
+		hook->used--;
+	}
+	hook->num--;
+}
+
 static inline void shl_hook_rm(struct shl_hook *hook, shl_hook_cb cb,
 			       void *data)
 {
-	struct shl_dlist *iter;
 	struct shl_hook_entry *entry;
+	unsigned int i;
 
 	if (!hook || !cb)
 		return;
 
-	shl_dlist_for_each_reverse(iter, &hook->entries) {
-		entry = shl_dlist_entry(iter, struct shl_hook_entry, list);
+	for (i = hook->used; i > 0; --i) {
+		entry = &hook->entries[i - 1];
 		if (entry->cb == cb && entry->data == data) {
-			/* if *_call() is running we must not disturb it */
-			if (hook->cur_entry == iter)
-				hook->cur_entry = iter->next;
-			shl_dlist_unlink(&entry->list);
-			free(entry);
-			hook->num--;
+			shl_hook__drop(hook, i - 1);
 			return;
 		}
 	}
@@ -182,22 +212,16 @@ static inline void shl_hook_rm(struct shl_hook *hook, shl_hook_cb cb,
 static inline void shl_hook_rm_all(struct shl_hook *hook, shl_hook_cb cb,
 				   void *data)
 {
-	struct shl_dlist *iter, *tmp;
 	struct shl_hook_entry *entry;
+	unsigned int i;
 
 	if (!hook || !cb)
 		return;
 
-	shl_dlist_for_each_reverse_safe(iter, tmp, &hook->entries) {
-		entry = shl_dlist_entry(iter, struct shl_hook_entry, list);
-		if (entry->cb == cb && entry->data == data) {
-			/* if *_call() is running we must not disturb it */
-			if (hook->cur_entry == iter)
-				hook->cur_entry = iter->next;
-			shl_dlist_unlink(&entry->list);
-			free(entry);
-			hook->num--;
-		}
+	for (i = hook->used; i > 0; --i) {
+		entry = &hook->entries[i - 1];
+		if (entry->cb == cb && entry->data == data)
+			shl_hook__drop(hook, i - 1);
 	}
 }
 
@@ -205,32 +229,52 @@ static inline void shl_hook_call(struct shl_hook *hook, void *parent,
 				 void *arg)
 {
 	struct shl_hook_entry *entry;
-	bool oneshot;
+	unsigned int i, j, gen;
+	shl_hook_cb cb;
+	void *data;
 
-	if (!hook || hook->cur_entry)
+	if (!hook || hook->in_call)
 		return;
 
-	for (hook->cur_entry = hook->entries.next;
-	     hook->cur_entry != &hook->entries; ) {
-		entry = shl_dlist_entry(hook->cur_entry,
-					struct shl_hook_entry, list);
-		hook->cur_entry = entry->list.next;
-		oneshot = entry->oneshot;
+	hook->in_call = true;
+	gen = ++hook->gen;
+
+	/* Callbacks may add entries, which can move the array, so re-read
+	 * the slot on every round and copy it out before dispatching. Slots
+	 * added during this call carry the current generation and are
+	 * skipped until the next dispatch. */
+	for (i = 0; i < hook->used; ++i) {
+		entry = &hook->entries[i];
+		if (!entry->cb || entry->gen == gen)
+			continue;
+
+		cb = entry->cb;
+		data = entry->data;
+		if (entry->oneshot) {
+			entry->cb = NULL;
+			hook->num--;
+		}
 
-		if (oneshot)
-			shl_dlist_unlink(&entry->list);
+		cb(parent, arg, data);
+	}
 
-		entry->cb(parent, arg, entry->data);
+	hook->in_call = false;
+	if (hook->dead) {
+		shl_hook_free(hook);
+		return;
+	}
 
-		if (oneshot) {
-			free(entry);
-			--hook->num;
+	/* compact slots that died during the dispatch */
+	if (hook->num != hook->used) {
+		for (i = 0, j = 0; i < hook->used; ++i) {
+			if (!hook->entries[i].cb)
+				continue;
+			if (i != j)
+				hook->entries[j] = hook->entries[i];
+			++j;
 		}
+		hook->used = j;
 	}
-
-	hook->cur_entry = NULL;
-	if (hook->dead)
-		shl_hook_free(hook);
 }
 
 #endif /* SHL_HOOK_H */
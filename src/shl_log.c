@@ -313,6 +313,235 @@ static void log__format(const char *file,
 
 static FILE *log__file = NULL;
 
+/*
+ * Rate Limiting
+ * A single flapping event source (like a DRM connector that bounces between
+ * connected and disconnected) can submit the same warning thousands of times
+ * per second. Writing all of them is useless and expensive, so messages are
+ * rate-limited per call-site. A call-site is identified by the address of its
+ * __FILE__ literal plus the line number, so the lookup is a cheap hash over
+ * two integers and needs no string compares. Each site may log
+ * LOG_SITE_BURST messages per second; further messages within the same second
+ * are dropped and a single "repeated" note is logged once the next message of
+ * that site gets through.
+ * Sites are kept in a small direct-mapped table. On a collision the old site
+ * is evicted and its suppression-count is discarded; with 64 slots this is
+ * rare enough not to matter for diagnostics.
+ * Severities of CRITICAL and above are never rate-limited.
+ */
+
+#define LOG_SITE_NUM 64
+#define LOG_SITE_BURST 10
+
+struct log_site {
+	const char *file;
+	int line;
+	long long sec;
+	unsigned int count;
+	unsigned long suppressed;
+};
+
+static struct log_site log__sites[LOG_SITE_NUM];
+
+static bool log__ratelimit(const char *file, int line, long long sec,
+			   unsigned long *suppressed)
+{
+	struct log_site *site;
+	size_t idx;
+
+	idx = ((unsigned long)file >> 4) ^ ((unsigned long)line * 2654435761UL);
+	site = &log__sites[idx & (LOG_SITE_NUM - 1)];
+
+	if (site->file != file || site->line != line) {
+		site->file = file;
+		site->line = line;
+		site->sec = sec;
+		site->count = 1;
+		site->suppressed = 0;
+		return false;
+	}
+
+	if (site->sec != sec) {
+		*suppressed = site->suppressed;
+		site->sec = sec;
+		site->count = 1;
+		site->suppressed = 0;
+		return false;
+	}
+
+	if (++site->count > LOG_SITE_BURST) {
+		++site->suppressed;
+		return true;
+	}
+
+	return false;
+}
+
+/*
+ * Asynchronous Writer
+ * Writing to the log-target can block for milliseconds if the consumer (a
+ * slow terminal, journald, a busy disk) does not keep up. Almost all of our
+ * messages are submitted from the event-loop thread, so a blocking write
+ * stalls rendering and input handling. Therefore, messages are rendered into
+ * fixed-size records, queued in a ring and written by a background thread;
+ * the submitting thread only pays for formatting and a memcpy under a lock
+ * that is never held across I/O.
+ * The writer is started lazily on the first queued message and flushed and
+ * joined via atexit(). Severities of CRITICAL and above bypass the ring:
+ * they drain it and are then written synchronously so the message is
+ * guaranteed to hit the log-target even if we crash right after. If the ring
+ * overruns, messages are dropped and a single note with the drop-count is
+ * queued once there is room again.
+ * fork() is serialized against the writer via pthread_atfork(). Threads do
+ * not survive a fork, so forked children are reset to synchronous writing;
+ * records queued by the parent stay with the parent.
+ */
+
+#define LOG_MSG_MAX 512
+#define LOG_RING_NUM 128
+
+struct log_record {
+	size_t len;
+	char buf[LOG_MSG_MAX];
+};
+
+static struct log_record *log__ring;
+static size_t log__ring_first;
+static size_t log__ring_num;
+static unsigned long log__ring_dropped;
+static pthread_cond_t log__cond = PTHREAD_COND_INITIALIZER;
+static pthread_t log__writer;
+static bool log__writer_running;
+static bool log__writer_stop;
+static bool log__writing;
+
+static FILE *log__target(void)
+{
+	return log__file ? log__file : stderr;
+}
+
+/* write all queued records to the current log-target; needs log__mutex */
+static void log__ring_flush(void)
+{
+	struct log_record *rec;
+	FILE *out;
+
+	out = log__target();
+	while (log__ring_num) {
+		rec = &log__ring[log__ring_first];
+		log__ring_first = (log__ring_first + 1) % LOG_RING_NUM;
+		--log__ring_num;
+		fwrite(rec->buf, 1, rec->len, out);
+	}
+}
+
+/* wait until the writer holds no popped record; needs log__mutex */
+static void log__writer_settle(void)
+{
+	while (log__writing)
+		pthread_cond_wait(&log__cond, &log__mutex);
+}
+
+static void *log__writer_fn(void *arg)
+{
+	struct log_record rec;
+	FILE *out;
+
+	log_lock();
+
+	while (log__ring_num || !log__writer_stop) {
+		if (!log__ring_num) {
+			pthread_cond_wait(&log__cond, &log__mutex);
+			continue;
+		}
+
+		rec = log__ring[log__ring_first];
+		log__ring_first = (log__ring_first + 1) % LOG_RING_NUM;
+		--log__ring_num;
+		out = log__target();
+
+		/* do the blocking write without the lock so submitters are
+		 * never stalled; log__writing keeps log_set_file() and the
+		 * synchronous paths from racing against us */
+		log__writing = true;
+		log_unlock();
+		fwrite(rec.buf, 1, rec.len, out);
+		log_lock();
+		log__writing = false;
+		pthread_cond_broadcast(&log__cond);
+	}
+
+	log_unlock();
+	return NULL;
+}
+
+static void log__exit(void)
+{
+	log_lock();
+	if (log__writer_running) {
+		log__writer_stop = true;
+		pthread_cond_broadcast(&log__cond);
+		log_unlock();
+		pthread_join(log__writer, NULL);
+		log_lock();
+		log__writer_running = false;
+	}
+	log__ring_flush();
+	log_unlock();
+}
+
+static void log__fork_prepare(void)
+{
+	log_lock();
+	log__writer_settle();
+}
+
+static void log__fork_parent(void)
+{
+	log_unlock();
+}
+
+static void log__fork_child(void)
+{
+	/* the writer thread does not survive a fork; queued records belong to
+	 * the parent which will still write them */
+	log__writer_running = false;
+	log__writer_stop = false;
+	log__ring_first = 0;
+	log__ring_num = 0;
+	log__ring_dropped = 0;
+	log_unlock();
+}
+
+/* start the background writer; needs log__mutex; failure is not fatal, we
+ * simply keep writing synchronously */
+static void log__writer_start(void)
+{
+	static bool tried;
+
+	if (log__writer_running || tried)
+		return;
+	tried = true;
+
+	log__ring = malloc(sizeof(*log__ring) * LOG_RING_NUM);
+	if (!log__ring)
+		return;
+
+	if (pthread_atfork(log__fork_prepare, log__fork_parent,
+			   log__fork_child))
+		goto err_ring;
+	if (pthread_create(&log__writer, NULL, log__writer_fn, NULL))
+		goto err_ring;
+
+	log__writer_running = true;
+	atexit(log__exit);
+	return;
+
+err_ring:
+	free(log__ring);
+	log__ring = NULL;
+}
+
 int log_set_file(const char *file)
 {
 	FILE *f, *old;
@@ -335,6 +564,10 @@ int log_set_file(const char *file)
 	if (log__file != f) {
 		log__format(LOG_DEFAULT, LOG_NOTICE,
 				"set log-file to %s", file);
+		/* queued messages go to the old target; also make sure the
+		 * writer holds no reference to it before it is closed */
+		log__writer_settle();
+		log__ring_flush();
 		old = log__file;
 		log__file = f;
 		f = NULL;
@@ -374,6 +607,110 @@ static const char *log__sev2str[] = {
 	[LOG_FATAL] = "FATAL",
 };
 
+/* render the message header into @rec; mirrors the historic fprintf-based
+ * layout so log output stays byte-identical */
+static size_t log__render_head(struct log_record *rec, long long sec,
+			       long long usec, const char *prefix,
+			       const char *subs)
+{
+	int len;
+
+	if (prefix) {
+		if (subs)
+			len = snprintf(rec->buf, LOG_MSG_MAX,
+				       "[%.4lld.%.6lld] %s: %s: ",
+				       sec, usec, prefix, subs);
+		else
+			len = snprintf(rec->buf, LOG_MSG_MAX,
+				       "[%.4lld.%.6lld] %s: ",
+				       sec, usec, prefix);
+	} else {
+		if (subs)
+			len = snprintf(rec->buf, LOG_MSG_MAX,
+				       "[%.4lld.%.6lld] %s: ",
+				       sec, usec, subs);
+		else
+			len = snprintf(rec->buf, LOG_MSG_MAX,
+				       "[%.4lld.%.6lld] ", sec, usec);
+	}
+
+	if (len < 0)
+		len = 0;
+	if (len > LOG_MSG_MAX - 1)
+		len = LOG_MSG_MAX - 1;
+
+	return len;
+}
+
+/* append to @rec; truncated output is cut off, never overflown */
+__attribute__((format(printf, 2, 3)))
+static void log__render_append(struct log_record *rec, const char *format, ...)
+{
+	va_list list;
+	int len;
+
+	va_start(list, format);
+	len = vsnprintf(rec->buf + rec->len, LOG_MSG_MAX - rec->len, format,
+			list);
+	va_end(list);
+
+	if (len < 0)
+		len = 0;
+	if ((size_t)len > LOG_MSG_MAX - 1 - rec->len)
+		len = LOG_MSG_MAX - 1 - rec->len;
+
+	rec->len += len;
+}
+
+/* queue @rec on the ring or write it out directly; needs log__mutex */
+static void log__dispatch(struct log_record *rec, unsigned int sev,
+			  long long sec, long long usec)
+{
+	struct log_record note;
+	size_t idx;
+	FILE *out;
+
+	if (sev > LOG_CRITICAL) {
+		log__writer_start();
+		if (log__writer_running) {
+			if (log__ring_num >= LOG_RING_NUM) {
+				++log__ring_dropped;
+				return;
+			}
+
+			if (log__ring_dropped &&
+			    log__ring_num + 1 < LOG_RING_NUM) {
+				note.len = log__render_head(&note, sec, usec,
+						log__sev2str[LOG_NOTICE],
+						"log");
+				log__render_append(&note,
+					"ring overflow, dropped %lu messages\n",
+					log__ring_dropped);
+				log__ring_dropped = 0;
+				idx = (log__ring_first + log__ring_num) %
+								LOG_RING_NUM;
+				log__ring[idx] = note;
+				++log__ring_num;
+			}
+
+			idx = (log__ring_first + log__ring_num) % LOG_RING_NUM;
+			log__ring[idx] = *rec;
+			++log__ring_num;
+			pthread_cond_broadcast(&log__cond);
+			return;
+		}
+	}
+
+	/* critical severities and the no-writer fallback are written
+	 * synchronously; drain the ring first to preserve ordering */
+	log__writer_settle();
+	log__ring_flush();
+	out = log__target();
+	fwrite(rec->buf, 1, rec->len, out);
+	if (sev <= LOG_CRITICAL)
+		fflush(out);
+}
+
 static void log__submit(const char *file,
 			int line,
 			const char *func,
@@ -383,41 +720,35 @@ static void log__submit(const char *file,
 			const char *format,
 			va_list args)
 {
+	struct log_record rec;
 	const char *prefix = NULL;
-	FILE *out;
 	long long sec, usec;
+	unsigned long suppressed = 0;
 	bool nl;
 	size_t len;
 
 	if (log__omit(file, line, func, config, subs, sev))
 		return;
 
-	if (log__file)
-		out = log__file;
-	else
-		out = stderr;
-
 	log__time(&sec, &usec);
 
 	if (sev < LOG_SEV_NUM)
 		prefix = log__sev2str[sev];
 
-	if (prefix) {
-		if (subs)
-			fprintf(out, "[%.4lld.%.6lld] %s: %s: ",
-				sec, usec, prefix, subs);
-		else
-			fprintf(out, "[%.4lld.%.6lld] %s: ",
-				sec, usec, prefix);
-	} else {
-		if (subs)
-			fprintf(out, "[%.4lld.%.6lld] %s: ", sec, usec, subs);
-		else
-			fprintf(out, "[%.4lld.%.6lld] ", sec, usec);
+	if (sev > LOG_CRITICAL && file &&
+	    log__ratelimit(file, line, sec, &suppressed))
+		return;
+
+	if (suppressed) {
+		rec.len = log__render_head(&rec, sec, usec, prefix, subs);
+		log__render_append(&rec,
+				   "last message repeated %lu more times (%s:%d)\n",
+				   suppressed, file, line);
+		log__dispatch(&rec, sev, sec, usec);
 	}
 
 	len = strlen(format);
-	nl = format[len - 1] == '\n';
+	nl = len && format[len - 1] == '\n';
 
 	if (!func)
 		func = "<unknown>";
@@ -426,10 +757,23 @@ static void log__submit(const char *file,
 	if (line < 0)
 		line = 0;
 
-	vfprintf(out, format, args);
+	rec.len = log__render_head(&rec, sec, usec, prefix, subs);
+
+	len = vsnprintf(rec.buf + rec.len, LOG_MSG_MAX - rec.len, format,
+			args);
+	if ((int)len < 0)
+		len = 0;
+	if (len > LOG_MSG_MAX - 1 - rec.len)
+		len = LOG_MSG_MAX - 1 - rec.len;
+	rec.len += len;
 
 	if (!nl)
-		fprintf(out, " (%s() in %s:%d)\n", func, file, line);
+		log__render_append(&rec, " (%s() in %s:%d)\n", func, file,
+				   line);
+	else if (rec.buf[rec.len - 1] != '\n')
+		rec.buf[rec.len - 1] = '\n';
+
+	log__dispatch(&rec, sev, sec, usec);
 }
 
 static void log__format(const char *file,
@@ -0,0 +1,112 @@
+/*
+ * shl - Object Pool
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * A pool for fixed-size objects with freelist recycling
+ * Freed objects are kept on a freelist (up to a configurable cap) and handed
+ * out again on the next allocation, so alloc/free cycles of the same object
+ * type hit the heap only while the pool warms up. This is meant for objects
+ * that churn in bursts, like ring segments or event-loop sources. Pools are
+ * not thread-safe; use one pool per thread or protect it externally.
+ */
+
+#ifndef SHL_POOL_H
+#define SHL_POOL_H
+
+#include <stddef.h>
+#include <stdlib.h>
+
+struct shl_pool_obj {
+	struct shl_pool_obj *next;
+};
+
+struct shl_pool {
+	struct shl_pool_obj *cache;
+	size_t obj_size;
+	size_t num;
+	size_t max;
+};
+
+#define SHL_POOL_INIT(size, max_cache) { NULL, (size), 0, (max_cache) }
+
+static inline void shl_pool_init(struct shl_pool *pool, size_t obj_size,
+				 size_t max_cache)
+{
+	pool->cache = NULL;
+	pool->obj_size = obj_size;
+	pool->num = 0;
+	pool->max = max_cache;
+}
+
+static inline void *shl_pool_alloc(struct shl_pool *pool)
+{
+	struct shl_pool_obj *obj;
+	size_t size;
+
+	obj = pool->cache;
+	if (obj) {
+		pool->cache = obj->next;
+		--pool->num;
+		return obj;
+	}
+
+	/* freed objects carry the freelist link */
+	size = pool->obj_size;
+	if (size < sizeof(*obj))
+		size = sizeof(*obj);
+
+	return malloc(size);
+}
+
+static inline void shl_pool_free(struct shl_pool *pool, void *ptr)
+{
+	struct shl_pool_obj *obj = ptr;
+
+	if (!ptr)
+		return;
+
+	if (pool->num >= pool->max) {
+		free(ptr);
+		return;
+	}
+
+	obj->next = pool->cache;
+	pool->cache = obj;
+	++pool->num;
+}
+
+static inline void shl_pool_drain(struct shl_pool *pool)
+{
+	struct shl_pool_obj *obj;
+
+	while (pool->cache) {
+		obj = pool->cache;
+		pool->cache = obj->next;
+		free(obj);
+	}
+	pool->num = 0;
+}
+
+#endif /* SHL_POOL_H */
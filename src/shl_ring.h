@@ -35,9 +35,14 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <sys/uio.h>
+#include "shl_pool.h"
 
 #define SHL_RING_SIZE 512
 
+/* number of dropped segments each ring keeps for reuse */
+#define SHL_RING_POOL_MAX 16
+
 struct shl_ring_entry {
 	struct shl_ring_entry *next;
 	size_t len;
@@ -47,6 +52,7 @@ struct shl_ring_entry {
 struct shl_ring {
 	struct shl_ring_entry *first;
 	struct shl_ring_entry *last;
+	struct shl_pool pool;
 };
 
 static inline int shl_ring_new(struct shl_ring **out)
@@ -61,6 +67,8 @@ static inline int shl_ring_new(struct shl_ring **out)
 		return -ENOMEM;
 
 	memset(ring, 0, sizeof(*ring));
+	shl_pool_init(&ring->pool, sizeof(struct shl_ring_entry) +
+		      SHL_RING_SIZE, SHL_RING_POOL_MAX);
 
 	*out = ring;
 	return 0;
@@ -78,6 +86,7 @@ static inline void shl_ring_free(struct shl_ring *ring)
 		ring->first = tmp->next;
 		free(tmp);
 	}
+	shl_pool_drain(&ring->pool);
 	free(ring);
 }
 
@@ -101,7 +110,7 @@ static inline int shl_ring_write(struct shl_ring *ring, const char *val,
 next:
 	ent = ring->last;
 	if (!ent || ent->len >= SHL_RING_SIZE) {
-		ent = malloc(sizeof(*ent) + SHL_RING_SIZE);
+		ent = shl_pool_alloc(&ring->pool);
 		if (!ent)
 			return -ENOMEM;
 
@@ -157,6 +166,27 @@ static inline const char *shl_ring_peek(struct shl_ring *ring, size_t *len,
 	return &ring->first->buf[offset];
 }
 
+/* Fill @vec with up to @num iovecs, one for each pending segment in order,
+ * so the caller can flush the whole ring with a single gather-write. Returns
+ * the number of iovecs filled. */
+static inline size_t shl_ring_peek_all(struct shl_ring *ring,
+				       struct iovec *vec, size_t num)
+{
+	struct shl_ring_entry *iter;
+	size_t n = 0;
+
+	if (!ring || !vec)
+		return 0;
+
+	for (iter = ring->first; iter && n < num; iter = iter->next) {
+		vec[n].iov_base = iter->buf;
+		vec[n].iov_len = iter->len;
+		++n;
+	}
+
+	return n;
+}
+
 static inline void shl_ring_drop(struct shl_ring *ring, size_t len)
 {
 	struct shl_ring_entry *ent;
@@ -172,7 +202,7 @@ next:
 	if (len >= ent->len) {
 		len -= ent->len;
 		ring->first = ent->next;
-		free(ent);
+		shl_pool_free(&ring->pool, ent);
 		if (!ring->first)
 			ring->last = NULL;
 
@@ -194,7 +224,7 @@ static inline void shl_ring_flush(struct shl_ring *ring)
 	while (ring->first) {
 		tmp = ring->first;
 		ring->first = tmp->next;
-		free(tmp);
+		shl_pool_free(&ring->pool, tmp);
 	}
 	ring->last = NULL;
 }
@@ -0,0 +1,139 @@
+/*
+ * shl_sched - CPU Affinity and Scheduling Helpers
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * CPU affinity and scheduling helpers
+ */
+
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "shl_sched.h"
+
+static pthread_mutex_t sched__mutex = PTHREAD_MUTEX_INITIALIZER;
+static cpu_set_t sched__worker_cpus;
+static bool sched__have_worker_cpus;
+
+static int sched_parse_cpus(const char *cpus, cpu_set_t *set)
+{
+	const char *pos = cpus;
+	char *end;
+	long lo, hi;
+
+	CPU_ZERO(set);
+
+	while (*pos) {
+		lo = strtol(pos, &end, 10);
+		if (end == pos || lo < 0 || lo >= CPU_SETSIZE)
+			return -EINVAL;
+		hi = lo;
+		pos = end;
+
+		if (*pos == '-') {
+			++pos;
+			hi = strtol(pos, &end, 10);
+			if (end == pos || hi < lo || hi >= CPU_SETSIZE)
+				return -EINVAL;
+			pos = end;
+		}
+
+		while (lo <= hi)
+			CPU_SET(lo++, set);
+
+		if (*pos == ',')
+			++pos;
+		else if (*pos)
+			return -EINVAL;
+	}
+
+	if (!CPU_COUNT(set))
+		return -EINVAL;
+
+	return 0;
+}
+
+int shl_sched_apply_cpus(const char *cpus)
+{
+	cpu_set_t set;
+	int ret;
+
+	if (!cpus)
+		return -EINVAL;
+
+	ret = sched_parse_cpus(cpus, &set);
+	if (ret)
+		return ret;
+
+	ret = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+	if (ret)
+		return -ret;
+
+	return 0;
+}
+
+int shl_sched_set_worker_cpus(const char *cpus)
+{
+	cpu_set_t set;
+	int ret;
+
+	if (cpus) {
+		ret = sched_parse_cpus(cpus, &set);
+		if (ret)
+			return ret;
+	}
+
+	pthread_mutex_lock(&sched__mutex);
+	if (cpus)
+		memcpy(&sched__worker_cpus, &set, sizeof(set));
+	sched__have_worker_cpus = !!cpus;
+	pthread_mutex_unlock(&sched__mutex);
+
+	return 0;
+}
+
+void shl_sched_prepare_worker(void)
+{
+	struct sched_param param;
+	cpu_set_t set;
+	bool have;
+
+	/* New threads inherit the scheduling policy of their creator, but
+	 * a realtime policy on the dispatch thread must never extend to
+	 * bulk raster/render work. */
+	memset(&param, 0, sizeof(param));
+	pthread_setschedparam(pthread_self(), SCHED_OTHER, &param);
+
+	pthread_mutex_lock(&sched__mutex);
+	have = sched__have_worker_cpus;
+	if (have)
+		memcpy(&set, &sched__worker_cpus, sizeof(set));
+	pthread_mutex_unlock(&sched__mutex);
+
+	if (have)
+		pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
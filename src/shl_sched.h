@@ -0,0 +1,52 @@
+/*
+ * shl_sched - CPU Affinity and Scheduling Helpers
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * CPU affinity and scheduling helpers
+ * Small helpers to pin threads to a CPU list and to keep worker threads off
+ * a realtime policy of the dispatch thread. CPU lists use the kernel cpuset
+ * syntax, that is, comma-separated decimal CPU numbers or ranges like
+ * "0-3,6".
+ */
+
+#ifndef SHL_SCHED_H
+#define SHL_SCHED_H
+
+/* Pin the calling thread to the CPU list @cpus. Returns 0 on success,
+ * -EINVAL if the list cannot be parsed, otherwise a negative error code. */
+int shl_sched_apply_cpus(const char *cpus);
+
+/* Set the CPU list that shl_sched_prepare_worker() pins worker threads to.
+ * A NULL @cpus clears the list. Returns 0 on success, -EINVAL if the list
+ * cannot be parsed. */
+int shl_sched_set_worker_cpus(const char *cpus);
+
+/* Call this first in every worker thread. It resets the thread to
+ * SCHED_OTHER so workers never inherit a realtime policy of the thread
+ * that created them, and pins the thread to the worker CPU list if one
+ * was set. Errors are ignored; this is best-effort tuning. */
+void shl_sched_prepare_worker(void);
+
+#endif /* SHL_SCHED_H */
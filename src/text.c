@@ -32,13 +32,19 @@
  */
 
 #include <errno.h>
+#include <inttypes.h>
 #include <pthread.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/stat.h>
+#include "mem.h"
 #include "shl_dlist.h"
+#include "shl_hashtable.h"
 #include "shl_log.h"
 #include "shl_misc.h"
 #include "shl_register.h"
+#include "shl_timer.h"
 #include "text.h"
 #include "uterm_video.h"
 
@@ -111,12 +117,18 @@ static int new_text(struct kmscon_text *text, const char *backend)
 
 	memset(text, 0, sizeof(*text));
 	text->ref = 1;
+	shl_dlist_init(&text->blink_list);
+	text->blink_phase = true;
 
 	if (backend)
 		record = shl_register_find(&text_reg, backend);
 	else
 		record = shl_register_first(&text_reg);
 
+	/* the backend may live in a module that is loaded on demand */
+	if (!record && backend && !kmscon_load_module(backend))
+		record = shl_register_find(&text_reg, backend);
+
 	if (!record) {
 		log_error("requested backend '%s' not found", name);
 		return -ENOENT;
@@ -168,6 +180,11 @@ int kmscon_text_new(struct kmscon_text **out, const char *backend)
 			goto err_free;
 	}
 
+	/* statistics are optional; all timer helpers accept NULL */
+	ret = shl_timer_new(&text->timer);
+	if (ret)
+		log_warning("cannot create stats timer: %d", ret);
+
 	log_debug("using: be: %s", text->ops->name);
 	*out = text;
 	return 0;
@@ -208,10 +225,388 @@ void kmscon_text_unref(struct kmscon_text *text)
 
 	if (text->ops->destroy)
 		text->ops->destroy(text);
+	shl_hashtable_free(text->blink_tbl);
 	shl_register_record_unref(text->record);
+	shl_timer_free(text->timer);
 	free(text);
 }
 
+/**
+ * kmscon_text_record_swap:
+ * @txt: valid text renderer
+ * @usecs: time the display swap took in microseconds
+ *
+ * The text renderer cannot see the display swap, so the caller accounts it
+ * here to complete the per-frame statistics.
+ */
+void kmscon_text_record_swap(struct kmscon_text *txt, uint64_t usecs)
+{
+	if (!txt)
+		return;
+
+	++txt->stats.swaps;
+	txt->stats.swap_usecs += usecs;
+}
+
+/**
+ * kmscon_text_dump_stats:
+ * @txt: valid text renderer
+ *
+ * This logs the render statistics collected since the last dump and resets
+ * them. The draw-stage covers everything between kmscon_text_prepare() and
+ * kmscon_text_render(), that is, the console-iteration including all
+ * kmscon_text_draw() calls.
+ */
+void kmscon_text_dump_stats(struct kmscon_text *txt)
+{
+	uint64_t frames, swaps;
+
+	if (!txt)
+		return;
+
+	frames = txt->stats.frames ? txt->stats.frames : 1;
+	swaps = txt->stats.swaps ? txt->stats.swaps : 1;
+
+	log_info("stats: be: %s frames: %" PRIu64 " cells: %" PRIu64
+		 " (avg %" PRIu64 "/frame)",
+		 txt->ops->name, txt->stats.frames, txt->stats.cells,
+		 txt->stats.cells / frames);
+	log_info("stats: avg/frame: prepare: %" PRIu64 "us draw: %" PRIu64
+		 "us render: %" PRIu64 "us swap: %" PRIu64 "us (%" PRIu64
+		 " swaps)",
+		 txt->stats.prepare_usecs / frames,
+		 txt->stats.draw_usecs / frames,
+		 txt->stats.render_usecs / frames,
+		 txt->stats.swap_usecs / swaps,
+		 txt->stats.swaps);
+
+	memset(&txt->stats, 0, sizeof(txt->stats));
+}
+
+/*
+ * Rendered-line cache
+ * Browsing the scrollback redraws full grids of content that never changes.
+ * Backends with CPU access to their target buffers can therefore copy the
+ * rasterized strip of a cell-row out and blit it back whenever the same row
+ * content comes around again, turning Shift+PageUp/PageDown into row blits
+ * plus the rows that were never on screen before. The text layer buffers
+ * the cells of each row as they arrive from tsm, keys strips by a content
+ * hash of the whole row and only caches rows that were drawn completely;
+ * rows with age-skipped cells bypass the cache. Strips are bounded by an
+ * LRU and also registered with the memory-pressure registry.
+ */
+
+/* total strip payload per renderer before the LRU starts evicting */
+#define TEXT_STRIP_MEM_MAX (8 * 1024 * 1024)
+/* combining-character limit of a buffered cell; longer cells are drawn
+ * directly and make their row uncacheable */
+#define TEXT_CELL_CHMAX 8
+
+struct text_cell {
+	uint32_t id;
+	uint32_t ch[TEXT_CELL_CHMAX];
+	size_t len;
+	unsigned int width;
+	unsigned int posx;
+	struct tsm_screen_attr attr;
+};
+
+struct text_strip {
+	struct shl_dlist lru;
+	uint64_t hash;
+	/* ops->strip_size() bytes of pixel data */
+	uint8_t data[];
+};
+
+static unsigned int text_strip_hash_fn(const void *data)
+{
+	const uint64_t *hash = data;
+
+	return (unsigned int)(*hash ^ (*hash >> 32));
+}
+
+static bool text_strip_equal_fn(const void *data1, const void *data2)
+{
+	return *(const uint64_t*)data1 == *(const uint64_t*)data2;
+}
+
+/* FNV-1a over the buffered cells of the current row. 64bit so an accidental
+ * collision showing a wrong line is practically impossible. */
+static uint64_t text_row_hash(struct kmscon_text *txt, unsigned int num)
+{
+	const struct text_cell *cell;
+	uint64_t hash = 0xcbf29ce484222325ULL;
+	const uint8_t *p;
+	unsigned int i;
+	size_t n;
+	uint8_t flags;
+
+	for (i = 0; i < num; ++i) {
+		cell = &txt->row[i];
+		flags = cell->attr.bold | cell->attr.underline << 1 |
+			cell->attr.inverse << 2 | cell->attr.protect << 3 |
+			cell->attr.blink << 4;
+
+		for (p = (const uint8_t*)&cell->id, n = 0; n < sizeof(cell->id); ++n)
+			hash = (hash ^ p[n]) * 0x100000001b3ULL;
+		for (p = (const uint8_t*)cell->ch, n = 0;
+		     n < cell->len * sizeof(*cell->ch); ++n)
+			hash = (hash ^ p[n]) * 0x100000001b3ULL;
+		hash = (hash ^ cell->len) * 0x100000001b3ULL;
+		hash = (hash ^ cell->width) * 0x100000001b3ULL;
+		hash = (hash ^ cell->posx) * 0x100000001b3ULL;
+		hash = (hash ^ (uint8_t)cell->attr.fccode) * 0x100000001b3ULL;
+		hash = (hash ^ (uint8_t)cell->attr.bccode) * 0x100000001b3ULL;
+		hash = (hash ^ cell->attr.fr) * 0x100000001b3ULL;
+		hash = (hash ^ cell->attr.fg) * 0x100000001b3ULL;
+		hash = (hash ^ cell->attr.fb) * 0x100000001b3ULL;
+		hash = (hash ^ cell->attr.br) * 0x100000001b3ULL;
+		hash = (hash ^ cell->attr.bg) * 0x100000001b3ULL;
+		hash = (hash ^ cell->attr.bb) * 0x100000001b3ULL;
+		hash = (hash ^ flags) * 0x100000001b3ULL;
+	}
+
+	return hash;
+}
+
+static void text_strip_evict(struct kmscon_text *txt,
+			     struct text_strip *strip)
+{
+	shl_dlist_unlink(&strip->lru);
+	shl_hashtable_remove(txt->strips, &strip->hash);
+	txt->strip_mem.bytes -= sizeof(*strip) + txt->strip_size;
+	free(strip);
+}
+
+static void text_strips_clear(struct kmscon_text *txt)
+{
+	struct text_strip *strip;
+
+	if (!txt->strips)
+		return;
+
+	while (!shl_dlist_empty(&txt->strip_lru)) {
+		strip = shl_dlist_entry(txt->strip_lru.next,
+					struct text_strip, lru);
+		text_strip_evict(txt, strip);
+	}
+}
+
+static void text_strips_shrink(struct mem_cache *mem)
+{
+	struct kmscon_text *txt = shl_dlist_entry(mem, struct kmscon_text,
+						  strip_mem);
+
+	text_strips_clear(txt);
+}
+
+/* The cache is strictly optional; if anything fails the renderer simply
+ * runs without it. */
+static void text_strips_init(struct kmscon_text *txt)
+{
+	int ret;
+
+	if (!txt->ops->strip_size || !txt->ops->strip_get ||
+	    !txt->ops->strip_put)
+		return;
+
+	txt->strip_size = txt->ops->strip_size(txt);
+	if (!txt->strip_size)
+		return;
+
+	txt->row = malloc(sizeof(*txt->row) * txt->cols);
+	if (!txt->row)
+		return;
+
+	ret = shl_hashtable_new(&txt->strips, text_strip_hash_fn,
+				text_strip_equal_fn, NULL, NULL);
+	if (ret) {
+		free(txt->row);
+		txt->row = NULL;
+		return;
+	}
+
+	shl_dlist_init(&txt->strip_lru);
+	txt->row_num = 0;
+	txt->strip_mem.name = "text-strips";
+	txt->strip_mem.level = 0;
+	txt->strip_mem.bytes = 0;
+	txt->strip_mem.shrink = text_strips_shrink;
+	mem_cache_register(&txt->strip_mem);
+}
+
+static void text_strips_destroy(struct kmscon_text *txt)
+{
+	if (!txt->strips)
+		return;
+
+	text_strips_clear(txt);
+	mem_cache_unregister(&txt->strip_mem);
+	shl_hashtable_free(txt->strips);
+	txt->strips = NULL;
+	free(txt->row);
+	txt->row = NULL;
+	txt->row_num = 0;
+}
+
+/*
+ * Blink-attribute tracking
+ * The renderers draw blinking cells like any other cell, so toggling the
+ * phase used to require periodic full redraws. Instead, the set of cells
+ * carrying the blink attribute is tracked as they pass through
+ * kmscon_text_draw(): the caller can suppress its blink timer entirely
+ * while the set is empty and a phase toggle only repaints the tracked
+ * cells. The tracked cells are re-drawn on every rendered frame, which
+ * also keeps all buffers of the swap cycle in the current phase without
+ * extra per-buffer bookkeeping.
+ */
+
+struct text_blink {
+	struct shl_dlist list;
+	unsigned long key;
+	unsigned int posy;
+	struct text_cell cell;
+};
+
+static void text_blink_clear(struct kmscon_text *txt)
+{
+	struct text_blink *blink;
+
+	while (!shl_dlist_empty(&txt->blink_list)) {
+		blink = shl_dlist_entry(txt->blink_list.next,
+					struct text_blink, list);
+		shl_dlist_unlink(&blink->list);
+		shl_hashtable_remove(txt->blink_tbl, (void*)blink->key);
+		free(blink);
+	}
+	txt->blink_num = 0;
+}
+
+static void text_track_blink(struct kmscon_text *txt,
+			     uint32_t id, const uint32_t *ch, size_t len,
+			     unsigned int width,
+			     unsigned int posx, unsigned int posy,
+			     const struct tsm_screen_attr *attr)
+{
+	struct text_blink *blink;
+	unsigned long key = (unsigned long)posy * txt->cols + posx;
+	int ret;
+
+	/* tracking is optional; without it blinking cells simply stay in
+	 * whatever phase they were drawn in */
+	if (!txt->blink_tbl) {
+		ret = shl_hashtable_new(&txt->blink_tbl, shl_direct_hash,
+					shl_direct_equal, NULL, NULL);
+		if (ret) {
+			txt->blink_tbl = NULL;
+			return;
+		}
+	}
+
+	if (shl_hashtable_find(txt->blink_tbl, (void**)&blink, (void*)key)) {
+		if (!attr->blink) {
+			shl_dlist_unlink(&blink->list);
+			shl_hashtable_remove(txt->blink_tbl, (void*)key);
+			free(blink);
+			--txt->blink_num;
+			return;
+		}
+	} else {
+		if (!attr->blink)
+			return;
+
+		blink = malloc(sizeof(*blink));
+		if (!blink)
+			return;
+
+		ret = shl_hashtable_insert(txt->blink_tbl, (void*)key, blink);
+		if (ret) {
+			free(blink);
+			return;
+		}
+		shl_dlist_link(&txt->blink_list, &blink->list);
+		++txt->blink_num;
+	}
+
+	blink->key = key;
+	blink->posy = posy;
+	blink->cell.id = id;
+	if (len > TEXT_CELL_CHMAX)
+		len = TEXT_CELL_CHMAX;
+	if (len)
+		memcpy(blink->cell.ch, ch, len * sizeof(*ch));
+	blink->cell.len = len;
+	blink->cell.width = width;
+	blink->cell.posx = posx;
+	blink->cell.attr = *attr;
+}
+
+/* Re-position tracked cells after the scroll fast-path moved the buffer
+ * contents; entries scrolled out of view are dropped, rows scrolled into
+ * view are redrawn and re-tracked normally. */
+static void text_shift_blink(struct kmscon_text *txt, int rows)
+{
+	struct shl_dlist *iter, *tmp;
+	struct text_blink *blink;
+	int posy;
+
+	shl_dlist_for_each_safe(iter, tmp, &txt->blink_list) {
+		blink = shl_dlist_entry(iter, struct text_blink, list);
+
+		shl_hashtable_remove(txt->blink_tbl, (void*)blink->key);
+
+		posy = (int)blink->posy - rows;
+		if (posy < 0 || posy >= (int)txt->rows) {
+			shl_dlist_unlink(&blink->list);
+			free(blink);
+			--txt->blink_num;
+			continue;
+		}
+
+		blink->posy = posy;
+		blink->key = (unsigned long)posy * txt->cols +
+			     blink->cell.posx;
+		if (shl_hashtable_insert(txt->blink_tbl, (void*)blink->key,
+					 blink)) {
+			shl_dlist_unlink(&blink->list);
+			free(blink);
+			--txt->blink_num;
+		}
+	}
+}
+
+/**
+ * kmscon_text_set_blink:
+ * @txt: valid text renderer
+ * @phase: true if blinking cells are visible
+ *
+ * Set the phase blinking cells are drawn in. The caller toggles this
+ * periodically and re-renders; only the tracked blink cells are repainted
+ * as all other cells are skipped by the damage tracking.
+ */
+void kmscon_text_set_blink(struct kmscon_text *txt, bool phase)
+{
+	if (!txt)
+		return;
+
+	txt->blink_phase = phase;
+}
+
+/**
+ * kmscon_text_blink_num:
+ * @txt: valid text renderer
+ *
+ * Returns: number of cells with the blink attribute in the last drawn
+ * frame; 0 if none, so the caller can suppress its blink timer.
+ */
+unsigned int kmscon_text_blink_num(struct kmscon_text *txt)
+{
+	if (!txt)
+		return 0;
+
+	return txt->blink_num;
+}
+
 /**
  * kmscon_text_set:
  * @txt: Valid text-renderer object
@@ -244,6 +639,24 @@ int kmscon_text_set(struct kmscon_text *txt,
 	if (!bold_font)
 		bold_font = font;
 
+	/* A mode switch hands the same font and display in again. Let the
+	 * backend just recompute its geometry instead of tearing down and
+	 * rebuilding all its caches; the damage state is reset as the new
+	 * mode invalidates all buffer contents. */
+	if (txt->ops->resize && txt->font == font &&
+	    txt->bold_font == bold_font && txt->disp == disp) {
+		ret = txt->ops->resize(txt);
+		if (!ret) {
+			kmscon_text_damage_all(txt);
+			/* strip geometry depends on the mode */
+			text_strips_destroy(txt);
+			text_strips_init(txt);
+			/* cell positions changed; re-tracked on redraw */
+			text_blink_clear(txt);
+			return 0;
+		}
+	}
+
 	kmscon_text_unset(txt);
 
 	txt->font = font;
@@ -260,6 +673,20 @@ int kmscon_text_set(struct kmscon_text *txt,
 		}
 	}
 
+	/* Damage tracking needs the real buffer-cycle depth of the display;
+	 * if the backend cannot report it, play safe and redraw everything. */
+	if (txt->ops->bufs) {
+		txt->bufs = uterm_display_get_bufs(disp);
+		if (txt->bufs > txt->ops->bufs)
+			txt->bufs = txt->ops->bufs;
+		if (txt->bufs > KMSCON_TEXT_MAX_BUFS)
+			txt->bufs = KMSCON_TEXT_MAX_BUFS;
+	} else {
+		txt->bufs = 0;
+	}
+
+	text_strips_init(txt);
+
 	kmscon_font_ref(txt->font);
 	kmscon_font_ref(txt->bold_font);
 	uterm_display_ref(txt->disp);
@@ -281,6 +708,9 @@ void kmscon_text_unset(struct kmscon_text *txt)
 	if (!txt || !txt->disp || !txt->font)
 		return;
 
+	text_strips_destroy(txt);
+	text_blink_clear(txt);
+
 	if (txt->ops->unset)
 		txt->ops->unset(txt);
 
@@ -293,6 +723,139 @@ void kmscon_text_unset(struct kmscon_text *txt)
 	txt->cols = 0;
 	txt->rows = 0;
 	txt->rendering = false;
+	txt->bufs = 0;
+	kmscon_text_damage_all(txt);
+}
+
+/**
+ * kmscon_text_damage_all:
+ * @txt: valid text renderer
+ *
+ * This invalidates all damage-tracking state of @txt. The next rendering round
+ * will redraw every cell instead of only cells that changed since the target
+ * buffer was rendered last. Call this whenever the contents of the target
+ * buffers become unknown, that is, after display sleep/wake cycles, failed
+ * page-flips or modesets.
+ */
+void kmscon_text_damage_all(struct kmscon_text *txt)
+{
+	if (!txt)
+		return;
+
+	memset(txt->buf_ages, 0, sizeof(txt->buf_ages));
+	txt->buf_pos = 0;
+	txt->skip_age = 0;
+	txt->last_age = 0;
+
+	memset(txt->buf_shifts, 0, sizeof(txt->buf_shifts));
+	memset(txt->buf_pure, 0, sizeof(txt->buf_pure));
+	txt->pending_shift = 0;
+	txt->pending_pure = false;
+	txt->shift_declared = false;
+	txt->shift_active = false;
+	txt->shift_applied = 0;
+}
+
+/**
+ * kmscon_text_set_shift:
+ * @txt: valid text renderer
+ * @rows: number of cell-rows the screen content moved up (negative for down)
+ *
+ * Declare that the only change to the screen since the last rendered frame is
+ * a pure vertical scroll by @rows cell-rows. This allows renderers that keep
+ * their target buffers to shift the existing framebuffer contents and repaint
+ * only the newly exposed rows. Only one declaration per frame takes the
+ * fast path; if a declaration is still pending because the redraw was
+ * deferred, further ones degrade to a full redraw.
+ * The caller must guarantee that the screen really scrolled by exactly @rows;
+ * if the scroll might have been clamped, verify the rendered frame with
+ * kmscon_text_shift_stale() and redraw fully if it reports staleness.
+ * Any other screen modification must be signalled with kmscon_text_dirty().
+ */
+void kmscon_text_set_shift(struct kmscon_text *txt, int rows)
+{
+	if (!txt)
+		return;
+
+	/* Coalesced declarations cannot be verified: if one of them was
+	 * clamped by tsm, the net shift is wrong while the console age
+	 * still advanced, so kmscon_text_shift_stale() passes. Keep the
+	 * fast path limited to a single declaration per frame. */
+	if (txt->shift_declared) {
+		kmscon_text_dirty(txt);
+		return;
+	}
+
+	txt->shift_declared = true;
+	txt->pending_shift += rows;
+}
+
+/**
+ * kmscon_text_dirty:
+ * @txt: valid text renderer
+ *
+ * Declare that the screen changed in a way that is not a pure scroll since
+ * the last rendered frame. This disables the scroll fast-path for the next
+ * frames until the damage information is complete again; the normal
+ * age-based cell skipping is not affected.
+ */
+void kmscon_text_dirty(struct kmscon_text *txt)
+{
+	if (!txt)
+		return;
+
+	txt->pending_pure = false;
+}
+
+/**
+ * kmscon_text_shift_stale:
+ * @txt: valid text renderer
+ * @age: return value of the tsm_screen_draw() call of this rendering round
+ *
+ * If a scroll fast-path shift was applied to the target buffer but the
+ * tsm_screen did not actually change (the declared scroll was clamped away,
+ * e.g. at the top of the scrollback), the buffer now shows wrongly shifted
+ * content. This can only be detected after drawing, so call this between
+ * tsm_screen_draw() and kmscon_text_render(). If it returns true, abort the
+ * round with kmscon_text_abort() and redraw the frame from scratch.
+ *
+ * Returns: true if the applied shift did not match the screen
+ */
+bool kmscon_text_shift_stale(struct kmscon_text *txt, tsm_age_t age)
+{
+	if (!txt || !txt->rendering)
+		return false;
+
+	return txt->shift_active && txt->shift_applied && age &&
+	       age == txt->last_age;
+}
+
+/**
+ * kmscon_text_set_age:
+ * @txt: valid text renderer
+ * @age: screen age of the frame that was just rendered
+ *
+ * Record the tsm_screen age of the frame that was just rendered and
+ * successfully handed to the display. The age is remembered per target buffer
+ * so double/triple-buffered backends can skip cells that are still up-to-date
+ * in the buffer they render into next. Pass the return value of
+ * tsm_screen_draw() after uterm_display_swap() succeeded. If the swap fails,
+ * call kmscon_text_damage_all() instead.
+ */
+void kmscon_text_set_age(struct kmscon_text *txt, tsm_age_t age)
+{
+	if (!txt || !txt->bufs)
+		return;
+
+	txt->buf_ages[txt->buf_pos] = age;
+	txt->buf_shifts[txt->buf_pos] = txt->pending_shift;
+	txt->buf_pure[txt->buf_pos] = txt->pending_pure;
+	txt->buf_pos = (txt->buf_pos + 1) % txt->bufs;
+
+	txt->last_age = age;
+	txt->pending_shift = 0;
+	txt->pending_pure = true;
+	txt->shift_declared = false;
 }
 
 /**
@@ -333,6 +896,63 @@ unsigned int kmscon_text_get_rows(struct kmscon_text *txt)
 	return txt->rows;
 }
 
+/*
+ * Scroll fast-path
+ * If every frame since the one still contained in the current target buffer
+ * was a pure vertical scroll, we can shift the existing buffer contents via
+ * the backend's blit_shift() and restrict drawing to the newly exposed rows.
+ * Cells inside the shift-valid window are skipped in kmscon_text_draw_cb().
+ */
+static void text_try_shift(struct kmscon_text *txt)
+{
+	unsigned int bufs, i, slot, adiff;
+	int total, ret;
+
+	if (!txt->ops->blit_shift || !txt->cur_age || !txt->pending_pure)
+		return;
+
+	bufs = txt->bufs;
+
+	/* the target buffer must contain a valid frame */
+	if (!txt->buf_ages[(txt->buf_pos + bufs - txt->cur_age) % bufs])
+		return;
+
+	/* sum up scrolls of all frames newer than the target buffer */
+	total = txt->pending_shift;
+	for (i = 1; i < txt->cur_age; ++i) {
+		slot = (txt->buf_pos + bufs - i) % bufs;
+		if (!txt->buf_ages[slot] || !txt->buf_pure[slot])
+			return;
+		total += txt->buf_shifts[slot];
+	}
+
+	adiff = (total < 0) ? -total : total;
+	if (adiff >= txt->rows)
+		return;
+
+	if (total) {
+		ret = txt->ops->blit_shift(txt, total);
+		if (ret)
+			return;
+	}
+
+	txt->shift_active = true;
+	txt->shift_applied = total;
+	if (total >= 0) {
+		txt->shift_valid_start = 0;
+		txt->shift_valid_end = txt->rows - total;
+	} else {
+		txt->shift_valid_start = -total;
+		txt->shift_valid_end = txt->rows;
+	}
+
+	/* age-skipping must not hide exposed rows with stale content */
+	txt->skip_age = 0;
+
+	if (total && txt->blink_num)
+		text_shift_blink(txt, total);
+}
+
 /**
  * kmscon_text_prepare:
  * @txt: valid text renderer
@@ -353,13 +973,47 @@ int kmscon_text_prepare(struct kmscon_text *txt)
 	if (!txt || !txt->font || !txt->disp)
 		return -EINVAL;
 
+	txt->shift_active = false;
+	txt->shift_applied = 0;
+	txt->fill_num = 0;
+	txt->row_num = 0;
+
+	shl_timer_reset(txt->timer);
+
 	txt->rendering = true;
 	if (txt->ops->prepare)
 		ret = txt->ops->prepare(txt);
-	if (ret)
+	if (ret) {
 		txt->rendering = false;
+		return ret;
+	}
 
-	return ret;
+	/* The buffer we render into now is the one we rendered into
+	 * txt->cur_age frames ago. Cells that did not change since then can
+	 * be skipped as the buffer still contains their current content.
+	 * Backends with a fixed buffer cycle always re-use the buffer from
+	 * txt->bufs frames ago; EGL backends report the real age of the
+	 * back-buffer instead, which may differ per frame. The query needs
+	 * the display to be current, hence it runs after ops->prepare(). */
+	txt->cur_age = 0;
+	txt->skip_age = 0;
+	if (txt->bufs) {
+		ret = uterm_display_get_buffer_age(txt->disp);
+		if (ret == -EOPNOTSUPP)
+			txt->cur_age = txt->bufs;
+		else if (ret >= 1 && ret <= (int)txt->bufs)
+			txt->cur_age = ret;
+
+		if (txt->cur_age)
+			txt->skip_age = txt->buf_ages[(txt->buf_pos +
+					txt->bufs - txt->cur_age) % txt->bufs];
+	}
+
+	text_try_shift(txt);
+
+	txt->stats.prepare_usecs += shl_timer_elapsed(txt->timer);
+	shl_timer_reset(txt->timer);
+	return 0;
 }
 
 /**
@@ -380,18 +1034,271 @@ int kmscon_text_prepare(struct kmscon_text *txt)
  *
  * Returns: 0 on success or negative error code if this glyph couldn't be drawn.
  */
+/* background color of @attr as seen on screen */
+static void text_fill_bg(const struct tsm_screen_attr *attr,
+			 uint8_t *r, uint8_t *g, uint8_t *b)
+{
+	if (attr->inverse) {
+		*r = attr->fr;
+		*g = attr->fg;
+		*b = attr->fb;
+	} else {
+		*r = attr->br;
+		*g = attr->bg;
+		*b = attr->bb;
+	}
+}
+
+static int text_flush_fill(struct kmscon_text *txt)
+{
+	unsigned int num;
+
+	if (!txt->fill_num)
+		return 0;
+
+	num = txt->fill_num;
+	txt->fill_num = 0;
+	return txt->ops->fill(txt, txt->fill_x, txt->fill_y, num,
+			      &txt->fill_attr);
+}
+
+static int text_draw_cell(struct kmscon_text *txt,
+			  uint32_t id, const uint32_t *ch, size_t len,
+			  unsigned int width,
+			  unsigned int posx, unsigned int posy,
+			  const struct tsm_screen_attr *attr)
+{
+	uint8_t r, g, b, rr, rg, rb;
+	int ret;
+
+	/*
+	 * Most of a frame is empty cells sharing the background of their
+	 * neighbors. Batch horizontal runs of them and hand the run to the
+	 * backend as one wide fill; glyphs pass through unbatched as cells
+	 * are disjoint and ordering between them does not matter.
+	 */
+	if (txt->ops->fill && !len && width) {
+		text_fill_bg(attr, &r, &g, &b);
+		if (txt->fill_num) {
+			text_fill_bg(&txt->fill_attr, &rr, &rg, &rb);
+			if (txt->fill_y != posy ||
+			    txt->fill_x + txt->fill_num != posx ||
+			    rr != r || rg != g || rb != b) {
+				ret = text_flush_fill(txt);
+				if (ret)
+					return ret;
+			}
+		}
+		if (!txt->fill_num) {
+			txt->fill_x = posx;
+			txt->fill_y = posy;
+			txt->fill_attr = *attr;
+		}
+		txt->fill_num += width;
+		return 0;
+	}
+
+	return txt->ops->draw(txt, id, ch, len, width, posx, posy, attr);
+}
+
+/* Draw the buffered row: blit a cached strip if the complete row content
+ * was rendered before, otherwise replay the cells through the backend and
+ * remember the resulting strip. */
+static int text_flush_row(struct kmscon_text *txt)
+{
+	struct text_strip *strip;
+	struct text_cell *cell;
+	unsigned int i, num;
+	uint64_t hash = 0;
+	bool complete, cached = false;
+	int ret;
+
+	num = txt->row_num;
+	txt->row_num = 0;
+	if (!num)
+		return 0;
+
+	complete = !txt->row_skip && txt->row_covered == txt->cols;
+
+	if (complete) {
+		hash = text_row_hash(txt, num);
+		if (shl_hashtable_find(txt->strips, (void**)&strip, &hash)) {
+			/* pending fills must not overdraw the strip later */
+			ret = text_flush_fill(txt);
+			if (ret)
+				return ret;
+
+			ret = txt->ops->strip_put(txt, txt->row_y,
+						  strip->data);
+			if (!ret) {
+				shl_dlist_unlink(&strip->lru);
+				shl_dlist_link(&txt->strip_lru, &strip->lru);
+				return 0;
+			}
+			/* blit failed; redraw but do not re-insert the hash */
+			cached = true;
+		}
+	}
+
+	for (i = 0; i < num; ++i) {
+		cell = &txt->row[i];
+		ret = text_draw_cell(txt, cell->id, cell->ch, cell->len,
+				     cell->width, cell->posx, txt->row_y,
+				     &cell->attr);
+		if (ret)
+			return ret;
+	}
+
+	if (!complete || cached)
+		return 0;
+
+	/* the row must be fully rasterized before it can be copied out */
+	ret = text_flush_fill(txt);
+	if (ret)
+		return ret;
+
+	strip = malloc(sizeof(*strip) + txt->strip_size);
+	if (!strip)
+		return 0;
+
+	ret = txt->ops->strip_get(txt, txt->row_y, strip->data);
+	if (ret) {
+		free(strip);
+		return 0;
+	}
+
+	strip->hash = hash;
+	ret = shl_hashtable_insert(txt->strips, &strip->hash, strip);
+	if (ret) {
+		free(strip);
+		return 0;
+	}
+	shl_dlist_link(&txt->strip_lru, &strip->lru);
+	txt->strip_mem.bytes += sizeof(*strip) + txt->strip_size;
+
+	while (txt->strip_mem.bytes > TEXT_STRIP_MEM_MAX &&
+	       !shl_dlist_empty(&txt->strip_lru)) {
+		strip = shl_dlist_entry(txt->strip_lru.prev,
+					struct text_strip, lru);
+		text_strip_evict(txt, strip);
+	}
+
+	return 0;
+}
+
+static int text_queue_cell(struct kmscon_text *txt,
+			   uint32_t id, const uint32_t *ch, size_t len,
+			   unsigned int width,
+			   unsigned int posx, unsigned int posy,
+			   const struct tsm_screen_attr *attr)
+{
+	struct text_cell *cell;
+
+	if (!txt->row_num) {
+		txt->row_y = posy;
+		txt->row_covered = 0;
+		txt->row_skip = false;
+	}
+
+	/* gaps from age-skipped neighbours make the row incomplete */
+	if (posx != txt->row_covered)
+		txt->row_skip = true;
+
+	/* blinking cells render phase-dependent; never cache such rows */
+	if (attr->blink)
+		txt->row_skip = true;
+
+	if (len > TEXT_CELL_CHMAX || txt->row_num == txt->cols) {
+		/* cannot buffer this cell; draw it through and give up on
+		 * caching the row. Ordering within a row does not matter as
+		 * the cells are disjoint. */
+		txt->row_skip = true;
+		if (posx + width > txt->row_covered)
+			txt->row_covered = posx + width;
+		return text_draw_cell(txt, id, ch, len, width, posx, posy,
+				      attr);
+	}
+
+	cell = &txt->row[txt->row_num++];
+	cell->id = id;
+	if (len)
+		memcpy(cell->ch, ch, len * sizeof(*ch));
+	cell->len = len;
+	cell->width = width;
+	cell->posx = posx;
+	cell->attr = *attr;
+	txt->row_covered = posx + width;
+
+	return 0;
+}
+
 int kmscon_text_draw(struct kmscon_text *txt,
 		     uint32_t id, const uint32_t *ch, size_t len,
 		     unsigned int width,
 		     unsigned int posx, unsigned int posy,
 		     const struct tsm_screen_attr *attr)
 {
+	int ret;
+
 	if (!txt || !txt->rendering)
 		return -EINVAL;
 	if (posx >= txt->cols || posy >= txt->rows || !attr)
 		return -EINVAL;
 
-	return txt->ops->draw(txt, id, ch, len, width, posx, posy, attr);
+	++txt->stats.cells;
+
+	/* keep the set of blinking cells current; non-blink cells only need
+	 * a lookup while the set is non-empty, to catch overwrites */
+	if (attr->blink || txt->blink_num)
+		text_track_blink(txt, id, ch, len, width, posx, posy, attr);
+	if (attr->blink && !txt->blink_phase) {
+		id = 0;
+		ch = NULL;
+		len = 0;
+	}
+
+	if (txt->strips) {
+		if (txt->row_num && txt->row_y != posy) {
+			ret = text_flush_row(txt);
+			if (ret)
+				return ret;
+		}
+		return text_queue_cell(txt, id, ch, len, width, posx, posy,
+				       attr);
+	}
+
+	return text_draw_cell(txt, id, ch, len, width, posx, posy, attr);
+}
+
+/* Redraw the tracked blinking cells in the current phase. Running this on
+ * every frame keeps all buffers of the swap cycle in phase and also repaints
+ * the cells on otherwise-unchanged frames, where age-skipping drops
+ * everything else. */
+static int text_replay_blink(struct kmscon_text *txt)
+{
+	struct shl_dlist *iter;
+	struct text_blink *blink;
+	struct text_cell *cell;
+	int ret;
+
+	shl_dlist_for_each(iter, &txt->blink_list) {
+		blink = shl_dlist_entry(iter, struct text_blink, list);
+		cell = &blink->cell;
+
+		if (txt->blink_phase)
+			ret = text_draw_cell(txt, cell->id, cell->ch,
+					     cell->len, cell->width,
+					     cell->posx, blink->posy,
+					     &cell->attr);
+		else
+			ret = text_draw_cell(txt, 0, NULL, 0, cell->width,
+					     cell->posx, blink->posy,
+					     &cell->attr);
+		if (ret)
+			return ret;
+	}
+
+	return 0;
 }
 
 /**
@@ -410,10 +1317,28 @@ int kmscon_text_render(struct kmscon_text *txt)
 	if (!txt || !txt->rendering)
 		return -EINVAL;
 
+	if (txt->strips)
+		ret = text_flush_row(txt);
+	if (!ret && txt->blink_num)
+		ret = text_replay_blink(txt);
+	if (!ret)
+		ret = text_flush_fill(txt);
+	if (ret) {
+		kmscon_text_abort(txt);
+		return ret;
+	}
+
+	/* everything since prepare was feeding glyphs */
+	txt->stats.draw_usecs += shl_timer_elapsed(txt->timer);
+	shl_timer_reset(txt->timer);
+
 	if (txt->ops->render)
 		ret = txt->ops->render(txt);
 	txt->rendering = false;
 
+	txt->stats.render_usecs += shl_timer_elapsed(txt->timer);
+	++txt->stats.frames;
+
 	return ret;
 }
 
@@ -432,9 +1357,14 @@ void kmscon_text_abort(struct kmscon_text *txt)
 	if (!txt || !txt->rendering)
 		return;
 
+	txt->fill_num = 0;
+	txt->row_num = 0;
 	if (txt->ops->abort)
 		txt->ops->abort(txt);
 	txt->rendering = false;
+
+	/* we might have rendered parts of the frame already */
+	kmscon_text_damage_all(txt);
 }
 
 int kmscon_text_draw_cb(struct tsm_screen *con,
@@ -444,5 +1374,195 @@ int kmscon_text_draw_cb(struct tsm_screen *con,
 			const struct tsm_screen_attr *attr,
 			tsm_age_t age, void *data)
 {
-	return kmscon_text_draw(data, id, ch, len, width, posx, posy, attr);
+	struct kmscon_text *txt = data;
+
+	/* cells inside the shift-valid window were moved into place by the
+	 * scroll fast-path and must not be redrawn */
+	if (txt->shift_active &&
+	    posy >= txt->shift_valid_start && posy < txt->shift_valid_end)
+		return 0;
+
+	/* skip cells that are still up-to-date in the current target buffer;
+	 * age 0 means "unknown" and must always be drawn */
+	if (age && txt->skip_age && age <= txt->skip_age)
+		return 0;
+
+	return kmscon_text_draw(txt, id, ch, len, width, posx, posy, attr);
+}
+
+/* auto-selection of the text renderer; see kmscon_text_autoselect() */
+#define TEXT_AUTO_DIR "/var/lib/kmscon"
+#define TEXT_AUTO_FRAMES 10
+
+static int text_bench(const char *name, struct kmscon_font *font,
+		      struct kmscon_font *bold_font,
+		      struct uterm_display *disp, uint64_t *elapsed)
+{
+	struct kmscon_text *txt;
+	struct shl_timer *timer;
+	struct tsm_screen_attr attr;
+	uint32_t ch;
+	unsigned int i, x, y;
+	int ret;
+
+	ret = kmscon_text_new(&txt, name);
+	if (ret)
+		return ret;
+
+	ret = kmscon_text_set(txt, font, bold_font, disp);
+	if (ret)
+		goto err_text;
+
+	ret = shl_timer_new(&timer);
+	if (ret)
+		goto err_unset;
+
+	memset(&attr, 0, sizeof(attr));
+	attr.fr = 255;
+	attr.fg = 255;
+	attr.fb = 255;
+
+	/* Redraw the whole grid with shifting content so no cell survives
+	 * between frames; this approximates full-screen scrolling, the most
+	 * expensive workload of the console. The swap is included in the
+	 * measurement since backends pay very different presentation costs. */
+	for (i = 0; i < TEXT_AUTO_FRAMES; ++i) {
+		ret = kmscon_text_prepare(txt);
+		if (ret)
+			goto err_timer;
+
+		for (y = 0; y < txt->rows; ++y) {
+			for (x = 0; x < txt->cols; ++x) {
+				ch = 'A' + (x + y + i) % 26;
+				kmscon_text_draw(txt, ch, &ch, 1, 1, x, y,
+						 &attr);
+			}
+		}
+
+		ret = kmscon_text_render(txt);
+		if (ret)
+			goto err_timer;
+
+		uterm_display_swap(disp, true);
+	}
+
+	*elapsed = shl_timer_elapsed(timer);
+
+err_timer:
+	shl_timer_free(timer);
+err_unset:
+	kmscon_text_unset(txt);
+err_text:
+	kmscon_text_unref(txt);
+	return ret;
+}
+
+static void text_auto_path(struct uterm_display *disp, bool opengl,
+			   char *path, size_t size)
+{
+	struct uterm_mode *mode;
+
+	mode = uterm_display_get_current(disp);
+	snprintf(path, size, TEXT_AUTO_DIR "/renderer-%ux%u-%s",
+		 mode ? uterm_mode_get_width(mode) : 0,
+		 mode ? uterm_mode_get_height(mode) : 0,
+		 opengl ? "gl" : "fb");
+	path[size - 1] = 0;
+}
+
+/**
+ * kmscon_text_autoselect:
+ * @font: Non-bold font face to benchmark with
+ * @bold_font: Bold font face to benchmark with
+ * @disp: Display to render on
+ * @name: Storage for the name of the selected backend
+ * @size: Size of @name in bytes
+ *
+ * Select the fastest text backend for @disp by running a short synthetic
+ * full-redraw benchmark on every available backend. The winner is persisted
+ * below /var/lib/kmscon, keyed by display mode and GL availability, so the
+ * benchmark runs only on the first start on a device; later starts return
+ * the stored name. The benchmark renders to the real display and is only
+ * meant to run before the first frame of a session.
+ *
+ * Returns: 0 on success, negative error code if no backend works.
+ */
+int kmscon_text_autoselect(struct kmscon_font *font,
+			   struct kmscon_font *bold_font,
+			   struct uterm_display *disp,
+			   char *name, size_t size)
+{
+	static const char *cands[] = { "bbulk", "bblit", "pixman", "gltex" };
+	char path[128], buf[32];
+	const char *winner = NULL;
+	uint64_t best = 0, elapsed;
+	unsigned int i;
+	bool opengl;
+	FILE *f;
+	int ret;
+
+	if (!font || !bold_font || !disp || !name || !size)
+		return -EINVAL;
+
+	ret = uterm_display_use(disp, &opengl);
+	opengl = ret >= 0 && opengl;
+
+	text_auto_path(disp, opengl, path, sizeof(path));
+
+	f = fopen(path, "re");
+	if (f) {
+		if (fgets(buf, sizeof(buf), f)) {
+			buf[strcspn(buf, "\n")] = 0;
+			if (*buf) {
+				log_debug("using stored text renderer %s",
+					  buf);
+				strncpy(name, buf, size - 1);
+				name[size - 1] = 0;
+				fclose(f);
+				return 0;
+			}
+		}
+		fclose(f);
+	}
+
+	log_info("benchmarking text renderers for display %p", disp);
+
+	for (i = 0; i < sizeof(cands) / sizeof(*cands); ++i) {
+		if (!opengl && !strcmp(cands[i], "gltex"))
+			continue;
+
+		ret = text_bench(cands[i], font, bold_font, disp, &elapsed);
+		if (ret) {
+			log_debug("text renderer %s not usable: %d",
+				  cands[i], ret);
+			continue;
+		}
+
+		log_debug("text renderer %s: %" PRIu64 "us for %u frames",
+			  cands[i], elapsed, TEXT_AUTO_FRAMES);
+		if (!winner || elapsed < best) {
+			winner = cands[i];
+			best = elapsed;
+		}
+	}
+
+	if (!winner)
+		return -ENOENT;
+
+	log_info("selected text renderer %s (%" PRIu64 "us for %u frames)",
+		 winner, best, TEXT_AUTO_FRAMES);
+	strncpy(name, winner, size - 1);
+	name[size - 1] = 0;
+
+	mkdir(TEXT_AUTO_DIR, 0755);
+	f = fopen(path, "we");
+	if (!f) {
+		log_warning("cannot store renderer selection in %s (%d): %m",
+			    path, errno);
+		return 0;
+	}
+	fprintf(f, "%s\n", winner);
+	fclose(f);
+
+	return 0;
 }
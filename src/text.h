@@ -35,15 +35,23 @@
 
 #include <errno.h>
 #include <libtsm.h>
+#include <stdbool.h>
 #include <stdlib.h>
 #include "font.h"
 #include "kmscon_module.h"
+#include "mem.h"
+#include "shl_dlist.h"
 #include "uterm_video.h"
 
 /* text renderer */
 
+/* maximum number of target buffers we track damage-ages for */
+#define KMSCON_TEXT_MAX_BUFS 4
+
 struct kmscon_text;
 struct kmscon_text_ops;
+struct shl_hashtable;
+struct text_cell;
 
 struct kmscon_text {
 	unsigned long ref;
@@ -57,29 +65,129 @@ struct kmscon_text {
 	unsigned int cols;
 	unsigned int rows;
 	bool rendering;
+
+	/* damage tracking */
+	/* effective buffer-cycle depth of the current display; 0 disables
+	 * damage tracking */
+	unsigned int bufs;
+	tsm_age_t buf_ages[KMSCON_TEXT_MAX_BUFS];
+	unsigned int buf_pos;
+	/* buffer age of the current rendering round in frames; either the
+	 * fixed cycle depth or queried from the display per frame */
+	unsigned int cur_age;
+	tsm_age_t skip_age;
+	tsm_age_t last_age;
+
+	/* scroll fast-path */
+	int buf_shifts[KMSCON_TEXT_MAX_BUFS];
+	bool buf_pure[KMSCON_TEXT_MAX_BUFS];
+	int pending_shift;
+	bool pending_pure;
+	/* a shift was declared for the next frame; a second declaration
+	 * before that frame renders degrades to a full redraw */
+	bool shift_declared;
+	bool shift_active;
+	int shift_applied;
+	unsigned int shift_valid_start;
+	unsigned int shift_valid_end;
+
+	/* background-run fill fast-path; see kmscon_text_draw() */
+	unsigned int fill_x;
+	unsigned int fill_y;
+	unsigned int fill_num;
+	struct tsm_screen_attr fill_attr;
+
+	/* rendered-line cache; see text_flush_row() in text.c. Only used
+	 * when the backend provides the strip_*() operations. */
+	struct shl_hashtable *strips;
+	struct shl_dlist strip_lru;
+	size_t strip_size;
+	struct mem_cache strip_mem;
+	/* cells of the row currently being assembled */
+	struct text_cell *row;
+	unsigned int row_num;
+	unsigned int row_y;
+	unsigned int row_covered;
+	bool row_skip;
+
+	/* blink-attribute cell tracking; see kmscon_text_draw() */
+	struct shl_hashtable *blink_tbl;
+	struct shl_dlist blink_list;
+	unsigned int blink_num;
+	/* true while blinking cells are in their visible phase */
+	bool blink_phase;
+
+	/* render statistics; reset on every dump */
+	struct shl_timer *timer;
+	struct {
+		uint64_t frames;
+		uint64_t cells;
+		uint64_t prepare_usecs;
+		uint64_t draw_usecs;
+		uint64_t render_usecs;
+		uint64_t swaps;
+		uint64_t swap_usecs;
+	} stats;
 };
 
 struct kmscon_text_ops {
 	const char *name;
 	struct kmscon_module *owner;
+	/* maximum buffer-cycle depth this backend supports damage-tracking
+	 * for; the effective depth is queried from the display and clamped
+	 * to this. 0 disables damage-tracking for this backend. */
+	unsigned int bufs;
+	/* prepare/draw/render may run off the eloop thread, concurrently
+	 * for different kmscon_text objects. CPU-only backends can set
+	 * this; GL backends cannot as eglMakeCurrent binds the (per-video,
+	 * display-shared) context to the calling thread. */
+	bool thread_render;
 	int (*init) (struct kmscon_text *txt);
 	void (*destroy) (struct kmscon_text *txt);
 	int (*set) (struct kmscon_text *txt);
 	void (*unset) (struct kmscon_text *txt);
+	/* geometry-only update: font and display are unchanged but the
+	 * display mode switched. Backends keep their caches alive and only
+	 * recompute sizes; return an error to request a full unset/set
+	 * cycle instead. Optional. */
+	int (*resize) (struct kmscon_text *txt);
 	int (*prepare) (struct kmscon_text *txt);
 	int (*draw) (struct kmscon_text *txt,
 		     uint32_t id, const uint32_t *ch, size_t len,
 		     unsigned int width,
 		     unsigned int posx, unsigned int posy,
 		     const struct tsm_screen_attr *attr);
+	/* fill @num cells starting at @posx/@posy with the background color
+	 * of @attr; optional. Empty cells are batched into horizontal runs
+	 * and routed here instead of (*draw) so backends can use a wide
+	 * fill instead of per-cell glyph blends. */
+	int (*fill) (struct kmscon_text *txt,
+		     unsigned int posx, unsigned int posy, unsigned int num,
+		     const struct tsm_screen_attr *attr);
 	int (*render) (struct kmscon_text *txt);
 	void (*abort) (struct kmscon_text *txt);
+	/* shift the current target buffer contents vertically by @rows
+	 * cell-rows (positive means contents move up); optional */
+	int (*blit_shift) (struct kmscon_text *txt, int rows);
+	/* rendered-line cache support: byte size of one rasterized cell-row
+	 * strip, and copies of such a strip out of / into the current target
+	 * buffer. Optional, but all three must be provided together; only
+	 * called between (*prepare) and (*render). */
+	size_t (*strip_size) (struct kmscon_text *txt);
+	int (*strip_get) (struct kmscon_text *txt, unsigned int posy,
+			  void *buf);
+	int (*strip_put) (struct kmscon_text *txt, unsigned int posy,
+			  const void *buf);
 };
 
 int kmscon_text_register(const struct kmscon_text_ops *ops);
 void kmscon_text_unregister(const char *name);
 
 int kmscon_text_new(struct kmscon_text **out, const char *backend);
+int kmscon_text_autoselect(struct kmscon_font *font,
+			   struct kmscon_font *bold_font,
+			   struct uterm_display *disp,
+			   char *name, size_t size);
 void kmscon_text_ref(struct kmscon_text *txt);
 void kmscon_text_unref(struct kmscon_text *txt);
 
@@ -91,6 +199,18 @@ void kmscon_text_unset(struct kmscon_text *txt);
 unsigned int kmscon_text_get_cols(struct kmscon_text *txt);
 unsigned int kmscon_text_get_rows(struct kmscon_text *txt);
 
+void kmscon_text_record_swap(struct kmscon_text *txt, uint64_t usecs);
+void kmscon_text_dump_stats(struct kmscon_text *txt);
+
+void kmscon_text_set_blink(struct kmscon_text *txt, bool phase);
+unsigned int kmscon_text_blink_num(struct kmscon_text *txt);
+
+void kmscon_text_damage_all(struct kmscon_text *txt);
+void kmscon_text_set_age(struct kmscon_text *txt, tsm_age_t age);
+void kmscon_text_set_shift(struct kmscon_text *txt, int rows);
+void kmscon_text_dirty(struct kmscon_text *txt);
+bool kmscon_text_shift_stale(struct kmscon_text *txt, tsm_age_t age);
+
 int kmscon_text_prepare(struct kmscon_text *txt);
 int kmscon_text_draw(struct kmscon_text *txt,
 		     uint32_t id, const uint32_t *ch, size_t len,
@@ -109,15 +109,50 @@ static int bblit_draw(struct kmscon_text *txt,
 	return ret;
 }
 
+static int bblit_fill(struct kmscon_text *txt,
+		      unsigned int posx, unsigned int posy, unsigned int num,
+		      const struct tsm_screen_attr *attr)
+{
+	uint8_t r, g, b;
+
+	if (attr->inverse) {
+		r = attr->fr;
+		g = attr->fg;
+		b = attr->fb;
+	} else {
+		r = attr->br;
+		g = attr->bg;
+		b = attr->bb;
+	}
+
+	return uterm_display_fill(txt->disp, r, g, b,
+				  posx * txt->font->attr.width,
+				  posy * txt->font->attr.height,
+				  num * txt->font->attr.width,
+				  txt->font->attr.height);
+}
+
+static int bblit_blit_shift(struct kmscon_text *txt, int rows)
+{
+	return uterm_display_shift(txt->disp,
+				   txt->rows * txt->font->attr.height,
+				   rows * (int)txt->font->attr.height);
+}
+
 struct kmscon_text_ops kmscon_text_bblit_ops = {
 	.name = "bblit",
 	.owner = NULL,
+	.bufs = KMSCON_TEXT_MAX_BUFS,
+	.thread_render = true,
 	.init = NULL,
 	.destroy = NULL,
 	.set = bblit_set,
 	.unset = NULL,
+	.resize = NULL,
 	.prepare = NULL,
 	.draw = bblit_draw,
+	.fill = bblit_fill,
 	.render = NULL,
 	.abort = NULL,
+	.blit_shift = bblit_blit_shift,
 };
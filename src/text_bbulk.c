@@ -29,7 +29,9 @@
  * @include: text.h
  *
  * Similar to the bblit renderer but assembles an array of blit-requests and
- * pushes all of them at once to the video device.
+ * pushes all of them at once to the video device. Only cells that are drawn
+ * in the current frame are queued, so cells skipped by the damage tracking
+ * or moved by the scroll fast-path cause no blend work at all.
  */
 
 #include <errno.h>
@@ -44,6 +46,7 @@
 
 struct bbulk {
 	struct uterm_video_blend_req *reqs;
+	size_t n_reqs;
 };
 
 #define FONT_WIDTH(txt) ((txt)->font->attr.width)
@@ -71,8 +74,7 @@ static void bbulk_destroy(struct kmscon_text *txt)
 static int bbulk_set(struct kmscon_text *txt)
 {
 	struct bbulk *bb = txt->data;
-	unsigned int sw, sh, i, j;
-	struct uterm_video_blend_req *req;
+	unsigned int sw, sh;
 	struct uterm_mode *mode;
 
 	memset(bb, 0, sizeof(*bb));
@@ -91,14 +93,6 @@ static int bbulk_set(struct kmscon_text *txt)
 		return -ENOMEM;
 	memset(bb->reqs, 0, sizeof(*bb->reqs) * txt->cols * txt->rows);
 
-	for (i = 0; i < txt->rows; ++i) {
-		for (j = 0; j < txt->cols; ++j) {
-			req = &bb->reqs[i * txt->cols + j];
-			req->x = j * FONT_WIDTH(txt);
-			req->y = i * FONT_HEIGHT(txt);
-		}
-	}
-
 	return 0;
 }
 
@@ -110,6 +104,14 @@ static void bbulk_unset(struct kmscon_text *txt)
 	bb->reqs = NULL;
 }
 
+static int bbulk_prepare(struct kmscon_text *txt)
+{
+	struct bbulk *bb = txt->data;
+
+	bb->n_reqs = 0;
+	return 0;
+}
+
 static int bbulk_draw(struct kmscon_text *txt,
 		      uint32_t id, const uint32_t *ch, size_t len,
 		      unsigned int width,
@@ -122,10 +124,8 @@ static int bbulk_draw(struct kmscon_text *txt,
 	struct uterm_video_blend_req *req;
 	struct kmscon_font *font;
 
-	if (!width) {
-		bb->reqs[posy * txt->cols + posx].buf = NULL;
+	if (!width)
 		return 0;
-	}
 
 	if (attr->bold)
 		font = txt->bold_font;
@@ -144,7 +144,9 @@ static int bbulk_draw(struct kmscon_text *txt,
 			return ret;
 	}
 
-	req = &bb->reqs[posy * txt->cols + posx];
+	req = &bb->reqs[bb->n_reqs++];
+	req->x = posx * FONT_WIDTH(txt);
+	req->y = posy * FONT_HEIGHT(txt);
 	req->buf = &glyph->buf;
 	if (attr->inverse) {
 		req->fr = attr->br;
@@ -168,20 +170,65 @@ static int bbulk_draw(struct kmscon_text *txt,
 static int bbulk_render(struct kmscon_text *txt)
 {
 	struct bbulk *bb = txt->data;
+	size_t n;
+
+	/* Only cells drawn in this frame were queued, so age-skipped cells
+	 * and the rows moved by the scroll fast-path are naturally excluded
+	 * from the request list. */
+	n = bb->n_reqs;
+	bb->n_reqs = 0;
+	if (!n)
+		return 0;
 
-	return uterm_display_fake_blendv(txt->disp, bb->reqs,
-					 txt->cols * txt->rows);
+	return uterm_display_fake_blendv(txt->disp, bb->reqs, n);
+}
+
+static int bbulk_fill(struct kmscon_text *txt,
+		      unsigned int posx, unsigned int posy, unsigned int num,
+		      const struct tsm_screen_attr *attr)
+{
+	uint8_t r, g, b;
+
+	if (attr->inverse) {
+		r = attr->fr;
+		g = attr->fg;
+		b = attr->fb;
+	} else {
+		r = attr->br;
+		g = attr->bg;
+		b = attr->bb;
+	}
+
+	/* runs never overlap queued glyph blends, so filling before the
+	 * requests are submitted in bbulk_render() is fine */
+	return uterm_display_fill(txt->disp, r, g, b,
+				  posx * FONT_WIDTH(txt),
+				  posy * FONT_HEIGHT(txt),
+				  num * FONT_WIDTH(txt),
+				  FONT_HEIGHT(txt));
+}
+
+static int bbulk_blit_shift(struct kmscon_text *txt, int rows)
+{
+	return uterm_display_shift(txt->disp,
+				   txt->rows * FONT_HEIGHT(txt),
+				   rows * (int)FONT_HEIGHT(txt));
 }
 
 struct kmscon_text_ops kmscon_text_bbulk_ops = {
 	.name = "bbulk",
 	.owner = NULL,
+	.bufs = KMSCON_TEXT_MAX_BUFS,
+	.thread_render = true,
 	.init = bbulk_init,
 	.destroy = bbulk_destroy,
 	.set = bbulk_set,
 	.unset = bbulk_unset,
-	.prepare = NULL,
+	.resize = NULL,
+	.prepare = bbulk_prepare,
 	.draw = bbulk_draw,
+	.fill = bbulk_fill,
 	.render = bbulk_render,
 	.abort = NULL,
+	.blit_shift = bbulk_blit_shift,
 };
@@ -34,6 +34,10 @@
  * texture sizes so we need to use multiple atlases. As there is no way to pass
  * a varying amount of textures to a shader, we need to render the screen for
  * each atlas we have.
+ * If the driver supports GL_EXT_instanced_arrays, cells are drawn as
+ * instances of a single unit-quad with per-cell instance attributes, which
+ * shrinks the CPU-side vertex building to 11 floats per cell instead of 60
+ * and draws each atlas with one instanced call.
  */
 
 #define GL_GLEXT_PROTOTYPES
@@ -45,9 +49,10 @@
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
+#include "mem.h"
 #include "shl_dlist.h"
 #include "shl_gl.h"
-#include "shl_hashtable.h"
+#include "shl_hashmap.h"
 #include "shl_log.h"
 #include "shl_misc.h"
 #include "text.h"
@@ -60,21 +65,32 @@
 #  define GL_UNPACK_ROW_LENGTH GL_UNPACK_ROW_LENGTH_EXT
 #endif
 
+/* floats per cell in the instanced vertex cache: cell position and atlas
+ * position (4), foreground color and cell width (4), background color (3) */
+#define INST_STRIDE 11
+
 struct atlas {
 	struct shl_dlist list;
 
 	GLuint tex;
 	unsigned int height;
 	unsigned int width;
+	unsigned int per_row;
 	unsigned int count;
 	unsigned int fill;
 
+	/* glyphs waiting for their texture upload at the next render */
+	struct glyph **pending;
+	unsigned int pending_num;
+	unsigned int pending_size;
+
 	unsigned int cache_size;
 	unsigned int cache_num;
 	GLfloat *cache_pos;
 	GLfloat *cache_texpos;
 	GLfloat *cache_fgcol;
 	GLfloat *cache_bgcol;
+	GLfloat *cache_inst;
 
 	GLfloat advance_htex;
 	GLfloat advance_vtex;
@@ -83,7 +99,8 @@ struct atlas {
 struct glyph {
 	const struct kmscon_glyph *glyph;
 	struct atlas *atlas;
-	unsigned int texoff;
+	unsigned int texoff_x;
+	unsigned int texoff_y;
 };
 
 #define GLYPH_WIDTH(gly) ((gly)->glyph->buf.width)
@@ -91,16 +108,33 @@ struct glyph {
 #define GLYPH_STRIDE(gly) ((gly)->glyph->buf.stride)
 #define GLYPH_DATA(gly) ((gly)->glyph->buf.data)
 
-struct gltex {
-	struct shl_hashtable *glyphs;
-	struct shl_hashtable *bold_glyphs;
+/*
+ * Shared renderer state
+ * All displays driven by the same uterm_video object render through the same
+ * GL context, so the compiled shaders, the glyph hashtables and the glyph
+ * atlases can be shared between them instead of being duplicated per display.
+ * Contexts are keyed by video object and font pair and refcounted by the
+ * attached text-renderer instances; only the viewport size and the cell
+ * advance stay per display.
+ */
+struct gltex_ctx {
+	struct shl_dlist list;
+	unsigned long ref;
+	struct uterm_video *video;
+	struct kmscon_font *font;
+	struct kmscon_font *bold_font;
+
+	struct shl_hashmap *glyphs;
+	struct shl_hashmap *bold_glyphs;
 	unsigned int max_tex_size;
 	bool supports_rowlen;
 
 	struct shl_dlist atlases;
+	/* atlases dropped by a shrink while no GL context was current; their
+	 * textures are freed at the next prepare */
+	struct shl_dlist dead_atlases;
 
-	GLfloat advance_x;
-	GLfloat advance_y;
+	struct mem_cache mem;
 
 	struct gl_shader *shader;
 	GLuint uni_proj;
@@ -108,8 +142,41 @@ struct gltex {
 	GLuint uni_advance_htex;
 	GLuint uni_advance_vtex;
 
+	bool supports_instancing;
+	struct gl_shader *cell_shader;
+	GLuint cuni_atlas;
+	GLuint cuni_advance_htex;
+	GLuint cuni_advance_vtex;
+	GLuint cuni_advance;
+
+	/* last uploaded uniform values; uniforms persist in the program
+	 * objects so redundant glUniform calls are skipped. A fresh program
+	 * has all uniforms at 0.0, which matches the zeroed fields. */
+	GLfloat last_htex;
+	GLfloat last_vtex;
+	GLfloat clast_htex;
+	GLfloat clast_vtex;
+	GLfloat cell_advance_x;
+	GLfloat cell_advance_y;
+};
+
+static struct shl_dlist gltex_ctxs = SHL_DLIST_INIT(gltex_ctxs);
+
+struct gltex {
+	struct gltex_ctx *ctx;
+
+	GLfloat advance_x;
+	GLfloat advance_y;
+
 	unsigned int sw;
 	unsigned int sh;
+
+	/* cell bounding-box of everything drawn this frame; reported as
+	 * damage hint to the display before the swap */
+	unsigned int dmg_x1;
+	unsigned int dmg_y1;
+	unsigned int dmg_x2;
+	unsigned int dmg_y2;
 };
 
 #define FONT_WIDTH(txt) ((txt)->font->attr.width)
@@ -141,155 +208,395 @@ static void free_glyph(void *data)
 	free(glyph);
 }
 
+static void free_atlas(struct atlas *atlas, bool gl)
+{
+	free(atlas->pending);
+	free(atlas->cache_pos);
+	free(atlas->cache_texpos);
+	free(atlas->cache_fgcol);
+	free(atlas->cache_bgcol);
+	free(atlas->cache_inst);
+
+	if (gl)
+		gl_tex_free(&atlas->tex, 1);
+	free(atlas);
+}
+
+/* Drop the glyph caches and atlases of @ctx under memory pressure. No GL
+ * context is current here, so the textures cannot be freed yet; the atlases
+ * are parked on dead_atlases and released at the next prepare. The glyph
+ * tables must go in the same round since the cached glyphs point into the
+ * atlases. */
+static void gltex_ctx_shrink(struct mem_cache *mem)
+{
+	struct gltex_ctx *ctx = shl_dlist_entry(mem, struct gltex_ctx, mem);
+	struct shl_hashmap *glyphs, *bold_glyphs;
+	struct shl_dlist *iter;
+	int ret;
+
+	ret = shl_hashmap_new(&glyphs, shl_map_direct_hash,
+				shl_map_direct_equal, NULL, free_glyph);
+	if (ret)
+		return;
+
+	ret = shl_hashmap_new(&bold_glyphs, shl_map_direct_hash,
+				shl_map_direct_equal, NULL, free_glyph);
+	if (ret) {
+		shl_hashmap_free(glyphs);
+		return;
+	}
+
+	shl_hashmap_free(ctx->glyphs);
+	shl_hashmap_free(ctx->bold_glyphs);
+	ctx->glyphs = glyphs;
+	ctx->bold_glyphs = bold_glyphs;
+
+	while (!shl_dlist_empty(&ctx->atlases)) {
+		iter = ctx->atlases.next;
+		shl_dlist_unlink(iter);
+		shl_dlist_link(&ctx->dead_atlases, iter);
+	}
+
+	ctx->mem.bytes = 0;
+}
+
 extern const char _binary_src_text_gltex_atlas_vert_bin_start[];
 extern const char _binary_src_text_gltex_atlas_vert_bin_end[];
 extern const char _binary_src_text_gltex_atlas_frag_bin_start[];
 extern const char _binary_src_text_gltex_atlas_frag_bin_end[];
+extern const char _binary_src_text_gltex_cell_vert_bin_start[];
+extern const char _binary_src_text_gltex_cell_vert_bin_end[];
 
-static int gltex_set(struct kmscon_text *txt)
+/* Create a fresh shared context; the caller must have made the GL context of
+ * @txt current. */
+static int gltex_ctx_new(struct kmscon_text *txt, struct uterm_video *video,
+			 struct gltex_ctx **out)
 {
-	struct gltex *gt = txt->data;
+	struct gltex_ctx *ctx;
 	int ret, vlen, flen;
 	const char *vert, *frag;
 	static char *attr[] = { "position", "texture_position",
 				"fgcolor", "bgcolor" };
 	GLint s;
 	const char *ext;
-	struct uterm_mode *mode;
-	bool opengl;
-
-	memset(gt, 0, sizeof(*gt));
-	shl_dlist_init(&gt->atlases);
+	float mat[16];
 
-	ret = shl_hashtable_new(&gt->glyphs, shl_direct_hash,
-				shl_direct_equal, NULL,
+	ctx = malloc(sizeof(*ctx));
+	if (!ctx)
+		return -ENOMEM;
+	memset(ctx, 0, sizeof(*ctx));
+	ctx->ref = 1;
+	ctx->video = video;
+	ctx->font = txt->font;
+	ctx->bold_font = txt->bold_font;
+	shl_dlist_init(&ctx->atlases);
+	shl_dlist_init(&ctx->dead_atlases);
+
+	ret = shl_hashmap_new(&ctx->glyphs, shl_map_direct_hash,
+				shl_map_direct_equal, NULL,
 				free_glyph);
 	if (ret)
-		return ret;
+		goto err_free;
 
-	ret = shl_hashtable_new(&gt->bold_glyphs, shl_direct_hash,
-				shl_direct_equal, NULL,
+	ret = shl_hashmap_new(&ctx->bold_glyphs, shl_map_direct_hash,
+				shl_map_direct_equal, NULL,
 				free_glyph);
 	if (ret)
 		goto err_htable;
 
-	ret = uterm_display_use(txt->disp, &opengl);
-	if (ret < 0 || !opengl) {
-		if (ret == -EOPNOTSUPP)
-			log_error("display doesn't support hardware-acceleration");
-		goto err_bold_htable;
-	}
-
 	vert = _binary_src_text_gltex_atlas_vert_bin_start;
 	vlen = _binary_src_text_gltex_atlas_vert_bin_end - vert;
 	frag = _binary_src_text_gltex_atlas_frag_bin_start;
 	flen = _binary_src_text_gltex_atlas_frag_bin_end - frag;
 	gl_clear_error();
 
-	ret = gl_shader_new(&gt->shader, vert, vlen, frag, flen, attr, 4,
+	ret = gl_shader_new(&ctx->shader, vert, vlen, frag, flen, attr, 4,
 			    log_llog, NULL);
 	if (ret)
 		goto err_bold_htable;
 
-	gt->uni_proj = gl_shader_get_uniform(gt->shader, "projection");
-	gt->uni_atlas = gl_shader_get_uniform(gt->shader, "atlas");
-	gt->uni_advance_htex = gl_shader_get_uniform(gt->shader,
-						     "advance_htex");
-	gt->uni_advance_vtex = gl_shader_get_uniform(gt->shader,
-						     "advance_vtex");
+	ctx->uni_proj = gl_shader_get_uniform(ctx->shader, "projection");
+	ctx->uni_atlas = gl_shader_get_uniform(ctx->shader, "atlas");
+	ctx->uni_advance_htex = gl_shader_get_uniform(ctx->shader,
+						      "advance_htex");
+	ctx->uni_advance_vtex = gl_shader_get_uniform(ctx->shader,
+						      "advance_vtex");
+
+	/* constant across frames; upload once while the program is bound */
+	gl_shader_use(ctx->shader);
+	gl_m4_identity(mat);
+	glUniformMatrix4fv(ctx->uni_proj, 1, GL_FALSE, mat);
+	glUniform1i(ctx->uni_atlas, 0);
 
-	if (gl_has_error(gt->shader)) {
+	if (gl_has_error(ctx->shader)) {
 		log_warning("cannot create shader");
+		ret = -EFAULT;
 		goto err_shader;
 	}
 
-	mode = uterm_display_get_current(txt->disp);
-	gt->sw = uterm_mode_get_width(mode);
-	gt->sh = uterm_mode_get_height(mode);
-
-	txt->cols = gt->sw / FONT_WIDTH(txt);
-	txt->rows = gt->sh / FONT_HEIGHT(txt);
-
 	glGetIntegerv(GL_MAX_TEXTURE_SIZE, &s);
 	if (s <= 0)
 		s = 64;
 	else if (s > 2048)
 		s = 2048;
-	gt->max_tex_size = s;
+	ctx->max_tex_size = s;
 
 	gl_clear_error();
 
 	ext = (const char*)glGetString(GL_EXTENSIONS);
 	if (ext && strstr((const char*)ext, "GL_EXT_unpack_subimage")) {
-		gt->supports_rowlen = true;
+		ctx->supports_rowlen = true;
 	} else {
 		log_warning("your GL implementation does not support GL_EXT_unpack_subimage, glyph-rendering may be slower than usual");
 	}
 
+#ifdef GL_EXT_instanced_arrays
+	if (ext && strstr((const char*)ext, "GL_EXT_instanced_arrays")) {
+		static char *cattr[] = { "corner", "cell", "fgcolor",
+					 "bgcolor" };
+
+		vert = _binary_src_text_gltex_cell_vert_bin_start;
+		vlen = _binary_src_text_gltex_cell_vert_bin_end - vert;
+
+		ret = gl_shader_new(&ctx->cell_shader, vert, vlen, frag, flen,
+				    cattr, 4, log_llog, NULL);
+		if (!ret) {
+			ctx->cuni_atlas =
+				gl_shader_get_uniform(ctx->cell_shader,
+						      "atlas");
+			ctx->cuni_advance_htex =
+				gl_shader_get_uniform(ctx->cell_shader,
+						      "advance_htex");
+			ctx->cuni_advance_vtex =
+				gl_shader_get_uniform(ctx->cell_shader,
+						      "advance_vtex");
+			ctx->cuni_advance =
+				gl_shader_get_uniform(ctx->cell_shader,
+						      "advance");
+
+			gl_shader_use(ctx->cell_shader);
+			glUniform1i(ctx->cuni_atlas, 0);
+
+			ctx->supports_instancing = true;
+		} else {
+			log_warning("cannot create instanced cell shader, using the per-vertex path");
+		}
+	}
+#endif
+
+	ctx->mem.name = "gltex-atlas";
+	ctx->mem.level = 1;
+	ctx->mem.shrink = gltex_ctx_shrink;
+	mem_cache_register(&ctx->mem);
+
+	shl_dlist_link(&gltex_ctxs, &ctx->list);
+	*out = ctx;
 	return 0;
 
 err_shader:
-	gl_shader_unref(gt->shader);
+	gl_shader_unref(ctx->shader);
 err_bold_htable:
-	shl_hashtable_free(gt->bold_glyphs);
+	shl_hashmap_free(ctx->bold_glyphs);
 err_htable:
-	shl_hashtable_free(gt->glyphs);
+	shl_hashmap_free(ctx->glyphs);
+err_free:
+	free(ctx);
 	return ret;
 }
 
-static void gltex_unset(struct kmscon_text *txt)
+/* find a shared context for the video object and font pair of @txt */
+static int gltex_ctx_find(struct kmscon_text *txt, struct gltex_ctx **out)
+{
+	struct uterm_video *video = uterm_display_get_video(txt->disp);
+	struct shl_dlist *iter;
+	struct gltex_ctx *ctx;
+
+	shl_dlist_for_each(iter, &gltex_ctxs) {
+		ctx = shl_dlist_entry(iter, struct gltex_ctx, list);
+		if (ctx->video == video && ctx->font == txt->font &&
+		    ctx->bold_font == txt->bold_font) {
+			++ctx->ref;
+			*out = ctx;
+			return 0;
+		}
+	}
+
+	return gltex_ctx_new(txt, video, out);
+}
+
+static void gltex_ctx_unref(struct kmscon_text *txt, struct gltex_ctx *ctx)
 {
-	struct gltex *gt = txt->data;
 	int ret;
 	struct shl_dlist *iter;
 	struct atlas *atlas;
 	bool gl = true;
 
+	if (!ctx || --ctx->ref)
+		return;
+
+	mem_cache_unregister(&ctx->mem);
+	shl_dlist_unlink(&ctx->list);
+
 	ret = uterm_display_use(txt->disp, NULL);
 	if (ret) {
 		gl = false;
 		log_warning("cannot activate OpenGL-CTX during destruction");
 	}
 
-	shl_hashtable_free(gt->bold_glyphs);
-	shl_hashtable_free(gt->glyphs);
+	shl_hashmap_free(ctx->bold_glyphs);
+	shl_hashmap_free(ctx->glyphs);
 
-	while (!shl_dlist_empty(&gt->atlases)) {
-		iter = gt->atlases.next;
+	while (!shl_dlist_empty(&ctx->atlases)) {
+		iter = ctx->atlases.next;
 		shl_dlist_unlink(iter);
-		atlas = shl_dlist_entry(iter, struct atlas, list);
-
-		free(atlas->cache_pos);
-		free(atlas->cache_texpos);
-		free(atlas->cache_fgcol);
-		free(atlas->cache_bgcol);
+		free_atlas(shl_dlist_entry(iter, struct atlas, list), gl);
+	}
 
-		if (gl)
-			gl_tex_free(&atlas->tex, 1);
-		free(atlas);
+	while (!shl_dlist_empty(&ctx->dead_atlases)) {
+		iter = ctx->dead_atlases.next;
+		shl_dlist_unlink(iter);
+		free_atlas(shl_dlist_entry(iter, struct atlas, list), gl);
 	}
 
 	if (gl) {
-		gl_shader_unref(gt->shader);
+		gl_shader_unref(ctx->cell_shader);
+		gl_shader_unref(ctx->shader);
 
 		gl_clear_error();
 	}
+
+	free(ctx);
+}
+
+/* recompute the geometry; shaders, glyph caches and atlases stay valid
+ * across mode switches since they only depend on the GL context and font */
+static int gltex_resize(struct kmscon_text *txt)
+{
+	struct gltex *gt = txt->data;
+	struct uterm_mode *mode;
+
+	mode = uterm_display_get_current(txt->disp);
+	if (!mode)
+		return -EINVAL;
+
+	gt->sw = uterm_mode_get_width(mode);
+	gt->sh = uterm_mode_get_height(mode);
+
+	txt->cols = gt->sw / FONT_WIDTH(txt);
+	txt->rows = gt->sh / FONT_HEIGHT(txt);
+
+	return 0;
+}
+
+static int gltex_set(struct kmscon_text *txt)
+{
+	struct gltex *gt = txt->data;
+	int ret;
+	bool opengl;
+
+	memset(gt, 0, sizeof(*gt));
+
+	ret = uterm_display_use(txt->disp, &opengl);
+	if (ret < 0 || !opengl) {
+		if (ret == -EOPNOTSUPP)
+			log_error("display doesn't support hardware-acceleration");
+		return ret < 0 ? ret : -EOPNOTSUPP;
+	}
+
+	ret = gltex_ctx_find(txt, &gt->ctx);
+	if (ret)
+		return ret;
+
+	ret = gltex_resize(txt);
+	if (ret) {
+		gltex_ctx_unref(txt, gt->ctx);
+		gt->ctx = NULL;
+	}
+
+	return ret;
+}
+
+static void gltex_unset(struct kmscon_text *txt)
+{
+	struct gltex *gt = txt->data;
+
+	gltex_ctx_unref(txt, gt->ctx);
+	gt->ctx = NULL;
+}
+
+/* Returns the next free glyph position in @atlas if a glyph of width @num is
+ * to be added. Wide glyphs must not wrap across a row boundary, so the
+ * remainder of a row may be skipped. */
+static unsigned int atlas_fill_pos(struct atlas *atlas, unsigned int num)
+{
+	unsigned int col;
+
+	col = atlas->fill % atlas->per_row;
+	if (num <= atlas->per_row && col + num > atlas->per_row)
+		return atlas->fill + atlas->per_row - col;
+
+	return atlas->fill;
+}
+
+/* Make sure the per-frame vertex cache of @atlas holds at least @nsize cells.
+ * Atlases are shared between displays of different sizes, so the cache has to
+ * grow to the largest attached screen. */
+static int atlas_reserve_cache(struct gltex_ctx *ctx, struct atlas *atlas,
+			       unsigned int nsize)
+{
+	GLfloat *f;
+
+	if (atlas->cache_size >= nsize)
+		return 0;
+
+	if (ctx->supports_instancing) {
+		f = realloc(atlas->cache_inst,
+			    sizeof(GLfloat) * nsize * INST_STRIDE);
+		if (!f)
+			return -ENOMEM;
+		atlas->cache_inst = f;
+	} else {
+		f = realloc(atlas->cache_pos, sizeof(GLfloat) * nsize * 2 * 6);
+		if (!f)
+			return -ENOMEM;
+		atlas->cache_pos = f;
+
+		f = realloc(atlas->cache_texpos,
+			    sizeof(GLfloat) * nsize * 2 * 6);
+		if (!f)
+			return -ENOMEM;
+		atlas->cache_texpos = f;
+
+		f = realloc(atlas->cache_fgcol, sizeof(GLfloat) * nsize * 3 * 6);
+		if (!f)
+			return -ENOMEM;
+		atlas->cache_fgcol = f;
+
+		f = realloc(atlas->cache_bgcol, sizeof(GLfloat) * nsize * 3 * 6);
+		if (!f)
+			return -ENOMEM;
+		atlas->cache_bgcol = f;
+	}
+
+	atlas->cache_size = nsize;
+	return 0;
 }
 
 /* returns an atlas with at least 1 free glyph position; NULL on error */
 static struct atlas *get_atlas(struct kmscon_text *txt, unsigned int num)
 {
 	struct gltex *gt = txt->data;
+	struct gltex_ctx *ctx = gt->ctx;
 	struct atlas *atlas;
-	size_t newsize;
+	size_t newsize, nrows;
 	unsigned int width, height, nsize;
 	GLenum err;
 
 	/* check whether the last added atlas has still room for one glyph */
-	if (!shl_dlist_empty(&gt->atlases)) {
-		atlas = shl_dlist_entry(gt->atlases.next, struct atlas,
+	if (!shl_dlist_empty(&ctx->atlases)) {
+		atlas = shl_dlist_entry(ctx->atlases.next, struct atlas,
 					   list);
-		if (atlas->fill + num <= atlas->count)
+		if (atlas_fill_pos(atlas, num) + num <= atlas->count)
 			return atlas;
 	}
 
@@ -309,16 +616,27 @@ static struct atlas *get_atlas(struct kmscon_text *txt, unsigned int num)
 		goto err_free;
 	}
 
-	newsize = gt->max_tex_size / FONT_WIDTH(txt);
+	newsize = ctx->max_tex_size / FONT_WIDTH(txt);
 	if (newsize < 1)
 		newsize = 1;
 
+	/* A single glyph-row holds only a few hundred glyphs, which forces
+	 * CJK-heavy screens onto many atlases and thus many draw-calls per
+	 * frame. Pack multiple rows into each atlas instead; stop adding rows
+	 * once the atlas holds a reasonable glyph working-set so we don't
+	 * waste texture memory for small fonts. */
+	nrows = ctx->max_tex_size / FONT_HEIGHT(txt);
+	if (nrows < 1)
+		nrows = 1;
+	while (nrows > 1 && newsize * (nrows / 2) >= 4096)
+		nrows /= 2;
+
 	/* OpenGL texture sizes are heavily restricted so we need to find a
 	 * valid texture size that is big enough to hold as many glyphs as
 	 * possible but at least 1 */
 try_next:
 	width = shl_next_pow2(FONT_WIDTH(txt) * newsize);
-	height = shl_next_pow2(FONT_HEIGHT(txt));
+	height = shl_next_pow2(FONT_HEIGHT(txt) * nrows);
 
 	gl_clear_error();
 
@@ -328,6 +646,10 @@ try_next:
 
 	err = glGetError();
 	if (err != GL_NO_ERROR) {
+		if (nrows > 1) {
+			nrows /= 2;
+			goto try_next;
+		}
 		if (newsize > 1) {
 			--newsize;
 			goto try_next;
@@ -338,34 +660,24 @@ try_next:
 		goto err_tex;
 	}
 
-	log_debug("new atlas of size %ux%u for %zu", width, height, newsize);
+	log_debug("new atlas of size %ux%u for %zu glyphs",
+		  width, height, newsize * nrows);
 
 	nsize = txt->cols * txt->rows;
 
-	atlas->cache_pos = malloc(sizeof(GLfloat) * nsize * 2 * 6);
-	if (!atlas->cache_pos)
-		goto err_mem;
-
-	atlas->cache_texpos = malloc(sizeof(GLfloat) * nsize * 2 * 6);
-	if (!atlas->cache_texpos)
+	if (atlas_reserve_cache(ctx, atlas, nsize))
 		goto err_mem;
 
-	atlas->cache_fgcol = malloc(sizeof(GLfloat) * nsize * 3 * 6);
-	if (!atlas->cache_fgcol)
-		goto err_mem;
-
-	atlas->cache_bgcol = malloc(sizeof(GLfloat) * nsize * 3 * 6);
-	if (!atlas->cache_bgcol)
-		goto err_mem;
-
-	atlas->cache_size = nsize;
-	atlas->count = newsize;
+	atlas->per_row = newsize;
+	atlas->count = newsize * nrows;
 	atlas->width = width;
 	atlas->height = height;
 	atlas->advance_htex = 1.0 / atlas->width * FONT_WIDTH(txt);
 	atlas->advance_vtex = 1.0 / atlas->height * FONT_HEIGHT(txt);
 
-	shl_dlist_link(&gt->atlases, &atlas->list);
+	ctx->mem.bytes += sizeof(*atlas) + (uint64_t)width * height;
+
+	shl_dlist_link(&ctx->atlases, &atlas->list);
 	return atlas;
 
 err_mem:
@@ -373,6 +685,7 @@ err_mem:
 	free(atlas->cache_texpos);
 	free(atlas->cache_fgcol);
 	free(atlas->cache_bgcol);
+	free(atlas->cache_inst);
 err_tex:
 	gl_tex_free(&atlas->tex, 1);
 err_free:
@@ -380,71 +693,48 @@ err_free:
 	return NULL;
 }
 
-static int find_glyph(struct kmscon_text *txt, struct glyph **out,
-		      uint32_t id, const uint32_t *ch, size_t len, bool bold)
+/* queue @glyph for upload into its atlas texture at the next render */
+static int atlas_queue_upload(struct atlas *atlas, struct glyph *glyph)
 {
-	struct gltex *gt = txt->data;
-	struct atlas *atlas;
-	struct glyph *glyph;
-	bool res;
-	int ret, i;
-	GLenum err;
-	uint8_t *packed_data, *dst, *src;
-	struct shl_hashtable *gtable;
-	struct kmscon_font *font;
+	struct glyph **q;
+	unsigned int size;
 
-	if (bold) {
-		gtable = gt->bold_glyphs;
-		font = txt->bold_font;
-	} else {
-		gtable = gt->glyphs;
-		font = txt->font;
-	}
-
-	res = shl_hashtable_find(gtable, (void**)&glyph,
-				 (void*)(unsigned long)id);
-	if (res) {
-		*out = glyph;
-		return 0;
-	}
-
-	glyph = malloc(sizeof(*glyph));
-	if (!glyph)
-		return -ENOMEM;
-	memset(glyph, 0, sizeof(*glyph));
-
-	if (!len)
-		ret = kmscon_font_render_empty(font, &glyph->glyph);
-	else
-		ret = kmscon_font_render(font, id, ch, len, &glyph->glyph);
+	if (atlas->pending_num >= atlas->pending_size) {
+		size = atlas->pending_size * 2;
+		if (!size)
+			size = 16;
 
-	if (ret) {
-		ret = kmscon_font_render_inval(font, &glyph->glyph);
-		if (ret)
-			goto err_free;
-	}
+		q = realloc(atlas->pending, size * sizeof(*q));
+		if (!q)
+			return -ENOMEM;
 
-	atlas = get_atlas(txt, glyph->glyph->width);
-	if (!atlas) {
-		ret = -EFAULT;
-		goto err_free;
+		atlas->pending = q;
+		atlas->pending_size = size;
 	}
 
-	/* Funnily, not all OpenGLESv2 implementations support specifying the
-	 * stride of a texture. Therefore, we then need to create a
-	 * temporary image with a stride equal to the image width for loading
-	 * the texture. This may slow down loading new glyphs but doesn't affect
-	 * overall rendering performance. But driver developers should really
-	 * add this! */
+	atlas->pending[atlas->pending_num++] = glyph;
+	return 0;
+}
 
-	gl_clear_error();
+/* Upload the bitmap of @glyph into its atlas texture. The caller must have
+ * bound the atlas texture and set GL_UNPACK_ALIGNMENT to 1.
+ * Funnily, not all OpenGLESv2 implementations support specifying the stride
+ * of a texture. Therefore, we then need to create a temporary image with a
+ * stride equal to the image width for loading the texture. This may slow down
+ * loading new glyphs but doesn't affect overall rendering performance. But
+ * driver developers should really add this! */
+static int atlas_upload_glyph(struct kmscon_text *txt,
+			      const struct glyph *glyph)
+{
+	struct gltex *gt = txt->data;
+	uint8_t *packed_data, *dst, *src;
+	int i;
 
-	glBindTexture(GL_TEXTURE_2D, atlas->tex);
-	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-	if (!gt->supports_rowlen) {
+	if (!gt->ctx->supports_rowlen) {
 		if (GLYPH_STRIDE(glyph) == GLYPH_WIDTH(glyph)) {
 			glTexSubImage2D(GL_TEXTURE_2D, 0,
-					FONT_WIDTH(txt) * atlas->fill, 0,
+					FONT_WIDTH(txt) * glyph->texoff_x,
+					FONT_HEIGHT(txt) * glyph->texoff_y,
 					GLYPH_WIDTH(glyph),
 					GLYPH_HEIGHT(glyph),
 					GL_ALPHA, GL_UNSIGNED_BYTE,
@@ -453,8 +743,7 @@ static int find_glyph(struct kmscon_text *txt, struct glyph **out,
 			packed_data = malloc(GLYPH_WIDTH(glyph) * GLYPH_HEIGHT(glyph));
 			if (!packed_data) {
 				log_error("cannot allocate memory for glyph storage");
-				ret = -ENOMEM;
-				goto err_free;
+				return -ENOMEM;
 			}
 
 			src = GLYPH_DATA(glyph);
@@ -466,7 +755,8 @@ static int find_glyph(struct kmscon_text *txt, struct glyph **out,
 			}
 
 			glTexSubImage2D(GL_TEXTURE_2D, 0,
-					FONT_WIDTH(txt) * atlas->fill, 0,
+					FONT_WIDTH(txt) * glyph->texoff_x,
+					FONT_HEIGHT(txt) * glyph->texoff_y,
 					GLYPH_WIDTH(glyph),
 					GLYPH_HEIGHT(glyph),
 					GL_ALPHA, GL_UNSIGNED_BYTE,
@@ -476,40 +766,159 @@ static int find_glyph(struct kmscon_text *txt, struct glyph **out,
 	} else {
 		glPixelStorei(GL_UNPACK_ROW_LENGTH, GLYPH_STRIDE(glyph));
 		glTexSubImage2D(GL_TEXTURE_2D, 0,
-				FONT_WIDTH(txt) * atlas->fill, 0,
+				FONT_WIDTH(txt) * glyph->texoff_x,
+				FONT_HEIGHT(txt) * glyph->texoff_y,
 				GLYPH_WIDTH(glyph),
 				GLYPH_HEIGHT(glyph),
 				GL_ALPHA, GL_UNSIGNED_BYTE,
 				GLYPH_DATA(glyph));
 		glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
 	}
-	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
 
-	/* Check for GL-errors
-	 * As OpenGL is a state-machine, we cannot really tell which call failed
-	 * without adding a glGetError() after each call. This is totally
-	 * overkill so let us at least catch the error afterwards.
-	 * We also add a hint to disable OpenGL if this does not work. This
-	 * should _always_ work but OpenGL is kind of a black-box that isn't
-	 * verbose at all and many things can go wrong. */
+	return 0;
+}
+
+/* Upload all glyphs queued by find_glyph() since the last render. Batching
+ * the uploads means each atlas is bound exactly once per frame and the
+ * unpack state is set up once, no matter how many new glyphs appeared. */
+static int gltex_flush_pending(struct kmscon_text *txt)
+{
+	struct gltex *gt = txt->data;
+	struct atlas *atlas;
+	struct shl_dlist *iter;
+	unsigned int i;
+	GLenum err;
+	int ret = 0, r;
+
+	shl_dlist_for_each(iter, &gt->ctx->atlases) {
+		atlas = shl_dlist_entry(iter, struct atlas, list);
+		if (!atlas->pending_num)
+			continue;
 
-	err = glGetError();
-	if (err != GL_NO_ERROR) {
 		gl_clear_error();
-		log_warning("cannot load glyph data into OpenGL texture (%d: %s); disable the GL-renderer if this does not work reliably",
-			    err, gl_err_to_str(err));
+
+		glBindTexture(GL_TEXTURE_2D, atlas->tex);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+		for (i = 0; i < atlas->pending_num; ++i) {
+			r = atlas_upload_glyph(txt, atlas->pending[i]);
+			if (r && !ret)
+				ret = r;
+		}
+
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+		atlas->pending_num = 0;
+
+		/* Check for GL-errors
+		 * As OpenGL is a state-machine, we cannot really tell which
+		 * call failed without adding a glGetError() after each call.
+		 * This is totally overkill so let us at least catch the error
+		 * afterwards.
+		 * We also add a hint to disable OpenGL if this does not work.
+		 * This should _always_ work but OpenGL is kind of a black-box
+		 * that isn't verbose at all and many things can go wrong. */
+
+		err = glGetError();
+		if (err != GL_NO_ERROR) {
+			gl_clear_error();
+			log_warning("cannot load glyph data into OpenGL texture (%d: %s); disable the GL-renderer if this does not work reliably",
+				    err, gl_err_to_str(err));
+			if (!ret)
+				ret = -EFAULT;
+		}
+	}
+
+	return ret;
+}
+
+static int find_glyph(struct kmscon_text *txt, struct glyph **out,
+		      uint32_t id, const uint32_t *ch, size_t len, bool bold)
+{
+	struct gltex *gt = txt->data;
+	struct atlas *atlas;
+	struct glyph *glyph, *pglyph;
+	bool res;
+	int ret;
+	struct shl_hashmap *gtable;
+	struct kmscon_font *font;
+	unsigned int pos;
+
+	if (bold) {
+		gtable = gt->ctx->bold_glyphs;
+		font = txt->bold_font;
+	} else {
+		gtable = gt->ctx->glyphs;
+		font = txt->font;
+	}
+
+	res = shl_hashmap_find(gtable, (void**)&glyph,
+				 (void*)(unsigned long)id);
+	if (res) {
+		*out = glyph;
+		return 0;
+	}
+
+	glyph = malloc(sizeof(*glyph));
+	if (!glyph)
+		return -ENOMEM;
+	memset(glyph, 0, sizeof(*glyph));
+
+	if (!len)
+		ret = kmscon_font_render_empty(font, &glyph->glyph);
+	else
+		ret = kmscon_font_render(font, id, ch, len, &glyph->glyph);
+
+	if (ret == -EAGAIN) {
+		/* The glyph is rasterized in the background and the cell is
+		 * redrawn once it is done. Draw the replacement glyph for now
+		 * but cache it under the ID of the replacement character so
+		 * the real glyph is not shadowed once it lands. */
+		id = '?';
+		res = shl_hashmap_find(gtable, (void**)&pglyph,
+					 (void*)(unsigned long)id);
+		if (res) {
+			free(glyph);
+			*out = pglyph;
+			return 0;
+		}
+		ret = kmscon_font_render_inval(font, &glyph->glyph);
+		if (ret)
+			goto err_free;
+	} else if (ret) {
+		ret = kmscon_font_render_inval(font, &glyph->glyph);
+		if (ret)
+			goto err_free;
+	}
+
+	atlas = get_atlas(txt, glyph->glyph->width);
+	if (!atlas) {
 		ret = -EFAULT;
 		goto err_free;
 	}
 
-	glyph->atlas = atlas;
-	glyph->texoff = atlas->fill;
+	pos = atlas_fill_pos(atlas, glyph->glyph->width);
 
-	ret = shl_hashtable_insert(gtable, (void*)(long)id, glyph);
+	glyph->atlas = atlas;
+	glyph->texoff_x = pos % atlas->per_row;
+	glyph->texoff_y = pos / atlas->per_row;
+
+	/* The texture upload is deferred: the glyph is only queued here and
+	 * the renderer uploads all queued glyphs in one batch right before
+	 * the draw. A burst of cache misses (e.g. the first screen of a new
+	 * locale) thus costs a single texture bind per atlas instead of a
+	 * pipeline stall per glyph. */
+	ret = atlas_queue_upload(atlas, glyph);
 	if (ret)
 		goto err_free;
 
-	atlas->fill += glyph->glyph->width;
+	ret = shl_hashmap_insert(gtable, (void*)(long)id, glyph);
+	if (ret) {
+		--atlas->pending_num;
+		goto err_free;
+	}
+
+	atlas->fill = pos + glyph->glyph->width;
+	gt->ctx->mem.bytes += sizeof(*glyph);
 
 	*out = glyph;
 	return 0;
@@ -530,12 +939,30 @@ static int gltex_prepare(struct kmscon_text *txt)
 	if (ret)
 		return ret;
 
-	shl_dlist_for_each(iter, &gt->atlases) {
+	/* release atlases dropped by a shrink now that the GL context is
+	 * current again */
+	while (!shl_dlist_empty(&gt->ctx->dead_atlases)) {
+		iter = gt->ctx->dead_atlases.next;
+		shl_dlist_unlink(iter);
+		free_atlas(shl_dlist_entry(iter, struct atlas, list), true);
+	}
+
+	shl_dlist_for_each(iter, &gt->ctx->atlases) {
 		atlas = shl_dlist_entry(iter, struct atlas, list);
 
+		ret = atlas_reserve_cache(gt->ctx, atlas,
+					  txt->cols * txt->rows);
+		if (ret)
+			return ret;
+
 		atlas->cache_num = 0;
 	}
 
+	gt->dmg_x1 = txt->cols;
+	gt->dmg_y1 = txt->rows;
+	gt->dmg_x2 = 0;
+	gt->dmg_y2 = 0;
+
 	gt->advance_x = 2.0 / gt->sw * FONT_WIDTH(txt);
 	gt->advance_y = 2.0 / gt->sh * FONT_HEIGHT(txt);
 
@@ -561,9 +988,47 @@ static int gltex_draw(struct kmscon_text *txt,
 		return ret;
 	atlas = glyph->atlas;
 
+	if (posx < gt->dmg_x1)
+		gt->dmg_x1 = posx;
+	if (posy < gt->dmg_y1)
+		gt->dmg_y1 = posy;
+	if (posx + width > gt->dmg_x2)
+		gt->dmg_x2 = posx + width;
+	if (posy + 1 > gt->dmg_y2)
+		gt->dmg_y2 = posy + 1;
+
 	if (atlas->cache_num >= atlas->cache_size)
 		return -ERANGE;
 
+	if (gt->ctx->supports_instancing) {
+		GLfloat *inst = &atlas->cache_inst[atlas->cache_num *
+						   INST_STRIDE];
+
+		inst[0] = posx;
+		inst[1] = posy;
+		inst[2] = glyph->texoff_x;
+		inst[3] = glyph->texoff_y;
+		if (attr->inverse) {
+			inst[4] = attr->br / 255.0;
+			inst[5] = attr->bg / 255.0;
+			inst[6] = attr->bb / 255.0;
+			inst[8] = attr->fr / 255.0;
+			inst[9] = attr->fg / 255.0;
+			inst[10] = attr->fb / 255.0;
+		} else {
+			inst[4] = attr->fr / 255.0;
+			inst[5] = attr->fg / 255.0;
+			inst[6] = attr->fb / 255.0;
+			inst[8] = attr->br / 255.0;
+			inst[9] = attr->bg / 255.0;
+			inst[10] = attr->bb / 255.0;
+		}
+		inst[7] = width;
+
+		++atlas->cache_num;
+		return 0;
+	}
+
 	atlas->cache_pos[atlas->cache_num * 2 * 6 + 0] =
 		gt->advance_x * posx - 1;
 	atlas->cache_pos[atlas->cache_num * 2 * 6 + 1] =
@@ -590,19 +1055,19 @@ static int gltex_draw(struct kmscon_text *txt,
 	atlas->cache_pos[atlas->cache_num * 2 * 6 + 11] =
 		1 - gt->advance_y * posy;
 
-	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 0] = glyph->texoff;
-	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 1] = 0.0;
-	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 2] = glyph->texoff;
-	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 3] = 1.0;
-	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 4] = glyph->texoff + width;
-	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 5] = 1.0;
+	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 0] = glyph->texoff_x;
+	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 1] = glyph->texoff_y;
+	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 2] = glyph->texoff_x;
+	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 3] = glyph->texoff_y + 1;
+	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 4] = glyph->texoff_x + width;
+	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 5] = glyph->texoff_y + 1;
 
-	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 6] = glyph->texoff;
-	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 7] = 0.0;
-	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 8] = glyph->texoff + width;
-	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 9] = 1.0;
-	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 10] = glyph->texoff + width;
-	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 11] = 0.0;
+	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 6] = glyph->texoff_x;
+	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 7] = glyph->texoff_y;
+	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 8] = glyph->texoff_x + width;
+	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 9] = glyph->texoff_y + 1;
+	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 10] = glyph->texoff_x + width;
+	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 11] = glyph->texoff_y;
 
 	for (i = 0; i < 6; ++i) {
 		idx = atlas->cache_num * 3 * 6 + i * 3;
@@ -628,22 +1093,125 @@ static int gltex_draw(struct kmscon_text *txt,
 	return 0;
 }
 
-static int gltex_render(struct kmscon_text *txt)
+#ifdef GL_EXT_instanced_arrays
+static int gltex_render_instanced(struct kmscon_text *txt)
 {
 	struct gltex *gt = txt->data;
+	struct gltex_ctx *ctx = gt->ctx;
 	struct atlas *atlas;
 	struct shl_dlist *iter;
-	float mat[16];
+	static const GLfloat corners[] = { 0.0, 0.0,
+					   0.0, 1.0,
+					   1.0, 0.0,
+					   1.0, 1.0 };
 
 	gl_clear_error();
 
-	gl_shader_use(gt->shader);
+	gl_shader_use(ctx->cell_shader);
 
 	glViewport(0, 0, gt->sw, gt->sh);
 	glDisable(GL_BLEND);
 
-	gl_m4_identity(mat);
-	glUniformMatrix4fv(gt->uni_proj, 1, GL_FALSE, mat);
+	if (gt->advance_x != ctx->cell_advance_x ||
+	    gt->advance_y != ctx->cell_advance_y) {
+		glUniform2f(ctx->cuni_advance, gt->advance_x, gt->advance_y);
+		ctx->cell_advance_x = gt->advance_x;
+		ctx->cell_advance_y = gt->advance_y;
+	}
+
+	glEnableVertexAttribArray(0);
+	glEnableVertexAttribArray(1);
+	glEnableVertexAttribArray(2);
+	glEnableVertexAttribArray(3);
+
+	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, corners);
+	glVertexAttribDivisorEXT(1, 1);
+	glVertexAttribDivisorEXT(2, 1);
+	glVertexAttribDivisorEXT(3, 1);
+
+	glActiveTexture(GL_TEXTURE0);
+
+	shl_dlist_for_each(iter, &ctx->atlases) {
+		atlas = shl_dlist_entry(iter, struct atlas, list);
+		if (!atlas->cache_num)
+			continue;
+
+		glBindTexture(GL_TEXTURE_2D, atlas->tex);
+		if (atlas->advance_htex != ctx->clast_htex) {
+			glUniform1f(ctx->cuni_advance_htex,
+				    atlas->advance_htex);
+			ctx->clast_htex = atlas->advance_htex;
+		}
+		if (atlas->advance_vtex != ctx->clast_vtex) {
+			glUniform1f(ctx->cuni_advance_vtex,
+				    atlas->advance_vtex);
+			ctx->clast_vtex = atlas->advance_vtex;
+		}
+
+		glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE,
+				      INST_STRIDE * sizeof(GLfloat),
+				      &atlas->cache_inst[0]);
+		glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE,
+				      INST_STRIDE * sizeof(GLfloat),
+				      &atlas->cache_inst[4]);
+		glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE,
+				      INST_STRIDE * sizeof(GLfloat),
+				      &atlas->cache_inst[8]);
+		glDrawArraysInstancedEXT(GL_TRIANGLE_STRIP, 0, 4,
+					 atlas->cache_num);
+	}
+
+	glVertexAttribDivisorEXT(1, 0);
+	glVertexAttribDivisorEXT(2, 0);
+	glVertexAttribDivisorEXT(3, 0);
+
+	glDisableVertexAttribArray(0);
+	glDisableVertexAttribArray(1);
+	glDisableVertexAttribArray(2);
+	glDisableVertexAttribArray(3);
+
+	if (gl_has_error(ctx->cell_shader)) {
+		log_warning("rendering console caused OpenGL errors");
+		return -EFAULT;
+	}
+
+	return 0;
+}
+#endif
+
+static int gltex_render(struct kmscon_text *txt)
+{
+	struct gltex *gt = txt->data;
+	struct gltex_ctx *ctx = gt->ctx;
+	struct atlas *atlas;
+	struct shl_dlist *iter;
+	int ret;
+
+	ret = gltex_flush_pending(txt);
+	if (ret)
+		return ret;
+
+	/* Tell the display which pixels this frame actually touches so the
+	 * swap can pass a damage region to the driver; a frame without any
+	 * drawn cells gives no hint and thus full damage. */
+	if (gt->dmg_x1 < gt->dmg_x2 && gt->dmg_y1 < gt->dmg_y2)
+		uterm_display_set_damage(txt->disp,
+					 gt->dmg_x1 * FONT_WIDTH(txt),
+					 gt->dmg_y1 * FONT_HEIGHT(txt),
+					 gt->dmg_x2 * FONT_WIDTH(txt),
+					 gt->dmg_y2 * FONT_HEIGHT(txt));
+
+#ifdef GL_EXT_instanced_arrays
+	if (gt->ctx->supports_instancing)
+		return gltex_render_instanced(txt);
+#endif
+
+	gl_clear_error();
+
+	gl_shader_use(ctx->shader);
+
+	glViewport(0, 0, gt->sw, gt->sh);
+	glDisable(GL_BLEND);
 
 	glEnableVertexAttribArray(0);
 	glEnableVertexAttribArray(1);
@@ -651,16 +1219,23 @@ static int gltex_render(struct kmscon_text *txt)
 	glEnableVertexAttribArray(3);
 
 	glActiveTexture(GL_TEXTURE0);
-	glUniform1i(gt->uni_atlas, 0);
 
-	shl_dlist_for_each(iter, &gt->atlases) {
+	shl_dlist_for_each(iter, &ctx->atlases) {
 		atlas = shl_dlist_entry(iter, struct atlas, list);
 		if (!atlas->cache_num)
 			continue;
 
 		glBindTexture(GL_TEXTURE_2D, atlas->tex);
-		glUniform1f(gt->uni_advance_htex, atlas->advance_htex);
-		glUniform1f(gt->uni_advance_vtex, atlas->advance_vtex);
+		if (atlas->advance_htex != ctx->last_htex) {
+			glUniform1f(ctx->uni_advance_htex,
+				    atlas->advance_htex);
+			ctx->last_htex = atlas->advance_htex;
+		}
+		if (atlas->advance_vtex != ctx->last_vtex) {
+			glUniform1f(ctx->uni_advance_vtex,
+				    atlas->advance_vtex);
+			ctx->last_vtex = atlas->advance_vtex;
+		}
 
 		glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, atlas->cache_pos);
 		glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 0, atlas->cache_texpos);
@@ -674,7 +1249,7 @@ static int gltex_render(struct kmscon_text *txt)
 	glDisableVertexAttribArray(2);
 	glDisableVertexAttribArray(3);
 
-	if (gl_has_error(gt->shader)) {
+	if (gl_has_error(ctx->shader)) {
 		log_warning("rendering console caused OpenGL errors");
 		return -EFAULT;
 	}
@@ -685,10 +1260,19 @@ static int gltex_render(struct kmscon_text *txt)
 struct kmscon_text_ops kmscon_text_gltex_ops = {
 	.name = "gltex",
 	.owner = NULL,
+	/* EGL buffer contents are only defined after a swap if the display
+	 * reports buffer ages; without that the display returns a cycle
+	 * depth of 0 and every frame is redrawn in full */
+	.bufs = KMSCON_TEXT_MAX_BUFS,
+	/* all displays on a GPU share one EGL context and eglMakeCurrent
+	 * binds it to the calling thread, so rendering must stay on the
+	 * eloop thread */
+	.thread_render = false,
 	.init = gltex_init,
 	.destroy = gltex_destroy,
 	.set = gltex_set,
 	.unset = gltex_unset,
+	.resize = gltex_resize,
 	.prepare = gltex_prepare,
 	.draw = gltex_draw,
 	.render = gltex_render,
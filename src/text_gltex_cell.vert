@@ -0,0 +1,58 @@
+/*
+ * kmscon - Instanced Cell Vertex Shader
+ *
+ * Copyright (c) 2011-2012 David Herrmann <dh.herrmann@googlemail.com>
+ * Copyright (c) 2011 University of Tuebingen
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Instanced Cell Vertex Shader
+ * One instance per character cell. @corner is the shared unit-quad corner,
+ * the other attributes advance per instance: @cell holds the cell grid
+ * position and the atlas glyph position, @fgcolor holds the foreground
+ * color and the cell width in its w component, @bgcolor the background
+ * color. @advance is the cell advance in clip-space units.
+ */
+
+uniform vec2 advance;
+
+attribute vec2 corner;
+attribute vec4 cell;
+attribute vec4 fgcolor;
+attribute vec3 bgcolor;
+
+varying vec2 texpos;
+varying vec3 fgcol;
+varying vec3 bgcol;
+
+void main()
+{
+	float w = fgcolor.w;
+	vec2 pos;
+
+	pos.x = (cell.x + corner.x * w) * advance.x - 1.0;
+	pos.y = 1.0 - (cell.y + corner.y) * advance.y;
+	gl_Position = vec4(pos, 0.0, 1.0);
+	texpos = vec2(cell.z + corner.x * w, cell.w + corner.y);
+	fgcol = fgcolor.rgb;
+	bgcol = bgcolor;
+}
@@ -32,6 +32,7 @@
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
+#include "mem.h"
 #include "shl_hashtable.h"
 #include "shl_log.h"
 #include "text.h"
@@ -50,9 +51,9 @@ struct tp_pixman {
 	struct shl_hashtable *glyphs;
 	struct shl_hashtable *bold_glyphs;
 
-	struct uterm_video_buffer buf[2];
-	pixman_image_t *surf[2];
-	unsigned int format[2];
+	struct uterm_video_buffer buf[UTERM_VIDEO_MAX_BUFS];
+	pixman_image_t *surf[UTERM_VIDEO_MAX_BUFS];
+	unsigned int format[UTERM_VIDEO_MAX_BUFS];
 
 	bool new_stride;
 	bool use_indirect;
@@ -64,6 +65,23 @@ struct tp_pixman {
 	unsigned int c_bpp;
 	uint32_t *c_data;
 	unsigned int c_stride;
+
+	/* batched glyph runs; see tp_draw() */
+	pixman_glyph_cache_t *glyph_cache;
+	pixman_glyph_t *run;
+	unsigned int run_num;
+	unsigned int run_size;
+	pixman_color_t run_color;
+	bool frozen;
+
+	/* cell bounding-box of everything drawn this frame; reported as
+	 * damage hint so indirect blits and the swap skip untouched pixels */
+	unsigned int dmg_x1;
+	unsigned int dmg_y1;
+	unsigned int dmg_x2;
+	unsigned int dmg_y2;
+
+	struct mem_cache mem;
 };
 
 static int tp_init(struct kmscon_text *txt)
@@ -94,6 +112,41 @@ static void free_glyph(void *data)
 	free(glyph);
 }
 
+/* Drop the cached glyph surfaces under memory pressure. The surfaces may
+ * reference buffers of the font glyph cache, so this registers one level
+ * above it and is shrunk first. */
+static void tp_shrink(struct mem_cache *mem)
+{
+	struct tp_pixman *tp = shl_dlist_entry(mem, struct tp_pixman, mem);
+	struct shl_hashtable *glyphs, *bold_glyphs;
+	int ret;
+
+	ret = shl_hashtable_new(&glyphs, shl_direct_hash,
+				shl_direct_equal, NULL, free_glyph);
+	if (ret)
+		return;
+
+	ret = shl_hashtable_new(&bold_glyphs, shl_direct_hash,
+				shl_direct_equal, NULL, free_glyph);
+	if (ret) {
+		shl_hashtable_free(glyphs);
+		return;
+	}
+
+	shl_hashtable_free(tp->glyphs);
+	shl_hashtable_free(tp->bold_glyphs);
+	tp->glyphs = glyphs;
+	tp->bold_glyphs = bold_glyphs;
+	tp->mem.bytes = 0;
+
+	/* the pixman glyph cache is keyed by the tp_glyph objects freed
+	 * above, so it has to go in the same round to avoid key aliasing */
+	if (tp->glyph_cache) {
+		pixman_glyph_cache_destroy(tp->glyph_cache);
+		tp->glyph_cache = pixman_glyph_cache_create();
+	}
+}
+
 static unsigned int format_u2p(unsigned int f)
 {
 	switch (f) {
@@ -164,7 +217,7 @@ static int tp_set(struct kmscon_text *txt)
 {
 	struct tp_pixman *tp = txt->data;
 	int ret;
-	unsigned int w, h;
+	unsigned int w, h, num, i;
 	struct uterm_mode *m;
 	pixman_color_t white;
 
@@ -211,32 +264,56 @@ static int tp_set(struct kmscon_text *txt)
 		if (ret)
 			goto err_htable_bold;
 	} else {
-		tp->format[0] = format_u2p(tp->buf[0].format);
-		tp->surf[0] = pixman_image_create_bits_no_clear(tp->format[0],
-					tp->buf[0].width, tp->buf[0].height,
-					(void*)tp->buf[0].data,
-					tp->buf[0].stride);
-		tp->format[1] = format_u2p(tp->buf[1].format);
-		tp->surf[1] = pixman_image_create_bits_no_clear(tp->format[1],
-					tp->buf[1].width, tp->buf[1].height,
-					(void*)tp->buf[1].data,
-					tp->buf[1].stride);
-		if (!tp->surf[0] || !tp->surf[1]) {
-			log_error("cannot create pixman surfaces");
-			goto err_ctx;
+		num = uterm_display_get_bufs(txt->disp);
+		if (!num || num > UTERM_VIDEO_MAX_BUFS)
+			num = 2;
+
+		for (i = 0; i < num; ++i) {
+			tp->format[i] = format_u2p(tp->buf[i].format);
+			tp->surf[i] = pixman_image_create_bits_no_clear(
+						tp->format[i],
+						tp->buf[i].width,
+						tp->buf[i].height,
+						(void*)tp->buf[i].data,
+						tp->buf[i].stride);
+			if (!tp->surf[i]) {
+				log_error("cannot create pixman surfaces");
+				goto err_ctx;
+			}
 		}
 	}
 
 	txt->cols = w / txt->font->attr.width;
 	txt->rows = h / txt->font->attr.height;
 
+	tp->glyph_cache = pixman_glyph_cache_create();
+	if (!tp->glyph_cache) {
+		log_error("cannot create pixman glyph cache");
+		ret = -ENOMEM;
+		goto err_ctx;
+	}
+
+	/* one row per composite call at most */
+	tp->run_size = txt->cols;
+	tp->run = malloc(sizeof(*tp->run) * tp->run_size);
+	if (!tp->run) {
+		pixman_glyph_cache_destroy(tp->glyph_cache);
+		tp->glyph_cache = NULL;
+		ret = -ENOMEM;
+		goto err_ctx;
+	}
+
+	tp->mem.name = "pixman-glyphs";
+	tp->mem.level = 1;
+	tp->mem.shrink = tp_shrink;
+	mem_cache_register(&tp->mem);
+
 	return 0;
 
 err_ctx:
-	if (tp->surf[1])
-		pixman_image_unref(tp->surf[1]);
-	if (tp->surf[0])
-		pixman_image_unref(tp->surf[0]);
+	for (i = 0; i < UTERM_VIDEO_MAX_BUFS; ++i)
+		if (tp->surf[i])
+			pixman_image_unref(tp->surf[i]);
 	free(tp->data[1]);
 	free(tp->data[0]);
 err_htable_bold:
@@ -251,9 +328,15 @@ err_white:
 static void tp_unset(struct kmscon_text *txt)
 {
 	struct tp_pixman *tp = txt->data;
-
-	pixman_image_unref(tp->surf[1]);
-	pixman_image_unref(tp->surf[0]);
+	unsigned int i;
+
+	mem_cache_unregister(&tp->mem);
+	free(tp->run);
+	if (tp->glyph_cache)
+		pixman_glyph_cache_destroy(tp->glyph_cache);
+	for (i = 0; i < UTERM_VIDEO_MAX_BUFS; ++i)
+		if (tp->surf[i])
+			pixman_image_unref(tp->surf[i]);
 	free(tp->data[1]);
 	free(tp->data[0]);
 	shl_hashtable_free(tp->bold_glyphs);
@@ -265,7 +348,7 @@ static int find_glyph(struct kmscon_text *txt, struct tp_glyph **out,
 		      uint32_t id, const uint32_t *ch, size_t len, bool bold)
 {
 	struct tp_pixman *tp = txt->data;
-	struct tp_glyph *glyph;
+	struct tp_glyph *glyph, *pglyph;
 	struct shl_hashtable *gtable;
 	struct kmscon_font *font;
 	const struct uterm_video_buffer *buf;
@@ -299,7 +382,23 @@ static int find_glyph(struct kmscon_text *txt, struct tp_glyph **out,
 	else
 		ret = kmscon_font_render(font, id, ch, len, &glyph->glyph);
 
-	if (ret) {
+	if (ret == -EAGAIN) {
+		/* The glyph is rasterized in the background and the cell is
+		 * redrawn once it is done. Draw the replacement glyph for now
+		 * but cache it under the ID of the replacement character so
+		 * the real glyph is not shadowed once it lands. */
+		id = '?';
+		res = shl_hashtable_find(gtable, (void**)&pglyph,
+					 (void*)(unsigned long)id);
+		if (res) {
+			free(glyph);
+			*out = pglyph;
+			return 0;
+		}
+		ret = kmscon_font_render_inval(font, &glyph->glyph);
+		if (ret)
+			goto err_free;
+	} else if (ret) {
 		ret = kmscon_font_render_inval(font, &glyph->glyph);
 		if (ret)
 			goto err_free;
@@ -355,6 +454,10 @@ static int find_glyph(struct kmscon_text *txt, struct tp_glyph **out,
 	if (ret)
 		goto err_pixman;
 
+	tp->mem.bytes += sizeof(*glyph);
+	if (glyph->data)
+		tp->mem.bytes += stride * buf->height;
+
 	*out = glyph;
 	return 0;
 
@@ -383,9 +486,70 @@ static int tp_prepare(struct kmscon_text *txt)
 	tp->c_data = pixman_image_get_data(img);
 	tp->c_stride = pixman_image_get_stride(img);
 
+	/* lookups and inserts may only happen on a frozen glyph cache;
+	 * eviction of old glyphs is deferred until the thaw in tp_render() */
+	if (tp->glyph_cache && !tp->frozen) {
+		pixman_glyph_cache_freeze(tp->glyph_cache);
+		tp->frozen = true;
+	}
+	tp->run_num = 0;
+
+	tp->dmg_x1 = txt->cols;
+	tp->dmg_y1 = txt->rows;
+	tp->dmg_x2 = 0;
+	tp->dmg_y2 = 0;
+
 	return 0;
 }
 
+/* grow this frame's damage bounding-box; coordinates are in cells */
+static void tp_damage(struct tp_pixman *tp, unsigned int x1, unsigned int y1,
+		      unsigned int x2, unsigned int y2)
+{
+	if (x1 < tp->dmg_x1)
+		tp->dmg_x1 = x1;
+	if (y1 < tp->dmg_y1)
+		tp->dmg_y1 = y1;
+	if (x2 > tp->dmg_x2)
+		tp->dmg_x2 = x2;
+	if (y2 > tp->dmg_y2)
+		tp->dmg_y2 = y2;
+}
+
+/* Composite the accumulated glyph run with a single call. All glyphs of a
+ * run share one foreground color, so runs break at color changes and at
+ * row boundaries. */
+static void tp_flush_run(struct kmscon_text *txt)
+{
+	struct tp_pixman *tp = txt->data;
+	pixman_image_t *col;
+
+	if (!tp->run_num)
+		return;
+
+	if (!tp->run_color.red && !tp->run_color.green && !tp->run_color.blue) {
+		col = tp->white;
+		pixman_image_ref(col);
+	} else {
+		col = pixman_image_create_solid_fill(&tp->run_color);
+		if (!col) {
+			log_error("cannot create pixman color image");
+			tp->run_num = 0;
+			return;
+		}
+	}
+
+	pixman_composite_glyphs_no_mask(PIXMAN_OP_OVER,
+					col,
+					tp->surf[tp->cur],
+					0, 0, 0, 0,
+					tp->glyph_cache,
+					tp->run_num, tp->run);
+
+	pixman_image_unref(col);
+	tp->run_num = 0;
+}
+
 static int tp_draw(struct kmscon_text *txt,
 		   uint32_t id, const uint32_t *ch, size_t len,
 		   unsigned int width,
@@ -394,6 +558,8 @@ static int tp_draw(struct kmscon_text *txt,
 {
 	struct tp_pixman *tp = txt->data;
 	struct tp_glyph *glyph;
+	struct kmscon_font *font;
+	const void *pg;
 	int ret;
 	uint32_t bc;
 	pixman_color_t fc;
@@ -406,6 +572,8 @@ static int tp_draw(struct kmscon_text *txt,
 	if (ret)
 		return ret;
 
+	tp_damage(tp, posx, posy, posx + width, posy + 1);
+
 	if (attr->inverse) {
 		bc = (attr->fr << 16) | (attr->fg << 8) | (attr->fb);
 		fc.red = attr->br << 8;
@@ -420,11 +588,45 @@ static int tp_draw(struct kmscon_text *txt,
 		fc.alpha = 0xffff;
 	}
 
-	/* TODO: We _really_ should fix pixman to allow something like
-	 * pixman_image_set_solid_fill(img, &fc) to avoid allocating a pixman
-	 * image for each glyph here.
-	 * libc malloc() is pretty fast, but this still costs us a lot of
-	 * rendering performance. */
+	pixman_fill(tp->c_data, tp->c_stride / 4, tp->c_bpp,
+		    posx * txt->font->attr.width,
+		    posy * txt->font->attr.height,
+		    width * txt->font->attr.width,
+		    txt->font->attr.height,
+		    bc);
+
+	if (!tp->glyph_cache)
+		goto fallback;
+
+	font = attr->bold ? txt->bold_font : txt->font;
+
+	/* The glyph cache copies the image on insert, so the entry stays
+	 * valid for the lifetime of the cache. It is keyed by the tp_glyph
+	 * object: stale IDs (e.g. the temporary replacement glyph while a
+	 * glyph rasterizes in the background) thus never shadow the final
+	 * image. */
+	pg = pixman_glyph_cache_lookup(tp->glyph_cache, font, glyph);
+	if (!pg) {
+		pg = pixman_glyph_cache_insert(tp->glyph_cache, font, glyph,
+					       0, 0, glyph->surf);
+		if (!pg)
+			goto fallback;
+	}
+
+	if (tp->run_num &&
+	    memcmp(&fc, &tp->run_color, sizeof(fc)))
+		tp_flush_run(txt);
+
+	tp->run_color = fc;
+	tp->run[tp->run_num].x = posx * txt->font->attr.width;
+	tp->run[tp->run_num].y = posy * txt->font->attr.height;
+	tp->run[tp->run_num].glyph = pg;
+	if (++tp->run_num == tp->run_size)
+		tp_flush_run(txt);
+
+	return 0;
+
+fallback:
 	if (!fc.red && !fc.green && !fc.blue) {
 		col = tp->white;
 		pixman_image_ref(col);
@@ -436,45 +638,160 @@ static int tp_draw(struct kmscon_text *txt,
 		}
 	}
 
-	if (!bc) {
-		pixman_image_composite(PIXMAN_OP_SRC,
-				       col,
-				       glyph->surf,
-				       tp->surf[tp->cur],
-				       0, 0, 0, 0,
-				       posx * txt->font->attr.width,
-				       posy * txt->font->attr.height,
-				       txt->font->attr.width,
-				       txt->font->attr.height);
-	} else {
-		pixman_fill(tp->c_data, tp->c_stride / 4, tp->c_bpp,
-			    posx * txt->font->attr.width,
-			    posy * txt->font->attr.height,
-			    txt->font->attr.width,
-			    txt->font->attr.height,
-			    bc);
-
-		pixman_image_composite(PIXMAN_OP_OVER,
-				       col,
-				       glyph->surf,
-				       tp->surf[tp->cur],
-				       0, 0, 0, 0,
-				       posx * txt->font->attr.width,
-				       posy * txt->font->attr.height,
-				       txt->font->attr.width,
-				       txt->font->attr.height);
-	}
+	pixman_image_composite(PIXMAN_OP_OVER,
+			       col,
+			       glyph->surf,
+			       tp->surf[tp->cur],
+			       0, 0, 0, 0,
+			       posx * txt->font->attr.width,
+			       posy * txt->font->attr.height,
+			       txt->font->attr.width,
+			       txt->font->attr.height);
 
 	pixman_image_unref(col);
 
 	return 0;
 }
 
+static int tp_fill(struct kmscon_text *txt,
+		   unsigned int posx, unsigned int posy, unsigned int num,
+		   const struct tsm_screen_attr *attr)
+{
+	struct tp_pixman *tp = txt->data;
+	uint32_t bc;
+
+	if (attr->inverse)
+		bc = (attr->fr << 16) | (attr->fg << 8) | (attr->fb);
+	else
+		bc = (attr->br << 16) | (attr->bg << 8) | (attr->bb);
+
+	tp_damage(tp, posx, posy, posx + num, posy + 1);
+
+	pixman_fill(tp->c_data, tp->c_stride / 4, tp->c_bpp,
+		    posx * txt->font->attr.width,
+		    posy * txt->font->attr.height,
+		    num * txt->font->attr.width,
+		    txt->font->attr.height,
+		    bc);
+
+	return 0;
+}
+
+static int tp_blit_shift(struct kmscon_text *txt, int rows)
+{
+	struct tp_pixman *tp = txt->data;
+	uint8_t *dst = (uint8_t*)tp->c_data;
+	unsigned int height, adiff;
+
+	/* only the XRGB32 formats are used for the target surfaces */
+	if (tp->c_bpp != 32)
+		return -EOPNOTSUPP;
+
+	/* the shift moves pixels under pending glyphs */
+	tp_flush_run(txt);
+
+	height = txt->rows * txt->font->attr.height;
+	adiff = (rows < 0) ? -rows : rows;
+	adiff *= txt->font->attr.height;
+	if (!adiff || adiff >= height)
+		return -EINVAL;
+
+	/* the shift rewrites nearly the whole cell area */
+	tp_damage(tp, 0, 0, txt->cols, txt->rows);
+
+	if (rows > 0)
+		memmove(dst, &dst[adiff * tp->c_stride],
+			(height - adiff) * tp->c_stride);
+	else
+		memmove(&dst[adiff * tp->c_stride], dst,
+			(height - adiff) * tp->c_stride);
+
+	return 0;
+}
+
+/* Rendered-line cache support; see text.c. The surfaces live in plain
+ * memory, so a strip is just a rectangular copy of one cell-row. */
+static size_t tp_strip_size(struct kmscon_text *txt)
+{
+	struct tp_pixman *tp = txt->data;
+
+	return (size_t)txt->font->attr.height * txt->cols *
+	       txt->font->attr.width * (PIXMAN_FORMAT_BPP(tp->format[0]) / 8);
+}
+
+static int tp_strip_get(struct kmscon_text *txt, unsigned int posy, void *buf)
+{
+	struct tp_pixman *tp = txt->data;
+	uint8_t *src = (uint8_t*)tp->c_data;
+	uint8_t *dst = buf;
+	unsigned int i, w, h;
+
+	if (tp->c_bpp != PIXMAN_FORMAT_BPP(tp->format[0]))
+		return -EOPNOTSUPP;
+
+	/* the strip must include glyphs still sitting in the pending run */
+	tp_flush_run(txt);
+
+	w = txt->cols * txt->font->attr.width * (tp->c_bpp / 8);
+	h = txt->font->attr.height;
+	src += (size_t)posy * h * tp->c_stride;
+
+	for (i = 0; i < h; ++i) {
+		memcpy(dst, src, w);
+		dst += w;
+		src += tp->c_stride;
+	}
+
+	return 0;
+}
+
+static int tp_strip_put(struct kmscon_text *txt, unsigned int posy,
+			const void *buf)
+{
+	struct tp_pixman *tp = txt->data;
+	uint8_t *dst = (uint8_t*)tp->c_data;
+	const uint8_t *src = buf;
+	unsigned int i, w, h;
+
+	if (tp->c_bpp != PIXMAN_FORMAT_BPP(tp->format[0]))
+		return -EOPNOTSUPP;
+
+	tp_damage(tp, 0, posy, txt->cols, posy + 1);
+
+	w = txt->cols * txt->font->attr.width * (tp->c_bpp / 8);
+	h = txt->font->attr.height;
+	dst += (size_t)posy * h * tp->c_stride;
+
+	for (i = 0; i < h; ++i) {
+		memcpy(dst, src, w);
+		src += w;
+		dst += tp->c_stride;
+	}
+
+	return 0;
+}
+
 static int tp_render(struct kmscon_text *txt)
 {
 	struct tp_pixman *tp = txt->data;
 	int ret;
 
+	tp_flush_run(txt);
+	if (tp->frozen) {
+		pixman_glyph_cache_thaw(tp->glyph_cache);
+		tp->frozen = false;
+	}
+
+	/* Tell the display which pixels this frame actually touches; the
+	 * blit below and the swap clip against it. A frame without any
+	 * drawn cells gives no hint and thus full damage. */
+	if (tp->dmg_x1 < tp->dmg_x2 && tp->dmg_y1 < tp->dmg_y2)
+		uterm_display_set_damage(txt->disp,
+					 tp->dmg_x1 * txt->font->attr.width,
+					 tp->dmg_y1 * txt->font->attr.height,
+					 tp->dmg_x2 * txt->font->attr.width,
+					 tp->dmg_y2 * txt->font->attr.height);
+
 	if (!tp->use_indirect)
 		return 0;
 
@@ -488,15 +805,34 @@ static int tp_render(struct kmscon_text *txt)
 	return 0;
 }
 
+static void tp_abort(struct kmscon_text *txt)
+{
+	struct tp_pixman *tp = txt->data;
+
+	tp->run_num = 0;
+	if (tp->frozen) {
+		pixman_glyph_cache_thaw(tp->glyph_cache);
+		tp->frozen = false;
+	}
+}
+
 struct kmscon_text_ops kmscon_text_pixman_ops = {
 	.name = "pixman",
 	.owner = NULL,
+	.bufs = KMSCON_TEXT_MAX_BUFS,
+	.thread_render = true,
 	.init = tp_init,
 	.destroy = tp_destroy,
 	.set = tp_set,
 	.unset = tp_unset,
+	.resize = NULL,
 	.prepare = tp_prepare,
 	.draw = tp_draw,
+	.fill = tp_fill,
 	.render = tp_render,
-	.abort = NULL,
+	.abort = tp_abort,
+	.blit_shift = tp_blit_shift,
+	.strip_size = tp_strip_size,
+	.strip_get = tp_strip_get,
+	.strip_put = tp_strip_put,
 };
@@ -32,6 +32,7 @@
 #include <limits.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <xf86drmMode.h>
 #include "uterm_video.h"
 
 struct uterm_drm2d_rb {
@@ -42,11 +43,38 @@ struct uterm_drm2d_rb {
 	void *map;
 };
 
+#define UTERM_DRM2D_RB_NUM 3
+
 struct uterm_drm2d_display {
 	int current_rb;
-	struct uterm_drm2d_rb rb[2];
+	int queued_rb;
+	struct uterm_drm2d_rb rb[UTERM_DRM2D_RB_NUM];
+
+	/* cacheable shadow buffer; damaged rows are streamed to the
+	 * write-combined dumb-buffer mapping on swap */
+	uint8_t *shadow;
+	unsigned int dirty_low;
+	unsigned int dirty_high;
+	/* false once a renderer got the raw mappings via get_buffers()
+	 * and renders past the shadow; see display_snapshot() */
+	bool shadow_valid;
+
+	/* damage hint saved for a queued page-flip */
+	struct drm_mode_rect queued_clip;
+	unsigned int queued_clip_num;
 };
 
+/* Index of the renderbuffer to render into next. The buffers after it in the
+ * ring are on the scanout, have their page-flip in flight or are queued for
+ * the next flip. */
+static inline int uterm_drm2d_back_rb(struct uterm_drm2d_display *d2d)
+{
+	int newest;
+
+	newest = (d2d->queued_rb >= 0) ? d2d->queued_rb : d2d->current_rb;
+	return (newest + 1) % UTERM_DRM2D_RB_NUM;
+}
+
 struct uterm_drm2d_video {
 	int fd;
 	struct ev_fd *efd;
@@ -58,6 +86,8 @@ int uterm_drm2d_display_blit(struct uterm_display *disp,
 int uterm_drm2d_display_fake_blendv(struct uterm_display *disp,
 				    const struct uterm_video_blend_req *req,
 				    size_t num);
+int uterm_drm2d_display_shift(struct uterm_display *disp,
+			      unsigned int height, int dy);
 int uterm_drm2d_display_fill(struct uterm_display *disp,
 			     uint8_t r, uint8_t g, uint8_t b,
 			     unsigned int x, unsigned int y,
@@ -42,10 +42,26 @@
 #include "uterm_drm_shared_internal.h"
 #include "uterm_drm2d_internal.h"
 #include "uterm_video.h"
+#include "uterm_video_blend_internal.h"
 #include "uterm_video_internal.h"
 
 #define LOG_SUBSYSTEM "uterm_drm2d_render"
 
+/* Rendering always targets the cacheable shadow buffer. Dumb-buffer mappings
+ * are write-combined, where the read-modify-write cycles of blending run
+ * against uncached reads and are catastrophically slow. The damaged rows are
+ * streamed to the back renderbuffer on swap. */
+static uint8_t *drm2d_render_target(struct uterm_drm2d_display *d2d,
+				    unsigned int y, unsigned int height)
+{
+	if (y < d2d->dirty_low)
+		d2d->dirty_low = y;
+	if (y + height > d2d->dirty_high)
+		d2d->dirty_high = y + height;
+
+	return d2d->shadow;
+}
+
 int uterm_drm2d_display_blit(struct uterm_display *disp,
 			     const struct uterm_video_buffer *buf,
 			     unsigned int x, unsigned int y)
@@ -54,13 +70,14 @@ int uterm_drm2d_display_blit(struct uterm_display *disp,
 	uint8_t *dst, *src;
 	unsigned int width, height;
 	unsigned int sw, sh;
+	unsigned int bx1, by1, bx2, by2;
 	struct uterm_drm2d_rb *rb;
 	struct uterm_drm2d_display *d2d = uterm_drm_display_get_data(disp);
 
 	if (!buf || buf->format != UTERM_FORMAT_XRGB32)
 		return -EINVAL;
 
-	rb = &d2d->rb[d2d->current_rb ^ 1];
+	rb = &d2d->rb[uterm_drm2d_back_rb(d2d)];
 	sw = uterm_drm_mode_get_width(disp->current_mode);
 	sh = uterm_drm_mode_get_height(disp->current_mode);
 
@@ -80,10 +97,37 @@ int uterm_drm2d_display_blit(struct uterm_display *disp,
 	else
 		height = buf->height;
 
-	dst = rb->map;
-	dst = &dst[y * rb->stride + x * 4];
 	src = buf->data;
 
+	/* Honor the damage hint; pixels the next swap does not change need
+	 * not be copied at all. Full-screen blits of mostly-idle consoles
+	 * shrink to the few touched rows. */
+	if (disp->damage_set) {
+		bx1 = (x > disp->damage_x1) ? x : disp->damage_x1;
+		by1 = (y > disp->damage_y1) ? y : disp->damage_y1;
+		bx2 = (x + width < disp->damage_x2)
+				? x + width : disp->damage_x2;
+		by2 = (y + height < disp->damage_y2)
+				? y + height : disp->damage_y2;
+		if (bx1 >= bx2 || by1 >= by2)
+			return 0;
+
+		src += (by1 - y) * buf->stride + (bx1 - x) * 4;
+		x = bx1;
+		y = by1;
+		width = bx2 - bx1;
+		height = by2 - by1;
+	}
+
+	dst = drm2d_render_target(d2d, y, height);
+	dst = &dst[y * rb->stride + x * 4];
+
+	/* full-width copy with matching strides collapses into one memcpy */
+	if (!x && 4 * width == rb->stride && buf->stride == rb->stride) {
+		memcpy(dst, src, (size_t)height * rb->stride);
+		return 0;
+	}
+
 	while (height--) {
 		memcpy(dst, src, 4 * width);
 		dst += rb->stride;
@@ -99,16 +143,16 @@ int uterm_drm2d_display_fake_blendv(struct uterm_display *disp,
 {
 	unsigned int tmp;
 	uint8_t *dst, *src;
-	unsigned int width, height, i, j;
+	unsigned int width, height, j;
 	unsigned int sw, sh;
-	uint_fast32_t r, g, b, out;
+	uint_fast32_t fg, bg;
 	struct uterm_drm2d_rb *rb;
 	struct uterm_drm2d_display *d2d = uterm_drm_display_get_data(disp);
 
 	if (!req)
 		return -EINVAL;
 
-	rb = &d2d->rb[d2d->current_rb ^ 1];
+	rb = &d2d->rb[uterm_drm2d_back_rb(d2d)];
 	sw = uterm_drm_mode_get_width(disp->current_mode);
 	sh = uterm_drm_mode_get_height(disp->current_mode);
 
@@ -135,55 +179,53 @@ int uterm_drm2d_display_fake_blendv(struct uterm_display *disp,
 		else
 			height = req->buf->height;
 
-		dst = rb->map;
+		dst = drm2d_render_target(d2d, req->y, height);
 		dst = &dst[req->y * rb->stride + req->x * 4];
 		src = req->buf->data;
 
-		while (height--) {
-			for (i = 0; i < width; ++i) {
-				/* Division by 255 (t /= 255) is done with:
-				 *   t += 0x80
-				 *   t = (t + (t >> 8)) >> 8
-				 * This speeds up the computation by ~20% as the
-				 * division is not needed. */
-				if (src[i] == 0) {
-					r = req->br;
-					g = req->bg;
-					b = req->bb;
-					out = (r << 16) | (g << 8) | b;
-				} else if (src[i] == 255) {
-					r = req->fr;
-					g = req->fg;
-					b = req->fb;
-					out = (r << 16) | (g << 8) | b;
-				} else {
-					r = req->fr * src[i] +
-					    req->br * (255 - src[i]);
-					r += 0x80;
-					r = (r + (r >> 8)) >> 8;
-
-					g = req->fg * src[i] +
-					    req->bg * (255 - src[i]);
-					g += 0x80;
-					g = (g + (g >> 8)) >> 8;
-
-					b = req->fb * src[i] +
-					    req->bb * (255 - src[i]);
-					b += 0x80;
-					b = (b + (b >> 8)) >> 8;
-					out = (r << 16) | (g << 8) | b;
-				}
-
-				((uint32_t*)dst)[i] = out;
-			}
-			dst += rb->stride;
-			src += req->buf->stride;
-		}
+		fg = ((uint_fast32_t)req->fr << 16) | (req->fg << 8) |
+		     req->fb;
+		bg = ((uint_fast32_t)req->br << 16) | (req->bg << 8) |
+		     req->bb;
+
+		uterm_video_blend_xrgb32(dst, rb->stride,
+					 src, req->buf->stride,
+					 width, height, fg, bg);
 	}
 
 	return 0;
 }
 
+int uterm_drm2d_display_shift(struct uterm_display *disp,
+			      unsigned int height, int dy)
+{
+	uint8_t *dst;
+	unsigned int sh, adiff;
+	struct uterm_drm2d_rb *rb;
+	struct uterm_drm2d_display *d2d = uterm_drm_display_get_data(disp);
+
+	rb = &d2d->rb[uterm_drm2d_back_rb(d2d)];
+	sh = uterm_drm_mode_get_height(disp->current_mode);
+	if (height > sh)
+		height = sh;
+
+	adiff = (dy < 0) ? -dy : dy;
+	if (!adiff)
+		return 0;
+	if (adiff >= height)
+		return -EINVAL;
+
+	dst = drm2d_render_target(d2d, 0, height);
+	if (dy > 0)
+		memmove(dst, &dst[adiff * rb->stride],
+			(height - adiff) * rb->stride);
+	else
+		memmove(&dst[adiff * rb->stride], dst,
+			(height - adiff) * rb->stride);
+
+	return 0;
+}
+
 int uterm_drm2d_display_fill(struct uterm_display *disp,
 			     uint8_t r, uint8_t g, uint8_t b,
 			     unsigned int x, unsigned int y,
@@ -195,7 +237,7 @@ int uterm_drm2d_display_fill(struct uterm_display *disp,
 	struct uterm_drm2d_rb *rb;
 	struct uterm_drm2d_display *d2d = uterm_drm_display_get_data(disp);
 
-	rb = &d2d->rb[d2d->current_rb ^ 1];
+	rb = &d2d->rb[uterm_drm2d_back_rb(d2d)];
 	sw = uterm_drm_mode_get_width(disp->current_mode);
 	sh = uterm_drm_mode_get_height(disp->current_mode);
 
@@ -210,7 +252,7 @@ int uterm_drm2d_display_fill(struct uterm_display *disp,
 	if (tmp > sh)
 		height = sh - y;
 
-	dst = rb->map;
+	dst = drm2d_render_target(d2d, y, height);
 	dst = &dst[y * rb->stride + x * 4];
 
 	while (height--) {
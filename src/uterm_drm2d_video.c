@@ -162,7 +162,7 @@ static int display_activate(struct uterm_display *disp, struct uterm_mode *mode)
 	struct uterm_drm_video *vdrm = video->data;
 	struct uterm_drm_display *ddrm = disp->data;
 	struct uterm_drm2d_display *d2d = uterm_drm_display_get_data(disp);
-	int ret;
+	int ret, i;
 	drmModeModeInfo *minfo;
 
 	if (!mode)
@@ -177,15 +177,28 @@ static int display_activate(struct uterm_display *disp, struct uterm_mode *mode)
 		return ret;
 
 	d2d->current_rb = 0;
+	d2d->queued_rb = -1;
 	disp->current_mode = mode;
 
-	ret = init_rb(disp, &d2d->rb[0]);
-	if (ret)
-		goto err_saved;
+	for (i = 0; i < UTERM_DRM2D_RB_NUM; ++i) {
+		ret = init_rb(disp, &d2d->rb[i]);
+		if (ret) {
+			while (i--)
+				destroy_rb(disp, &d2d->rb[i]);
+			goto err_saved;
+		}
+	}
 
-	ret = init_rb(disp, &d2d->rb[1]);
-	if (ret)
-		goto err_rb;
+	d2d->shadow = malloc(d2d->rb[0].stride * minfo->vdisplay);
+	if (!d2d->shadow) {
+		ret = -ENOMEM;
+		goto err_fb;
+	}
+	memset(d2d->shadow, 0, d2d->rb[0].stride * minfo->vdisplay);
+	d2d->dirty_low = minfo->vdisplay;
+	d2d->dirty_high = 0;
+	/* everything is black after the mode-set, including the shadow */
+	d2d->shadow_valid = true;
 
 	ret = drmModeSetCrtc(vdrm->fd, ddrm->crtc_id,
 			     d2d->rb[0].fb, 0, 0, &ddrm->conn_id, 1,
@@ -200,9 +213,10 @@ static int display_activate(struct uterm_display *disp, struct uterm_mode *mode)
 	return 0;
 
 err_fb:
-	destroy_rb(disp, &d2d->rb[1]);
-err_rb:
-	destroy_rb(disp, &d2d->rb[0]);
+	free(d2d->shadow);
+	d2d->shadow = NULL;
+	for (i = 0; i < UTERM_DRM2D_RB_NUM; ++i)
+		destroy_rb(disp, &d2d->rb[i]);
 err_saved:
 	disp->current_mode = NULL;
 	uterm_drm_display_deactivate(disp, vdrm->fd);
@@ -213,14 +227,18 @@ static void display_deactivate(struct uterm_display *disp)
 {
 	struct uterm_drm_video *vdrm;
 	struct uterm_drm2d_display *d2d = uterm_drm_display_get_data(disp);
+	int i;
 
 	vdrm = disp->video->data;
 	log_info("deactivating display %p", disp);
 
 	uterm_drm_display_deactivate(disp, vdrm->fd);
 
-	destroy_rb(disp, &d2d->rb[1]);
-	destroy_rb(disp, &d2d->rb[0]);
+	d2d->queued_rb = -1;
+	free(d2d->shadow);
+	d2d->shadow = NULL;
+	for (i = 0; i < UTERM_DRM2D_RB_NUM; ++i)
+		destroy_rb(disp, &d2d->rb[i]);
 	disp->current_mode = NULL;
 }
 
@@ -231,7 +249,12 @@ static int display_use(struct uterm_display *disp, bool *opengl)
 	if (opengl)
 		*opengl = false;
 
-	return d2d->current_rb ^ 1;
+	return uterm_drm2d_back_rb(d2d);
+}
+
+static unsigned int display_get_bufs(struct uterm_display *disp)
+{
+	return UTERM_DRM2D_RB_NUM;
 }
 
 static int display_get_buffers(struct uterm_display *disp,
@@ -245,7 +268,7 @@ static int display_get_buffers(struct uterm_display *disp,
 	if (!(formats & UTERM_FORMAT_XRGB32))
 		return -EOPNOTSUPP;
 
-	for (i = 0; i < 2; ++i) {
+	for (i = 0; i < UTERM_DRM2D_RB_NUM; ++i) {
 		rb = &d2d->rb[i];
 		buffer[i].width = uterm_drm_mode_get_width(disp->current_mode);
 		buffer[i].height = uterm_drm_mode_get_height(disp->current_mode);
@@ -254,23 +277,143 @@ static int display_get_buffers(struct uterm_display *disp,
 		buffer[i].data = rb->map;
 	}
 
+	/* the renderer writes the mappings directly from now on; the
+	 * shadow no longer tracks the newest frame */
+	d2d->shadow_valid = false;
+
 	return 0;
 }
 
+/* Export the newest complete frame. The shadow buffer holds it in cacheable
+ * memory as long as the renderer draws through our blit/blend/fill ops; a
+ * renderer that writes the raw mappings leaves the shadow stale, so fall
+ * back to the slow-to-read scanout mapping then. */
+static int display_snapshot(struct uterm_display *disp,
+			    struct uterm_video_buffer *buffer)
+{
+	struct uterm_drm2d_display *d2d = uterm_drm_display_get_data(disp);
+	struct uterm_drm2d_rb *rb;
+
+	rb = &d2d->rb[d2d->current_rb];
+	buffer->width = uterm_drm_mode_get_width(disp->current_mode);
+	buffer->height = uterm_drm_mode_get_height(disp->current_mode);
+	buffer->stride = rb->stride;
+	buffer->format = UTERM_FORMAT_XRGB32;
+	if (d2d->shadow && d2d->shadow_valid)
+		buffer->data = d2d->shadow;
+	else
+		buffer->data = rb->map;
+
+	return 0;
+}
+
+/* Stream the damaged shadow rows to the back renderbuffer. memcpy() uses
+ * wide aligned stores that combine well on WC memory and never reads back
+ * from the dumb buffer. Renderers using uterm_display_get_buffers() write to
+ * the mappings directly and leave the shadow clean, so this is a no-op for
+ * them. */
+static void display_flush_shadow(struct uterm_display *disp)
+{
+	struct uterm_drm2d_display *d2d = uterm_drm_display_get_data(disp);
+	struct uterm_drm2d_rb *rb;
+	unsigned int low, high, sh;
+	uint8_t *dst;
+
+	if (!d2d->shadow || d2d->dirty_low >= d2d->dirty_high)
+		return;
+
+	rb = &d2d->rb[uterm_drm2d_back_rb(d2d)];
+	sh = uterm_drm_mode_get_height(disp->current_mode);
+	low = d2d->dirty_low;
+	high = d2d->dirty_high;
+	if (high > sh)
+		high = sh;
+
+	dst = rb->map;
+	memcpy(&dst[low * rb->stride], &d2d->shadow[low * rb->stride],
+	       (high - low) * rb->stride);
+
+	d2d->dirty_low = sh;
+	d2d->dirty_high = 0;
+}
+
 static int display_swap(struct uterm_display *disp, bool immediate)
 {
 	int ret, rb;
 	struct uterm_drm2d_display *d2d = uterm_drm_display_get_data(disp);
+	struct drm_mode_rect clip;
+	unsigned int num = 0, sh;
+
+	/* The dirty shadow rows are exactly what this frame changes on the
+	 * scanout, so export them as damage hint before they are cleared.
+	 * Renderers writing to the mappings directly leave the shadow clean
+	 * and get no hint, which means full damage. */
+	if (d2d->shadow && d2d->dirty_low < d2d->dirty_high) {
+		sh = uterm_drm_mode_get_height(disp->current_mode);
+		clip.x1 = 0;
+		clip.y1 = d2d->dirty_low;
+		clip.x2 = uterm_drm_mode_get_width(disp->current_mode);
+		clip.y2 = (d2d->dirty_high > sh) ? sh : d2d->dirty_high;
+		num = 1;
+	}
+
+	display_flush_shadow(disp);
+
+	rb = uterm_drm2d_back_rb(d2d);
 
-	rb = d2d->current_rb ^ 1;
-	ret = uterm_drm_display_swap(disp, d2d->rb[rb].fb, immediate);
+	if (!immediate && (disp->flags & DISPLAY_VSYNC)) {
+		/* A page-flip is still in flight. With three buffers we can
+		 * accept one finished frame nonetheless and submit its flip
+		 * from the page-flip handler, so the caller can start
+		 * rendering the next frame right away instead of idling until
+		 * the flip completes. */
+		if (d2d->queued_rb >= 0)
+			return -EBUSY;
+
+		d2d->queued_rb = rb;
+		d2d->queued_clip_num = num;
+		if (num)
+			d2d->queued_clip = clip;
+		return 0;
+	}
+
+	ret = uterm_drm_display_swap_damaged(disp, d2d->rb[rb].fb, immediate,
+					     num ? &clip : NULL, num);
 	if (ret)
 		return ret;
 
+	/* an immediate modeset supersedes a queued flip */
+	d2d->queued_rb = -1;
 	d2d->current_rb = rb;
 	return 0;
 }
 
+static void page_flip_handler(struct uterm_display *disp)
+{
+	struct uterm_drm2d_display *d2d = uterm_drm_display_get_data(disp);
+	int ret;
+
+	if (d2d->queued_rb < 0)
+		return;
+
+	/* submit the queued frame right away so it catches the next vblank
+	 * without waiting for the caller to produce a new one */
+	ret = uterm_drm_display_flip(disp, d2d->rb[d2d->queued_rb].fb,
+				     d2d->queued_clip_num ?
+						&d2d->queued_clip : NULL,
+				     d2d->queued_clip_num);
+	d2d->queued_clip_num = 0;
+	if (ret) {
+		d2d->queued_rb = -1;
+		return;
+	}
+
+	d2d->current_rb = d2d->queued_rb;
+	d2d->queued_rb = -1;
+	uterm_display_ref(disp);
+	disp->flags |= DISPLAY_VSYNC;
+}
+
 static const struct display_ops drm2d_display_ops = {
 	.init = display_init,
 	.destroy = display_destroy,
@@ -278,18 +421,21 @@ static const struct display_ops drm2d_display_ops = {
 	.deactivate = display_deactivate,
 	.set_dpms = uterm_drm_display_set_dpms,
 	.use = display_use,
+	.get_bufs = display_get_bufs,
 	.get_buffers = display_get_buffers,
 	.swap = display_swap,
+	.snapshot = display_snapshot,
 	.blit = uterm_drm2d_display_blit,
 	.fake_blendv = uterm_drm2d_display_fake_blendv,
 	.fill = uterm_drm2d_display_fill,
+	.shift = uterm_drm2d_display_shift,
+	.set_cursor = uterm_drm_display_set_cursor,
+	.move_cursor = uterm_drm_display_move_cursor,
 };
 
-static void show_displays(struct uterm_video *video)
+static void flush_displays(struct uterm_video *video)
 {
 	struct uterm_display *iter;
-	struct uterm_drm2d_display *d2d;
-	struct uterm_drm2d_rb *rb;
 	struct shl_dlist *i;
 
 	if (!video_is_awake(video))
@@ -303,15 +449,12 @@ static void show_displays(struct uterm_video *video)
 		if (iter->dpms != UTERM_DPMS_ON)
 			continue;
 
-		/* We use double-buffering so there might be no free back-buffer
-		 * here. Hence, draw into the current (pending) front-buffer and
-		 * wait for possible page-flips to complete. This might cause
-		 * tearing but that's acceptable as this is only called during
-		 * wakeup/sleep. */
-
-		d2d = uterm_drm_display_get_data(iter);
-		rb = &d2d->rb[d2d->current_rb];
-		memset(rb->map, 0, rb->size);
+		/* Pending page-flip events are lost once we drop DRM-master,
+		 * so wait for them before going to sleep. The renderbuffers
+		 * are deliberately left intact: waking up re-sets the CRTC to
+		 * the last complete frame, which makes switching back to
+		 * kmscon instant instead of flashing black until the first
+		 * redraw. */
 		uterm_drm_display_wait_pflip(iter);
 	}
 }
@@ -323,7 +466,7 @@ static int video_init(struct uterm_video *video, const char *node)
 	struct uterm_drm_video *vdrm;
 
 	ret = uterm_drm_video_init(video, node, &drm2d_display_ops,
-				   NULL, NULL);
+				   page_flip_handler, NULL);
 	if (ret)
 		return ret;
 	vdrm = video->data;
@@ -353,7 +496,7 @@ static int video_poll(struct uterm_video *video)
 
 static void video_sleep(struct uterm_video *video)
 {
-	show_displays(video);
+	flush_displays(video);
 	uterm_drm_video_sleep(video);
 }
 
@@ -367,11 +510,13 @@ static int video_wake_up(struct uterm_video *video)
 		return ret;
 	}
 
-	show_displays(video);
+	/* the hotplug pass of the wake-up already re-set all CRTCs to their
+	 * preserved renderbuffers; nothing to repaint here */
 	return 0;
 }
 
 static const struct video_ops drm2d_video_ops = {
+	.prepare = uterm_drm_video_prepare,
 	.init = video_init,
 	.destroy = video_destroy,
 	.segfault = NULL, /* TODO: reset all saved CRTCs on segfault */
@@ -73,6 +73,12 @@ struct uterm_drm3d_video {
 
 	unsigned int sinit;
 	bool supports_rowlen;
+	bool supports_buffer_age;
+	/* eglSwapBuffersWithDamageKHR; NULL if the EGL implementation does
+	 * not support swaps with a damage region */
+	EGLBoolean (EGLAPIENTRYP swap_damaged) (EGLDisplay dpy,
+						EGLSurface surface,
+						EGLint *rects, EGLint n_rects);
 	GLuint tex;
 
 	struct gl_shader *fill_shader;
@@ -30,6 +30,7 @@
 #define EGL_EGLEXT_PROTOTYPES
 #define GL_GLEXT_PROTOTYPES
 
+#include <drm_fourcc.h>
 #include <EGL/egl.h>
 #include <EGL/eglext.h>
 #include <errno.h>
@@ -100,6 +101,9 @@ static struct uterm_drm3d_rb *bo_to_rb(struct uterm_display *disp,
 	struct uterm_drm_video *vdrm = video->data;
 	int ret;
 	unsigned int stride, handle, width, height;;
+#ifdef BUILD_HAVE_GBM_MODIFIERS
+	uint64_t modifier;
+#endif
 
 	if (rb)
 		return rb;
@@ -113,14 +117,51 @@ static struct uterm_drm3d_rb *bo_to_rb(struct uterm_display *disp,
 	rb->disp = disp;
 	rb->bo = bo;
 
+	width = gbm_bo_get_width(rb->bo);
+	height = gbm_bo_get_height(rb->bo);
+
+#ifdef BUILD_HAVE_GBM_MODIFIERS
+	/* a tiled/compressed layout needs per-plane handles and the modifier
+	 * attached to the fb; the legacy ioctl would scan it out as linear */
+	modifier = gbm_bo_get_modifier(rb->bo);
+	if (modifier != DRM_FORMAT_MOD_INVALID &&
+	    modifier != DRM_FORMAT_MOD_LINEAR) {
+		uint32_t handles[4] = { 0 };
+		uint32_t strides[4] = { 0 };
+		uint32_t offsets[4] = { 0 };
+		uint64_t modifiers[4] = { 0 };
+		int i, num;
+
+		num = gbm_bo_get_plane_count(rb->bo);
+		if (num > 4)
+			num = 4;
+		for (i = 0; i < num; ++i) {
+			handles[i] = gbm_bo_get_handle_for_plane(rb->bo,
+								 i).u32;
+			strides[i] = gbm_bo_get_stride_for_plane(rb->bo, i);
+			offsets[i] = gbm_bo_get_offset(rb->bo, i);
+			modifiers[i] = modifier;
+		}
+
+		ret = drmModeAddFB2WithModifiers(vdrm->fd, width, height,
+						 DRM_FORMAT_XRGB8888,
+						 handles, strides, offsets,
+						 modifiers, &rb->fb,
+						 DRM_MODE_FB_MODIFIERS);
+		if (!ret)
+			goto out;
+
+		log_warning("cannot add modifier drm-fb (%d): %m, trying legacy fb",
+			    errno);
+	}
+#endif
+
 #ifdef BUILD_HAVE_GBM_BO_GET_PITCH
 	stride = gbm_bo_get_pitch(rb->bo);
 #else
 	stride = gbm_bo_get_stride(rb->bo);
 #endif
 	handle = gbm_bo_get_handle(rb->bo).u32;
-	width = gbm_bo_get_width(rb->bo);
-	height = gbm_bo_get_height(rb->bo);
 
 	ret = drmModeAddFB(vdrm->fd, width, height, 24, 32, stride,
 			   handle, &rb->fb);
@@ -130,6 +171,9 @@ static struct uterm_drm3d_rb *bo_to_rb(struct uterm_display *disp,
 		return NULL;
 	}
 
+#ifdef BUILD_HAVE_GBM_MODIFIERS
+out:
+#endif
 	gbm_bo_set_user_data(bo, rb, bo_destroy_event);
 	return rb;
 }
@@ -163,10 +207,24 @@ static int display_activate(struct uterm_display *disp,
 	d3d->next = NULL;
 	disp->current_mode = mode;
 
-	d3d->gbm = gbm_surface_create(v3d->gbm, minfo->hdisplay,
-				      minfo->vdisplay, GBM_FORMAT_XRGB8888,
-				      GBM_BO_USE_SCANOUT |
-				      GBM_BO_USE_RENDERING);
+	d3d->gbm = NULL;
+#ifdef BUILD_HAVE_GBM_MODIFIERS
+	/* let the driver pick a tiled/compressed layout from the set the
+	 * scanout plane advertised; linear wastes memory bandwidth */
+	if (ddrm->modifier_num)
+		d3d->gbm = gbm_surface_create_with_modifiers(v3d->gbm,
+							minfo->hdisplay,
+							minfo->vdisplay,
+							GBM_FORMAT_XRGB8888,
+							ddrm->modifiers,
+							ddrm->modifier_num);
+#endif
+	if (!d3d->gbm)
+		d3d->gbm = gbm_surface_create(v3d->gbm, minfo->hdisplay,
+					      minfo->vdisplay,
+					      GBM_FORMAT_XRGB8888,
+					      GBM_BO_USE_SCANOUT |
+					      GBM_BO_USE_RENDERING);
 	if (!d3d->gbm) {
 		log_error("cannot create gbm surface (%d): %m", errno);
 		ret = -EFAULT;
@@ -288,6 +346,42 @@ int uterm_drm3d_display_use(struct uterm_display *disp, bool *opengl)
 	return 0;
 }
 
+/* How many swaps back EGL buffer ages are still useful to a renderer. Mesa
+ * cycles through three or four buffers per gbm surface; older ages force a
+ * full redraw anyway. */
+#define DRM3D_AGE_DEPTH 4
+
+static unsigned int display_get_bufs(struct uterm_display *disp)
+{
+	struct uterm_video *video = disp->video;
+	struct uterm_drm3d_video *v3d = uterm_drm_video_get_data(video);
+
+	/* EGL back-buffers cycle in no fixed order; only with buffer-age
+	 * support can a renderer find out what the buffer still contains */
+	if (!v3d->supports_buffer_age)
+		return 0;
+
+	return DRM3D_AGE_DEPTH;
+}
+
+static int display_get_buffer_age(struct uterm_display *disp)
+{
+	struct uterm_drm3d_display *d3d = uterm_drm_display_get_data(disp);
+	struct uterm_video *video = disp->video;
+	struct uterm_drm3d_video *v3d = uterm_drm_video_get_data(video);
+	EGLint age = 0;
+
+	if (!v3d->supports_buffer_age)
+		return 0;
+
+	/* requires the surface to be current; callers go through use() */
+	if (!eglQuerySurface(v3d->disp, d3d->surface, EGL_BUFFER_AGE_EXT,
+			     &age))
+		return 0;
+
+	return age;
+}
+
 static int display_swap(struct uterm_display *disp, bool immediate)
 {
 	int ret;
@@ -296,11 +390,25 @@ static int display_swap(struct uterm_display *disp, bool immediate)
 	struct uterm_drm3d_display *d3d = uterm_drm_display_get_data(disp);
 	struct uterm_video *video = disp->video;
 	struct uterm_drm3d_video *v3d = uterm_drm_video_get_data(video);
+	unsigned int sh;
+	EGLint rect[4];
+	EGLBoolean b;
 
 	if (!gbm_surface_has_free_buffers(d3d->gbm))
 		return -EBUSY;
 
-	if (!eglSwapBuffers(v3d->disp, d3d->surface)) {
+	if (v3d->swap_damaged && disp->damage_set) {
+		/* EGL damage rectangles have a bottom-left origin */
+		sh = uterm_drm_mode_get_height(disp->current_mode);
+		rect[0] = disp->damage_x1;
+		rect[1] = (disp->damage_y2 > sh) ? 0 : sh - disp->damage_y2;
+		rect[2] = disp->damage_x2 - disp->damage_x1;
+		rect[3] = disp->damage_y2 - disp->damage_y1;
+		b = v3d->swap_damaged(v3d->disp, d3d->surface, rect, 1);
+	} else {
+		b = eglSwapBuffers(v3d->disp, d3d->surface);
+	}
+	if (!b) {
 		log_error("cannot swap EGL buffers (%d): %m", errno);
 		return -EFAULT;
 	}
@@ -347,11 +455,15 @@ static const struct display_ops drm_display_ops = {
 	.deactivate = display_deactivate,
 	.set_dpms = uterm_drm_display_set_dpms,
 	.use = uterm_drm3d_display_use,
+	.get_bufs = display_get_bufs,
+	.get_buffer_age = display_get_buffer_age,
 	.get_buffers = NULL,
 	.swap = display_swap,
 	.blit = uterm_drm3d_display_blit,
 	.fake_blendv = uterm_drm3d_display_fake_blendv,
 	.fill = uterm_drm3d_display_fill,
+	.set_cursor = uterm_drm_display_set_cursor,
+	.move_cursor = uterm_drm_display_move_cursor,
 };
 
 static void show_displays(struct uterm_video *video)
@@ -464,6 +576,13 @@ static int video_init(struct uterm_video *video, const char *node)
 		goto err_disp;
 	}
 
+	if (strstr(ext, "EGL_EXT_buffer_age"))
+		v3d->supports_buffer_age = true;
+
+	if (strstr(ext, "EGL_KHR_swap_buffers_with_damage"))
+		v3d->swap_damaged = (void*)
+			eglGetProcAddress("eglSwapBuffersWithDamageKHR");
+
 	api = EGL_OPENGL_ES_API;
 	if (!eglBindAPI(api)) {
 		log_err("cannot bind opengl-es api");
@@ -539,9 +658,29 @@ static int video_poll(struct uterm_video *video)
 	return uterm_drm_video_poll(video);
 }
 
+static void flush_displays(struct uterm_video *video)
+{
+	struct uterm_display *iter;
+	struct shl_dlist *i;
+
+	if (!video_is_awake(video))
+		return;
+
+	shl_dlist_for_each(i, &video->displays) {
+		iter = shl_dlist_entry(i, struct uterm_display, list);
+
+		if (!display_is_online(iter))
+			continue;
+
+		/* pending page-flip events are lost once we drop DRM-master;
+		 * the gbm surface and EGL state stay allocated across sleep */
+		uterm_drm_display_wait_pflip(iter);
+	}
+}
+
 static void video_sleep(struct uterm_video *video)
 {
-	show_displays(video);
+	flush_displays(video);
 	uterm_drm_video_sleep(video);
 }
 
@@ -560,6 +699,7 @@ static int video_wake_up(struct uterm_video *video)
 }
 
 static const struct video_ops drm_video_ops = {
+	.prepare = uterm_drm_video_prepare,
 	.init = video_init,
 	.destroy = video_destroy,
 	.segfault = NULL, /* TODO: reset all saved CRTCs on segfault */
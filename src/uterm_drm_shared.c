@@ -27,12 +27,17 @@
  * DRM shared functions
  */
 
+#include <drm_fourcc.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <inttypes.h>
 #include <poll.h>
 #include <stdbool.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #include <xf86drm.h>
 #include <xf86drmMode.h>
@@ -212,12 +217,176 @@ int uterm_drm_display_init(struct uterm_display *disp, void *data)
 
 void uterm_drm_display_destroy(struct uterm_display *disp)
 {
-	free(disp->data);
+	struct uterm_drm_display *ddrm = disp->data;
+
+	free(ddrm->modifiers);
+	free(ddrm);
+}
+
+/*
+ * Atomic page-flips
+ * If the device supports atomic modesetting, flips go through
+ * drmModeAtomicCommit() on the primary plane of the CRTC instead of the
+ * legacy drmModePageFlip(). This lets us attach FB_DAMAGE_CLIPS hints from
+ * the damage tracker so PSR-panels and remote pipes only update the touched
+ * region. Full modesets keep using the legacy path.
+ */
+
+static uint32_t display_find_prop(int fd, drmModeObjectProperties *props,
+				  const char *name, uint64_t *value)
+{
+	drmModePropertyPtr prop;
+	unsigned int i;
+	uint32_t id = 0;
+
+	for (i = 0; i < props->count_props; ++i) {
+		prop = drmModeGetProperty(fd, props->props[i]);
+		if (!prop)
+			continue;
+		if (!strcmp(prop->name, name)) {
+			id = prop->prop_id;
+			if (value)
+				*value = props->prop_values[i];
+		}
+		drmModeFreeProperty(prop);
+		if (id)
+			return id;
+	}
+
+	return 0;
+}
+
+/*
+ * Collect the modifiers the primary plane accepts for XRGB8888 from its
+ * IN_FORMATS blob. The backends pass the list to modifier-aware buffer
+ * allocation so the driver may pick tiled/compressed layouts instead of
+ * falling back to linear scanout. Missing blob simply leaves the list
+ * empty; allocation then keeps using the legacy path.
+ */
+static void display_read_modifiers(struct uterm_display *disp, int fd,
+				   drmModeObjectProperties *props)
+{
+	struct uterm_drm_display *ddrm = disp->data;
+	drmModePropertyBlobRes *blob;
+	struct drm_format_modifier_blob *data;
+	struct drm_format_modifier *mods;
+	uint32_t *formats;
+	uint64_t value;
+	unsigned int i, fmt;
+
+	free(ddrm->modifiers);
+	ddrm->modifiers = NULL;
+	ddrm->modifier_num = 0;
+
+	value = 0;
+	if (!display_find_prop(fd, props, "IN_FORMATS", &value) || !value)
+		return;
+
+	blob = drmModeGetPropertyBlob(fd, value);
+	if (!blob)
+		return;
+
+	data = blob->data;
+	formats = (uint32_t*)((char*)data + data->formats_offset);
+	mods = (struct drm_format_modifier*)
+				((char*)data + data->modifiers_offset);
+
+	for (fmt = 0; fmt < data->count_formats; ++fmt)
+		if (formats[fmt] == DRM_FORMAT_XRGB8888)
+			break;
+	if (fmt == data->count_formats)
+		goto out_blob;
+
+	ddrm->modifiers = malloc(sizeof(uint64_t) * data->count_modifiers);
+	if (!ddrm->modifiers)
+		goto out_blob;
+
+	for (i = 0; i < data->count_modifiers; ++i) {
+		if (fmt < mods[i].offset || fmt >= mods[i].offset + 64)
+			continue;
+		if (!(mods[i].formats & (1ULL << (fmt - mods[i].offset))))
+			continue;
+		ddrm->modifiers[ddrm->modifier_num++] = mods[i].modifier;
+	}
+
+	if (!ddrm->modifier_num) {
+		free(ddrm->modifiers);
+		ddrm->modifiers = NULL;
+	}
+
+out_blob:
+	drmModeFreePropertyBlob(blob);
+}
+
+static void display_find_plane(struct uterm_display *disp, int fd,
+			       drmModeRes *res)
+{
+	struct uterm_drm_display *ddrm = disp->data;
+	drmModePlaneResPtr planes;
+	drmModePlanePtr plane;
+	drmModeObjectProperties *props;
+	uint64_t type;
+	unsigned int i, pipe;
+
+	ddrm->plane_id = 0;
+
+	for (pipe = 0; pipe < res->count_crtcs; ++pipe)
+		if (res->crtcs[pipe] == ddrm->crtc_id)
+			break;
+	if (pipe == res->count_crtcs)
+		return;
+
+	planes = drmModeGetPlaneResources(fd);
+	if (!planes)
+		return;
+
+	for (i = 0; i < planes->count_planes && !ddrm->plane_id; ++i) {
+		plane = drmModeGetPlane(fd, planes->planes[i]);
+		if (!plane)
+			continue;
+		if (!(plane->possible_crtcs & (1 << pipe))) {
+			drmModeFreePlane(plane);
+			continue;
+		}
+
+		props = drmModeObjectGetProperties(fd, plane->plane_id,
+						   DRM_MODE_OBJECT_PLANE);
+		if (!props) {
+			drmModeFreePlane(plane);
+			continue;
+		}
+
+		type = 0;
+		if (display_find_prop(fd, props, "type", &type) &&
+		    type == DRM_PLANE_TYPE_PRIMARY) {
+			ddrm->prop_fb_id = display_find_prop(fd, props,
+							     "FB_ID", NULL);
+			ddrm->prop_damage = display_find_prop(fd, props,
+							"FB_DAMAGE_CLIPS",
+							NULL);
+			if (ddrm->prop_fb_id)
+				ddrm->plane_id = plane->plane_id;
+			if (ddrm->plane_id)
+				display_read_modifiers(disp, fd, props);
+		}
+
+		drmModeFreeObjectProperties(props);
+		drmModeFreePlane(plane);
+	}
+
+	drmModeFreePlaneResources(planes);
+
+	if (ddrm->plane_id)
+		log_debug("atomic page-flips on plane %u (damage %s, %u modifiers)",
+			  ddrm->plane_id,
+			  ddrm->prop_damage ? "supported" : "unsupported",
+			  ddrm->modifier_num);
 }
 
 int uterm_drm_display_activate(struct uterm_display *disp, int fd)
 {
 	struct uterm_video *video = disp->video;
+	struct uterm_drm_video *vdrm = video->data;
 	struct uterm_drm_display *ddrm = disp->data;
 	drmModeRes *res;
 	drmModeConnector *conn;
@@ -260,6 +429,171 @@ int uterm_drm_display_activate(struct uterm_display *disp, int fd)
 		drmModeFreeCrtc(ddrm->saved_crtc);
 	ddrm->saved_crtc = drmModeGetCrtc(fd, ddrm->crtc_id);
 
+	if (vdrm->atomic) {
+		res = drmModeGetResources(fd);
+		if (res) {
+			display_find_plane(disp, fd, res);
+			drmModeFreeResources(res);
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Hardware cursor
+ * The cursor plane is backed by a small dumb-buffer which is lazily created
+ * on the first uterm_drm_display_set_cursor() call and destroyed again on
+ * deactivation. 64x64 ARGB is the size every KMS driver supports.
+ */
+
+#define CURSOR_BO_SIZE 64
+
+static int display_init_cursor(struct uterm_display *disp)
+{
+	struct uterm_drm_display *ddrm = disp->data;
+	struct uterm_drm_video *vdrm = disp->video->data;
+	struct drm_mode_create_dumb req;
+	struct drm_mode_destroy_dumb dreq;
+	struct drm_mode_map_dumb mreq;
+	int ret;
+
+	if (ddrm->cursor_map)
+		return 0;
+
+	memset(&req, 0, sizeof(req));
+	req.width = CURSOR_BO_SIZE;
+	req.height = CURSOR_BO_SIZE;
+	req.bpp = 32;
+	req.flags = 0;
+
+	ret = drmIoctl(vdrm->fd, DRM_IOCTL_MODE_CREATE_DUMB, &req);
+	if (ret < 0) {
+		log_warning("cannot create cursor buffer for display %p",
+			    disp);
+		return -EFAULT;
+	}
+
+	ddrm->cursor_bo = req.handle;
+	ddrm->cursor_size = req.size;
+	ddrm->cursor_stride = req.pitch;
+	ddrm->cursor_w = req.width;
+	ddrm->cursor_h = req.height;
+
+	memset(&mreq, 0, sizeof(mreq));
+	mreq.handle = ddrm->cursor_bo;
+
+	ret = drmIoctl(vdrm->fd, DRM_IOCTL_MODE_MAP_DUMB, &mreq);
+	if (ret) {
+		log_warning("cannot map cursor buffer for display %p", disp);
+		goto err_bo;
+	}
+
+	ddrm->cursor_map = mmap(0, ddrm->cursor_size,
+				PROT_READ | PROT_WRITE, MAP_SHARED,
+				vdrm->fd, mreq.offset);
+	if (ddrm->cursor_map == MAP_FAILED) {
+		log_warning("cannot mmap cursor buffer for display %p", disp);
+		ddrm->cursor_map = NULL;
+		goto err_bo;
+	}
+
+	return 0;
+
+err_bo:
+	memset(&dreq, 0, sizeof(dreq));
+	dreq.handle = ddrm->cursor_bo;
+	drmIoctl(vdrm->fd, DRM_IOCTL_MODE_DESTROY_DUMB, &dreq);
+	ddrm->cursor_bo = 0;
+	return -EFAULT;
+}
+
+static void display_destroy_cursor(struct uterm_display *disp, int fd)
+{
+	struct uterm_drm_display *ddrm = disp->data;
+	struct drm_mode_destroy_dumb dreq;
+
+	if (!ddrm->cursor_map)
+		return;
+
+	if (ddrm->cursor_enabled && (disp->video->flags & VIDEO_AWAKE))
+		drmModeSetCursor(fd, ddrm->crtc_id, 0, 0, 0);
+
+	munmap(ddrm->cursor_map, ddrm->cursor_size);
+	ddrm->cursor_map = NULL;
+	memset(&dreq, 0, sizeof(dreq));
+	dreq.handle = ddrm->cursor_bo;
+	drmIoctl(fd, DRM_IOCTL_MODE_DESTROY_DUMB, &dreq);
+	ddrm->cursor_bo = 0;
+	ddrm->cursor_enabled = false;
+}
+
+int uterm_drm_display_set_cursor(struct uterm_display *disp,
+				 const struct uterm_video_buffer *buf)
+{
+	struct uterm_drm_display *ddrm = disp->data;
+	struct uterm_drm_video *vdrm = disp->video->data;
+	const uint32_t *src;
+	uint32_t *dst;
+	unsigned int i, j;
+	int ret;
+
+	if (!buf) {
+		if (!ddrm->cursor_enabled)
+			return 0;
+
+		ret = drmModeSetCursor(vdrm->fd, ddrm->crtc_id, 0, 0, 0);
+		if (ret)
+			return -EFAULT;
+
+		ddrm->cursor_enabled = false;
+		return 0;
+	}
+
+	if (buf->format != UTERM_FORMAT_XRGB32 || !buf->data)
+		return -EOPNOTSUPP;
+
+	ret = display_init_cursor(disp);
+	if (ret)
+		return ret;
+
+	if (buf->width > ddrm->cursor_w || buf->height > ddrm->cursor_h)
+		return -EINVAL;
+
+	memset(ddrm->cursor_map, 0, ddrm->cursor_size);
+	for (i = 0; i < buf->height; ++i) {
+		dst = (uint32_t*)((uint8_t*)ddrm->cursor_map +
+				  i * ddrm->cursor_stride);
+		src = (const uint32_t*)(buf->data + i * buf->stride);
+		for (j = 0; j < buf->width; ++j)
+			dst[j] = src[j] ? src[j] | 0xff000000 : 0;
+	}
+
+	ret = drmModeSetCursor(vdrm->fd, ddrm->crtc_id, ddrm->cursor_bo,
+			       ddrm->cursor_w, ddrm->cursor_h);
+	if (ret) {
+		log_warning("cannot set cursor on display %p (%d): %m",
+			    disp, errno);
+		return -EFAULT;
+	}
+
+	ddrm->cursor_enabled = true;
+	return 0;
+}
+
+int uterm_drm_display_move_cursor(struct uterm_display *disp, int x, int y)
+{
+	struct uterm_drm_display *ddrm = disp->data;
+	struct uterm_drm_video *vdrm = disp->video->data;
+	int ret;
+
+	if (!ddrm->cursor_enabled)
+		return -EINVAL;
+
+	ret = drmModeMoveCursor(vdrm->fd, ddrm->crtc_id, x, y);
+	if (ret)
+		return -EFAULT;
+
 	return 0;
 }
 
@@ -268,6 +602,7 @@ void uterm_drm_display_deactivate(struct uterm_display *disp, int fd)
 	struct uterm_drm_display *ddrm = disp->data;
 
 	uterm_drm_display_wait_pflip(disp);
+	display_destroy_cursor(disp, fd);
 
 	if (ddrm->saved_crtc) {
 		if (disp->video->flags & VIDEO_AWAKE) {
@@ -283,6 +618,10 @@ void uterm_drm_display_deactivate(struct uterm_display *disp, int fd)
 	}
 
 	ddrm->crtc_id = 0;
+	ddrm->plane_id = 0;
+	free(ddrm->modifiers);
+	ddrm->modifiers = NULL;
+	ddrm->modifier_num = 0;
 	disp->flags &= ~(DISPLAY_VSYNC | DISPLAY_ONLINE | DISPLAY_PFLIP);
 }
 
@@ -331,8 +670,91 @@ int uterm_drm_display_wait_pflip(struct uterm_display *disp)
 	return 0;
 }
 
-int uterm_drm_display_swap(struct uterm_display *disp, uint32_t fb,
-			   bool immediate)
+static int display_flip_atomic(struct uterm_display *disp, uint32_t fb,
+			       const struct drm_mode_rect *clips,
+			       unsigned int num)
+{
+	struct uterm_drm_display *ddrm = disp->data;
+	struct uterm_drm_video *vdrm = disp->video->data;
+	drmModeAtomicReq *req;
+	uint32_t blob = 0;
+	int ret;
+
+	req = drmModeAtomicAlloc();
+	if (!req)
+		return -ENOMEM;
+
+	ret = drmModeAtomicAddProperty(req, ddrm->plane_id, ddrm->prop_fb_id,
+				       fb);
+	if (ret < 0) {
+		ret = -EFAULT;
+		goto err_req;
+	}
+
+	/* the damage hint is optional; skip it silently if the blob cannot
+	 * be created */
+	if (num && ddrm->prop_damage) {
+		ret = drmModeCreatePropertyBlob(vdrm->fd, clips,
+						num * sizeof(*clips), &blob);
+		if (ret)
+			blob = 0;
+		if (blob) {
+			ret = drmModeAtomicAddProperty(req, ddrm->plane_id,
+						       ddrm->prop_damage,
+						       blob);
+			if (ret < 0) {
+				ret = -EFAULT;
+				goto err_blob;
+			}
+		}
+	}
+
+	ret = drmModeAtomicCommit(vdrm->fd, req,
+				  DRM_MODE_ATOMIC_NONBLOCK |
+				  DRM_MODE_PAGE_FLIP_EVENT, disp);
+	if (ret)
+		ret = -EFAULT;
+
+err_blob:
+	if (blob)
+		drmModeDestroyPropertyBlob(vdrm->fd, blob);
+err_req:
+	drmModeAtomicFree(req);
+	return ret;
+}
+
+int uterm_drm_display_flip(struct uterm_display *disp, uint32_t fb,
+			   const struct drm_mode_rect *clips,
+			   unsigned int num)
+{
+	struct uterm_drm_display *ddrm = disp->data;
+	struct uterm_drm_video *vdrm = disp->video->data;
+	int ret;
+
+	if (ddrm->plane_id) {
+		ret = display_flip_atomic(disp, fb, clips, num);
+		if (!ret)
+			return 0;
+
+		log_warning("atomic commit failed on display %p (%d): %m, falling back to legacy page-flips",
+			    disp, errno);
+		ddrm->plane_id = 0;
+	}
+
+	ret = drmModePageFlip(vdrm->fd, ddrm->crtc_id, fb,
+			      DRM_MODE_PAGE_FLIP_EVENT, disp);
+	if (ret) {
+		log_error("cannot page-flip on DRM-CRTC (%d): %m", errno);
+		return -EFAULT;
+	}
+
+	return 0;
+}
+
+int uterm_drm_display_swap_damaged(struct uterm_display *disp, uint32_t fb,
+				   bool immediate,
+				   const struct drm_mode_rect *clips,
+				   unsigned int num)
 {
 	struct uterm_drm_display *ddrm = disp->data;
 	struct uterm_video *video = disp->video;
@@ -359,13 +781,9 @@ int uterm_drm_display_swap(struct uterm_display *disp, uint32_t fb,
 		if ((disp->flags & DISPLAY_VSYNC))
 			return -EBUSY;
 
-		ret = drmModePageFlip(vdrm->fd, ddrm->crtc_id, fb,
-				      DRM_MODE_PAGE_FLIP_EVENT, disp);
-		if (ret) {
-			log_error("cannot page-flip on DRM-CRTC (%d): %m",
-				  errno);
-			return -EFAULT;
-		}
+		ret = uterm_drm_display_flip(disp, fb, clips, num);
+		if (ret)
+			return ret;
 
 		uterm_display_ref(disp);
 		disp->flags |= DISPLAY_VSYNC;
@@ -374,6 +792,12 @@ int uterm_drm_display_swap(struct uterm_display *disp, uint32_t fb,
 	return 0;
 }
 
+int uterm_drm_display_swap(struct uterm_display *disp, uint32_t fb,
+			   bool immediate)
+{
+	return uterm_drm_display_swap_damaged(disp, fb, immediate, NULL, 0);
+}
+
 static void uterm_drm_display_pflip(struct uterm_display *disp)
 {
 	struct uterm_drm_video *vdrm = disp->video->data;
@@ -479,6 +903,96 @@ static void vt_timeout(struct ev_timer *timer, uint64_t exp, void *data)
 	}
 }
 
+static void mode_cache_save(struct uterm_video *video,
+			    drmModeConnector *conn);
+static void bind_display(struct uterm_video *video, drmModeRes *res,
+			 drmModeConnector *conn);
+
+/* compare the bound mode list of @disp with the probed list of @conn */
+static bool display_modes_match(struct uterm_display *disp,
+				drmModeConnector *conn)
+{
+	struct shl_dlist *iter;
+	struct uterm_mode *mode;
+	struct uterm_drm_mode *m;
+	int i = 0;
+
+	shl_dlist_for_each(iter, &disp->modes) {
+		mode = shl_dlist_entry(iter, struct uterm_mode, list);
+		m = mode->data;
+		if (i >= conn->count_modes ||
+		    memcmp(&m->info, &conn->modes[i], sizeof(m->info)))
+			return false;
+		++i;
+	}
+
+	return i == conn->count_modes;
+}
+
+/* Re-validate displays bound from the on-disk mode cache with a full,
+ * forced connector probe. Matching mode lists just clear the cached flag;
+ * a mismatch (stale cache) rebinds the display with the probed modes. */
+static void probe_timeout(struct ev_timer *timer, uint64_t exp, void *data)
+{
+	struct uterm_video *video = data;
+	struct uterm_drm_video *vdrm = video->data;
+	struct uterm_display *disp;
+	struct uterm_drm_display *ddrm;
+	struct shl_dlist *iter, *tmp;
+	drmModeConnector *conn;
+
+	ev_timer_update(vdrm->probe_timer, NULL);
+
+	if (!video_is_awake(video))
+		return;
+
+	log_debug("re-validating cached displays");
+
+	shl_dlist_for_each_safe(iter, tmp, &video->displays) {
+		disp = shl_dlist_entry(iter, struct uterm_display, list);
+		ddrm = disp->data;
+		if (!ddrm->cached)
+			continue;
+
+		conn = drmModeGetConnector(vdrm->fd, ddrm->conn_id);
+		if (!conn) {
+			uterm_display_unbind(disp);
+			continue;
+		}
+
+		if (conn->connection != DRM_MODE_CONNECTED ||
+		    !conn->count_modes) {
+			uterm_display_unbind(disp);
+			drmModeFreeConnector(conn);
+			continue;
+		}
+
+		if (display_modes_match(disp, conn)) {
+			ddrm->cached = false;
+			mode_cache_save(video, conn);
+		} else {
+			log_debug("cached modes for connector %" PRIu32
+				  " are stale; rebinding display",
+				  ddrm->conn_id);
+			uterm_display_unbind(disp);
+			bind_display(video, NULL, conn);
+		}
+
+		drmModeFreeConnector(conn);
+	}
+}
+
+void uterm_drm_video_arm_probe_timer(struct uterm_video *video)
+{
+	struct uterm_drm_video *vdrm = video->data;
+	struct itimerspec spec;
+
+	memset(&spec, 0, sizeof(spec));
+	spec.it_value.tv_nsec = 50L * 1000L * 1000L; /* 50ms */
+
+	ev_timer_update(vdrm->probe_timer, &spec);
+}
+
 void uterm_drm_video_arm_vt_timer(struct uterm_video *video)
 {
 	struct uterm_drm_video *vdrm = video->data;
@@ -491,6 +1005,37 @@ void uterm_drm_video_arm_vt_timer(struct uterm_video *video)
 	ev_timer_update(vdrm->vt_timer, &spec);
 }
 
+int uterm_drm_video_prepare(const char *node)
+{
+	drmModeRes *res;
+	drmModeConnector *conn;
+	int fd, i;
+
+	fd = open(node, O_RDWR | O_CLOEXEC | O_NONBLOCK);
+	if (fd < 0)
+		return -EFAULT;
+	drmDropMaster(fd);
+
+	res = drmModeGetResources(fd);
+	if (!res) {
+		close(fd);
+		return -EACCES;
+	}
+
+	/* Probe every connector once; reading the EDIDs can take hundreds
+	 * of milliseconds per output but the kernel caches the result, so
+	 * the probe during the real wake-up is served from that cache. */
+	for (i = 0; i < res->count_connectors; ++i) {
+		conn = drmModeGetConnector(fd, res->connectors[i]);
+		if (conn)
+			drmModeFreeConnector(conn);
+	}
+
+	drmModeFreeResources(res);
+	close(fd);
+	return 0;
+}
+
 int uterm_drm_video_init(struct uterm_video *video, const char *node,
 			 const struct display_ops *display_ops,
 			 uterm_drm_page_flip_t pflip, void *data)
@@ -518,6 +1063,12 @@ int uterm_drm_video_init(struct uterm_video *video, const char *node,
 	/* TODO: fix the race-condition with DRM-Master-on-open */
 	drmDropMaster(vdrm->fd);
 
+	if (!drmSetClientCap(vdrm->fd, DRM_CLIENT_CAP_UNIVERSAL_PLANES, 1) &&
+	    !drmSetClientCap(vdrm->fd, DRM_CLIENT_CAP_ATOMIC, 1)) {
+		vdrm->atomic = true;
+		log_debug("atomic modesetting available on %s", node);
+	}
+
 	ret = ev_eloop_new_fd(video->eloop, &vdrm->efd, vdrm->fd, EV_READABLE,
 			      io_event, video);
 	if (ret)
@@ -532,9 +1083,16 @@ int uterm_drm_video_init(struct uterm_video *video, const char *node,
 	if (ret)
 		goto err_timer;
 
+	ret = ev_eloop_new_timer(video->eloop, &vdrm->probe_timer, NULL,
+				 probe_timeout, video);
+	if (ret)
+		goto err_vt_timer;
+
 	video->flags |= VIDEO_HOTPLUG;
 	return 0;
 
+err_vt_timer:
+	ev_eloop_rm_timer(vdrm->vt_timer);
 err_timer:
 	shl_timer_free(vdrm->timer);
 err_fd:
@@ -550,6 +1108,7 @@ void uterm_drm_video_destroy(struct uterm_video *video)
 {
 	struct uterm_drm_video *vdrm = video->data;
 
+	ev_eloop_rm_timer(vdrm->probe_timer);
 	ev_eloop_rm_timer(vdrm->vt_timer);
 	ev_eloop_unregister_idle_cb(video->eloop, do_pflips, video, EV_SINGLE);
 	shl_timer_free(vdrm->timer);
@@ -585,26 +1144,209 @@ int uterm_drm_video_find_crtc(struct uterm_video *video, drmModeRes *res,
 	return -1;
 }
 
-static void bind_display(struct uterm_video *video, drmModeRes *res,
-			 drmModeConnector *conn)
+/*
+ * Connector mode cache
+ * drmModeGetConnector() forces a full connector re-probe including EDID
+ * transfers, which costs several hundred milliseconds per card on slow
+ * hardware. The hotplug scan therefore only reads the current kernel state
+ * via drmModeGetConnectorCurrent() and, if the kernel has not probed a
+ * connector yet, falls back to an on-disk cache of the last validated mode
+ * list. Displays bound from the cache are re-validated by a full probe
+ * shortly afterwards; see probe_timeout().
+ */
+
+#define DRM_CACHE_DIR "/var/cache/kmscon"
+#define DRM_CACHE_MAGIC 0x4d52444bU
+
+struct mode_cache_header {
+	uint32_t magic;
+	uint32_t count;
+	uint32_t edid_hash;
+};
+
+/* djb2 over the EDID blob; 0 if the connector has no EDID available */
+static uint32_t conn_edid_hash(int fd, drmModeConnector *conn)
+{
+	drmModePropertyRes *prop;
+	drmModePropertyBlobRes *blob;
+	uint32_t hash = 0, j;
+	unsigned char *d;
+	int i;
+
+	for (i = 0; i < conn->count_props; ++i) {
+		prop = drmModeGetProperty(fd, conn->props[i]);
+		if (!prop)
+			continue;
+		if (strcmp(prop->name, "EDID")) {
+			drmModeFreeProperty(prop);
+			continue;
+		}
+		drmModeFreeProperty(prop);
+
+		blob = drmModeGetPropertyBlob(fd, conn->prop_values[i]);
+		if (!blob)
+			break;
+
+		hash = 5381;
+		d = blob->data;
+		for (j = 0; j < blob->length; ++j)
+			hash = hash * 33 + d[j];
+		drmModeFreePropertyBlob(blob);
+		break;
+	}
+
+	return hash;
+}
+
+static char *mode_cache_path(struct uterm_video *video, uint32_t conn_id)
+{
+	struct uterm_drm_video *vdrm = video->data;
+	struct stat st;
+	char *path;
+	int ret;
+
+	if (fstat(vdrm->fd, &st))
+		return NULL;
+
+	ret = asprintf(&path, "%s/drm-%08lx-%" PRIu32 ".modes",
+		       DRM_CACHE_DIR, (unsigned long)st.st_rdev, conn_id);
+	if (ret < 0)
+		return NULL;
+
+	return path;
+}
+
+static void mode_cache_save(struct uterm_video *video, drmModeConnector *conn)
+{
+	struct uterm_drm_video *vdrm = video->data;
+	struct mode_cache_header hdr;
+	char *path, *tmp;
+	int fd, ret;
+	size_t len;
+
+	path = mode_cache_path(video, conn->connector_id);
+	if (!path)
+		return;
+
+	ret = asprintf(&tmp, "%s.tmp", path);
+	if (ret < 0) {
+		free(path);
+		return;
+	}
+
+	if (mkdir(DRM_CACHE_DIR, 0755) < 0 && errno != EEXIST)
+		goto out_free;
+
+	fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+	if (fd < 0)
+		goto out_free;
+
+	hdr.magic = DRM_CACHE_MAGIC;
+	hdr.count = conn->count_modes;
+	hdr.edid_hash = conn_edid_hash(vdrm->fd, conn);
+	len = sizeof(*conn->modes) * conn->count_modes;
+
+	if (write(fd, &hdr, sizeof(hdr)) != (ssize_t)sizeof(hdr) ||
+	    write(fd, conn->modes, len) != (ssize_t)len) {
+		close(fd);
+		unlink(tmp);
+		goto out_free;
+	}
+	close(fd);
+
+	if (rename(tmp, path) < 0)
+		unlink(tmp);
+	else
+		log_debug("cached %d modes for connector %u",
+			  conn->count_modes, conn->connector_id);
+
+out_free:
+	free(tmp);
+	free(path);
+}
+
+/* Load the cached mode list for @conn. A connector that has an EDID which
+ * differs from the cached one clearly shows a different monitor, so the stale
+ * cache file is dropped. Without an EDID (the kernel has not probed, yet) the
+ * cache is trusted and re-validated later. Returns the number of modes or a
+ * negative error code; the array is stored in @out and must be freed. */
+static int mode_cache_load(struct uterm_video *video, drmModeConnector *conn,
+			   drmModeModeInfo **out)
+{
+	struct uterm_drm_video *vdrm = video->data;
+	struct mode_cache_header hdr;
+	drmModeModeInfo *modes;
+	uint32_t edid;
+	char *path;
+	ssize_t len;
+	int fd;
+
+	path = mode_cache_path(video, conn->connector_id);
+	if (!path)
+		return -ENOMEM;
+
+	fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0) {
+		free(path);
+		return -ENOENT;
+	}
+
+	if (read(fd, &hdr, sizeof(hdr)) != (ssize_t)sizeof(hdr) ||
+	    hdr.magic != DRM_CACHE_MAGIC || !hdr.count || hdr.count > 128)
+		goto err_drop;
+
+	edid = conn_edid_hash(vdrm->fd, conn);
+	if (edid && edid != hdr.edid_hash)
+		goto err_drop;
+
+	len = sizeof(*modes) * hdr.count;
+	modes = malloc(len);
+	if (!modes) {
+		close(fd);
+		free(path);
+		return -ENOMEM;
+	}
+
+	if (read(fd, modes, len) != len) {
+		free(modes);
+		goto err_drop;
+	}
+
+	close(fd);
+	free(path);
+	*out = modes;
+	return hdr.count;
+
+err_drop:
+	close(fd);
+	unlink(path);
+	free(path);
+	return -EFAULT;
+}
+
+static void bind_display_modes(struct uterm_video *video,
+			       drmModeConnector *conn,
+			       drmModeModeInfo *modes, unsigned int count,
+			       bool cached)
 {
 	struct uterm_drm_video *vdrm = video->data;
 	struct uterm_display *disp;
 	struct uterm_drm_display *ddrm;
 	struct uterm_mode *mode;
-	int ret, i;
+	int ret;
+	unsigned int i;
 
 	ret = display_new(&disp, vdrm->display_ops);
 	if (ret)
 		return;
 	ddrm = disp->data;
 
-	for (i = 0; i < conn->count_modes; ++i) {
+	for (i = 0; i < count; ++i) {
 		ret = mode_new(&mode, &uterm_drm_mode_ops);
 		if (ret)
 			continue;
 
-		uterm_drm_mode_set(mode, &conn->modes[i]);
+		uterm_drm_mode_set(mode, &modes[i]);
 
 		ret = uterm_mode_bind(mode, disp);
 		if (ret) {
@@ -626,6 +1368,7 @@ static void bind_display(struct uterm_video *video, drmModeRes *res,
 	}
 
 	ddrm->conn_id = conn->connector_id;
+	ddrm->cached = cached;
 	disp->flags |= DISPLAY_AVAILABLE;
 	disp->dpms = uterm_drm_get_dpms(vdrm->fd, conn);
 
@@ -644,6 +1387,93 @@ err_unref:
 	return;
 }
 
+static void bind_display(struct uterm_video *video, drmModeRes *res,
+			 drmModeConnector *conn)
+{
+	drmModeModeInfo *modes;
+	int count;
+
+	if (conn->count_modes) {
+		bind_display_modes(video, conn, conn->modes,
+				   conn->count_modes, false);
+		mode_cache_save(video, conn);
+		return;
+	}
+
+	/* the kernel has not probed this connector, yet */
+	count = mode_cache_load(video, conn, &modes);
+	if (count <= 0) {
+		log_warn("no valid mode for display found");
+		return;
+	}
+
+	log_debug("using %d cached modes for connector %u", count,
+		  conn->connector_id);
+	bind_display_modes(video, conn, modes, count, true);
+	free(modes);
+}
+
+/* Re-check a single connector instead of scanning the whole card; all other
+ * displays are left untouched. */
+static void uterm_drm_hotplug_connector(struct uterm_video *video,
+					uint32_t conn_id,
+					bool read_dpms, bool modeset)
+{
+	struct uterm_drm_video *vdrm = video->data;
+	drmModeConnector *conn;
+	struct uterm_display *disp = NULL;
+	struct uterm_drm_display *ddrm;
+	struct shl_dlist *iter;
+	int dpms;
+
+	log_debug("testing DRM hotplug status of connector %u", conn_id);
+
+	shl_dlist_for_each(iter, &video->displays) {
+		disp = shl_dlist_entry(iter, struct uterm_display, list);
+		ddrm = disp->data;
+		if (ddrm->conn_id == conn_id)
+			break;
+	}
+	if (iter == &video->displays)
+		disp = NULL;
+
+	/* read the current kernel state only; forcing a re-probe transfers
+	 * EDIDs and stalls rendering for hundreds of ms */
+	conn = drmModeGetConnectorCurrent(vdrm->fd, conn_id);
+	if (!conn || conn->connection != DRM_MODE_CONNECTED) {
+		if (disp)
+			uterm_display_unbind(disp);
+		if (conn)
+			drmModeFreeConnector(conn);
+		return;
+	}
+
+	if (!disp) {
+		bind_display(video, NULL, conn);
+	} else {
+		disp->flags |= DISPLAY_AVAILABLE;
+		if (display_is_online(disp)) {
+			if (read_dpms) {
+				dpms = uterm_drm_get_dpms(vdrm->fd, conn);
+				if (dpms != disp->dpms) {
+					log_debug("DPMS state for display %p changed",
+						  disp);
+					uterm_drm_display_set_dpms(disp,
+								   disp->dpms);
+				}
+			}
+
+			if (modeset) {
+				log_debug("re-activate display %p", disp);
+				uterm_display_use(disp, NULL);
+				uterm_display_swap(disp, true);
+			}
+		}
+	}
+
+	drmModeFreeConnector(conn);
+}
+
 int uterm_drm_video_hotplug(struct uterm_video *video,
 			    bool read_dpms, bool modeset)
 {
@@ -658,6 +1488,15 @@ int uterm_drm_video_hotplug(struct uterm_video *video,
 	if (!video_is_awake(video) || !video_need_hotplug(video))
 		return 0;
 
+	/* A hotplug event that names its connector only needs that single
+	 * connector re-checked. Skip the full card scan so plugging one
+	 * monitor does not stall the displays on all others. */
+	if (video->poll_conn) {
+		uterm_drm_hotplug_connector(video, video->poll_conn,
+					    read_dpms, modeset);
+		goto out_rescan;
+	}
+
 	log_debug("testing DRM hotplug status");
 
 	res = drmModeGetResources(vdrm->fd);
@@ -672,7 +1511,10 @@ int uterm_drm_video_hotplug(struct uterm_video *video,
 	}
 
 	for (i = 0; i < res->count_connectors; ++i) {
-		conn = drmModeGetConnector(vdrm->fd, res->connectors[i]);
+		/* read the current kernel state only; forcing a re-probe
+		 * transfers EDIDs and stalls startup for hundreds of ms */
+		conn = drmModeGetConnectorCurrent(vdrm->fd,
+						  res->connectors[i]);
 		if (!conn)
 			continue;
 		if (conn->connection != DRM_MODE_CONNECTED) {
@@ -724,6 +1566,18 @@ int uterm_drm_video_hotplug(struct uterm_video *video,
 			uterm_display_unbind(disp);
 	}
 
+out_rescan:
+	/* displays bound from the cache must be re-validated by a real probe;
+	 * do that from a timer so startup is not stalled */
+	shl_dlist_for_each(iter, &video->displays) {
+		disp = shl_dlist_entry(iter, struct uterm_display, list);
+		ddrm = disp->data;
+		if (ddrm->cached) {
+			uterm_drm_video_arm_probe_timer(video);
+			break;
+		}
+	}
+
 	video->flags &= ~VIDEO_HOTPLUG;
 	return 0;
 }
@@ -28,6 +28,7 @@
 #ifndef UTERM_DRM_SHARED_INTERNAL_H
 #define UTERM_DRM_SHARED_INTERNAL_H
 
+#include <stdbool.h>
 #include <stdlib.h>
 #include <xf86drm.h>
 #include <xf86drmMode.h>
@@ -70,6 +71,27 @@ struct uterm_drm_display {
 	int crtc_id;
 	drmModeCrtc *saved_crtc;
 	void *data;
+	/* mode list restored from the on-disk cache, not yet re-validated */
+	bool cached;
+
+	/* atomic page-flips; 0 if the device has no usable primary plane */
+	uint32_t plane_id;
+	uint32_t prop_fb_id;
+	uint32_t prop_damage;
+
+	/* scanout modifiers the primary plane accepts for XRGB8888; NULL if
+	 * the kernel exposes no IN_FORMATS blob */
+	uint64_t *modifiers;
+	unsigned int modifier_num;
+
+	/* cursor plane; dumb-buffer backed, created on first use */
+	uint32_t cursor_bo;
+	void *cursor_map;
+	uint64_t cursor_size;
+	uint32_t cursor_stride;
+	unsigned int cursor_w;
+	unsigned int cursor_h;
+	bool cursor_enabled;
 };
 
 int uterm_drm_display_init(struct uterm_display *disp, void *data);
@@ -80,6 +102,16 @@ int uterm_drm_display_set_dpms(struct uterm_display *disp, int state);
 int uterm_drm_display_wait_pflip(struct uterm_display *disp);
 int uterm_drm_display_swap(struct uterm_display *disp, uint32_t fb,
 			   bool immediate);
+int uterm_drm_display_swap_damaged(struct uterm_display *disp, uint32_t fb,
+				   bool immediate,
+				   const struct drm_mode_rect *clips,
+				   unsigned int num);
+int uterm_drm_display_flip(struct uterm_display *disp, uint32_t fb,
+			   const struct drm_mode_rect *clips,
+			   unsigned int num);
+int uterm_drm_display_set_cursor(struct uterm_display *disp,
+				 const struct uterm_video_buffer *buf);
+int uterm_drm_display_move_cursor(struct uterm_display *disp, int x, int y);
 
 static inline void *uterm_drm_display_get_data(struct uterm_display *disp)
 {
@@ -94,14 +126,17 @@ typedef void (*uterm_drm_page_flip_t) (struct uterm_display *disp);
 
 struct uterm_drm_video {
 	int fd;
+	bool atomic;
 	struct ev_fd *efd;
 	uterm_drm_page_flip_t page_flip;
 	void *data;
 	struct shl_timer *timer;
 	struct ev_timer *vt_timer;
+	struct ev_timer *probe_timer;
 	const struct display_ops *display_ops;
 };
 
+int uterm_drm_video_prepare(const char *node);
 int uterm_drm_video_init(struct uterm_video *video, const char *node,
 			 const struct display_ops *display_ops,
 			 uterm_drm_page_flip_t pflip, void *data);
@@ -116,6 +151,7 @@ int uterm_drm_video_poll(struct uterm_video *video);
 int uterm_drm_video_wait_pflip(struct uterm_video *video,
 			       unsigned int *mtimeout);
 void uterm_drm_video_arm_vt_timer(struct uterm_video *video);
+void uterm_drm_video_arm_probe_timer(struct uterm_video *video);
 
 static inline void *uterm_drm_video_get_data(struct uterm_video *video)
 {
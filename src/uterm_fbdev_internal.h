@@ -40,6 +40,14 @@ struct fbdev_mode {
 	unsigned int height;
 };
 
+/* number of cached attr->device-pixel luts; must be a power of two */
+#define FBDEV_BLEND_LUT_NUM 64
+
+struct fbdev_blend_lut {
+	uint64_t key;
+	uint32_t pix[256];
+};
+
 struct fbdev_display {
 	int fd;
 	struct fb_fix_screeninfo finfo;
@@ -54,6 +62,21 @@ struct fbdev_display {
 	uint8_t *map;
 	unsigned int stride;
 
+	/* cacheable shadow buffer; damaged rows are streamed to the
+	 * write-combined mapping on swap */
+	uint8_t *shadow;
+	unsigned int dirty_low;
+	unsigned int dirty_high;
+	/* false once a renderer got the raw mapping via get_buffers()
+	 * and renders past the shadow; see display_snapshot() */
+	bool shadow_valid;
+
+	/* true while FBIO_WAITFORVSYNC works; see display_wait_vsync() */
+	bool vsync_wait;
+
+	/* blend luts for non-XRGB32 targets; see fbdev_blend_lut() */
+	struct fbdev_blend_lut *luts;
+
 	bool xrgb32;
 	bool rgb16;
 	unsigned int Bpp;
@@ -79,6 +102,8 @@ int uterm_fbdev_display_blit(struct uterm_display *disp,
 int uterm_fbdev_display_fake_blendv(struct uterm_display *disp,
 				    const struct uterm_video_blend_req *req,
 				    size_t num);
+int uterm_fbdev_display_shift(struct uterm_display *disp,
+			      unsigned int height, int dy);
 int uterm_fbdev_display_fill(struct uterm_display *disp,
 			     uint8_t r, uint8_t g, uint8_t b,
 			     unsigned int x, unsigned int y,
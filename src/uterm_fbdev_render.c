@@ -34,10 +34,26 @@
 #include "shl_log.h"
 #include "uterm_fbdev_internal.h"
 #include "uterm_video.h"
+#include "uterm_video_blend_internal.h"
 #include "uterm_video_internal.h"
 
 #define LOG_SUBSYSTEM "fbdev_render"
 
+/* Rendering always targets the cacheable shadow buffer. The framebuffer
+ * mapping is usually write-combined, where the read-modify-write cycles of
+ * blending run against uncached reads and are catastrophically slow. The
+ * damaged rows are streamed to the device mapping on swap. */
+static uint8_t *fbdev_render_target(struct fbdev_display *fbdev,
+				    unsigned int y, unsigned int height)
+{
+	if (y < fbdev->dirty_low)
+		fbdev->dirty_low = y;
+	if (y + height > fbdev->dirty_high)
+		fbdev->dirty_high = y + height;
+
+	return fbdev->shadow;
+}
+
 static int clamp_value(int val, int low, int up)
 {
 	if (val < low)
@@ -129,10 +145,7 @@ int uterm_fbdev_display_blit(struct uterm_display *disp,
 	else
 		height = buf->height;
 
-	if (!(disp->flags & DISPLAY_DBUF) || fbdev->bufid)
-		dst = fbdev->map;
-	else
-		dst = &fbdev->map[fbdev->yres * fbdev->stride];
+	dst = fbdev_render_target(fbdev, y, height);
 	dst = &dst[y * fbdev->stride + x * fbdev->Bpp];
 	src = buf->data;
 
@@ -167,15 +180,80 @@ int uterm_fbdev_display_blit(struct uterm_display *disp,
 	return 0;
 }
 
+/*
+ * Return a lut that maps an 8bit-grey glyph value directly to the blended
+ * device pixel for the fg/bg colors of @req. Prompt-heavy workloads reuse
+ * the same few dozen attributes millions of times, so caching the 256
+ * possible blend results makes the conversion vanish from the per-pixel
+ * loop. The luts live in a small direct-mapped table; rebuilding one on a
+ * collision costs as much as blending a single glyph.
+ *
+ * The lut is built with plain truncating conversion. The error-diffusion
+ * of xrgb32_to_device() carries state from pixel to pixel which a lut
+ * cannot represent; dropping it for glyph blending only affects smooth
+ * gradients in anti-aliased edges, not the solid colors that dominate
+ * text. Blits and fills keep the dithered path.
+ */
+static const uint32_t *fbdev_blend_lut(struct uterm_display *disp,
+				       const struct uterm_video_blend_req *req)
+{
+	struct fbdev_display *fbdev = disp->data;
+	struct fbdev_blend_lut *lut;
+	uint64_t key;
+	unsigned int i, r, g, b;
+
+	if (!fbdev->luts) {
+		fbdev->luts = calloc(FBDEV_BLEND_LUT_NUM,
+				     sizeof(*fbdev->luts));
+		if (!fbdev->luts)
+			return NULL;
+	}
+
+	/* lowest bit marks the slot valid so black-on-black is not 0 */
+	key = (uint64_t)req->fr << 41 | (uint64_t)req->fg << 33 |
+	      (uint64_t)req->fb << 25 | (uint64_t)req->br << 17 |
+	      (uint64_t)req->bg << 9 | (uint64_t)req->bb << 1 | 1;
+
+	lut = &fbdev->luts[(key * 0x9e3779b97f4a7c15ULL) >> 32 &
+			   (FBDEV_BLEND_LUT_NUM - 1)];
+	if (lut->key == key)
+		return lut->pix;
+
+	for (i = 0; i < 256; ++i) {
+		if (i == 0) {
+			r = req->br;
+			g = req->bg;
+			b = req->bb;
+		} else if (i == 255) {
+			r = req->fr;
+			g = req->fg;
+			b = req->fb;
+		} else {
+			r = (req->fr * i + req->br * (255 - i)) / 256;
+			g = (req->fg * i + req->bg * (255 - i)) / 256;
+			b = (req->fb * i + req->bb * (255 - i)) / 256;
+		}
+
+		lut->pix[i]  = (r >> (8 - fbdev->len_r)) << fbdev->off_r;
+		lut->pix[i] |= (g >> (8 - fbdev->len_g)) << fbdev->off_g;
+		lut->pix[i] |= (b >> (8 - fbdev->len_b)) << fbdev->off_b;
+	}
+	lut->key = key;
+
+	return lut->pix;
+}
+
 int uterm_fbdev_display_fake_blendv(struct uterm_display *disp,
 				    const struct uterm_video_blend_req *req,
 				    size_t num)
 {
 	unsigned int tmp;
 	uint8_t *dst, *src;
-	unsigned int width, height, i, j;
+	unsigned int width, height, i, j, e;
 	unsigned int r, g, b;
+	uint_fast8_t a;
 	uint32_t val;
+	const uint32_t *lut;
 	struct fbdev_display *fbdev = disp->data;
 
 	if (!req)
@@ -204,10 +282,7 @@ int uterm_fbdev_display_fake_blendv(struct uterm_display *disp,
 		else
 			height = req->buf->height;
 
-		if (!(disp->flags & DISPLAY_DBUF) || fbdev->bufid)
-			dst = fbdev->map;
-		else
-			dst = &fbdev->map[fbdev->yres * fbdev->stride];
+		dst = fbdev_render_target(fbdev, req->y, height);
 		dst = &dst[req->y * fbdev->stride + req->x * fbdev->Bpp];
 		src = req->buf->data;
 
@@ -216,29 +291,55 @@ int uterm_fbdev_display_fake_blendv(struct uterm_display *disp,
 		 * Downside is, full white is 254/254/254
 		 * instead of 255/255/255. */
 		if (fbdev->xrgb32) {
+			uterm_video_blend_xrgb32(dst, fbdev->stride,
+					src, req->buf->stride,
+					width, height,
+					((uint_fast32_t)req->fr << 16) |
+						(req->fg << 8) | req->fb,
+					((uint_fast32_t)req->br << 16) |
+						(req->bg << 8) | req->bb);
+		} else if (fbdev->Bpp == 2 &&
+			   (lut = fbdev_blend_lut(disp, req))) {
+			/* Glyph buffers are dominated by runs of fully
+			 * transparent or fully opaque pixels; fill those
+			 * with the constant pixel instead of chasing the
+			 * lut, like the shared xrgb32 kernels do. */
 			while (height--) {
-				for (i = 0; i < width; ++i) {
-					if (src[i] == 0) {
-						r = req->br;
-						g = req->bg;
-						b = req->bb;
-					} else if (src[i] == 255) {
-						r = req->fr;
-						g = req->fg;
-						b = req->fb;
-					} else {
-						r = req->fr * src[i] +
-						    req->br * (255 - src[i]);
-						r /= 256;
-						g = req->fg * src[i] +
-						    req->bg * (255 - src[i]);
-						g /= 256;
-						b = req->fb * src[i] +
-						    req->bb * (255 - src[i]);
-						b /= 256;
+				for (i = 0; i < width; ) {
+					a = src[i];
+					if (a == 0 || a == 255) {
+						val = lut[a];
+						for (e = i + 1; e < width; ++e)
+							if (src[e] != a)
+								break;
+						while (i < e)
+							((uint16_t*)dst)[i++] =
+									val;
+						continue;
 					}
-					val = (r << 16) | (g << 8) | b;
-					((uint32_t*)dst)[i] = val;
+					((uint16_t*)dst)[i] = lut[a];
+					++i;
+				}
+				dst += fbdev->stride;
+				src += req->buf->stride;
+			}
+		} else if (fbdev->Bpp == 4 &&
+			   (lut = fbdev_blend_lut(disp, req))) {
+			while (height--) {
+				for (i = 0; i < width; ) {
+					a = src[i];
+					if (a == 0 || a == 255) {
+						val = lut[a];
+						for (e = i + 1; e < width; ++e)
+							if (src[e] != a)
+								break;
+						while (i < e)
+							((uint32_t*)dst)[i++] =
+									val;
+						continue;
+					}
+					((uint32_t*)dst)[i] = lut[a];
+					++i;
 				}
 				dst += fbdev->stride;
 				src += req->buf->stride;
@@ -309,6 +410,34 @@ int uterm_fbdev_display_fake_blendv(struct uterm_display *disp,
 	return 0;
 }
 
+int uterm_fbdev_display_shift(struct uterm_display *disp,
+			      unsigned int height, int dy)
+{
+	uint8_t *dst;
+	unsigned int adiff;
+	struct fbdev_display *fbdev = disp->data;
+
+	if (height > fbdev->yres)
+		height = fbdev->yres;
+
+	adiff = (dy < 0) ? -dy : dy;
+	if (!adiff)
+		return 0;
+	if (adiff >= height)
+		return -EINVAL;
+
+	dst = fbdev_render_target(fbdev, 0, height);
+
+	if (dy > 0)
+		memmove(dst, &dst[adiff * fbdev->stride],
+			(height - adiff) * fbdev->stride);
+	else
+		memmove(&dst[adiff * fbdev->stride], dst,
+			(height - adiff) * fbdev->stride);
+
+	return 0;
+}
+
 int uterm_fbdev_display_fill(struct uterm_display *disp,
 			     uint8_t r, uint8_t g, uint8_t b,
 			     unsigned int x, unsigned int y,
@@ -330,10 +459,7 @@ int uterm_fbdev_display_fill(struct uterm_display *disp,
 	if (tmp > fbdev->yres)
 		height = fbdev->yres - y;
 
-	if (!(disp->flags & DISPLAY_DBUF) || fbdev->bufid)
-		dst = fbdev->map;
-	else
-		dst = &fbdev->map[fbdev->yres * fbdev->stride];
+	dst = fbdev_render_target(fbdev, y, height);
 	dst = &dst[y * fbdev->stride + x * fbdev->Bpp];
 
 	full_val  = ((r & 0xff) >> (8 - fbdev->len_r)) << fbdev->off_r;
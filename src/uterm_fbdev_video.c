@@ -308,11 +308,25 @@ static int display_activate_force(struct uterm_display *disp,
 	}
 
 	memset(dfb->map, 0, len);
+
+	dfb->shadow = malloc(finfo->line_length * vinfo->yres);
+	if (!dfb->shadow) {
+		ret = -ENOMEM;
+		goto err_map;
+	}
+	memset(dfb->shadow, 0, finfo->line_length * vinfo->yres);
+	dfb->dirty_low = vinfo->yres;
+	dfb->dirty_high = 0;
+	/* everything is black after the mode-set, including the shadow */
+	dfb->shadow_valid = true;
+
 	dfb->xres = vinfo->xres;
 	dfb->yres = vinfo->yres;
 	dfb->len = len;
 	dfb->stride = finfo->line_length;
 	dfb->bufid = 0;
+	/* optimistic; the first failing wait disables it */
+	dfb->vsync_wait = true;
 	dfb->Bpp = vinfo->bits_per_pixel / 8;
 	dfb->off_r = vinfo->red.offset;
 	dfb->len_r = vinfo->red.length;
@@ -360,6 +374,8 @@ static int display_activate_force(struct uterm_display *disp,
 	return 0;
 
 err_map:
+	free(dfb->shadow);
+	dfb->shadow = NULL;
 	munmap(dfb->map, dfb->len);
 err_close:
 	close(dfb->fd);
@@ -382,6 +398,10 @@ static void display_deactivate_force(struct uterm_display *disp, bool force)
 		munmap(dfb->map, dfb->len);
 		close(dfb->fd);
 		dfb->map = NULL;
+		free(dfb->shadow);
+		dfb->shadow = NULL;
+		free(dfb->luts);
+		dfb->luts = NULL;
 	}
 	if (!force) {
 		uterm_mode_unbind(disp->current_mode);
@@ -444,6 +464,11 @@ static int display_use(struct uterm_display *disp, bool *opengl)
 	return dfb->bufid ^ 1;
 }
 
+static unsigned int display_get_bufs(struct uterm_display *disp)
+{
+	return (disp->flags & DISPLAY_DBUF) ? 2 : 1;
+}
+
 static int display_get_buffers(struct uterm_display *disp,
 			       struct uterm_video_buffer *buffer,
 			       unsigned int formats)
@@ -470,15 +495,103 @@ static int display_get_buffers(struct uterm_display *disp,
 			buffer[i].data = &dfb->map[dfb->yres * dfb->stride];
 	}
 
+	/* the renderer writes the mapping directly from now on; the
+	 * shadow no longer tracks the newest frame */
+	dfb->shadow_valid = false;
+
+	return 0;
+}
+
+/* Export the newest complete frame from the cacheable shadow buffer. The
+ * device mapping itself is often unreadable or painfully slow to read, so
+ * only XRGB32 setups with a shadow support snapshots. A renderer that
+ * writes the mapping directly leaves the shadow stale; unlike drm2d there
+ * is no readable fallback, so report no support then. */
+static int display_snapshot(struct uterm_display *disp,
+			    struct uterm_video_buffer *buffer)
+{
+	struct fbdev_display *dfb = disp->data;
+
+	if (!dfb->xrgb32 || !dfb->shadow || !dfb->shadow_valid)
+		return -EOPNOTSUPP;
+
+	buffer->width = dfb->xres;
+	buffer->height = dfb->yres;
+	buffer->stride = dfb->stride;
+	buffer->format = UTERM_FORMAT_XRGB32;
+	buffer->data = dfb->shadow;
+
 	return 0;
 }
 
+/* Stream the damaged shadow rows to the device mapping. memcpy() uses wide
+ * aligned stores that combine well on WC memory and never reads back from
+ * the device. Renderers using uterm_display_get_buffers() write to the
+ * mapping directly and leave the shadow clean, so this is a no-op for them. */
+static void display_flush_shadow(struct uterm_display *disp)
+{
+	struct fbdev_display *dfb = disp->data;
+	unsigned int low, high;
+	uint8_t *dst;
+
+	if (!dfb->shadow || dfb->dirty_low >= dfb->dirty_high)
+		return;
+
+	low = dfb->dirty_low;
+	high = dfb->dirty_high;
+	if (high > dfb->yres)
+		high = dfb->yres;
+
+	if (!(disp->flags & DISPLAY_DBUF) || dfb->bufid)
+		dst = dfb->map;
+	else
+		dst = &dfb->map[dfb->yres * dfb->stride];
+
+	memcpy(&dst[low * dfb->stride], &dfb->shadow[low * dfb->stride],
+	       (high - low) * dfb->stride);
+
+	dfb->dirty_low = dfb->yres;
+	dfb->dirty_high = 0;
+}
+
+#ifndef FBIO_WAITFORVSYNC
+#define FBIO_WAITFORVSYNC _IOW('F', 0x20, uint32_t)
+#endif
+
+/* Block until the next vertical blanking period so the following pan or
+ * shadow flush never hits an active scanout. Not all drivers implement the
+ * ioctl; the first failure disables it for good and leaves only the timer
+ * pacing estimated from the fb_var timings. The wait is bounded by one
+ * refresh and the vblank timer already limits us to one swap per refresh,
+ * so most of that interval was spent sleeping in the event loop anyway. */
+static void display_wait_vsync(struct uterm_display *disp)
+{
+	struct fbdev_display *dfb = disp->data;
+	uint32_t arg = 0;
+	int ret;
+
+	if (!dfb->vsync_wait)
+		return;
+
+	ret = ioctl(dfb->fd, FBIO_WAITFORVSYNC, &arg);
+	if (ret) {
+		log_debug("no FBIO_WAITFORVSYNC on %s (%d): %m, timer pacing only",
+			  dfb->node, errno);
+		dfb->vsync_wait = false;
+	}
+}
+
 static int display_swap(struct uterm_display *disp, bool immediate)
 {
 	struct fbdev_display *dfb = disp->data;
 	struct fb_var_screeninfo *vinfo;
 	int ret;
 
+	if (!immediate)
+		display_wait_vsync(disp);
+
+	display_flush_shadow(disp);
+
 	if (!(disp->flags & DISPLAY_DBUF)) {
 		if (immediate)
 			return 0;
@@ -514,11 +627,14 @@ static const struct display_ops fbdev_display_ops = {
 	.deactivate = display_deactivate,
 	.set_dpms = display_set_dpms,
 	.use = display_use,
+	.get_bufs = display_get_bufs,
 	.get_buffers = display_get_buffers,
 	.swap = display_swap,
+	.snapshot = display_snapshot,
 	.blit = uterm_fbdev_display_blit,
 	.fake_blendv = uterm_fbdev_display_fake_blendv,
 	.fill = uterm_fbdev_display_fill,
+	.shift = uterm_fbdev_display_shift,
 };
 
 static void intro_idle_event(struct ev_eloop *eloop, void *unused, void *data)
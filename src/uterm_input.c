@@ -51,23 +51,12 @@
 
 static void input_free_dev(struct uterm_input_dev *dev);
 
-static void notify_key(struct uterm_input_dev *dev,
-			uint16_t type,
-			uint16_t code,
-			int32_t value)
-{
-	if (type != EV_KEY)
-		return;
-
-	uxkb_dev_process(dev, value, code);
-}
-
 static void input_data_dev(struct ev_fd *fd, int mask, void *data)
 {
 	struct uterm_input_dev *dev = data;
-	struct input_event ev[16];
-	ssize_t len, n;
-	int i;
+	struct input_event *ev = dev->ev_buf;
+	size_t size = dev->ev_buf_num * sizeof(*ev);
+	ssize_t len;
 
 	if (mask & (EV_HUP | EV_ERR)) {
 		llog_debug(dev->input, "EOF on %s", dev->node);
@@ -75,37 +64,53 @@ static void input_data_dev(struct ev_fd *fd, int mask, void *data)
 		return;
 	}
 
-	len = sizeof(ev);
-	while (len == sizeof(ev)) {
-		len = read(dev->rfd, &ev, sizeof(ev));
+	/* Bursty devices deliver more events than fit into one batch, so
+	 * drain the fd until it runs dry before going back to epoll. Each
+	 * batch goes through uxkb as one group. */
+	while (true) {
+		len = read(dev->rfd, ev, size);
 		if (len < 0) {
+			if (errno == EINTR)
+				continue;
 			if (errno == EWOULDBLOCK)
 				break;
 			llog_warn(dev->input, "reading from %s failed (%d): %m",
 				  dev->node, errno);
 			input_free_dev(dev);
+			return;
 		} else if (len == 0) {
 			llog_debug(dev->input, "EOF on %s", dev->node);
 			input_free_dev(dev);
+			return;
 		} else if (len % sizeof(*ev)) {
 			llog_warn(dev->input, "invalid input_event on %s",
 				  dev->node);
 		} else {
-			n = len / sizeof(*ev);
-			for (i = 0; i < n; i++)
-				notify_key(dev, ev[i].type, ev[i].code,
-								ev[i].value);
+			uxkb_dev_process_group(dev, ev, len / sizeof(*ev));
+			/* a short batch means the queue is empty */
+			if ((size_t)len < size)
+				break;
 		}
 	}
 }
 
 static int input_wake_up_dev(struct uterm_input_dev *dev)
 {
+	struct input_event *buf;
 	int ret;
 
 	if (dev->rfd >= 0)
 		return 0;
 
+	if (dev->ev_buf_num != dev->input->batch_size) {
+		buf = realloc(dev->ev_buf,
+			      dev->input->batch_size * sizeof(*buf));
+		if (!buf)
+			return -ENOMEM;
+		dev->ev_buf = buf;
+		dev->ev_buf_num = dev->input->batch_size;
+	}
+
 	dev->rfd = open(dev->node, O_CLOEXEC | O_NONBLOCK | O_RDWR);
 	if (dev->rfd < 0) {
 		llog_warn(dev->input, "cannot open device %s (%d): %m",
@@ -123,6 +128,9 @@ static int input_wake_up_dev(struct uterm_input_dev *dev)
 		return ret;
 	}
 
+	/* keystrokes must not queue behind PTY floods */
+	ev_fd_set_priority(dev->fd, EV_PRIO_HIGH);
+
 	return 0;
 }
 
@@ -160,23 +168,13 @@ static void input_new_dev(struct uterm_input *input,
 	if (!dev->node)
 		goto err_free;
 
-	dev->num_syms = 1;
-	dev->event.keysyms = malloc(sizeof(uint32_t) * dev->num_syms);
-	if (!dev->event.keysyms)
-		goto err_node;
-	dev->event.codepoints = malloc(sizeof(uint32_t) * dev->num_syms);
-	if (!dev->event.codepoints)
-		goto err_syms;
-	dev->repeat_event.keysyms = malloc(sizeof(uint32_t) * dev->num_syms);
-	if (!dev->repeat_event.keysyms)
-		goto err_codepoints;
-	dev->repeat_event.codepoints = malloc(sizeof(uint32_t) * dev->num_syms);
-	if (!dev->repeat_event.codepoints)
-		goto err_rsyms;
+	dev->num_syms = UTERM_INPUT_INLINE_SYMS;
+	uterm_input_event_init(&dev->event);
+	uterm_input_event_init(&dev->repeat_event);
 
 	ret = uxkb_dev_init(dev);
 	if (ret)
-		goto err_rcodepoints;
+		goto err_node;
 
 	if (input->awake > 0) {
 		ret = input_wake_up_dev(dev);
@@ -190,14 +188,6 @@ static void input_new_dev(struct uterm_input *input,
 
 err_kbd:
 	uxkb_dev_destroy(dev);
-err_rcodepoints:
-	free(dev->repeat_event.codepoints);
-err_rsyms:
-	free(dev->repeat_event.keysyms);
-err_codepoints:
-	free(dev->event.codepoints);
-err_syms:
-	free(dev->event.keysyms);
 err_node:
 	free(dev->node);
 err_free:
@@ -210,10 +200,9 @@ static void input_free_dev(struct uterm_input_dev *dev)
 	input_sleep_dev(dev);
 	shl_dlist_unlink(&dev->list);
 	uxkb_dev_destroy(dev);
-	free(dev->repeat_event.codepoints);
-	free(dev->repeat_event.keysyms);
-	free(dev->event.codepoints);
-	free(dev->event.keysyms);
+	uterm_input_event_destroy(&dev->repeat_event);
+	uterm_input_event_destroy(&dev->event);
+	free(dev->ev_buf);
 	free(dev->node);
 	free(dev);
 }
@@ -256,6 +245,7 @@ int uterm_input_new(struct uterm_input **out,
 	input->eloop = eloop;
 	input->repeat_delay = repeat_delay;
 	input->repeat_rate = repeat_rate;
+	input->batch_size = UTERM_INPUT_DEFAULT_BATCH;
 	shl_dlist_init(&input->devices);
 
 	ret = shl_hook_new(&input->hook);
@@ -401,6 +391,19 @@ void uterm_input_remove_dev(struct uterm_input *input, const char *node)
 	}
 }
 
+SHL_EXPORT
+void uterm_input_set_batch_size(struct uterm_input *input, unsigned int num)
+{
+	if (!input)
+		return;
+
+	if (!num)
+		num = UTERM_INPUT_DEFAULT_BATCH;
+
+	/* devices pick the new size up when they are (re)opened */
+	input->batch_size = num;
+}
+
 SHL_EXPORT
 int uterm_input_register_cb(struct uterm_input *input,
 				uterm_input_cb cb,
@@ -61,6 +61,10 @@ enum uterm_input_modifier {
 /* keep in sync with TSM_VTE_INVALID */
 #define UTERM_INPUT_INVALID 0xffffffff
 
+/* sym capacity of the inline event buffers; nearly all events carry a
+ * single keysym, bigger events fall back to heap buffers */
+#define UTERM_INPUT_INLINE_SYMS 8
+
 struct uterm_input_event {
 	bool handled;		/* user-controlled, default is false */
 	uint16_t keycode;	/* linux keycode - KEY_* - linux/input.h */
@@ -70,6 +74,11 @@ struct uterm_input_event {
 	unsigned int num_syms;	/* number of keysyms */
 	uint32_t *keysyms;	/* XKB-common keysym-array - XKB_KEY_* */
 	uint32_t *codepoints;	/* ucs4 unicode value or UTERM_INPUT_INVALID */
+
+	/* @keysyms/@codepoints point here unless the event overflowed the
+	 * inline capacity; do not touch directly */
+	uint32_t inline_syms[UTERM_INPUT_INLINE_SYMS];
+	uint32_t inline_codepoints[UTERM_INPUT_INLINE_SYMS];
 };
 
 #define UTERM_INPUT_HAS_MODS(_ev, _mods) (((_ev)->mods & (_mods)) == (_mods))
@@ -89,6 +98,11 @@ void uterm_input_unref(struct uterm_input *input);
 void uterm_input_add_dev(struct uterm_input *input, const char *node);
 void uterm_input_remove_dev(struct uterm_input *input, const char *node);
 
+/* Set how many evdev events are read per syscall while draining a device.
+ * Bursty devices like barcode scanners benefit from bigger batches. Takes
+ * effect when devices are (re)opened; 0 restores the default. */
+void uterm_input_set_batch_size(struct uterm_input *input, unsigned int num);
+
 int uterm_input_register_cb(struct uterm_input *input, uterm_input_cb cb,
 			    void *data);
 void uterm_input_unregister_cb(struct uterm_input *input, uterm_input_cb cb,
@@ -30,6 +30,7 @@
 
 #include <inttypes.h>
 #include <limits.h>
+#include <linux/input.h>
 #include <stdbool.h>
 #include <stdlib.h>
 #include <xkbcommon/xkbcommon-keysyms.h>
@@ -44,6 +45,9 @@ enum uterm_input_device_capability {
 	UTERM_DEVICE_HAS_LEDS = (1 << 1),
 };
 
+/* default number of input_events read per syscall while draining a device */
+#define UTERM_INPUT_DEFAULT_BATCH 64
+
 struct uterm_input_dev {
 	struct shl_dlist list;
 	struct uterm_input *input;
@@ -52,6 +56,9 @@ struct uterm_input_dev {
 	int rfd;
 	char *node;
 	struct ev_fd *fd;
+	/* read buffer for evdev batches, sized to input->batch_size */
+	struct input_event *ev_buf;
+	unsigned int ev_buf_num;
 	struct xkb_state *state;
 	/* Used in sleep/wake up to store the key's pressed/released state. */
 	char key_state_bits[SHL_DIV_ROUND_UP(KEY_CNT, CHAR_BIT)];
@@ -72,10 +79,13 @@ struct uterm_input {
 	int awake;
 	unsigned int repeat_rate;
 	unsigned int repeat_delay;
+	unsigned int batch_size;
 
 	struct shl_hook *hook;
 	struct xkb_context *ctx;
 	struct xkb_keymap *keymap;
+	/* entry of the shared keymap cache or NULL */
+	struct uxkb_keymap *cached;
 
 	struct shl_dlist devices;
 };
@@ -93,11 +103,25 @@ int uxkb_desc_init(struct uterm_input *input,
 		   const char *keymap);
 void uxkb_desc_destroy(struct uterm_input *input);
 
+static inline void uterm_input_event_init(struct uterm_input_event *ev)
+{
+	ev->keysyms = ev->inline_syms;
+	ev->codepoints = ev->inline_codepoints;
+}
+
+static inline void uterm_input_event_destroy(struct uterm_input_event *ev)
+{
+	if (ev->keysyms != ev->inline_syms)
+		free(ev->keysyms);
+	if (ev->codepoints != ev->inline_codepoints)
+		free(ev->codepoints);
+}
+
 int uxkb_dev_init(struct uterm_input_dev *dev);
 void uxkb_dev_destroy(struct uterm_input_dev *dev);
-int uxkb_dev_process(struct uterm_input_dev *dev,
-		     uint16_t key_state,
-		     uint16_t code);
+void uxkb_dev_process_group(struct uterm_input_dev *dev,
+			    const struct input_event *ev,
+			    size_t num);
 void uxkb_dev_sleep(struct uterm_input_dev *dev);
 void uxkb_dev_wake_up(struct uterm_input_dev *dev);
 
@@ -25,13 +25,17 @@
  */
 
 #include <errno.h>
+#include <fcntl.h>
 #include <inttypes.h>
 #include <linux/input.h>
 #include <stdbool.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #include <xkbcommon/xkbcommon.h>
+#include "shl_dlist.h"
 #include "shl_hook.h"
 #include "shl_llog.h"
 #include "shl_misc.h"
@@ -80,6 +84,294 @@ static void uxkb_log(struct xkb_context *context, enum xkb_log_level level,
 		    args);
 }
 
+/*
+ * Keymap cache
+ * Compiling a keymap from RMLVO is by far the most expensive part of input
+ * initialization. Keymaps are immutable, so all input objects with the same
+ * description share a single compiled keymap via this process-wide cache.
+ * Freshly compiled keymaps are additionally serialized into a cache
+ * directory; on the next boot the pre-compiled keymap is parsed directly and
+ * the whole XKB rule evaluation is skipped. A serialized keymap that is
+ * older than the system XKB data is discarded and recompiled, so updates of
+ * xkeyboard-config reach the user on the next start.
+ * Input objects are only used on the main thread, hence no locking.
+ */
+
+struct uxkb_keymap {
+	struct shl_dlist list;
+	unsigned long ref;
+	char *key;
+	struct xkb_keymap *keymap;
+};
+
+static struct shl_dlist uxkb_keymaps = SHL_DLIST_INIT(uxkb_keymaps);
+
+#define UXKB_CACHE_DIR "/var/cache/kmscon"
+#define UXKB_DATA_DIR "/usr/share/X11/xkb"
+
+/* Newest mtime below the system XKB data root. A package update replaces
+ * files in the per-type subdirectories, which bumps the mtime of the
+ * directory they live in; checking the handful of subdirectories catches
+ * that without walking the whole tree. */
+static time_t uxkb_data_mtime(void)
+{
+	static const char *dirs[] = {
+		"", "/rules", "/keycodes", "/compat", "/symbols", "/types",
+	};
+	char path[sizeof(UXKB_DATA_DIR) + 16];
+	struct stat st;
+	time_t newest = 0;
+	unsigned int i;
+
+	for (i = 0; i < sizeof(dirs) / sizeof(*dirs); ++i) {
+		snprintf(path, sizeof(path), "%s%s", UXKB_DATA_DIR, dirs[i]);
+		if (!stat(path, &st) && st.st_mtime > newest)
+			newest = st.st_mtime;
+	}
+
+	return newest;
+}
+
+static char *uxkb_keymap_key(const char *model, const char *layout,
+			     const char *variant, const char *options)
+{
+	char *key;
+	int ret;
+
+	ret = asprintf(&key, "%s|%s|%s|%s", model ? : "", layout ? : "",
+		       variant ? : "", options ? : "");
+	if (ret < 0)
+		return NULL;
+
+	return key;
+}
+
+static char *uxkb_keymap_path(const char *key)
+{
+	unsigned int h1 = 5381, h2 = 0;
+	const char *p;
+	char *path;
+	int ret;
+
+	/* two independent string hashes; the chance that two different
+	 * descriptions collide in both is negligible */
+	for (p = key; *p; ++p) {
+		h1 = h1 * 33 + (unsigned char)*p;
+		h2 = (unsigned char)*p + (h2 << 6) + (h2 << 16) - h2;
+	}
+
+	ret = asprintf(&path, "%s/keymap-%08x%08x.xkb", UXKB_CACHE_DIR,
+		       h1, h2);
+	if (ret < 0)
+		return NULL;
+
+	return path;
+}
+
+static struct xkb_keymap *uxkb_keymap_load(struct uterm_input *input,
+					   const char *path)
+{
+	struct xkb_keymap *keymap;
+	struct stat st;
+	char *buf;
+	int fd, ret;
+
+	fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return NULL;
+
+	ret = fstat(fd, &st);
+	if (ret || !st.st_size) {
+		close(fd);
+		return NULL;
+	}
+
+	/* the cache must be newer than the data it was compiled from */
+	if (st.st_mtime <= uxkb_data_mtime()) {
+		close(fd);
+		llog_debug(input, "cached keymap %s is older than the XKB data, removing",
+			   path);
+		unlink(path);
+		return NULL;
+	}
+
+	buf = malloc(st.st_size + 1);
+	if (!buf) {
+		close(fd);
+		return NULL;
+	}
+
+	ret = read(fd, buf, st.st_size);
+	close(fd);
+	if (ret != st.st_size) {
+		free(buf);
+		return NULL;
+	}
+	buf[st.st_size] = 0;
+
+	keymap = xkb_keymap_new_from_string(input->ctx, buf,
+					    XKB_KEYMAP_FORMAT_TEXT_V1, 0);
+	free(buf);
+	if (!keymap) {
+		/* drop corrupt cache files so they are recompiled */
+		llog_warning(input, "cannot parse cached keymap %s, removing",
+			     path);
+		unlink(path);
+		return NULL;
+	}
+
+	llog_debug(input, "new keyboard description from cache %s", path);
+	return keymap;
+}
+
+static void uxkb_keymap_save(struct uterm_input *input, const char *path,
+			     struct xkb_keymap *keymap)
+{
+	char *str, *tmp;
+	size_t len;
+	int fd, ret;
+
+	str = xkb_keymap_get_as_string(keymap, XKB_KEYMAP_FORMAT_TEXT_V1);
+	if (!str)
+		return;
+
+	ret = mkdir(UXKB_CACHE_DIR, 0755);
+	if (ret && errno != EEXIST)
+		goto out_str;
+
+	ret = asprintf(&tmp, "%s.tmp", path);
+	if (ret < 0)
+		goto out_str;
+
+	fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+	if (fd < 0)
+		goto out_tmp;
+
+	len = strlen(str);
+	ret = write(fd, str, len);
+	close(fd);
+	if (ret != (int)len) {
+		unlink(tmp);
+		goto out_tmp;
+	}
+
+	ret = rename(tmp, path);
+	if (ret)
+		unlink(tmp);
+	else
+		llog_debug(input, "serialized keymap to cache %s", path);
+
+out_tmp:
+	free(tmp);
+out_str:
+	free(str);
+}
+
+static struct uxkb_keymap *uxkb_keymap_new(const char *key,
+					   struct xkb_keymap *keymap)
+{
+	struct uxkb_keymap *entry;
+
+	entry = malloc(sizeof(*entry));
+	if (!entry)
+		return NULL;
+
+	memset(entry, 0, sizeof(*entry));
+	entry->ref = 1;
+	entry->keymap = xkb_keymap_ref(keymap);
+
+	entry->key = strdup(key);
+	if (!entry->key) {
+		xkb_keymap_unref(entry->keymap);
+		free(entry);
+		return NULL;
+	}
+
+	shl_dlist_link_tail(&uxkb_keymaps, &entry->list);
+	return entry;
+}
+
+static void uxkb_keymap_unref(struct uxkb_keymap *entry)
+{
+	if (!entry || !entry->ref || --entry->ref)
+		return;
+
+	shl_dlist_unlink(&entry->list);
+	xkb_keymap_unref(entry->keymap);
+	free(entry->key);
+	free(entry);
+}
+
+/* Look the description up in the shared cache and the on-disk cache. On
+ * success, @input->keymap and @input->cached are set. */
+static int uxkb_keymap_lookup(struct uterm_input *input,
+			      const char *model, const char *layout,
+			      const char *variant, const char *options)
+{
+	struct uxkb_keymap *entry;
+	struct xkb_keymap *keymap;
+	struct shl_dlist *iter;
+	char *key, *path;
+	int ret = -ENOENT;
+
+	key = uxkb_keymap_key(model, layout, variant, options);
+	if (!key)
+		return -ENOMEM;
+
+	shl_dlist_for_each(iter, &uxkb_keymaps) {
+		entry = shl_dlist_entry(iter, struct uxkb_keymap, list);
+		if (strcmp(entry->key, key))
+			continue;
+
+		++entry->ref;
+		input->keymap = xkb_keymap_ref(entry->keymap);
+		input->cached = entry;
+		llog_debug(input, "new keyboard description from shared keymap");
+		ret = 0;
+		goto out_key;
+	}
+
+	path = uxkb_keymap_path(key);
+	if (!path)
+		goto out_key;
+
+	keymap = uxkb_keymap_load(input, path);
+	free(path);
+	if (!keymap)
+		goto out_key;
+
+	input->keymap = keymap;
+	input->cached = uxkb_keymap_new(key, keymap);
+	ret = 0;
+
+out_key:
+	free(key);
+	return ret;
+}
+
+/* Share a freshly compiled @input->keymap with other input objects and
+ * serialize it to disk for the next boot. */
+static void uxkb_keymap_store(struct uterm_input *input,
+			      const char *model, const char *layout,
+			      const char *variant, const char *options)
+{
+	char *key, *path;
+
+	key = uxkb_keymap_key(model, layout, variant, options);
+	if (!key)
+		return;
+
+	input->cached = uxkb_keymap_new(key, input->keymap);
+
+	path = uxkb_keymap_path(key);
+	if (path) {
+		uxkb_keymap_save(input, path, input->keymap);
+		free(path);
+	}
+
+	free(key);
+}
+
 int uxkb_desc_init(struct uterm_input *input,
 		   const char *model,
 		   const char *layout,
@@ -124,6 +416,10 @@ int uxkb_desc_init(struct uterm_input *input,
 		llog_warn(input, "cannot parse keymap, reverting to rmlvo");
 	}
 
+	ret = uxkb_keymap_lookup(input, model, layout, variant, options);
+	if (!ret)
+		return 0;
+
 	input->keymap = xkb_keymap_new_from_names(input->ctx, &rmlvo, 0);
 	if (!input->keymap) {
 		llog_warn(input, "failed to create keymap (%s, %s, %s, %s), "
@@ -155,6 +451,10 @@ int uxkb_desc_init(struct uterm_input *input,
 	} else {
 		llog_debug(input, "new keyboard description (%s, %s, %s, %s)",
 			   model, layout, variant, options);
+
+		/* share the result; fallback keymaps indicate a broken
+		 * configuration and are not worth caching */
+		uxkb_keymap_store(input, model, layout, variant, options);
 	}
 
 	return 0;
@@ -166,6 +466,7 @@ err_ctx:
 
 void uxkb_desc_destroy(struct uterm_input *input)
 {
+	uxkb_keymap_unref(input->cached);
 	xkb_keymap_unref(input->keymap);
 	xkb_context_unref(input->ctx);
 }
@@ -246,46 +547,57 @@ static void uxkb_dev_update_keyboard_leds(struct uterm_input_dev *dev)
 			     errno);
 }
 
-static inline int uxkb_dev_resize_event(struct uterm_input_dev *dev, size_t s)
+static int uxkb_dev_resize_buf(struct uterm_input_dev *dev, uint32_t **buf,
+			       uint32_t *inline_buf, size_t s)
 {
 	uint32_t *tmp;
 
+	if (*buf == inline_buf) {
+		tmp = malloc(sizeof(uint32_t) * s);
+		if (tmp)
+			memcpy(tmp, inline_buf,
+			       sizeof(uint32_t) * UTERM_INPUT_INLINE_SYMS);
+	} else {
+		tmp = realloc(*buf, sizeof(uint32_t) * s);
+	}
+
+	if (!tmp) {
+		llog_warning(dev->input, "cannot reallocate keysym buffer");
+		return -ENOKEY;
+	}
+
+	*buf = tmp;
+	return 0;
+}
+
+/* The events use their fixed-capacity inline buffers by default so the
+ * key-press hot path never allocates; only events with more keysyms than
+ * UTERM_INPUT_INLINE_SYMS fall back to heap buffers. */
+static inline int uxkb_dev_resize_event(struct uterm_input_dev *dev, size_t s)
+{
+	int ret;
+
 	if (s > dev->num_syms) {
-		tmp = realloc(dev->event.keysyms,
-			      sizeof(uint32_t) * s);
-		if (!tmp) {
-			llog_warning(dev->input,
-				     "cannot reallocate keysym buffer");
-			return -ENOKEY;
-		}
-		dev->event.keysyms = tmp;
-
-		tmp = realloc(dev->event.codepoints,
-			      sizeof(uint32_t) * s);
-		if (!tmp) {
-			llog_warning(dev->input,
-				     "cannot reallocate codepoints buffer");
-			return -ENOKEY;
-		}
-		dev->event.codepoints = tmp;
-
-		tmp = realloc(dev->repeat_event.keysyms,
-			      sizeof(uint32_t) * s);
-		if (!tmp) {
-			llog_warning(dev->input,
-				     "cannot reallocate keysym buffer");
-			return -ENOKEY;
-		}
-		dev->repeat_event.keysyms = tmp;
-
-		tmp = realloc(dev->repeat_event.codepoints,
-			      sizeof(uint32_t) * s);
-		if (!tmp) {
-			llog_warning(dev->input,
-				     "cannot reallocate codepoints buffer");
-			return -ENOKEY;
-		}
-		dev->repeat_event.codepoints = tmp;
+		ret = uxkb_dev_resize_buf(dev, &dev->event.keysyms,
+					  dev->event.inline_syms, s);
+		if (ret)
+			return ret;
+
+		ret = uxkb_dev_resize_buf(dev, &dev->event.codepoints,
+					  dev->event.inline_codepoints, s);
+		if (ret)
+			return ret;
+
+		ret = uxkb_dev_resize_buf(dev, &dev->repeat_event.keysyms,
+					  dev->repeat_event.inline_syms, s);
+		if (ret)
+			return ret;
+
+		ret = uxkb_dev_resize_buf(dev, &dev->repeat_event.codepoints,
+					  dev->repeat_event.inline_codepoints,
+					  s);
+		if (ret)
+			return ret;
 
 		dev->num_syms = s;
 	}
@@ -375,8 +687,9 @@ static void uxkb_dev_repeat(struct uterm_input_dev *dev, unsigned int state)
 	ev_timer_update(dev->repeat_timer, &spec);
 }
 
-int uxkb_dev_process(struct uterm_input_dev *dev,
-		     uint16_t key_state, uint16_t code)
+static void uxkb_dev_process_key(struct uterm_input_dev *dev,
+				 uint16_t key_state, uint16_t code,
+				 bool *leds_dirty)
 {
 	struct xkb_state *state;
 	xkb_keycode_t keycode;
@@ -385,7 +698,7 @@ int uxkb_dev_process(struct uterm_input_dev *dev,
 	enum xkb_state_component changed;
 
 	if (key_state == KEY_REPEATED)
-		return -ENOKEY;
+		return;
 
 	state = dev->state;
 	keycode = code + EVDEV_KEYCODE_OFFSET;
@@ -399,25 +712,44 @@ int uxkb_dev_process(struct uterm_input_dev *dev,
 		changed = xkb_state_update_key(state, keycode, XKB_KEY_UP);
 
 	if (changed & XKB_STATE_LEDS)
-		uxkb_dev_update_keyboard_leds(dev);
+		*leds_dirty = true;
 
 	if (num_keysyms <= 0)
-		return -ENOKEY;
+		return;
 
 	ret = uxkb_dev_fill_event(dev, &dev->event, keycode, num_keysyms,
 				  keysyms);
 	if (ret)
-		return -ENOKEY;
+		return;
 
 	uxkb_dev_repeat(dev, key_state);
 
 	if (key_state == KEY_RELEASED)
-		return -ENOKEY;
+		return;
 
 	dev->event.handled = false;
 	shl_hook_call(dev->input->hook, dev->input, &dev->event);
+}
 
-	return 0;
+/* Feed a batch of evdev events through the keyboard state machine as one
+ * group. The LED writeback is deferred to the end of the group, so a burst
+ * toggling lock keys costs a single write() instead of one per key. */
+void uxkb_dev_process_group(struct uterm_input_dev *dev,
+			    const struct input_event *ev, size_t num)
+{
+	bool leds_dirty = false;
+	size_t i;
+
+	for (i = 0; i < num; ++i) {
+		if (ev[i].type != EV_KEY)
+			continue;
+
+		uxkb_dev_process_key(dev, ev[i].value, ev[i].code,
+				     &leds_dirty);
+	}
+
+	if (leds_dirty)
+		uxkb_dev_update_keyboard_leds(dev);
 }
 
 void uxkb_dev_sleep(struct uterm_input_dev *dev)
@@ -33,14 +33,18 @@
 
 #include <errno.h>
 #include <fcntl.h>
+#include <inttypes.h>
 #include <libudev.h>
 #include <linux/fb.h>
 #include <stdbool.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/ioctl.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #include "shl_dlist.h"
+#include "shl_hashtable.h"
 #include "shl_log.h"
 #include "shl_misc.h"
 #include "uterm_monitor.h"
@@ -55,6 +59,14 @@ struct uterm_monitor_dev {
 	unsigned int flags;
 	char *node;
 	void *data;
+	/* hotplug seen while draining udev events; emitted once per drain */
+	bool hotplug;
+	/* connector id the pending hotplug is scoped to; 0 if the events
+	 * did not name one or named several */
+	unsigned int hotplug_conn;
+	/* restored from the inventory cache and not yet confirmed by a
+	 * real udev enumeration; see inventory_load() */
+	bool from_cache;
 };
 
 struct uterm_monitor_seat {
@@ -63,6 +75,8 @@ struct uterm_monitor_seat {
 	char *name;
 	void *data;
 	struct shl_dlist devices;
+	/* marks seats found during a refresh; cleared by the sweep */
+	bool seen;
 };
 
 struct uterm_monitor {
@@ -79,10 +93,18 @@ struct uterm_monitor {
 	struct ev_fd *umon_fd;
 
 	struct shl_dlist seats;
+	/* seat-name -> seat lookup; keys are owned by the seats */
+	struct shl_hashtable *seat_names;
+
+	/* warm-start inventory cache state; see uterm_monitor_scan() */
+	bool scanned;
+	bool scan_pending;
 };
 
 static void monitor_new_seat(struct uterm_monitor *mon, const char *name);
 static void monitor_free_seat(struct uterm_monitor_seat *seat);
+static void monitor_scan_idle(struct ev_eloop *eloop, void *unused,
+			      void *data);
 
 static void monitor_refresh_seats(struct uterm_monitor *mon)
 {
@@ -98,35 +120,35 @@ static void monitor_refresh_seats(struct uterm_monitor *mon)
 		return;
 	}
 
+	/* The login monitor does not tell us which seat changed, so we have
+	 * to re-enumerate on every wakeup. However, the diff against our seat
+	 * set is a single hash lookup per enumerated seat plus one sweep over
+	 * the known seats, instead of a quadratic strcmp walk. */
 	num = uterm_sd_get_seats(mon->sd, &seats);
 	if (num < 0) {
 		log_warn("cannot read seat information from systemd: %d", num);
 		return;
 	}
 
+	/* Mark all seats that are still present; add unknown ones. New seats
+	 * start marked so the sweep below does not remove them again. */
+	for (i = 0; i < num; ++i) {
+		if (shl_hashtable_find(mon->seat_names, (void**)&seat,
+				       seats[i]))
+			seat->seen = true;
+		else
+			monitor_new_seat(mon, seats[i]);
+		free(seats[i]);
+	}
+
 	/* Remove all seats that are no longer present */
 	shl_dlist_for_each_safe(iter, tmp, &mon->seats) {
 		seat = shl_dlist_entry(iter, struct uterm_monitor_seat,
 						list);
-		for (i = 0; i < num; ++i) {
-			if (!strcmp(seats[i], seat->name))
-				break;
-		}
-
-		if (i < num) {
-			free(seats[i]);
-			seats[i] = NULL;
-		} else {
+		if (seat->seen)
+			seat->seen = false;
+		else
 			monitor_free_seat(seat);
-		}
-	}
-
-	/* Add all new seats */
-	for (i = 0; i < num; ++i) {
-		if (seats[i]) {
-			monitor_new_seat(mon, seats[i]);
-			free(seats[i]);
-		}
 	}
 
 	free(seats);
@@ -196,7 +218,8 @@ static void monitor_sd_deinit(struct uterm_monitor *mon)
 static void seat_new_dev(struct uterm_monitor_seat *seat,
 				unsigned int type,
 				unsigned int flags,
-				const char *node)
+				const char *node,
+				bool from_cache)
 {
 	struct uterm_monitor_dev *dev;
 	struct uterm_monitor_event ev;
@@ -208,6 +231,7 @@ static void seat_new_dev(struct uterm_monitor_seat *seat,
 	dev->seat = seat;
 	dev->type = type;
 	dev->flags = flags;
+	dev->from_cache = from_cache;
 
 	dev->node = strdup(node);
 	if (!dev->node)
@@ -300,6 +324,10 @@ static void monitor_new_seat(struct uterm_monitor *mon, const char *name)
 	seat->name = strdup(name);
 	if (!seat->name)
 		goto err_free;
+	seat->seen = true;
+
+	if (shl_hashtable_insert(mon->seat_names, seat->name, seat))
+		goto err_name;
 
 	shl_dlist_link(&mon->seats, &seat->list);
 
@@ -313,6 +341,8 @@ static void monitor_new_seat(struct uterm_monitor *mon, const char *name)
 	log_debug("new seat %s", name);
 	return;
 
+err_name:
+	free(seat->name);
 err_free:
 	free(seat);
 }
@@ -331,6 +361,7 @@ static void monitor_free_seat(struct uterm_monitor_seat *seat)
 		seat_free_dev(dev);
 	}
 
+	shl_hashtable_remove(seat->mon->seat_names, seat->name);
 	shl_dlist_unlink(&seat->list);
 
 	memset(&ev, 0, sizeof(ev));
@@ -559,12 +590,205 @@ static unsigned int get_drm_flags(struct uterm_monitor *mon,
 	return flags;
 }
 
+/*
+ * Device inventory cache
+ * A full udev enumeration (DRM cards, fbdev nodes, every input device) takes
+ * hundreds of milliseconds on small boards and blocks seat startup. The
+ * device inventory of the last run is therefore persisted and replayed on the
+ * next start: cached entries whose device node still exists with the same
+ * device number bring their seats up immediately, the real enumeration then
+ * runs from an idle callback and reconciles the set (new devices are added,
+ * unconfirmed cached ones dropped).
+ */
+
+#define MONITOR_CACHE_DIR "/var/cache/kmscon"
+#define MONITOR_CACHE_FILE MONITOR_CACHE_DIR "/devices"
+#define MONITOR_CACHE_MAGIC 0x564e494bU
+#define MONITOR_CACHE_MAX 256
+
+struct inventory_header {
+	uint32_t magic;
+	uint32_t count;
+};
+
+struct inventory_entry {
+	uint32_t type;
+	uint32_t flags;
+	/* st_rdev of the node when the entry was written */
+	uint64_t rdev;
+	char seat[64];
+	char node[128];
+};
+
+static bool monitor_node_known(struct uterm_monitor *mon, const char *node)
+{
+	struct shl_dlist *iter, *iter2;
+	struct uterm_monitor_seat *seat;
+	struct uterm_monitor_dev *sdev;
+
+	shl_dlist_for_each(iter, &mon->seats) {
+		seat = shl_dlist_entry(iter, struct uterm_monitor_seat,
+				       list);
+		shl_dlist_for_each(iter2, &seat->devices) {
+			sdev = shl_dlist_entry(iter2,
+					       struct uterm_monitor_dev,
+					       list);
+			if (!strcmp(node, sdev->node))
+				return true;
+		}
+	}
+
+	return false;
+}
+
+static void inventory_save(struct uterm_monitor *mon)
+{
+	struct inventory_header hdr;
+	struct inventory_entry ent;
+	struct shl_dlist *iter, *iter2;
+	struct uterm_monitor_seat *seat;
+	struct uterm_monitor_dev *sdev;
+	struct stat st;
+	uint32_t num = 0;
+	int fd;
+
+	if (mkdir(MONITOR_CACHE_DIR, 0755) < 0 && errno != EEXIST)
+		return;
+
+	fd = open(MONITOR_CACHE_FILE ".tmp",
+		  O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+	if (fd < 0)
+		return;
+
+	/* placeholder header; rewritten once the count is known */
+	memset(&hdr, 0, sizeof(hdr));
+	if (write(fd, &hdr, sizeof(hdr)) != (ssize_t)sizeof(hdr))
+		goto err_drop;
+
+	shl_dlist_for_each(iter, &mon->seats) {
+		seat = shl_dlist_entry(iter, struct uterm_monitor_seat,
+				       list);
+		shl_dlist_for_each(iter2, &seat->devices) {
+			sdev = shl_dlist_entry(iter2,
+					       struct uterm_monitor_dev,
+					       list);
+			if (num >= MONITOR_CACHE_MAX)
+				goto out_hdr;
+
+			memset(&ent, 0, sizeof(ent));
+			ent.type = sdev->type;
+			ent.flags = sdev->flags;
+			if (!stat(sdev->node, &st))
+				ent.rdev = st.st_rdev;
+			strncpy(ent.seat, seat->name, sizeof(ent.seat) - 1);
+			strncpy(ent.node, sdev->node, sizeof(ent.node) - 1);
+
+			if (write(fd, &ent, sizeof(ent)) !=
+							(ssize_t)sizeof(ent))
+				goto err_drop;
+			++num;
+		}
+	}
+
+out_hdr:
+	hdr.magic = MONITOR_CACHE_MAGIC;
+	hdr.count = num;
+	if (lseek(fd, 0, SEEK_SET) != 0 ||
+	    write(fd, &hdr, sizeof(hdr)) != (ssize_t)sizeof(hdr))
+		goto err_drop;
+	close(fd);
+
+	if (rename(MONITOR_CACHE_FILE ".tmp", MONITOR_CACHE_FILE) < 0)
+		unlink(MONITOR_CACHE_FILE ".tmp");
+	else
+		log_debug("cached inventory of %" PRIu32 " devices", num);
+
+	return;
+
+err_drop:
+	close(fd);
+	unlink(MONITOR_CACHE_FILE ".tmp");
+}
+
+/* Replay the inventory of the previous run. An entry is only applied when
+ * its device node still exists with the same device number and its seat is
+ * known; everything else is left to the reconciling enumeration. Returns
+ * the number of devices brought up from the cache. */
+static int inventory_load(struct uterm_monitor *mon)
+{
+	struct inventory_header hdr;
+	struct inventory_entry ent;
+	struct uterm_monitor_seat *seat;
+	struct stat st;
+	unsigned int i;
+	int fd, num = 0;
+
+	fd = open(MONITOR_CACHE_FILE, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return 0;
+
+	if (read(fd, &hdr, sizeof(hdr)) != (ssize_t)sizeof(hdr) ||
+	    hdr.magic != MONITOR_CACHE_MAGIC ||
+	    hdr.count > MONITOR_CACHE_MAX)
+		goto err_drop;
+
+	for (i = 0; i < hdr.count; ++i) {
+		if (read(fd, &ent, sizeof(ent)) != (ssize_t)sizeof(ent))
+			goto err_drop;
+		ent.seat[sizeof(ent.seat) - 1] = 0;
+		ent.node[sizeof(ent.node) - 1] = 0;
+
+		if (stat(ent.node, &st) || st.st_rdev != ent.rdev)
+			continue;
+		if (!shl_hashtable_find(mon->seat_names, (void**)&seat,
+					(void*)ent.seat))
+			continue;
+		if (monitor_node_known(mon, ent.node))
+			continue;
+
+		seat_new_dev(seat, ent.type, ent.flags, ent.node, true);
+		++num;
+	}
+
+	close(fd);
+	if (num)
+		log_info("restored %d devices from inventory cache", num);
+	return num;
+
+err_drop:
+	close(fd);
+	unlink(MONITOR_CACHE_FILE);
+	return 0;
+}
+
+/* drop cached devices the reconciling enumeration did not confirm */
+static void inventory_sweep(struct uterm_monitor *mon)
+{
+	struct shl_dlist *iter, *iter2, *tmp;
+	struct uterm_monitor_seat *seat;
+	struct uterm_monitor_dev *sdev;
+
+	shl_dlist_for_each(iter, &mon->seats) {
+		seat = shl_dlist_entry(iter, struct uterm_monitor_seat,
+				       list);
+		shl_dlist_for_each_safe(iter2, tmp, &seat->devices) {
+			sdev = shl_dlist_entry(iter2,
+					       struct uterm_monitor_dev,
+					       list);
+			if (!sdev->from_cache)
+				continue;
+			log_debug("cached device %s vanished", sdev->node);
+			seat_free_dev(sdev);
+		}
+	}
+}
+
 static void monitor_udev_add(struct uterm_monitor *mon,
 				struct udev_device *dev)
 {
 	const char *sname, *subs, *node, *name, *sysname;
-	struct shl_dlist *iter;
 	struct uterm_monitor_seat *seat;
+	struct uterm_monitor_dev *sdev;
 	unsigned int type, flags;
 	int id;
 	struct udev_device *p;
@@ -575,11 +799,6 @@ static void monitor_udev_add(struct uterm_monitor *mon,
 		return;
 	}
 
-	if (monitor_find_dev(mon, dev)) {
-		log_debug("adding already available device %s", name);
-		return;
-	}
-
 	node = udev_device_get_devnode(dev);
 	if (!node)
 		return;
@@ -644,21 +863,33 @@ static void monitor_udev_add(struct uterm_monitor *mon,
 	if (!sname)
 		sname = "seat0";
 
-	/* find correct seat */
-	shl_dlist_for_each(iter, &mon->seats) {
-		seat = shl_dlist_entry(iter, struct uterm_monitor_seat,
-						list);
-		if (!strcmp(sname, seat->name))
-			break;
+	sdev = monitor_find_dev(mon, dev);
+	if (sdev) {
+		/* The enumeration confirmed this device. If it was restored
+		 * from the inventory cache, its seat assignment or flags may
+		 * have changed while we were down; treat that like the
+		 * seat-switch case of monitor_udev_change() and re-add it. */
+		if (strcmp(sname, sdev->seat->name) ||
+		    sdev->type != type || sdev->flags != flags) {
+			log_debug("device %s changed seat or flags, re-adding",
+				  name);
+			seat_free_dev(sdev);
+		} else {
+			log_debug("adding already available device %s", name);
+			sdev->from_cache = false;
+			return;
+		}
 	}
 
-	if (iter == &mon->seats) {
+	/* find correct seat */
+	if (!shl_hashtable_find(mon->seat_names, (void**)&seat,
+				(void*)sname)) {
 		log_debug("adding device for unknown seat %s (%s)",
 				sname, name);
 		return;
 	}
 
-	seat_new_dev(seat, type, flags, node);
+	seat_new_dev(seat, type, flags, node, false);
 }
 
 static void monitor_udev_remove(struct uterm_monitor *mon,
@@ -680,7 +911,7 @@ static void monitor_udev_change(struct uterm_monitor *mon,
 {
 	const char *sname, *val;
 	struct uterm_monitor_dev *sdev;
-	struct uterm_monitor_event ev;
+	unsigned int conn;
 
 	sdev = monitor_find_dev(mon, dev);
 	if (sdev) {
@@ -694,25 +925,62 @@ static void monitor_udev_change(struct uterm_monitor *mon,
 			return;
 		}
 
-		/* DRM devices send hotplug events; catch them here */
+		/* DRM devices send hotplug events; catch them here. A dock
+		 * attach delivers one change event per connector, so only mark
+		 * the device and let monitor_udev_event() emit a single
+		 * hotplug callback after the queue is drained. The kernel
+		 * names the affected connector in the CONNECTOR property;
+		 * keep it as long as all coalesced events agree on one so
+		 * the video backend can restrict its re-probe to it. */
 		val = udev_device_get_property_value(dev, "HOTPLUG");
 		if (val && !strcmp(val, "1")) {
+			conn = 0;
+			val = udev_device_get_property_value(dev, "CONNECTOR");
+			if (val)
+				conn = atoi(val);
+
+			if (!sdev->hotplug)
+				sdev->hotplug_conn = conn;
+			else if (sdev->hotplug_conn != conn)
+				sdev->hotplug_conn = 0;
+			sdev->hotplug = true;
+		}
+	} else {
+		/* Unknown device; maybe it switched into a known seat? Try
+		 * adding it as new device. If that fails, we ignore it */
+		monitor_udev_add(mon, dev);
+	}
+}
+
+static void monitor_send_hotplugs(struct uterm_monitor *mon)
+{
+	struct shl_dlist *iter, *iter2;
+	struct uterm_monitor_seat *seat;
+	struct uterm_monitor_dev *sdev;
+	struct uterm_monitor_event ev;
+
+	shl_dlist_for_each(iter, &mon->seats) {
+		seat = shl_dlist_entry(iter, struct uterm_monitor_seat, list);
+		shl_dlist_for_each(iter2, &seat->devices) {
+			sdev = shl_dlist_entry(iter2,
+					       struct uterm_monitor_dev, list);
+			if (!sdev->hotplug)
+				continue;
+			sdev->hotplug = false;
+
 			memset(&ev, 0, sizeof(ev));
 			ev.type = UTERM_MONITOR_HOTPLUG_DEV;
-			ev.seat = sdev->seat;
-			ev.seat_name = sdev->seat->name;
-			ev.seat_data = sdev->seat->data;
+			ev.seat = seat;
+			ev.seat_name = seat->name;
+			ev.seat_data = seat->data;
 			ev.dev = sdev;
 			ev.dev_type = sdev->type;
 			ev.dev_node = sdev->node;
 			ev.dev_data = sdev->data;
-			sdev->seat->mon->cb(sdev->seat->mon, &ev,
-						sdev->seat->mon->data);
+			ev.hotplug_conn = sdev->hotplug_conn;
+			sdev->hotplug_conn = 0;
+			mon->cb(mon, &ev, mon->data);
 		}
-	} else {
-		/* Unknown device; maybe it switched into a known seat? Try
-		 * adding it as new device. If that fails, we ignore it */
-		monitor_udev_add(mon, dev);
 	}
 }
 
@@ -723,6 +991,7 @@ static void monitor_udev_event(struct ev_fd *fd,
 	struct uterm_monitor *mon = data;
 	struct udev_device *dev;
 	const char *action;
+	bool changed = false;
 
 	if (mask & (EV_HUP | EV_ERR)) {
 		log_warn("udev monitor closed unexpectedly");
@@ -743,20 +1012,31 @@ static void monitor_udev_event(struct ev_fd *fd,
 		/* we use non-blocking udev monitor so ignore errors */
 		dev = udev_monitor_receive_device(mon->umon);
 		if (!dev)
-			return;
+			break;
 
 		action = udev_device_get_action(dev);
 		if (action) {
-			if (!strcmp(action, "add"))
+			if (!strcmp(action, "add")) {
 				monitor_udev_add(mon, dev);
-			else if (!strcmp(action, "remove"))
+				changed = true;
+			} else if (!strcmp(action, "remove")) {
 				monitor_udev_remove(mon, dev);
-			else if (!strcmp(action, "change"))
+				changed = true;
+			} else if (!strcmp(action, "change")) {
 				monitor_udev_change(mon, dev);
+				changed = true;
+			}
 		}
 
 		udev_device_unref(dev);
 	}
+
+	/* coalesced hotplug events collected during the drain */
+	monitor_send_hotplugs(mon);
+
+	/* keep the warm-start inventory current */
+	if (changed)
+		inventory_save(mon);
 }
 
 SHL_EXPORT
@@ -781,10 +1061,15 @@ int uterm_monitor_new(struct uterm_monitor **out,
 	mon->data = data;
 	shl_dlist_init(&mon->seats);
 
-	ret = monitor_sd_init(mon);
+	ret = shl_hashtable_new(&mon->seat_names, shl_string_hash,
+				shl_string_equal, NULL, NULL);
 	if (ret)
 		goto err_free;
 
+	ret = monitor_sd_init(mon);
+	if (ret)
+		goto err_tbl;
+
 	mon->udev = udev_new();
 	if (!mon->udev) {
 		log_err("cannot create udev object");
@@ -871,6 +1156,8 @@ err_udev:
 	udev_unref(mon->udev);
 err_sd:
 	monitor_sd_deinit(mon);
+err_tbl:
+	shl_hashtable_free(mon->seat_names);
 err_free:
 	free(mon);
 	return ret;
@@ -900,16 +1187,19 @@ void uterm_monitor_unref(struct uterm_monitor *mon)
 		monitor_free_seat(seat);
 	}
 
+	if (mon->scan_pending)
+		ev_eloop_unregister_idle_cb(mon->eloop, monitor_scan_idle,
+					    mon, EV_ONESHOT | EV_SINGLE);
 	ev_eloop_rm_fd(mon->umon_fd);
 	udev_monitor_unref(mon->umon);
 	udev_unref(mon->udev);
 	monitor_sd_deinit(mon);
+	shl_hashtable_free(mon->seat_names);
 	ev_eloop_unref(mon->eloop);
 	free(mon);
 }
 
-SHL_EXPORT
-void uterm_monitor_scan(struct uterm_monitor *mon)
+static void monitor_scan_now(struct uterm_monitor *mon)
 {
 	struct udev_enumerate *e;
 	struct udev_list_entry *entry;
@@ -917,11 +1207,6 @@ void uterm_monitor_scan(struct uterm_monitor *mon)
 	const char *path;
 	int ret;
 
-	if (!mon)
-		return;
-
-	monitor_refresh_seats(mon);
-
 	e = udev_enumerate_new(mon->udev);
 	if (!e) {
 		log_err("cannot create udev enumeration");
@@ -975,6 +1260,52 @@ out_enum:
 	udev_enumerate_unref(e);
 }
 
+/* reconciling enumeration behind a warm start from the inventory cache */
+static void monitor_scan_idle(struct ev_eloop *eloop, void *unused, void *data)
+{
+	struct uterm_monitor *mon = data;
+
+	mon->scan_pending = false;
+
+	log_debug("reconciling cached inventory with udev");
+	monitor_scan_now(mon);
+	inventory_sweep(mon);
+	inventory_save(mon);
+}
+
+SHL_EXPORT
+void uterm_monitor_scan(struct uterm_monitor *mon)
+{
+	int ret;
+
+	if (!mon)
+		return;
+
+	monitor_refresh_seats(mon);
+
+	/* Warm start: bring the seats up from the inventory the previous
+	 * run cached and defer the expensive enumeration to an idle
+	 * callback. A cold or stale cache falls through to the synchronous
+	 * scan. */
+	if (!mon->scanned) {
+		mon->scanned = true;
+		if (inventory_load(mon) > 0) {
+			ret = ev_eloop_register_idle_cb(mon->eloop,
+							monitor_scan_idle,
+							mon,
+							EV_ONESHOT |
+							EV_SINGLE);
+			if (!ret) {
+				mon->scan_pending = true;
+				return;
+			}
+		}
+	}
+
+	monitor_scan_now(mon);
+	inventory_save(mon);
+}
+
 SHL_EXPORT
 void uterm_monitor_set_seat_data(struct uterm_monitor_seat *seat, void *data)
 {
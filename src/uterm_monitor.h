@@ -73,6 +73,10 @@ struct uterm_monitor_event {
 	unsigned int dev_flags;
 	const char *dev_node;
 	void *dev_data;
+
+	/* for HOTPLUG_DEV: connector id the event is scoped to, or 0 if
+	 * unknown or if multiple connectors changed */
+	unsigned int hotplug_conn;
 };
 
 typedef void (*uterm_monitor_cb) (struct uterm_monitor *mon,
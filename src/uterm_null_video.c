@@ -0,0 +1,559 @@
+/*
+ * uterm - Linux User-Space Terminal null video module
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * NULL Video backend
+ * Headless backend that renders into plain malloc'ed XRGB32 buffers and
+ * drives page-flips off the virtual vblank timer. It needs no hardware and
+ * no privileges, so tests and benchmarks can exercise the renderers
+ * end-to-end at memory speed and profiles show renderer CPU cost without
+ * device overhead drowning it out.
+ * The device node is not a path; it is an optional mode-string of the form
+ * "<width>x<height>" (e.g. "1280x720") and defaults to 1920x1080.
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "shl_log.h"
+#include "shl_misc.h"
+#include "uterm_video.h"
+#include "uterm_video_blend_internal.h"
+#include "uterm_video_internal.h"
+
+#define LOG_SUBSYSTEM "video_null"
+
+#define NULL_DEFAULT_WIDTH 1920
+#define NULL_DEFAULT_HEIGHT 1080
+
+struct null_mode {
+	unsigned int width;
+	unsigned int height;
+	char name[32];
+};
+
+struct null_display {
+	uint8_t *map;
+	size_t len;
+	unsigned int xres;
+	unsigned int yres;
+	unsigned int stride;
+	int bufid;
+};
+
+struct null_video {
+	unsigned int width;
+	unsigned int height;
+	bool pending_intro;
+};
+
+static int mode_init(struct uterm_mode *mode)
+{
+	struct null_mode *nmode;
+
+	nmode = malloc(sizeof(*nmode));
+	if (!nmode)
+		return -ENOMEM;
+	memset(nmode, 0, sizeof(*nmode));
+	mode->data = nmode;
+
+	return 0;
+}
+
+static void mode_destroy(struct uterm_mode *mode)
+{
+	free(mode->data);
+}
+
+static const char *mode_get_name(const struct uterm_mode *mode)
+{
+	struct null_mode *nmode = mode->data;
+
+	return nmode->name;
+}
+
+static unsigned int mode_get_width(const struct uterm_mode *mode)
+{
+	struct null_mode *nmode = mode->data;
+
+	return nmode->width;
+}
+
+static unsigned int mode_get_height(const struct uterm_mode *mode)
+{
+	struct null_mode *nmode = mode->data;
+
+	return nmode->height;
+}
+
+static const struct mode_ops null_mode_ops = {
+	.init = mode_init,
+	.destroy = mode_destroy,
+	.get_name = mode_get_name,
+	.get_width = mode_get_width,
+	.get_height = mode_get_height,
+};
+
+static int display_init(struct uterm_display *disp)
+{
+	struct null_display *ndisp;
+
+	ndisp = malloc(sizeof(*ndisp));
+	if (!ndisp)
+		return -ENOMEM;
+	memset(ndisp, 0, sizeof(*ndisp));
+	disp->data = ndisp;
+	disp->dpms = UTERM_DPMS_ON;
+
+	return 0;
+}
+
+static void display_destroy(struct uterm_display *disp)
+{
+	struct null_display *ndisp = disp->data;
+
+	free(ndisp->map);
+	free(ndisp);
+}
+
+static int display_activate(struct uterm_display *disp,
+			    struct uterm_mode *mode)
+{
+	struct null_display *ndisp = disp->data;
+	struct null_video *nvid = disp->video->data;
+	struct null_mode *nmode;
+	struct uterm_mode *m;
+	int ret;
+
+	/* like fbdev we have a single fixed mode, so require @mode to be
+	 * NULL; the resolution is chosen via the mode-string */
+	if (mode)
+		return -EINVAL;
+
+	ndisp->xres = nvid->width;
+	ndisp->yres = nvid->height;
+	ndisp->stride = ndisp->xres * 4;
+	ndisp->len = (size_t)ndisp->stride * ndisp->yres * 2;
+	ndisp->bufid = 0;
+
+	ndisp->map = malloc(ndisp->len);
+	if (!ndisp->map)
+		return -ENOMEM;
+	memset(ndisp->map, 0, ndisp->len);
+
+	/* virtual 60Hz flip clock */
+	display_set_vblank_timer(disp, 16);
+
+	if (disp->current_mode) {
+		m = disp->current_mode;
+	} else {
+		ret = mode_new(&m, &null_mode_ops);
+		if (ret)
+			goto err_map;
+		ret = uterm_mode_bind(m, disp);
+		if (ret) {
+			uterm_mode_unref(m);
+			goto err_map;
+		}
+		disp->current_mode = m;
+		disp->default_mode = m;
+		uterm_mode_unref(m);
+	}
+
+	nmode = m->data;
+	nmode->width = ndisp->xres;
+	nmode->height = ndisp->yres;
+	snprintf(nmode->name, sizeof(nmode->name), "%ux%u", ndisp->xres,
+		 ndisp->yres);
+
+	log_info("activating null display to %ux%u", ndisp->xres,
+		 ndisp->yres);
+
+	disp->flags |= DISPLAY_ONLINE | DISPLAY_DBUF;
+	return 0;
+
+err_map:
+	free(ndisp->map);
+	ndisp->map = NULL;
+	return ret;
+}
+
+static void display_deactivate(struct uterm_display *disp)
+{
+	struct null_display *ndisp = disp->data;
+
+	log_info("deactivating null display");
+
+	free(ndisp->map);
+	ndisp->map = NULL;
+	disp->flags &= ~DISPLAY_ONLINE;
+}
+
+static int display_set_dpms(struct uterm_display *disp, int state)
+{
+	disp->dpms = state;
+	return 0;
+}
+
+static int display_use(struct uterm_display *disp, bool *opengl)
+{
+	struct null_display *ndisp = disp->data;
+
+	if (opengl)
+		*opengl = false;
+
+	return ndisp->bufid ^ 1;
+}
+
+static unsigned int display_get_bufs(struct uterm_display *disp)
+{
+	return 2;
+}
+
+static int display_get_buffers(struct uterm_display *disp,
+			       struct uterm_video_buffer *buffer,
+			       unsigned int formats)
+{
+	struct null_display *ndisp = disp->data;
+	unsigned int i;
+
+	if (!(formats & UTERM_FORMAT_XRGB32))
+		return -EOPNOTSUPP;
+
+	for (i = 0; i < 2; ++i) {
+		buffer[i].width = ndisp->xres;
+		buffer[i].height = ndisp->yres;
+		buffer[i].stride = ndisp->stride;
+		buffer[i].format = UTERM_FORMAT_XRGB32;
+		buffer[i].data = &ndisp->map[i * ndisp->yres * ndisp->stride];
+	}
+
+	return 0;
+}
+
+/* buffer the renderers draw into; the other one is on "scanout" */
+static uint8_t *null_render_target(struct null_display *ndisp)
+{
+	return &ndisp->map[(ndisp->bufid ^ 1) * ndisp->yres * ndisp->stride];
+}
+
+static int display_swap(struct uterm_display *disp, bool immediate)
+{
+	struct null_display *ndisp = disp->data;
+
+	ndisp->bufid ^= 1;
+
+	if (immediate)
+		return 0;
+
+	return display_schedule_vblank_timer(disp);
+}
+
+static int display_snapshot(struct uterm_display *disp,
+			    struct uterm_video_buffer *buffer)
+{
+	struct null_display *ndisp = disp->data;
+
+	buffer->width = ndisp->xres;
+	buffer->height = ndisp->yres;
+	buffer->stride = ndisp->stride;
+	buffer->format = UTERM_FORMAT_XRGB32;
+	buffer->data = &ndisp->map[ndisp->bufid * ndisp->yres * ndisp->stride];
+
+	return 0;
+}
+
+static int display_blit(struct uterm_display *disp,
+			const struct uterm_video_buffer *buf,
+			unsigned int x, unsigned int y)
+{
+	struct null_display *ndisp = disp->data;
+	unsigned int tmp, width, height;
+	uint8_t *dst, *src;
+
+	if (!buf || buf->format != UTERM_FORMAT_XRGB32)
+		return -EINVAL;
+
+	tmp = x + buf->width;
+	if (tmp < x || x >= ndisp->xres)
+		return -EINVAL;
+	if (tmp > ndisp->xres)
+		width = ndisp->xres - x;
+	else
+		width = buf->width;
+
+	tmp = y + buf->height;
+	if (tmp < y || y >= ndisp->yres)
+		return -EINVAL;
+	if (tmp > ndisp->yres)
+		height = ndisp->yres - y;
+	else
+		height = buf->height;
+
+	dst = null_render_target(ndisp);
+	dst = &dst[y * ndisp->stride + x * 4];
+	src = buf->data;
+
+	while (height--) {
+		memcpy(dst, src, 4 * width);
+		dst += ndisp->stride;
+		src += buf->stride;
+	}
+
+	return 0;
+}
+
+static int display_fake_blendv(struct uterm_display *disp,
+			       const struct uterm_video_blend_req *req,
+			       size_t num)
+{
+	struct null_display *ndisp = disp->data;
+	unsigned int tmp, width, height;
+	uint8_t *dst;
+	size_t j;
+
+	if (!req)
+		return -EINVAL;
+
+	for (j = 0; j < num; ++j, ++req) {
+		if (!req->buf)
+			continue;
+
+		if (req->buf->format != UTERM_FORMAT_GREY)
+			return -EOPNOTSUPP;
+
+		tmp = req->x + req->buf->width;
+		if (tmp < req->x || req->x >= ndisp->xres)
+			return -EINVAL;
+		if (tmp > ndisp->xres)
+			width = ndisp->xres - req->x;
+		else
+			width = req->buf->width;
+
+		tmp = req->y + req->buf->height;
+		if (tmp < req->y || req->y >= ndisp->yres)
+			return -EINVAL;
+		if (tmp > ndisp->yres)
+			height = ndisp->yres - req->y;
+		else
+			height = req->buf->height;
+
+		dst = null_render_target(ndisp);
+		dst = &dst[req->y * ndisp->stride + req->x * 4];
+
+		uterm_video_blend_xrgb32(dst, ndisp->stride,
+				req->buf->data, req->buf->stride,
+				width, height,
+				((uint_fast32_t)req->fr << 16) |
+					(req->fg << 8) | req->fb,
+				((uint_fast32_t)req->br << 16) |
+					(req->bg << 8) | req->bb);
+	}
+
+	return 0;
+}
+
+static int display_fill(struct uterm_display *disp,
+			uint8_t r, uint8_t g, uint8_t b,
+			unsigned int x, unsigned int y,
+			unsigned int width, unsigned int height)
+{
+	struct null_display *ndisp = disp->data;
+	unsigned int tmp, i;
+	uint8_t *dst;
+	uint32_t val;
+
+	tmp = x + width;
+	if (tmp < x || x >= ndisp->xres)
+		return -EINVAL;
+	if (tmp > ndisp->xres)
+		width = ndisp->xres - x;
+	tmp = y + height;
+	if (tmp < y || y >= ndisp->yres)
+		return -EINVAL;
+	if (tmp > ndisp->yres)
+		height = ndisp->yres - y;
+
+	dst = null_render_target(ndisp);
+	dst = &dst[y * ndisp->stride + x * 4];
+	val = ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+
+	while (height--) {
+		for (i = 0; i < width; ++i)
+			((uint32_t*)dst)[i] = val;
+		dst += ndisp->stride;
+	}
+
+	return 0;
+}
+
+static int display_shift(struct uterm_display *disp,
+			 unsigned int height, int dy)
+{
+	struct null_display *ndisp = disp->data;
+	unsigned int adiff;
+	uint8_t *dst;
+
+	if (height > ndisp->yres)
+		height = ndisp->yres;
+
+	adiff = (dy < 0) ? -dy : dy;
+	if (!adiff)
+		return 0;
+	if (adiff >= height)
+		return -EINVAL;
+
+	dst = null_render_target(ndisp);
+
+	if (dy > 0)
+		memmove(dst, &dst[adiff * ndisp->stride],
+			(height - adiff) * ndisp->stride);
+	else
+		memmove(&dst[adiff * ndisp->stride], dst,
+			(height - adiff) * ndisp->stride);
+
+	return 0;
+}
+
+static const struct display_ops null_display_ops = {
+	.init = display_init,
+	.destroy = display_destroy,
+	.activate = display_activate,
+	.deactivate = display_deactivate,
+	.set_dpms = display_set_dpms,
+	.use = display_use,
+	.get_bufs = display_get_bufs,
+	.get_buffers = display_get_buffers,
+	.swap = display_swap,
+	.snapshot = display_snapshot,
+	.blit = display_blit,
+	.fake_blendv = display_fake_blendv,
+	.fill = display_fill,
+	.shift = display_shift,
+};
+
+static void intro_idle_event(struct ev_eloop *eloop, void *unused, void *data)
+{
+	struct uterm_video *video = data;
+	struct null_video *nvid = video->data;
+	struct uterm_display *disp;
+	int ret;
+
+	nvid->pending_intro = false;
+	ev_eloop_unregister_idle_cb(eloop, intro_idle_event, data, EV_NORMAL);
+
+	ret = display_new(&disp, &null_display_ops);
+	if (ret) {
+		log_error("cannot create null display: %d", ret);
+		return;
+	}
+
+	ret = uterm_display_bind(disp, video);
+	if (ret) {
+		log_error("cannot bind null display: %d", ret);
+		uterm_display_unref(disp);
+		return;
+	}
+
+	uterm_display_unref(disp);
+}
+
+static int video_init(struct uterm_video *video, const char *node)
+{
+	struct null_video *nvid;
+	unsigned int w, h;
+	int ret;
+
+	nvid = malloc(sizeof(*nvid));
+	if (!nvid)
+		return -ENOMEM;
+	memset(nvid, 0, sizeof(*nvid));
+	video->data = nvid;
+
+	nvid->width = NULL_DEFAULT_WIDTH;
+	nvid->height = NULL_DEFAULT_HEIGHT;
+	if (node && *node) {
+		if (sscanf(node, "%ux%u", &w, &h) != 2 || !w || !h) {
+			log_error("invalid null-video mode-string %s", node);
+			ret = -EINVAL;
+			goto err_free;
+		}
+		nvid->width = w;
+		nvid->height = h;
+	}
+
+	log_info("new null device %ux%u", nvid->width, nvid->height);
+
+	ret = ev_eloop_register_idle_cb(video->eloop, intro_idle_event, video,
+					EV_NORMAL);
+	if (ret) {
+		log_error("cannot register idle event: %d", ret);
+		goto err_free;
+	}
+	nvid->pending_intro = true;
+
+	return 0;
+
+err_free:
+	free(nvid);
+	return ret;
+}
+
+static void video_destroy(struct uterm_video *video)
+{
+	struct null_video *nvid = video->data;
+
+	log_info("free null device");
+
+	if (nvid->pending_intro)
+		ev_eloop_unregister_idle_cb(video->eloop, intro_idle_event,
+					    video, EV_NORMAL);
+
+	free(nvid);
+}
+
+static int video_wake_up(struct uterm_video *video)
+{
+	/* the buffers stay allocated and intact across sleep */
+	return 0;
+}
+
+static const struct video_ops null_video_ops = {
+	.init = video_init,
+	.destroy = video_destroy,
+	.segfault = NULL,
+	.poll = NULL,
+	.sleep = NULL,
+	.wake_up = video_wake_up,
+};
+
+static const struct uterm_video_module null_module = {
+	.ops = &null_video_ops,
+};
+
+SHL_EXPORT
+const struct uterm_video_module *UTERM_VIDEO_NULL = &null_module;
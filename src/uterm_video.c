@@ -355,6 +355,15 @@ void uterm_display_unregister_cb(struct uterm_display *disp,
 	shl_hook_rm_cast(disp->hook, cb, data);
 }
 
+SHL_EXPORT
+struct uterm_video *uterm_display_get_video(struct uterm_display *disp)
+{
+	if (!disp)
+		return NULL;
+
+	return disp->video;
+}
+
 SHL_EXPORT
 struct uterm_mode *uterm_display_get_modes(struct uterm_display *disp)
 {
@@ -451,6 +460,15 @@ int uterm_display_use(struct uterm_display *disp, bool *opengl)
 	return VIDEO_CALL(disp->ops->use, -EOPNOTSUPP, disp, opengl);
 }
 
+SHL_EXPORT
+unsigned int uterm_display_get_bufs(struct uterm_display *disp)
+{
+	if (!disp || !display_is_online(disp))
+		return 0;
+
+	return VIDEO_CALL(disp->ops->get_bufs, 0, disp);
+}
+
 SHL_EXPORT
 int uterm_display_get_buffers(struct uterm_display *disp,
 			      struct uterm_video_buffer *buffer,
@@ -463,13 +481,44 @@ int uterm_display_get_buffers(struct uterm_display *disp,
 			  formats);
 }
 
+SHL_EXPORT
+int uterm_display_get_buffer_age(struct uterm_display *disp)
+{
+	if (!disp || !display_is_online(disp))
+		return -EINVAL;
+
+	return VIDEO_CALL(disp->ops->get_buffer_age, -EOPNOTSUPP, disp);
+}
+
+SHL_EXPORT
+void uterm_display_set_damage(struct uterm_display *disp,
+			      unsigned int x1, unsigned int y1,
+			      unsigned int x2, unsigned int y2)
+{
+	if (!disp)
+		return;
+
+	disp->damage_set = true;
+	disp->damage_x1 = x1;
+	disp->damage_y1 = y1;
+	disp->damage_x2 = (x2 < x1) ? x1 : x2;
+	disp->damage_y2 = (y2 < y1) ? y1 : y2;
+}
+
 SHL_EXPORT
 int uterm_display_swap(struct uterm_display *disp, bool immediate)
 {
+	int ret;
+
 	if (!disp || !display_is_online(disp) || !video_is_awake(disp->video))
 		return -EINVAL;
 
-	return VIDEO_CALL(disp->ops->swap, 0, disp, immediate);
+	ret = VIDEO_CALL(disp->ops->swap, 0, disp, immediate);
+
+	/* damage hints describe a single frame only */
+	disp->damage_set = false;
+
+	return ret;
 }
 
 SHL_EXPORT
@@ -494,6 +543,16 @@ int uterm_display_fill(struct uterm_display *disp,
 			  width, height);
 }
 
+SHL_EXPORT
+int uterm_display_shift(struct uterm_display *disp,
+			unsigned int height, int dy)
+{
+	if (!disp || !display_is_online(disp) || !video_is_awake(disp->video))
+		return -EINVAL;
+
+	return VIDEO_CALL(disp->ops->shift, -EOPNOTSUPP, disp, height, dy);
+}
+
 SHL_EXPORT
 int uterm_display_blit(struct uterm_display *disp,
 		       const struct uterm_video_buffer *buf,
@@ -542,6 +601,46 @@ int uterm_display_fake_blendv(struct uterm_display *disp,
 	return VIDEO_CALL(disp->ops->fake_blendv, -EOPNOTSUPP, disp, req, num);
 }
 
+SHL_EXPORT
+int uterm_display_snapshot(struct uterm_display *disp,
+			   struct uterm_video_buffer *buf)
+{
+	if (!disp || !buf || !display_is_online(disp) ||
+	    !video_is_awake(disp->video))
+		return -EINVAL;
+
+	return VIDEO_CALL(disp->ops->snapshot, -EOPNOTSUPP, disp, buf);
+}
+
+SHL_EXPORT
+int uterm_display_set_cursor(struct uterm_display *disp,
+			     const struct uterm_video_buffer *buf)
+{
+	if (!disp || !display_is_online(disp) || !video_is_awake(disp->video))
+		return -EINVAL;
+
+	return VIDEO_CALL(disp->ops->set_cursor, -EOPNOTSUPP, disp, buf);
+}
+
+SHL_EXPORT
+int uterm_display_move_cursor(struct uterm_display *disp, int x, int y)
+{
+	if (!disp || !display_is_online(disp) || !video_is_awake(disp->video))
+		return -EINVAL;
+
+	return VIDEO_CALL(disp->ops->move_cursor, -EOPNOTSUPP, disp, x, y);
+}
+
+SHL_EXPORT
+int uterm_video_prepare(const struct uterm_video_module *mod,
+			const char *node)
+{
+	if (!mod || !mod->ops)
+		return -EOPNOTSUPP;
+
+	return VIDEO_CALL(mod->ops->prepare, 0, node);
+}
+
 SHL_EXPORT
 int uterm_video_new(struct uterm_video **out, struct ev_eloop *eloop,
 		    const char *node, const struct uterm_video_module *mod)
@@ -698,9 +797,18 @@ bool uterm_video_is_awake(struct uterm_video *video)
 
 SHL_EXPORT
 void uterm_video_poll(struct uterm_video *video)
+{
+	uterm_video_poll_connector(video, 0);
+}
+
+SHL_EXPORT
+void uterm_video_poll_connector(struct uterm_video *video,
+				unsigned int connector_id)
 {
 	if (!video)
 		return;
 
+	video->poll_conn = connector_id;
 	VIDEO_CALL(video->ops->poll, 0, video);
+	video->poll_conn = 0;
 }
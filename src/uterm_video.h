@@ -102,6 +102,9 @@ enum uterm_video_format {
 	UTERM_FORMAT_RGB16	= 0x04,
 };
 
+/* maximum number of framebuffers a display cycles through on swaps */
+#define UTERM_VIDEO_MAX_BUFS 4
+
 struct uterm_video_buffer {
 	unsigned int width;
 	unsigned int height;
@@ -155,6 +158,7 @@ int uterm_display_register_cb(struct uterm_display *disp, uterm_display_cb cb,
 void uterm_display_unregister_cb(struct uterm_display *disp,
 				 uterm_display_cb cb, void *data);
 
+struct uterm_video *uterm_display_get_video(struct uterm_display *disp);
 struct uterm_mode *uterm_display_get_modes(struct uterm_display *disp);
 struct uterm_mode *uterm_display_get_current(struct uterm_display *disp);
 struct uterm_mode *uterm_display_get_default(struct uterm_display *disp);
@@ -166,12 +170,26 @@ int uterm_display_set_dpms(struct uterm_display *disp, int state);
 int uterm_display_get_dpms(const struct uterm_display *disp);
 
 int uterm_display_use(struct uterm_display *disp, bool *opengl);
+unsigned int uterm_display_get_bufs(struct uterm_display *disp);
+/* Age of the current back-buffer in swaps: 1 means it still holds the last
+ * frame, 0 means its content is undefined. Returns -EOPNOTSUPP on backends
+ * with a fixed buffer cycle, where uterm_display_get_bufs() is authoritative.
+ * The display must be current, so call uterm_display_use() first. */
+int uterm_display_get_buffer_age(struct uterm_display *disp);
 int uterm_display_get_buffers(struct uterm_display *disp,
 			      struct uterm_video_buffer *buffer,
 			      unsigned int formats);
+/* Hint which pixel region the next swap actually changes; backends that can
+ * pass damage to the driver use it, everyone else ignores it. The hint is
+ * cleared by the swap. */
+void uterm_display_set_damage(struct uterm_display *disp,
+			      unsigned int x1, unsigned int y1,
+			      unsigned int x2, unsigned int y2);
 int uterm_display_swap(struct uterm_display *disp, bool immediate);
 bool uterm_display_is_swapping(struct uterm_display *disp);
 
+int uterm_display_shift(struct uterm_display *disp,
+			unsigned int height, int dy);
 int uterm_display_fill(struct uterm_display *disp,
 		       uint8_t r, uint8_t g, uint8_t b,
 		       unsigned int x, unsigned int y,
@@ -188,8 +206,28 @@ int uterm_display_fake_blendv(struct uterm_display *disp,
 			      const struct uterm_video_blend_req *req,
 			      size_t num);
 
+/* Fill @buf with a read-only view of the currently displayed frame. The
+ * data pointer stays valid until the next render or swap on @disp, so the
+ * caller must copy it right away. Returns -EOPNOTSUPP if the backend cannot
+ * export its framebuffer. */
+int uterm_display_snapshot(struct uterm_display *disp,
+			   struct uterm_video_buffer *buf);
+
+/* Show @buf on the hardware cursor plane or hide the plane if @buf is NULL.
+ * @buf must be UTERM_FORMAT_XRGB32; all-zero pixels become transparent.
+ * Returns -EOPNOTSUPP if the backend has no cursor plane. */
+int uterm_display_set_cursor(struct uterm_display *disp,
+			     const struct uterm_video_buffer *buf);
+int uterm_display_move_cursor(struct uterm_display *disp, int x, int y);
+
 /* video interface */
 
+/* Perform the blocking parts of device bring-up for @node without creating
+ * an object. This is optional and purely an optimization: it may be called
+ * from any thread, so several devices can be warmed up in parallel before
+ * they are registered serially via uterm_video_new(). */
+int uterm_video_prepare(const struct uterm_video_module *mod,
+			const char *node);
 int uterm_video_new(struct uterm_video **out, struct ev_eloop *eloop,
 		    const char *node, const struct uterm_video_module *mod);
 void uterm_video_ref(struct uterm_video *video);
@@ -206,6 +244,8 @@ void uterm_video_sleep(struct uterm_video *video);
 int uterm_video_wake_up(struct uterm_video *video);
 bool uterm_video_is_awake(struct uterm_video *video);
 void uterm_video_poll(struct uterm_video *video);
+void uterm_video_poll_connector(struct uterm_video *video,
+				unsigned int connector_id);
 
 /* external modules */
 
@@ -227,4 +267,10 @@ extern const struct uterm_video_module *UTERM_VIDEO_DRM3D;
 #define UTERM_VIDEO_DRM3D NULL
 #endif
 
+#ifdef BUILD_ENABLE_VIDEO_NULL
+extern const struct uterm_video_module *UTERM_VIDEO_NULL;
+#else
+#define UTERM_VIDEO_NULL NULL
+#endif
+
 #endif /* UTERM_UTERM_VIDEO_H */
@@ -0,0 +1,64 @@
+/*
+ * uterm_video_blend - Shared Glyph Blend Kernels
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Shared glyph blend kernels
+ * The software video backends (fbdev, drm2d) blend 8bit-grey glyph buffers
+ * with a foreground and background color into XRGB32 framebuffers. This is
+ * the hottest loop during text output so we provide vectorized kernels that
+ * are selected at runtime depending on the host CPU. Backends should not
+ * open-code the blend loop but use this helper.
+ */
+
+#ifndef UTERM_VIDEO_BLEND_INTERNAL_H
+#define UTERM_VIDEO_BLEND_INTERNAL_H
+
+#include <inttypes.h>
+#include <stdlib.h>
+
+/* Blend the 8bit-grey buffer @src of size @width x @height into the XRGB32
+ * target @dst. @fg and @bg are packed 0x00RRGGBB colors. Strides are in
+ * bytes. The caller must have clipped @width/@height against the target. */
+void uterm_video_blend_xrgb32(uint8_t *dst, unsigned int dst_stride,
+			      const uint8_t *src, unsigned int src_stride,
+			      unsigned int width, unsigned int height,
+			      uint_fast32_t fg, uint_fast32_t bg);
+
+/* kernel introspection for the A/B regression harness; normal callers use
+ * uterm_video_blend_xrgb32() and get the fastest kernel automatically */
+struct uterm_video_blend_kernel {
+	const char *name;
+	void (*blend) (uint8_t *dst, unsigned int dst_stride,
+		       const uint8_t *src, unsigned int src_stride,
+		       unsigned int width, unsigned int height,
+		       uint_fast32_t fg, uint_fast32_t bg);
+};
+
+/* Returns the number of blend kernels the host CPU supports and stores the
+ * list in @out; the scalar reference kernel always comes first. */
+unsigned int uterm_video_blend_kernel_list(
+				const struct uterm_video_blend_kernel **out);
+
+#endif /* UTERM_VIDEO_BLEND_INTERNAL_H */
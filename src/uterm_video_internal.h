@@ -54,6 +54,10 @@ struct display_ops {
 	void (*deactivate) (struct uterm_display *disp);
 	int (*set_dpms) (struct uterm_display *disp, int state);
 	int (*use) (struct uterm_display *disp, bool *opengl);
+	unsigned int (*get_bufs) (struct uterm_display *disp);
+	/* age of the current back-buffer in swaps or 0 if unknown; optional
+	 * and only sensible for backends without a fixed buffer cycle */
+	int (*get_buffer_age) (struct uterm_display *disp);
 	int (*get_buffers) (struct uterm_display *disp,
 			    struct uterm_video_buffer *buffer,
 			    unsigned int formats);
@@ -67,9 +71,19 @@ struct display_ops {
 	int (*fill) (struct uterm_display *disp,
 		     uint8_t r, uint8_t g, uint8_t b, unsigned int x,
 		     unsigned int y, unsigned int width, unsigned int height);
+	int (*shift) (struct uterm_display *disp,
+		      unsigned int height, int dy);
+	int (*snapshot) (struct uterm_display *disp,
+			 struct uterm_video_buffer *buffer);
+	int (*set_cursor) (struct uterm_display *disp,
+			   const struct uterm_video_buffer *buf);
+	int (*move_cursor) (struct uterm_display *disp, int x, int y);
 };
 
 struct video_ops {
+	/* Blocking device warm-up; optional. Touches no object state and may
+	 * run on any thread before init() is called for @node. */
+	int (*prepare) (const char *node);
 	int (*init) (struct uterm_video *video, const char *node);
 	void (*destroy) (struct uterm_video *video);
 	void (*segfault) (struct uterm_video *video);
@@ -125,6 +139,13 @@ struct uterm_display {
 	struct itimerspec vblank_spec;
 	struct ev_timer *vblank_timer;
 
+	/* damage hint for the next swap; cleared by every swap */
+	bool damage_set;
+	unsigned int damage_x1;
+	unsigned int damage_y1;
+	unsigned int damage_x2;
+	unsigned int damage_y2;
+
 	const struct display_ops *ops;
 	void *data;
 };
@@ -156,6 +177,10 @@ struct uterm_video {
 	unsigned int flags;
 	struct ev_eloop *eloop;
 
+	/* connector the current poll is scoped to; 0 re-probes all
+	 * connectors. Only valid while ops->poll runs. */
+	unsigned int poll_conn;
+
 	struct shl_dlist displays;
 	struct shl_hook *hook;
 
@@ -75,6 +75,9 @@ struct uterm_vt {
 	bool real_delayed;
 	int real_target;
 	time_t real_target_time;
+	/* monotonic timestamp of the VT-switch signal; used to report how
+	 * long the ack and the asynchronous activation stages took */
+	uint64_t real_enter_time;
 };
 
 struct uterm_vt_master {
@@ -131,6 +134,14 @@ static int vt_call(struct uterm_vt *vt, unsigned int event, int target,
 	return 0;
 }
 
+static uint64_t vt_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
 static void vt_call_activate(struct uterm_vt *vt)
 {
 	vt_call(vt, UTERM_VT_ACTIVATE, vt->real_num, false);
@@ -174,11 +185,21 @@ static int vt_call_deactivate(struct uterm_vt *vt, bool force)
 static void real_delayed(struct ev_eloop *eloop, void *unused, void *data)
 {
 	struct uterm_vt *vt = data;
+	uint64_t start;
 
-	log_debug("enter VT %d %p during startup", vt->real_num, vt);
+	log_debug("enter VT %d %p from idle callback", vt->real_num, vt);
 	vt->real_delayed = false;
 	ev_eloop_unregister_idle_cb(eloop, real_delayed, vt, EV_NORMAL);
+
+	start = vt_now();
 	vt_call_activate(vt);
+
+	if (vt->real_enter_time) {
+		log_debug("VT %d switch stages: %" PRIu64 "us ack-to-wakeup, %" PRIu64 "us activation",
+			  vt->real_num, start - vt->real_enter_time,
+			  vt_now() - start);
+		vt->real_enter_time = 0;
+	}
 }
 
 static void real_sig_enter(struct uterm_vt *vt, struct signalfd_siginfo *info)
@@ -195,21 +216,34 @@ static void real_sig_enter(struct uterm_vt *vt, struct signalfd_siginfo *info)
 	if (vts.v_active != vt->real_num)
 		return;
 
-	if (vt->real_delayed) {
-		vt->real_delayed = false;
-		ev_eloop_unregister_idle_cb(vt->vtm->eloop, real_delayed, vt,
-					    EV_NORMAL);
-	} else if (vt->active) {
+	if (vt->active) {
 		log_warning("activating VT %d even though it's already active",
 			    vt->real_num);
-	} else {
+	} else if (!vt->real_delayed) {
 		uterm_input_wake_up(vt->input);
 	}
 
+	/* Acknowledge the switch right away so the kernel can complete it;
+	 * the expensive video wake-up runs afterwards from an idle callback.
+	 * The framebuffer snapshot restored by the seat code bridges the gap
+	 * until the first real frame, so deferring the full bring-up only
+	 * shortens the blank period of the switch. */
 	log_debug("enter VT %d %p due to VT signal", vt->real_num, vt);
+	vt->real_enter_time = vt_now();
 	ioctl(vt->real_fd, VT_RELDISP, VT_ACKACQ);
 	vt->real_target = -1;
-	vt_call_activate(vt);
+
+	if (vt->real_delayed)
+		return;
+
+	ret = ev_eloop_register_idle_cb(vt->vtm->eloop, real_delayed, vt,
+					EV_NORMAL);
+	if (ret) {
+		/* no idle slot; fall back to the synchronous path */
+		vt_call_activate(vt);
+		return;
+	}
+	vt->real_delayed = true;
 }
 
 static void real_sig_leave(struct uterm_vt *vt, struct signalfd_siginfo *info)
@@ -320,6 +354,9 @@ static int real_open(struct uterm_vt *vt, const char *vt_name)
 	if (ret)
 		goto err_fd;
 
+	/* VT switch requests must preempt bulk sources */
+	ev_fd_set_priority(vt->real_efd, EV_PRIO_HIGH);
+
 	/* Get the number of the VT which is active now, so we have something
 	 * to switch back to in uterm_vt_deactivate(). */
 	ret = ioctl(vt->real_fd, VT_GETSTATE, &vts);
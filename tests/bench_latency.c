@@ -0,0 +1,573 @@
+/*
+ * bench_latency - Keystroke-to-pixel latency benchmark
+ *
+ * Copyright (c) 2012-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Keystroke-to-pixel latency benchmark
+ * This measures the full input-to-display path: a key event is injected
+ * through a virtual uinput keyboard, decoded by uterm_input/uxkb, echoed as
+ * a probe glyph through the text renderer and the sample ends when the
+ * page-flip event for the frame arrives. It reports p50/p99 latency per
+ * text backend so regressions on the path users actually feel are visible
+ * across releases. It drives a real display and needs access to
+ * /dev/uinput, so run it as root from a free VT:
+ *
+ * $ ./bench_latency
+ *
+ * By default all available backends are measured; use --backends to restrict
+ * the run to a single one.
+ */
+
+static void print_help();
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <libtsm.h>
+#include <linux/uinput.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "eloop.h"
+#include "font.h"
+#include "kmscon_module.h"
+#include "shl_log.h"
+#include "text.h"
+#include "uterm_input.h"
+#include "uterm_video.h"
+#include "test_include.h"
+
+/* keystrokes measured per backend */
+#define LAT_SAMPLES 200
+/* eloop rounds waited for one flip before the sample counts as lost */
+#define LAT_MAX_ROUNDS 100
+
+/* eloop object */
+static struct ev_eloop *eloop;
+
+struct {
+	bool fbdev;
+	bool null;
+	char *dev;
+	char *backends;
+	char *font_engine;
+	char *font_name;
+	unsigned int font_size;
+} lat_conf;
+
+static const char *lat_backends[] = {
+	"bblit",
+	"bbulk",
+	"gltex",
+	"pixman",
+};
+
+struct lat_run {
+	struct kmscon_text *txt;
+	struct uterm_display *disp;
+	struct kmscon_font *font;
+	struct kmscon_font *bold_font;
+
+	/* injection time of the pending keystroke; 0 if none */
+	uint64_t inject;
+	/* a swap was scheduled and its page-flip is outstanding */
+	bool flip_pending;
+	/* cell toggled by every keystroke so each frame really draws */
+	unsigned int probe;
+
+	uint64_t samples[LAT_SAMPLES];
+	unsigned int num;
+};
+
+static uint64_t now_usec(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+/*
+ * Virtual keyboard
+ * The injected device goes through the very same evdev/uxkb path as real
+ * keyboards, so decode and dispatch costs are part of every sample.
+ */
+
+static int uinput_create(int *out, char *node, size_t size)
+{
+	struct uinput_setup us;
+	char sysname[64];
+	struct dirent *ent;
+	DIR *dir;
+	char path[128];
+	int fd, ret;
+
+	fd = open("/dev/uinput", O_WRONLY | O_NONBLOCK | O_CLOEXEC);
+	if (fd < 0) {
+		log_err("cannot open /dev/uinput (%d): %m", errno);
+		return -errno;
+	}
+
+	ret = ioctl(fd, UI_SET_EVBIT, EV_KEY);
+	if (!ret)
+		ret = ioctl(fd, UI_SET_KEYBIT, KEY_A);
+	if (ret) {
+		ret = -errno;
+		goto err_close;
+	}
+
+	memset(&us, 0, sizeof(us));
+	us.id.bustype = BUS_VIRTUAL;
+	strncpy(us.name, "bench-latency-keyboard", sizeof(us.name) - 1);
+
+	ret = ioctl(fd, UI_DEV_SETUP, &us);
+	if (!ret)
+		ret = ioctl(fd, UI_DEV_CREATE);
+	if (ret) {
+		ret = -errno;
+		goto err_close;
+	}
+
+	ret = ioctl(fd, UI_GET_SYSNAME(sizeof(sysname)), sysname);
+	if (ret < 0) {
+		ret = -errno;
+		goto err_destroy;
+	}
+
+	/* resolve the event node the kernel assigned to the device */
+	snprintf(path, sizeof(path), "/sys/devices/virtual/input/%s",
+		 sysname);
+	dir = opendir(path);
+	if (!dir) {
+		ret = -errno;
+		goto err_destroy;
+	}
+
+	ret = -ENODEV;
+	while ((ent = readdir(dir))) {
+		if (strncmp(ent->d_name, "event", 5))
+			continue;
+		snprintf(node, size, "/dev/input/%s", ent->d_name);
+		ret = 0;
+		break;
+	}
+	closedir(dir);
+	if (ret)
+		goto err_destroy;
+
+	/* give udev a moment to set up the new node */
+	usleep(200 * 1000);
+
+	*out = fd;
+	return 0;
+
+err_destroy:
+	ioctl(fd, UI_DEV_DESTROY);
+err_close:
+	close(fd);
+	log_err("cannot create uinput device: %d", ret);
+	return ret;
+}
+
+static void uinput_destroy(int fd)
+{
+	ioctl(fd, UI_DEV_DESTROY);
+	close(fd);
+}
+
+static int uinput_key(int fd, uint16_t key, int value)
+{
+	struct input_event ev[2];
+	ssize_t l;
+
+	memset(ev, 0, sizeof(ev));
+	ev[0].type = EV_KEY;
+	ev[0].code = key;
+	ev[0].value = value;
+	ev[1].type = EV_SYN;
+	ev[1].code = SYN_REPORT;
+
+	l = write(fd, ev, sizeof(ev));
+	if (l != sizeof(ev))
+		return -EFAULT;
+
+	return 0;
+}
+
+/*
+ * Measurement path
+ * The input callback renders the probe frame and schedules the swap; the
+ * display callback closes the sample when the flip for that frame arrives.
+ */
+
+static void lat_input_event(struct uterm_input *input,
+			    struct uterm_input_event *ev, void *data)
+{
+	struct lat_run *run = data;
+	struct tsm_screen_attr attr;
+	uint32_t ch;
+	int ret;
+
+	/* releases and repeats do not schedule frames */
+	if (!run->inject || run->flip_pending)
+		return;
+
+	memset(&attr, 0, sizeof(attr));
+	attr.fr = 255;
+	attr.fg = 255;
+	attr.fb = 255;
+
+	ret = kmscon_text_prepare(run->txt);
+	if (ret)
+		return;
+
+	ch = 'A' + (run->probe++ % 26);
+	kmscon_text_draw(run->txt, ch, &ch, 1, 1, 0, 0, &attr);
+	kmscon_text_render(run->txt);
+
+	ret = uterm_display_swap(run->disp, false);
+	if (ret) {
+		kmscon_text_damage_all(run->txt);
+		return;
+	}
+
+	run->flip_pending = true;
+}
+
+static void lat_display_event(struct uterm_display *disp,
+			      struct uterm_display_event *ev, void *data)
+{
+	struct lat_run *run = data;
+
+	if (ev->action != UTERM_PAGE_FLIP || !run->flip_pending)
+		return;
+
+	if (run->num < LAT_SAMPLES)
+		run->samples[run->num++] = now_usec() - run->inject;
+	run->flip_pending = false;
+	run->inject = 0;
+}
+
+static int cmp_u64(const void *a, const void *b)
+{
+	uint64_t va = *(const uint64_t*)a, vb = *(const uint64_t*)b;
+
+	return (va > vb) - (va < vb);
+}
+
+static uint64_t percentile(struct lat_run *run, unsigned int pct)
+{
+	unsigned int idx;
+
+	idx = (run->num - 1) * pct / 100;
+	return run->samples[idx];
+}
+
+static int lat_backend(const char *backend, struct uterm_display *disp,
+		       struct uterm_input *input, struct kmscon_font *font,
+		       struct kmscon_font *bold_font, int ufd)
+{
+	struct lat_run run;
+	unsigned int i, rounds, lost;
+	int ret;
+
+	memset(&run, 0, sizeof(run));
+	run.disp = disp;
+	run.font = font;
+	run.bold_font = bold_font;
+
+	ret = kmscon_text_new(&run.txt, backend);
+	if (ret) {
+		log_warning("backend %s not available: %d", backend, ret);
+		return 0;
+	}
+
+	ret = kmscon_text_set(run.txt, font, bold_font, disp);
+	if (ret) {
+		log_err("cannot set up backend %s: %d", backend, ret);
+		goto err_unref;
+	}
+
+	ret = uterm_display_register_cb(disp, lat_display_event, &run);
+	if (ret)
+		goto err_unset;
+
+	ret = uterm_input_register_cb(input, lat_input_event, &run);
+	if (ret)
+		goto err_display;
+
+	lost = 0;
+	for (i = 0; i < LAT_SAMPLES; ++i) {
+		run.inject = now_usec();
+		ret = uinput_key(ufd, KEY_A, 1);
+		if (ret)
+			break;
+
+		for (rounds = 0; run.inject && rounds < LAT_MAX_ROUNDS;
+		     ++rounds)
+			ev_eloop_dispatch(eloop, 10);
+		if (run.inject) {
+			/* no flip arrived; drop the sample */
+			run.inject = 0;
+			run.flip_pending = false;
+			++lost;
+		}
+
+		uinput_key(ufd, KEY_A, 0);
+		ev_eloop_dispatch(eloop, 0);
+	}
+
+	uterm_input_unregister_cb(input, lat_input_event, &run);
+	uterm_display_unregister_cb(disp, lat_display_event, &run);
+
+	if (!run.num) {
+		log_warning("backend %s: no samples collected", backend);
+		ret = 0;
+		goto err_unset;
+	}
+
+	qsort(run.samples, run.num, sizeof(*run.samples), cmp_u64);
+	log_notice("  %-8s p50 %6" PRIu64 "us  p99 %6" PRIu64 "us  "
+		   "min %6" PRIu64 "us  max %6" PRIu64 "us  "
+		   "(%u samples, %u lost)",
+		   backend, percentile(&run, 50), percentile(&run, 99),
+		   run.samples[0], run.samples[run.num - 1], run.num, lost);
+	ret = 0;
+	goto err_unset;
+
+err_display:
+	uterm_display_unregister_cb(disp, lat_display_event, &run);
+err_unset:
+	kmscon_text_unset(run.txt);
+err_unref:
+	kmscon_text_unref(run.txt);
+	return ret;
+}
+
+static int lat_display(struct uterm_display *disp, struct uterm_input *input,
+		       int ufd)
+{
+	struct kmscon_font_attr attr = { "", 0, 0, false, false, 0, 0 };
+	struct kmscon_font *font, *bold_font;
+	unsigned int i;
+	int ret;
+
+	strncpy(attr.name, lat_conf.font_name, KMSCON_FONT_MAX_NAME - 1);
+	attr.points = lat_conf.font_size;
+
+	ret = kmscon_font_find(&font, &attr, lat_conf.font_engine);
+	if (ret) {
+		log_err("cannot find font: %d", ret);
+		return ret;
+	}
+
+	attr.bold = true;
+	ret = kmscon_font_find(&bold_font, &attr, lat_conf.font_engine);
+	if (ret) {
+		log_warning("cannot create bold font: %d", ret);
+		bold_font = font;
+		kmscon_font_ref(bold_font);
+	}
+
+	if (lat_conf.backends) {
+		ret = lat_backend(lat_conf.backends, disp, input, font,
+				  bold_font, ufd);
+	} else {
+		for (i = 0;
+		     i < sizeof(lat_backends) / sizeof(*lat_backends);
+		     ++i) {
+			ret = lat_backend(lat_backends[i], disp, input,
+					  font, bold_font, ufd);
+			if (ret)
+				break;
+		}
+	}
+
+	kmscon_font_unref(bold_font);
+	kmscon_font_unref(font);
+	return ret;
+}
+
+static void print_help()
+{
+	/*
+	 * Usage/Help information
+	 * This should be scaled to a maximum of 80 characters per line:
+	 *
+	 * 80 char line:
+	 *       |   10   |    20   |    30   |    40   |    50   |    60   |    70   |    80   |
+	 *      "12345678901234567890123456789012345678901234567890123456789012345678901234567890\n"
+	 * 80 char line starting with tab:
+	 *       |10|    20   |    30   |    40   |    50   |    60   |    70   |    80   |
+	 *      "\t901234567890123456789012345678901234567890123456789012345678901234567890\n"
+	 */
+	fprintf(stderr,
+		"Usage:\n"
+		"\t%1$s [options]\n"
+		"\t%1$s -h [options]\n"
+		"\n"
+		"You can prefix boolean options with \"no-\" to negate it. If an argument is\n"
+		"given multiple times, only the last argument matters if not otherwise stated.\n"
+		"\n"
+		"General Options:\n"
+		TEST_HELP
+		"\n"
+		"Video Options:\n"
+		"\t    --fbdev                 [off]   Use fbdev instead of DRM\n"
+		"\t    --null                  [off]   Use in-memory null backend instead of DRM\n"
+		"\t    --dev                   [/dev/dri/card0 | /dev/fb0] Use the given device\n"
+		"\n"
+		"Benchmark Options:\n"
+		"\t    --backends <name>       [all]   Benchmark only the given text backend\n"
+		"\t    --font-engine <name>    [8x16]  Font engine\n"
+		"\t    --font-name <name>      [monospace] Font name\n"
+		"\t    --font-size <points>    [12]    Font size in points\n",
+		"bench_latency");
+	/*
+	 * 80 char line:
+	 *       |   10   |    20   |    30   |    40   |    50   |    60   |    70   |    80   |
+	 *      "12345678901234567890123456789012345678901234567890123456789012345678901234567890\n"
+	 * 80 char line starting with tab:
+	 *       |10|    20   |    30   |    40   |    50   |    60   |    70   |    80   |
+	 *      "\t901234567890123456789012345678901234567890123456789012345678901234567890\n"
+	 */
+}
+
+struct conf_option options[] = {
+	TEST_OPTIONS,
+	CONF_OPTION_BOOL(0, "fbdev", &lat_conf.fbdev, false),
+	CONF_OPTION_BOOL(0, "null", &lat_conf.null, false),
+	CONF_OPTION_STRING(0, "dev", &lat_conf.dev, NULL),
+	CONF_OPTION_STRING(0, "backends", &lat_conf.backends, NULL),
+	CONF_OPTION_STRING(0, "font-engine", &lat_conf.font_engine, "8x16"),
+	CONF_OPTION_STRING(0, "font-name", &lat_conf.font_name,
+			   KMSCON_FONT_DEFAULT_NAME),
+	CONF_OPTION_UINT(0, "font-size", &lat_conf.font_size, 12),
+};
+
+int main(int argc, char **argv)
+{
+	struct uterm_video *video;
+	struct uterm_display *disp;
+	struct uterm_input *input;
+	const struct uterm_video_module *mode;
+	const char *node;
+	char inode[64];
+	size_t onum;
+	int ret, ufd;
+
+	onum = sizeof(options) / sizeof(*options);
+	ret = test_prepare(options, onum, argc, argv, &eloop);
+	if (ret)
+		goto err_fail;
+
+	kmscon_font_register(&kmscon_font_8x16_ops);
+	kmscon_text_register(&kmscon_text_bblit_ops);
+	kmscon_load_modules();
+
+	if (lat_conf.null) {
+		mode = UTERM_VIDEO_NULL;
+		node = "1920x1080";
+	} else if (lat_conf.fbdev) {
+		mode = UTERM_VIDEO_FBDEV;
+		node = "/dev/fb0";
+	} else {
+		mode = UTERM_VIDEO_DRM3D;
+		node = "/dev/dri/card0";
+	}
+
+	if (lat_conf.dev)
+		node = lat_conf.dev;
+
+	log_notice("Creating video object using %s...", node);
+
+	ret = uterm_video_new(&video, eloop, node, mode);
+	if (ret) {
+		if (mode == UTERM_VIDEO_DRM3D) {
+			log_notice("cannot create drm device; trying drm2d mode");
+			ret = uterm_video_new(&video, eloop, node,
+					      UTERM_VIDEO_DRM2D);
+			if (ret)
+				goto err_exit;
+		} else {
+			goto err_exit;
+		}
+	}
+
+	ret = uterm_video_wake_up(video);
+	if (ret < 0)
+		goto err_unref;
+
+	disp = uterm_video_get_displays(video);
+	if (!disp) {
+		log_err("no display connected");
+		ret = -ENODEV;
+		goto err_unref;
+	}
+
+	ret = uterm_display_activate(disp, NULL);
+	if (ret) {
+		log_err("cannot activate display: %d", ret);
+		goto err_unref;
+	}
+	uterm_display_set_dpms(disp, UTERM_DPMS_ON);
+
+	ret = uinput_create(&ufd, inode, sizeof(inode));
+	if (ret)
+		goto err_unref;
+
+	ret = uterm_input_new(&input, eloop, "", "", "", "", "",
+			      0, 0, log_llog, NULL);
+	if (ret)
+		goto err_uinput;
+
+	uterm_input_wake_up(input);
+	uterm_input_add_dev(input, inode);
+
+	log_notice("Measuring keystroke-to-flip latency "
+		   "(%u keystrokes per backend):", LAT_SAMPLES);
+
+	ret = lat_display(disp, input, ufd);
+
+	uterm_input_remove_dev(input, inode);
+	uterm_input_unref(input);
+err_uinput:
+	uinput_destroy(ufd);
+err_unref:
+	uterm_video_unref(video);
+err_exit:
+	kmscon_unload_modules();
+	kmscon_text_unregister(kmscon_text_bblit_ops.name);
+	kmscon_font_unregister(kmscon_font_8x16_ops.name);
+	test_exit(options, onum, eloop);
+err_fail:
+	if (ret != -ECANCELED)
+		test_fail(ret);
+	return abs(ret);
+}
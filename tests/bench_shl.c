@@ -0,0 +1,463 @@
+/*
+ * bench_shl - Microbenchmarks for the shl data structures
+ *
+ * Copyright (c) 2012-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Microbenchmarks for the shl data structures
+ * shl_ring, shl_hashtable, shl_hashmap, shl_dlist and shl_hook sit under
+ * every hot path of kmscon but changes to them used to land blind. This
+ * replays their dominant access patterns (PTY-like ring traffic, glyph-cache
+ * sized hash workloads, list walks, hook dispatch) with deterministic input
+ * and reports nanoseconds per operation, amortized over enough iterations
+ * that clock resolution does not matter:
+ *
+ * $ ./bench_shl
+ *
+ * With --json a machine-readable baseline is written that can be diffed
+ * against a later run during review:
+ *
+ * $ ./bench_shl --json baseline.json
+ */
+
+static void print_help();
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "eloop.h"
+#include "shl_dlist.h"
+#include "shl_hashmap.h"
+#include "shl_hashtable.h"
+#include "shl_hook.h"
+#include "shl_log.h"
+#include "shl_ring.h"
+#include "shl_timer.h"
+#include "test_include.h"
+
+/* roughly the populated size of a per-face glyph cache */
+#define BENCH_HASH_SIZE 4096
+/* typical PTY read size on a busy terminal */
+#define BENCH_CHUNK_SIZE 4096
+
+#define BENCH_RESULT_MAX 32
+
+/* eloop object */
+static struct ev_eloop *eloop;
+
+struct {
+	char *json;
+} bench_conf;
+
+/* results are kept so --json can dump them after the run */
+static struct bench_result {
+	const char *name;
+	uint64_t ops;
+	uint64_t usecs;
+} bench_results[BENCH_RESULT_MAX];
+static unsigned int bench_result_num;
+
+/* accumulator the workloads write to so the compiler cannot drop them */
+static volatile uint64_t bench_sink;
+
+static void bench_report(const char *name, uint64_t ops, uint64_t usecs)
+{
+	if (!usecs)
+		usecs = 1;
+
+	log_notice("  %-24s %8.1f ns/op (%" PRIu64 " ops in %" PRIu64 " ms)",
+		   name, usecs * 1000.0 / ops, ops, usecs / 1000);
+
+	if (bench_result_num >= BENCH_RESULT_MAX)
+		return;
+
+	bench_results[bench_result_num].name = name;
+	bench_results[bench_result_num].ops = ops;
+	bench_results[bench_result_num].usecs = usecs;
+	++bench_result_num;
+}
+
+/*
+ * Ring workloads
+ * The PTY layer writes reads of BENCH_CHUNK_SIZE into the ring and the
+ * terminal drains it via peek+drop; the backlog throttle lets several chunks
+ * pile up before draining. Both patterns are replayed in steady state.
+ */
+
+static int bench_ring(void)
+{
+	static char chunk[BENCH_CHUNK_SIZE];
+	struct shl_ring *ring;
+	struct shl_timer timer;
+	const char *buf;
+	uint64_t i, rounds = 100000;
+	unsigned int j;
+	size_t len;
+	int ret;
+
+	memset(chunk, '#', sizeof(chunk));
+
+	ret = shl_ring_new(&ring);
+	if (ret)
+		return ret;
+
+	shl_timer_reset(&timer);
+	for (i = 0; i < rounds; ++i) {
+		ret = shl_ring_write(ring, chunk, sizeof(chunk));
+		if (ret)
+			goto err_free;
+		while ((buf = shl_ring_peek(ring, &len, 0))) {
+			bench_sink += len;
+			shl_ring_drop(ring, len);
+		}
+	}
+	bench_report("ring-write-drain", rounds, shl_timer_elapsed(&timer));
+
+	shl_timer_reset(&timer);
+	for (i = 0; i < rounds / 8; ++i) {
+		for (j = 0; j < 8; ++j) {
+			ret = shl_ring_write(ring, chunk, sizeof(chunk));
+			if (ret)
+				goto err_free;
+		}
+		while ((buf = shl_ring_peek(ring, &len, 0))) {
+			bench_sink += len;
+			shl_ring_drop(ring, len);
+		}
+	}
+	bench_report("ring-burst-drain", rounds / 8,
+		     shl_timer_elapsed(&timer));
+
+	ret = 0;
+err_free:
+	shl_ring_free(ring);
+	return ret;
+}
+
+/*
+ * Hash workloads
+ * Both tables are exercised with direct integer keys in the glyph-cache
+ * pattern: a burst of inserts when a screenful of new glyphs shows up, then
+ * lookup-dominated steady state. The insert benchmark rebuilds the table
+ * every round so allocation and growth are part of the cost, as they are at
+ * startup.
+ */
+
+static int bench_hashtable(void)
+{
+	struct shl_hashtable *tbl;
+	struct shl_timer timer;
+	uint64_t i, rounds = 256, lookups = 4000000;
+	unsigned int j;
+	void *val;
+	int ret;
+
+	shl_timer_reset(&timer);
+	for (i = 0; i < rounds; ++i) {
+		ret = shl_hashtable_new(&tbl, shl_direct_hash,
+					shl_direct_equal, NULL, NULL);
+		if (ret)
+			return ret;
+		for (j = 1; j <= BENCH_HASH_SIZE; ++j) {
+			ret = shl_hashtable_insert(tbl, (void*)(long)j,
+						   (void*)(long)j);
+			if (ret) {
+				shl_hashtable_free(tbl);
+				return ret;
+			}
+		}
+		if (i + 1 < rounds)
+			shl_hashtable_free(tbl);
+	}
+	bench_report("hashtable-insert", rounds * BENCH_HASH_SIZE,
+		     shl_timer_elapsed(&timer));
+
+	shl_timer_reset(&timer);
+	for (i = 0; i < lookups; ++i) {
+		if (shl_hashtable_find(tbl, &val,
+				       (void*)(long)(1 + i % BENCH_HASH_SIZE)))
+			bench_sink += (long)val;
+	}
+	bench_report("hashtable-find", lookups, shl_timer_elapsed(&timer));
+
+	shl_hashtable_free(tbl);
+	return 0;
+}
+
+static int bench_hashmap(void)
+{
+	struct shl_hashmap *map;
+	struct shl_timer timer;
+	uint64_t i, rounds = 256, lookups = 4000000;
+	unsigned int j;
+	void *val;
+	int ret;
+
+	shl_timer_reset(&timer);
+	for (i = 0; i < rounds; ++i) {
+		ret = shl_hashmap_new(&map, shl_map_direct_hash,
+				      shl_map_direct_equal, NULL, NULL);
+		if (ret)
+			return ret;
+		for (j = 1; j <= BENCH_HASH_SIZE; ++j) {
+			ret = shl_hashmap_insert(map, (void*)(long)j,
+						 (void*)(long)j);
+			if (ret) {
+				shl_hashmap_free(map);
+				return ret;
+			}
+		}
+		if (i + 1 < rounds)
+			shl_hashmap_free(map);
+	}
+	bench_report("hashmap-insert", rounds * BENCH_HASH_SIZE,
+		     shl_timer_elapsed(&timer));
+
+	shl_timer_reset(&timer);
+	for (i = 0; i < lookups; ++i) {
+		if (shl_hashmap_find(map, &val,
+				     (void*)(long)(1 + i % BENCH_HASH_SIZE)))
+			bench_sink += (long)val;
+	}
+	bench_report("hashmap-find", lookups, shl_timer_elapsed(&timer));
+
+	shl_hashmap_free(map);
+	return 0;
+}
+
+/*
+ * List walks
+ * Screens, seats and devices all live on shl_dlists that are walked on
+ * every redraw and every event; the node count here matches a busy but
+ * realistic list.
+ */
+
+struct bench_node {
+	struct shl_dlist list;
+	unsigned long value;
+};
+
+static int bench_dlist(void)
+{
+	struct shl_dlist head, *iter;
+	struct bench_node *nodes, *node;
+	struct shl_timer timer;
+	uint64_t i, walks = 100000;
+	unsigned int j, num = 256;
+
+	nodes = malloc(num * sizeof(*nodes));
+	if (!nodes)
+		return -ENOMEM;
+
+	shl_dlist_init(&head);
+	for (j = 0; j < num; ++j) {
+		nodes[j].value = j;
+		shl_dlist_link_tail(&head, &nodes[j].list);
+	}
+
+	shl_timer_reset(&timer);
+	for (i = 0; i < walks; ++i) {
+		shl_dlist_for_each(iter, &head) {
+			node = shl_dlist_entry(iter, struct bench_node, list);
+			bench_sink += node->value;
+		}
+	}
+	bench_report("dlist-walk", walks * num, shl_timer_elapsed(&timer));
+
+	free(nodes);
+	return 0;
+}
+
+/*
+ * Hook dispatch
+ * Most hooks in kmscon carry a handful of entries, which the inline vector
+ * of shl_hook covers; the larger size measures the spilled path.
+ */
+
+static void bench_hook_cb(void *parent, void *arg, void *data)
+{
+	++bench_sink;
+}
+
+static int bench_hook_size(const char *name, unsigned int num)
+{
+	struct shl_hook *hook;
+	struct shl_timer timer;
+	uint64_t i, calls = 1000000;
+	unsigned int j;
+	int ret;
+
+	ret = shl_hook_new(&hook);
+	if (ret)
+		return ret;
+
+	for (j = 0; j < num; ++j) {
+		ret = shl_hook_add(hook, bench_hook_cb, (void*)(long)j,
+				   false);
+		if (ret)
+			goto err_free;
+	}
+
+	shl_timer_reset(&timer);
+	for (i = 0; i < calls; ++i)
+		shl_hook_call(hook, NULL, NULL);
+	bench_report(name, calls * num, shl_timer_elapsed(&timer));
+
+	ret = 0;
+err_free:
+	shl_hook_free(hook);
+	return ret;
+}
+
+static int bench_hook(void)
+{
+	int ret;
+
+	ret = bench_hook_size("hook-call-1", 1);
+	if (ret)
+		return ret;
+	ret = bench_hook_size("hook-call-4", 4);
+	if (ret)
+		return ret;
+	return bench_hook_size("hook-call-32", 32);
+}
+
+static int bench_write_json(const char *path)
+{
+	unsigned int i;
+	FILE *f;
+
+	f = fopen(path, "w");
+	if (!f) {
+		log_err("cannot open %s for writing: %d", path, -errno);
+		return -errno;
+	}
+
+	fprintf(f, "{\n  \"benchmark\": \"bench_shl\",\n  \"results\": [\n");
+	for (i = 0; i < bench_result_num; ++i) {
+		fprintf(f, "    {\"name\": \"%s\", \"ops\": %" PRIu64
+			", \"usecs\": %" PRIu64 ", \"ns_per_op\": %.2f}%s\n",
+			bench_results[i].name,
+			bench_results[i].ops,
+			bench_results[i].usecs,
+			bench_results[i].usecs * 1000.0 /
+							bench_results[i].ops,
+			i + 1 < bench_result_num ? "," : "");
+	}
+	fprintf(f, "  ]\n}\n");
+	fclose(f);
+
+	log_notice("wrote baseline to %s", path);
+	return 0;
+}
+
+static void print_help()
+{
+	/*
+	 * Usage/Help information
+	 * This should be scaled to a maximum of 80 characters per line:
+	 *
+	 * 80 char line:
+	 *       |   10   |    20   |    30   |    40   |    50   |    60   |    70   |    80   |
+	 *      "12345678901234567890123456789012345678901234567890123456789012345678901234567890\n"
+	 * 80 char line starting with tab:
+	 *       |10|    20   |    30   |    40   |    50   |    60   |    70   |    80   |
+	 *      "\t901234567890123456789012345678901234567890123456789012345678901234567890\n"
+	 */
+	fprintf(stderr,
+		"Usage:\n"
+		"\t%1$s [options]\n"
+		"\t%1$s -h [options]\n"
+		"\n"
+		"You can prefix boolean options with \"no-\" to negate it. If an argument is\n"
+		"given multiple times, only the last argument matters if not otherwise stated.\n"
+		"\n"
+		"General Options:\n"
+		TEST_HELP
+		"\n"
+		"Benchmark Options:\n"
+		"\t    --json <file>           [off]   Write results as JSON to <file>\n",
+		"bench_shl");
+	/*
+	 * 80 char line:
+	 *       |   10   |    20   |    30   |    40   |    50   |    60   |    70   |    80   |
+	 *      "12345678901234567890123456789012345678901234567890123456789012345678901234567890\n"
+	 * 80 char line starting with tab:
+	 *       |10|    20   |    30   |    40   |    50   |    60   |    70   |    80   |
+	 *      "\t901234567890123456789012345678901234567890123456789012345678901234567890\n"
+	 */
+}
+
+struct conf_option options[] = {
+	TEST_OPTIONS,
+	CONF_OPTION_STRING(0, "json", &bench_conf.json, NULL),
+};
+
+int main(int argc, char **argv)
+{
+	size_t onum;
+	int ret;
+
+	onum = sizeof(options) / sizeof(*options);
+	ret = test_prepare(options, onum, argc, argv, &eloop);
+	if (ret)
+		goto err_fail;
+
+	log_notice("Ring:");
+	ret = bench_ring();
+	if (ret)
+		goto err_exit;
+
+	log_notice("Hashtable:");
+	ret = bench_hashtable();
+	if (ret)
+		goto err_exit;
+
+	log_notice("Hashmap:");
+	ret = bench_hashmap();
+	if (ret)
+		goto err_exit;
+
+	log_notice("Dlist:");
+	ret = bench_dlist();
+	if (ret)
+		goto err_exit;
+
+	log_notice("Hook:");
+	ret = bench_hook();
+	if (ret)
+		goto err_exit;
+
+	if (bench_conf.json)
+		ret = bench_write_json(bench_conf.json);
+
+err_exit:
+	test_exit(options, onum, eloop);
+err_fail:
+	if (ret != -ECANCELED)
+		test_fail(ret);
+	return abs(ret);
+}
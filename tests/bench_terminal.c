@@ -0,0 +1,492 @@
+/*
+ * bench_terminal - Terminal rendering throughput benchmark
+ *
+ * Copyright (c) 2012-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Terminal rendering throughput benchmark
+ * This replays synthetic PTY byte-streams (scrolling text, SGR colors, CJK
+ * wide-characters and cursor-movement storms) through tsm_vte into the text
+ * renderers and reports how many MB/s each registered backend sustains and
+ * how many frames it rendered. It drives a real display, so run it from a
+ * free VT:
+ *
+ * $ ./bench_terminal
+ *
+ * By default all available backends are measured; use --backends to restrict
+ * the run to a single one:
+ *
+ * $ ./bench_terminal --backends gltex
+ */
+
+static void print_help();
+
+#include <errno.h>
+#include <inttypes.h>
+#include <libtsm.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "eloop.h"
+#include "font.h"
+#include "kmscon_module.h"
+#include "shl_log.h"
+#include "shl_timer.h"
+#include "text.h"
+#include "uterm_video.h"
+#include "test_include.h"
+
+/* size of each generated byte-stream */
+#define BENCH_STREAM_SIZE (1024 * 1024)
+/* bytes fed into the VTE between two rendered frames; roughly what a single
+ * PTY read delivers on a busy terminal */
+#define BENCH_CHUNK_SIZE 4096
+
+/* eloop object */
+static struct ev_eloop *eloop;
+
+struct {
+	bool fbdev;
+	bool null;
+	char *dev;
+	char *backends;
+	char *font_engine;
+	char *font_name;
+	unsigned int font_size;
+} bench_conf;
+
+static const char *bench_backends[] = {
+	"bblit",
+	"bbulk",
+	"gltex",
+	"pixman",
+};
+
+/*
+ * Workload generators
+ * Each generator fills @buf with up to @size bytes of a synthetic PTY stream
+ * and returns the number of bytes written. The streams are deterministic so
+ * two runs (or two backends) always replay identical input.
+ */
+
+static size_t gen_scroll(char *buf, size_t size)
+{
+	static const char line[] =
+		"the quick brown fox jumps over the lazy dog 0123456789\r\n";
+	size_t len = 0;
+
+	len += snprintf(&buf[len], size - len, "\033[?1049h\033[2J\033[H");
+	while (len + sizeof(line) + 8 < size)
+		len += snprintf(&buf[len], size - len, "%s", line);
+	len += snprintf(&buf[len], size - len, "\033[?1049l");
+
+	return len;
+}
+
+static size_t gen_colors(char *buf, size_t size)
+{
+	size_t len = 0;
+	unsigned int i = 0;
+
+	len += snprintf(&buf[len], size - len, "\033[2J\033[H");
+	while (len + 32 < size) {
+		len += snprintf(&buf[len], size - len,
+				"\033[%u;%um#colored#\033[0m ",
+				30 + (i % 8), 40 + ((i / 8) % 8));
+		if (!(++i % 8))
+			len += snprintf(&buf[len], size - len, "\r\n");
+	}
+
+	return len;
+}
+
+static size_t gen_cjk(char *buf, size_t size)
+{
+	size_t len = 0;
+	uint32_t c;
+	unsigned int i = 0;
+
+	len += snprintf(&buf[len], size - len, "\033[2J\033[H");
+	while (len + 8 < size) {
+		/* CJK ideographs are all three bytes in UTF-8 */
+		c = 0x4e00 + (i % 0x1000);
+		buf[len++] = 0xe0 | (c >> 12);
+		buf[len++] = 0x80 | ((c >> 6) & 0x3f);
+		buf[len++] = 0x80 | (c & 0x3f);
+		if (!(++i % 32))
+			len += snprintf(&buf[len], size - len, "\r\n");
+	}
+
+	return len;
+}
+
+static size_t gen_cursor(char *buf, size_t size)
+{
+	size_t len = 0;
+	uint32_t seed = 1;
+
+	len += snprintf(&buf[len], size - len, "\033[2J");
+	while (len + 16 < size) {
+		/* deterministic LCG so every run hits the same cells */
+		seed = seed * 1103515245 + 12345;
+		len += snprintf(&buf[len], size - len, "\033[%u;%uH%c",
+				1 + ((seed >> 16) % 24),
+				1 + ((seed >> 8) % 80),
+				'!' + (seed % 94));
+	}
+
+	return len;
+}
+
+struct bench_workload {
+	const char *name;
+	size_t (*gen) (char *buf, size_t size);
+};
+
+static const struct bench_workload bench_workloads[] = {
+	{ "scroll", gen_scroll },
+	{ "colors", gen_colors },
+	{ "cjk", gen_cjk },
+	{ "cursor", gen_cursor },
+};
+
+static void write_event(struct tsm_vte *vte, const char *u8, size_t len,
+			void *data)
+{
+	/* queries answered by the VTE are discarded; there is no client */
+}
+
+static int bench_frame(struct kmscon_text *txt, struct tsm_screen *con,
+		       struct uterm_display *disp)
+{
+	tsm_age_t age;
+	int ret;
+
+	kmscon_text_prepare(txt);
+	age = tsm_screen_draw(con, kmscon_text_draw_cb, txt);
+	if (kmscon_text_shift_stale(txt, age)) {
+		kmscon_text_abort(txt);
+		kmscon_text_prepare(txt);
+		age = tsm_screen_draw(con, kmscon_text_draw_cb, txt);
+	}
+	kmscon_text_render(txt);
+
+	ret = uterm_display_swap(disp, true);
+	while (ret == -EBUSY) {
+		/* a page-flip is still pending; dispatch its event first */
+		ev_eloop_dispatch(eloop, -1);
+		ret = uterm_display_swap(disp, true);
+	}
+	if (ret) {
+		kmscon_text_damage_all(txt);
+		return ret;
+	}
+
+	kmscon_text_set_age(txt, age);
+	return 0;
+}
+
+static int bench_stream(struct kmscon_text *txt, struct tsm_screen *con,
+			struct tsm_vte *vte, struct uterm_display *disp,
+			const struct bench_workload *load, char *buf)
+{
+	struct shl_timer timer;
+	uint64_t usecs, frames;
+	size_t len, pos, chunk;
+	int ret;
+
+	len = load->gen(buf, BENCH_STREAM_SIZE);
+
+	tsm_vte_reset(vte);
+	tsm_screen_clear_sb(con);
+	kmscon_text_dirty(txt);
+
+	frames = 0;
+	shl_timer_reset(&timer);
+	for (pos = 0; pos < len; pos += chunk) {
+		chunk = len - pos;
+		if (chunk > BENCH_CHUNK_SIZE)
+			chunk = BENCH_CHUNK_SIZE;
+
+		tsm_vte_input(vte, &buf[pos], chunk);
+		ret = bench_frame(txt, con, disp);
+		if (ret) {
+			log_err("cannot render frame: %d", ret);
+			return ret;
+		}
+		++frames;
+	}
+	usecs = shl_timer_elapsed(&timer);
+	if (!usecs)
+		usecs = 1;
+
+	/* bytes per microsecond equals MB/s */
+	log_notice("  %-8s %8.2f MB/s %6" PRIu64 " frames (%" PRIu64 " ms)",
+		   load->name, (double)len / usecs, frames, usecs / 1000);
+
+	return 0;
+}
+
+static int bench_backend(const char *backend, struct tsm_screen *con,
+			 struct tsm_vte *vte, struct uterm_display *disp,
+			 struct kmscon_font *font,
+			 struct kmscon_font *bold_font, char *buf)
+{
+	struct kmscon_text *txt;
+	unsigned int i;
+	int ret;
+
+	ret = kmscon_text_new(&txt, backend);
+	if (ret) {
+		log_warning("backend %s not available: %d", backend, ret);
+		return 0;
+	}
+
+	ret = kmscon_text_set(txt, font, bold_font, disp);
+	if (ret) {
+		log_err("cannot set up backend %s: %d", backend, ret);
+		goto err_unref;
+	}
+
+	tsm_screen_resize(con, kmscon_text_get_cols(txt),
+			  kmscon_text_get_rows(txt));
+
+	log_notice("Backend %s:", backend);
+	for (i = 0; i < sizeof(bench_workloads) / sizeof(*bench_workloads);
+	     ++i) {
+		ret = bench_stream(txt, con, vte, disp, &bench_workloads[i],
+				   buf);
+		if (ret)
+			break;
+	}
+
+	kmscon_text_unset(txt);
+err_unref:
+	kmscon_text_unref(txt);
+	return ret;
+}
+
+static int bench_display(struct uterm_display *disp)
+{
+	struct kmscon_font_attr attr = { "", 0, 0, false, false, 0, 0 };
+	struct kmscon_font *font, *bold_font;
+	struct tsm_screen *con;
+	struct tsm_vte *vte;
+	char *buf;
+	unsigned int i;
+	int ret;
+
+	strncpy(attr.name, bench_conf.font_name, KMSCON_FONT_MAX_NAME - 1);
+	attr.points = bench_conf.font_size;
+
+	ret = kmscon_font_find(&font, &attr, bench_conf.font_engine);
+	if (ret) {
+		log_err("cannot find font: %d", ret);
+		return ret;
+	}
+
+	attr.bold = true;
+	ret = kmscon_font_find(&bold_font, &attr, bench_conf.font_engine);
+	if (ret) {
+		log_warning("cannot create bold font: %d", ret);
+		bold_font = font;
+		kmscon_font_ref(bold_font);
+	}
+
+	ret = tsm_screen_new(&con, log_llog, NULL);
+	if (ret)
+		goto err_font;
+
+	ret = tsm_vte_new(&vte, con, write_event, NULL, log_llog, NULL);
+	if (ret)
+		goto err_con;
+
+	buf = malloc(BENCH_STREAM_SIZE);
+	if (!buf) {
+		ret = -ENOMEM;
+		goto err_vte;
+	}
+
+	if (bench_conf.backends) {
+		ret = bench_backend(bench_conf.backends, con, vte, disp,
+				    font, bold_font, buf);
+	} else {
+		for (i = 0;
+		     i < sizeof(bench_backends) / sizeof(*bench_backends);
+		     ++i) {
+			ret = bench_backend(bench_backends[i], con, vte,
+					    disp, font, bold_font, buf);
+			if (ret)
+				break;
+		}
+	}
+
+	free(buf);
+err_vte:
+	tsm_vte_unref(vte);
+err_con:
+	tsm_screen_unref(con);
+err_font:
+	kmscon_font_unref(bold_font);
+	kmscon_font_unref(font);
+	return ret;
+}
+
+static void print_help()
+{
+	/*
+	 * Usage/Help information
+	 * This should be scaled to a maximum of 80 characters per line:
+	 *
+	 * 80 char line:
+	 *       |   10   |    20   |    30   |    40   |    50   |    60   |    70   |    80   |
+	 *      "12345678901234567890123456789012345678901234567890123456789012345678901234567890\n"
+	 * 80 char line starting with tab:
+	 *       |10|    20   |    30   |    40   |    50   |    60   |    70   |    80   |
+	 *      "\t901234567890123456789012345678901234567890123456789012345678901234567890\n"
+	 */
+	fprintf(stderr,
+		"Usage:\n"
+		"\t%1$s [options]\n"
+		"\t%1$s -h [options]\n"
+		"\n"
+		"You can prefix boolean options with \"no-\" to negate it. If an argument is\n"
+		"given multiple times, only the last argument matters if not otherwise stated.\n"
+		"\n"
+		"General Options:\n"
+		TEST_HELP
+		"\n"
+		"Video Options:\n"
+		"\t    --fbdev                 [off]   Use fbdev instead of DRM\n"
+		"\t    --null                  [off]   Use in-memory null backend instead of DRM\n"
+		"\t    --dev                   [/dev/dri/card0 | /dev/fb0] Use the given device\n"
+		"\n"
+		"Benchmark Options:\n"
+		"\t    --backends <name>       [all]   Benchmark only the given text backend\n"
+		"\t    --font-engine <name>    [8x16]  Font engine\n"
+		"\t    --font-name <name>      [monospace] Font name\n"
+		"\t    --font-size <points>    [12]    Font size in points\n",
+		"bench_terminal");
+	/*
+	 * 80 char line:
+	 *       |   10   |    20   |    30   |    40   |    50   |    60   |    70   |    80   |
+	 *      "12345678901234567890123456789012345678901234567890123456789012345678901234567890\n"
+	 * 80 char line starting with tab:
+	 *       |10|    20   |    30   |    40   |    50   |    60   |    70   |    80   |
+	 *      "\t901234567890123456789012345678901234567890123456789012345678901234567890\n"
+	 */
+}
+
+struct conf_option options[] = {
+	TEST_OPTIONS,
+	CONF_OPTION_BOOL(0, "fbdev", &bench_conf.fbdev, false),
+	CONF_OPTION_BOOL(0, "null", &bench_conf.null, false),
+	CONF_OPTION_STRING(0, "dev", &bench_conf.dev, NULL),
+	CONF_OPTION_STRING(0, "backends", &bench_conf.backends, NULL),
+	CONF_OPTION_STRING(0, "font-engine", &bench_conf.font_engine, "8x16"),
+	CONF_OPTION_STRING(0, "font-name", &bench_conf.font_name,
+			   KMSCON_FONT_DEFAULT_NAME),
+	CONF_OPTION_UINT(0, "font-size", &bench_conf.font_size, 12),
+};
+
+int main(int argc, char **argv)
+{
+	struct uterm_video *video;
+	struct uterm_display *disp;
+	const struct uterm_video_module *mode;
+	const char *node;
+	size_t onum;
+	int ret;
+
+	onum = sizeof(options) / sizeof(*options);
+	ret = test_prepare(options, onum, argc, argv, &eloop);
+	if (ret)
+		goto err_fail;
+
+	kmscon_font_register(&kmscon_font_8x16_ops);
+	kmscon_text_register(&kmscon_text_bblit_ops);
+	kmscon_load_modules();
+
+	if (bench_conf.null) {
+		mode = UTERM_VIDEO_NULL;
+		node = "1920x1080";
+	} else if (bench_conf.fbdev) {
+		mode = UTERM_VIDEO_FBDEV;
+		node = "/dev/fb0";
+	} else {
+		mode = UTERM_VIDEO_DRM3D;
+		node = "/dev/dri/card0";
+	}
+
+	if (bench_conf.dev)
+		node = bench_conf.dev;
+
+	log_notice("Creating video object using %s...", node);
+
+	ret = uterm_video_new(&video, eloop, node, mode);
+	if (ret) {
+		if (mode == UTERM_VIDEO_DRM3D) {
+			log_notice("cannot create drm device; trying drm2d mode");
+			ret = uterm_video_new(&video, eloop, node,
+					      UTERM_VIDEO_DRM2D);
+			if (ret)
+				goto err_exit;
+		} else {
+			goto err_exit;
+		}
+	}
+
+	ret = uterm_video_wake_up(video);
+	if (ret < 0)
+		goto err_unref;
+
+	disp = uterm_video_get_displays(video);
+	if (!disp) {
+		log_err("no display connected");
+		ret = -ENODEV;
+		goto err_unref;
+	}
+
+	ret = uterm_display_activate(disp, NULL);
+	if (ret) {
+		log_err("cannot activate display: %d", ret);
+		goto err_unref;
+	}
+	uterm_display_set_dpms(disp, UTERM_DPMS_ON);
+
+	ret = bench_display(disp);
+
+err_unref:
+	uterm_video_unref(video);
+err_exit:
+	kmscon_unload_modules();
+	kmscon_text_unregister(kmscon_text_bblit_ops.name);
+	kmscon_font_unregister(kmscon_font_8x16_ops.name);
+	test_exit(options, onum, eloop);
+err_fail:
+	if (ret != -ECANCELED)
+		test_fail(ret);
+	return abs(ret);
+}
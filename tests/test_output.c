@@ -35,20 +35,34 @@
  *
  * This would show a test screen:
  * $ ./test_output something
+ *
+ * With --ab it instead runs the pixel-exact A/B regression harness: the
+ * vectorized blend kernels are checked against the scalar reference and
+ * every available text backend renders deterministic scenes into the
+ * offscreen null video backend, whose checksums must match across backends.
+ * The run fails on any pixel mismatch and on a vector kernel falling more
+ * than 10% behind the scalar reference:
+ * $ ./test_output --ab
  */
 
 static void print_help();
 
 #include <errno.h>
 #include <inttypes.h>
+#include <libtsm.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 
 #include "eloop.h"
+#include "font.h"
+#include "kmscon_module.h"
 #include "shl_log.h"
+#include "shl_timer.h"
+#include "text.h"
 #include "uterm_video.h"
+#include "uterm_video_blend_internal.h"
 #include "test_include.h"
 
 /* eloop object */
@@ -56,7 +70,9 @@ static struct ev_eloop *eloop;
 
 struct {
 	bool fbdev;
+	bool null;
 	bool test;
+	bool ab;
 	char *dev;
 } output_conf;
 
@@ -143,6 +159,386 @@ static int list_outputs(struct uterm_video *video)
 	return 0;
 }
 
+/*
+ * A/B regression harness
+ * As the blit kernels grow SIMD variants and fast paths, every variant must
+ * provably produce identical pixels and actually be faster. Two layers are
+ * checked with deterministic input:
+ *  - every blend kernel the host CPU supports is compared byte-for-byte
+ *    against the scalar reference and timed; a vector kernel that mismatches
+ *    or falls more than 10% behind the reference fails the run
+ *  - every available text backend renders reference scenes into the null
+ *    video backend; the checksums of the first backend are the goldens the
+ *    others must reproduce exactly, and each backend must reproduce its own
+ *    output across repeated renders
+ * The null backend draws into plain memory, so the harness runs without
+ * hardware or privileges and its output is stable across hosts.
+ */
+
+/* odd blend width so the vector kernels run their scalar tail path */
+#define AB_KERNEL_W 1021
+#define AB_KERNEL_H 64
+#define AB_BENCH_W 1024
+#define AB_BENCH_H 256
+#define AB_BENCH_ITERS 200
+#define AB_SCENE_NUM 3
+/* vector kernels must reach this share of scalar throughput */
+#define AB_MIN_PERCENT 90
+
+static const char *ab_backends[] = {
+	"bblit",
+	"bbulk",
+	"pixman",
+};
+
+static uint64_t ab_checksum(const uint8_t *data, unsigned int stride,
+			    unsigned int width, unsigned int height)
+{
+	uint64_t hash = 0xcbf29ce484222325ULL;
+	unsigned int x, y;
+
+	for (y = 0; y < height; ++y) {
+		for (x = 0; x < width * 4; ++x) {
+			hash ^= data[y * stride + x];
+			hash *= 0x100000001b3ULL;
+		}
+	}
+
+	return hash;
+}
+
+/* deterministic glyph-like alpha plane: long transparent and opaque spans
+ * with anti-aliased ramps in between, as bitmap and scaled fonts produce */
+static void ab_gen_alpha(uint8_t *buf, size_t len)
+{
+	uint32_t seed = 0x12345678;
+	size_t i = 0, run;
+	uint8_t val;
+	bool ramp;
+
+	while (i < len) {
+		seed = seed * 1103515245 + 12345;
+		run = 1 + ((seed >> 16) % 37);
+		ramp = ((seed >> 8) & 3) == 3;
+		val = ((seed >> 8) & 1) ? 255 : 0;
+
+		while (run-- && i < len) {
+			buf[i++] = ramp ? (seed >> 24) + run : val;
+		}
+	}
+}
+
+static int ab_check_kernels(void)
+{
+	const struct uterm_video_blend_kernel *kernels;
+	uint8_t *alpha, *ref, *out;
+	struct shl_timer timer;
+	uint64_t usecs, ref_mbs = 0, mbs;
+	unsigned int num, i, j;
+	int ret = 0;
+
+	num = uterm_video_blend_kernel_list(&kernels);
+	log_notice("Blend kernels (%u):", num);
+
+	alpha = malloc(AB_BENCH_W * AB_BENCH_H);
+	ref = malloc(AB_BENCH_W * AB_BENCH_H * 4);
+	out = malloc(AB_BENCH_W * AB_BENCH_H * 4);
+	if (!alpha || !ref || !out) {
+		ret = -ENOMEM;
+		goto out_free;
+	}
+
+	ab_gen_alpha(alpha, AB_BENCH_W * AB_BENCH_H);
+
+	memset(ref, 0xa5, AB_BENCH_W * AB_BENCH_H * 4);
+	kernels[0].blend(ref, AB_BENCH_W * 4, alpha, AB_BENCH_W,
+			 AB_KERNEL_W, AB_KERNEL_H, 0x00ffd070, 0x00102030);
+
+	for (i = 1; i < num; ++i) {
+		memset(out, 0xa5, AB_BENCH_W * AB_BENCH_H * 4);
+		kernels[i].blend(out, AB_BENCH_W * 4, alpha, AB_BENCH_W,
+				 AB_KERNEL_W, AB_KERNEL_H,
+				 0x00ffd070, 0x00102030);
+		if (memcmp(ref, out, AB_BENCH_W * AB_BENCH_H * 4)) {
+			log_err("kernel %s produces different pixels than the scalar reference",
+				kernels[i].name);
+			ret = -EINVAL;
+		}
+	}
+
+	for (i = 0; i < num; ++i) {
+		shl_timer_reset(&timer);
+		for (j = 0; j < AB_BENCH_ITERS; ++j)
+			kernels[i].blend(out, AB_BENCH_W * 4, alpha,
+					 AB_BENCH_W, AB_BENCH_W, AB_BENCH_H,
+					 0x00ffd070, 0x00102030);
+		usecs = shl_timer_elapsed(&timer);
+		if (!usecs)
+			usecs = 1;
+
+		/* blended bytes per microsecond equals MB/s */
+		mbs = (uint64_t)AB_BENCH_W * AB_BENCH_H * 4 *
+						AB_BENCH_ITERS / usecs;
+		if (!i) {
+			ref_mbs = mbs;
+			log_notice("  %-8s %6" PRIu64 " MB/s (reference)",
+				   kernels[i].name, mbs);
+			continue;
+		}
+
+		log_notice("  %-8s %6" PRIu64 " MB/s (%" PRIu64 "%% of scalar)",
+			   kernels[i].name, mbs, mbs * 100 / ref_mbs);
+		if (mbs * 100 < ref_mbs * AB_MIN_PERCENT) {
+			log_err("kernel %s regressed below %u%% of the scalar reference",
+				kernels[i].name, AB_MIN_PERCENT);
+			ret = -EINVAL;
+		}
+	}
+
+out_free:
+	free(out);
+	free(ref);
+	free(alpha);
+	return ret;
+}
+
+/* Fill the whole cell grid with scene @scene; the content derives from an
+ * LCG so every backend and every run draws the identical frame. */
+static int ab_draw_scene(struct kmscon_text *txt, unsigned int scene)
+{
+	struct tsm_screen_attr attr;
+	unsigned int x, y, cols, rows;
+	uint32_t ch, seed = scene * 7919 + 1;
+	int ret;
+
+	cols = kmscon_text_get_cols(txt);
+	rows = kmscon_text_get_rows(txt);
+
+	ret = kmscon_text_prepare(txt);
+	if (ret)
+		return ret;
+
+	for (y = 0; y < rows; ++y) {
+		for (x = 0; x < cols; ++x) {
+			seed = seed * 1103515245 + 12345;
+			memset(&attr, 0, sizeof(attr));
+			attr.fccode = -1;
+			attr.bccode = -1;
+
+			switch (scene) {
+			case 0:
+				/* plain white-on-black ASCII text */
+				attr.fr = 255;
+				attr.fg = 255;
+				attr.fb = 255;
+				ch = ' ' + ((seed >> 16) % 95);
+				break;
+			case 1:
+				/* colored cells on colored background */
+				attr.fr = seed >> 24;
+				attr.fg = seed >> 16;
+				attr.fb = seed >> 8;
+				attr.br = ~(seed >> 24);
+				attr.bg = ~(seed >> 16);
+				attr.bb = ~(seed >> 8);
+				ch = 'A' + ((seed >> 16) % 26);
+				break;
+			default:
+				/* bold/inverse storms and empty cells */
+				attr.fr = 200;
+				attr.fg = 220;
+				attr.fb = 255;
+				attr.bb = 80;
+				attr.bold = (seed >> 16) & 1;
+				attr.inverse = (seed >> 17) & 1;
+				ch = ((seed >> 18) & 3) ? ' ' :
+						'!' + ((seed >> 20) % 94);
+				break;
+			}
+
+			ret = kmscon_text_draw(txt, ch, &ch, 1, 1, x, y,
+					       &attr);
+			if (ret)
+				return ret;
+		}
+	}
+
+	return kmscon_text_render(txt);
+}
+
+static int ab_render_scene(struct kmscon_text *txt,
+			   struct uterm_display *disp, unsigned int scene,
+			   uint64_t *sum)
+{
+	struct uterm_video_buffer buf;
+	int ret;
+
+	ret = ab_draw_scene(txt, scene);
+	if (ret)
+		return ret;
+
+	ret = uterm_display_swap(disp, true);
+	if (ret)
+		return ret;
+
+	ret = uterm_display_snapshot(disp, &buf);
+	if (ret)
+		return ret;
+
+	*sum = ab_checksum(buf.data, buf.stride, buf.width, buf.height);
+	return 0;
+}
+
+static int ab_check_backend(const char *backend, struct uterm_display *disp,
+			    struct kmscon_font *font,
+			    struct kmscon_font *bold_font,
+			    uint64_t *golden, bool have_golden)
+{
+	struct kmscon_text *txt;
+	struct shl_timer timer;
+	uint64_t sum, again, usecs;
+	unsigned int i;
+	int ret;
+
+	ret = kmscon_text_new(&txt, backend);
+	if (ret) {
+		log_warning("backend %s not available: %d", backend, ret);
+		return 0;
+	}
+
+	/* kmscon_text_new() falls back to the default backend; measuring
+	 * that one twice would only produce misleading numbers */
+	if (strcmp(txt->ops->name, backend)) {
+		log_warning("backend %s not available, skipping", backend);
+		kmscon_text_unref(txt);
+		return 0;
+	}
+
+	ret = kmscon_text_set(txt, font, bold_font, disp);
+	if (ret) {
+		log_err("cannot set up backend %s: %d", backend, ret);
+		goto err_unref;
+	}
+
+	log_notice("Backend %s:", backend);
+	for (i = 0; i < AB_SCENE_NUM; ++i) {
+		ret = ab_render_scene(txt, disp, i, &sum);
+		if (ret) {
+			log_err("cannot render scene %u: %d", i, ret);
+			goto err_unset;
+		}
+
+		/* a backend must reproduce its own pixels */
+		ret = ab_render_scene(txt, disp, i, &again);
+		if (ret)
+			goto err_unset;
+		if (sum != again) {
+			log_err("backend %s renders scene %u non-deterministically",
+				backend, i);
+			ret = -EINVAL;
+			goto err_unset;
+		}
+
+		if (!have_golden) {
+			golden[i] = sum;
+			log_notice("  scene %u golden %016" PRIx64, i, sum);
+		} else if (sum != golden[i]) {
+			log_err("backend %s scene %u checksum %016" PRIx64 " does not match golden %016" PRIx64,
+				backend, i, sum, golden[i]);
+			ret = -EINVAL;
+			goto err_unset;
+		}
+	}
+
+	shl_timer_reset(&timer);
+	for (i = 0; i < AB_SCENE_NUM * 10; ++i) {
+		ret = ab_render_scene(txt, disp, i % AB_SCENE_NUM, &sum);
+		if (ret)
+			goto err_unset;
+	}
+	usecs = shl_timer_elapsed(&timer);
+	if (!usecs)
+		usecs = 1;
+	log_notice("  %.2f frames/s",
+		   AB_SCENE_NUM * 10 * 1000000.0 / usecs);
+
+	/* positive return tells the caller the backend was measured */
+	ret = 1;
+err_unset:
+	kmscon_text_unset(txt);
+err_unref:
+	kmscon_text_unref(txt);
+	return ret;
+}
+
+static int ab_check_backends(struct uterm_display *disp)
+{
+	struct kmscon_font_attr attr = { "", 0, 12, false, false, 0, 0 };
+	struct kmscon_font *font, *bold_font;
+	uint64_t golden[AB_SCENE_NUM];
+	bool have_golden = false;
+	unsigned int i;
+	int ret;
+
+	strncpy(attr.name, KMSCON_FONT_DEFAULT_NAME,
+		KMSCON_FONT_MAX_NAME - 1);
+
+	ret = kmscon_font_find(&font, &attr, "8x16");
+	if (ret) {
+		log_err("cannot find font: %d", ret);
+		return ret;
+	}
+
+	attr.bold = true;
+	ret = kmscon_font_find(&bold_font, &attr, "8x16");
+	if (ret) {
+		bold_font = font;
+		kmscon_font_ref(bold_font);
+	}
+
+	for (i = 0; i < sizeof(ab_backends) / sizeof(*ab_backends); ++i) {
+		ret = ab_check_backend(ab_backends[i], disp, font, bold_font,
+				       golden, have_golden);
+		if (ret < 0)
+			break;
+		/* the first available backend defines the goldens */
+		if (ret > 0)
+			have_golden = true;
+		ret = 0;
+	}
+
+	kmscon_font_unref(bold_font);
+	kmscon_font_unref(font);
+	return ret;
+}
+
+static int ab_outputs(struct uterm_video *video)
+{
+	struct uterm_display *disp;
+	int ret;
+
+	/* the null backend introduces its display from an idle source */
+	ev_eloop_dispatch(eloop, 0);
+
+	disp = uterm_video_get_displays(video);
+	if (!disp) {
+		log_err("no display available");
+		return -ENODEV;
+	}
+
+	ret = uterm_display_activate(disp, NULL);
+	if (ret) {
+		log_err("cannot activate display: %d", ret);
+		return ret;
+	}
+
+	ret = ab_check_kernels();
+	if (ret)
+		return ret;
+
+	return ab_check_backends(disp);
+}
+
 static void print_help()
 {
 	/*
@@ -169,7 +565,9 @@ static void print_help()
 		"\n"
 		"Video Options:\n"
 		"\t    --fbdev                 [off]   Use fbdev instead of DRM\n"
+		"\t    --null                  [off]   Use in-memory null backend instead of DRM\n"
 		"\t    --test                  [off]   Try displaying content instead of listing devices\n"
+		"\t    --ab                    [off]   Run the offscreen A/B render regression harness\n"
 		"\t    --dev                   [/dev/dri/card0 | /dev/fb0] Use the given device\n",
 		"test_input");
 	/*
@@ -185,7 +583,9 @@ static void print_help()
 struct conf_option options[] = {
 	TEST_OPTIONS,
 	CONF_OPTION_BOOL(0, "fbdev", &output_conf.fbdev, false),
+	CONF_OPTION_BOOL(0, "null", &output_conf.null, false),
 	CONF_OPTION_BOOL(0, "test", &output_conf.test, false),
+	CONF_OPTION_BOOL(0, "ab", &output_conf.ab, false),
 	CONF_OPTION_STRING(0, "dev",  &output_conf.dev, NULL),
 };
 
@@ -202,7 +602,14 @@ int main(int argc, char **argv)
 	if (ret)
 		goto err_fail;
 
-	if (output_conf.fbdev) {
+	if (output_conf.ab) {
+		/* the harness needs deterministic offscreen buffers */
+		mode = UTERM_VIDEO_NULL;
+		node = "1024x768";
+	} else if (output_conf.null) {
+		mode = UTERM_VIDEO_NULL;
+		node = "1920x1080";
+	} else if (output_conf.fbdev) {
 		mode = UTERM_VIDEO_FBDEV;
 		node = "/dev/fb0";
 	} else {
@@ -215,6 +622,12 @@ int main(int argc, char **argv)
 
 	log_notice("Creating video object using %s...", node);
 
+	if (output_conf.ab) {
+		kmscon_font_register(&kmscon_font_8x16_ops);
+		kmscon_text_register(&kmscon_text_bblit_ops);
+		kmscon_load_modules();
+	}
+
 	ret = uterm_video_new(&video, eloop, node, mode);
 	if (ret) {
 		if (mode == UTERM_VIDEO_DRM3D) {
@@ -233,7 +646,13 @@ int main(int argc, char **argv)
 	if (ret < 0)
 		goto err_unref;
 
-	if (!output_conf.test) {
+	if (output_conf.ab) {
+		ret = ab_outputs(video);
+		if (ret) {
+			log_err("A/B harness failed: %d", ret);
+			goto err_unref;
+		}
+	} else if (!output_conf.test) {
 		ret = list_outputs(video);
 		if (ret) {
 			log_err("Cannot list outputs: %d", ret);
@@ -250,6 +669,11 @@ int main(int argc, char **argv)
 err_unref:
 	uterm_video_unref(video);
 err_exit:
+	if (output_conf.ab) {
+		kmscon_unload_modules();
+		kmscon_text_unregister(kmscon_text_bblit_ops.name);
+		kmscon_font_unregister(kmscon_font_8x16_ops.name);
+	}
 	test_exit(options, onum, eloop);
 err_fail:
 	if (ret != -ECANCELED)